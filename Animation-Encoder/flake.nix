@@ -0,0 +1,35 @@
+{
+  description = "Flake for building the animation encoder of the holographic display.";
+
+  inputs.nixpkgs.url = "github:NixOS/nixpkgs/nixos-unstable";
+
+  outputs = { self, nixpkgs }:
+    let
+      pkgs = import nixpkgs { system = "x86_64-linux"; };
+    in
+    {
+      packages.x86_64-linux.default = pkgs.stdenv.mkDerivation {
+        pname = "animation-encoder";
+        version = "0.1.0";
+
+        # The sparse layout comes from the generator, the container format from the firmware.
+        src = ./..;
+
+        buildInputs = [ 
+          pkgs.gcc
+        ];
+
+        # Define build steps
+        buildPhase = ''
+          g++ -O2 -std=gnu++17 -I Conversionmatrix-Generator/src -I Holographic-Display/include/Rendering \
+            -o animation-encoder Animation-Encoder/src/main.cpp
+        '';
+
+        # Define install steps
+        installPhase = ''
+          mkdir -p $out/bin
+          cp animation-encoder $out/bin/
+        '';
+      };
+    };
+}
@@ -0,0 +1,423 @@
+/*
+ * @file main.cpp
+ * @authors mia
+ * @brief Turns data files of the holographic display into compressed animation containers.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+ *
+ * Usage:
+ *   animation-encoder data.bin animation.hani [--keyframe-interval N]
+*/
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+
+// The sparse layout of the generator and the container format of the firmware.
+#include "sparse_layout.hpp"
+#include "frame_codec.hpp"
+
+using namespace std;
+using namespace Rendering;
+
+
+//  - - - - - - - - - - Constants - - - - - - - - - -
+
+const int PALETTE_SIZE_BYTES = 256 * 3;
+const int RGB_RECORD_SIZE_BYTES = 2 + IMAGE_SIZE_PIXELS * 3;
+
+// The header of indexed data files, see config.hpp of the firmware.
+const char INDEXED_MAGIC[] = "HIDX";
+const int INDEXED_HEADER_SIZE_BYTES = 8;
+const uint8_t INDEXED_GLOBAL_PALETTE = 0x01;
+
+// Runs and matches shorter than this don't pay off against literals.
+const int MIN_MATCH_PIXELS = 2;
+const int HASH_BITS = 16;
+const int MAX_MATCH_CANDIDATES = 32;
+const int MAX_MATCH_DISTANCE = 65535;
+
+//  - - - - - - - - - - Types - - - - - - - - - -
+
+struct Animation
+{
+  uint8_t format = CONTAINER_FORMAT_RGB;
+  // Either the same palette for all frames, or one per frame.
+  bool global_palette = false;
+  vector<uint8_t> palette;
+  vector<uint16_t> delays;
+  vector<vector<uint8_t>> palettes;
+  // The full image of every frame, 3 bytes or 1 index per pixel.
+  vector<vector<uint8_t>> images;
+};
+
+//  - - - - - - - - - - Function Declarations - - - - - - - - - -
+
+bool read_animation(const vector<uint8_t> &data, Animation &animation);
+vector<uint8_t> encode_frame(const uint8_t *pixels, const uint8_t *previous, int count, int pixel_size);
+void write_token(vector<uint8_t> &output, uint8_t operation, int count);
+vector<uint8_t> create_container(const Animation &animation, const vector<uint16_t> &sparse_pixels, int keyframe_interval);
+bool verify_container(const vector<uint8_t> &container, const Animation &animation, const vector<uint16_t> &sparse_pixels);
+
+//  - - - - - - - - - - Function Definitons - - - - - - - - - -
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    cerr << "Usage: " << argv[0] << " INPUT OUTPUT [--keyframe-interval N]\n"
+         << "  Turns an RGB or indexed data file into a compressed container.\n"
+         << "  Every Nth frame gets stored on its own, only the first one by default.\n";
+    return 1;
+  }
+
+  int keyframe_interval = 0;
+
+  for (int argument = 3; argument + 1 < argc; argument += 2)
+    if (string(argv[argument]) == "--keyframe-interval")
+      keyframe_interval = stoi(argv[argument + 1]);
+
+  ifstream input(argv[1], ios::binary);
+  vector<uint8_t> data((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+  Animation animation;
+
+  if (!input || !read_animation(data, animation))
+  {
+    cerr << "Couldn't read any frames from " << argv[1] << "\n";
+    return 1;
+  }
+
+  vector<uint16_t> sparse_pixels = create_sparse_pixels(create_pixel_remap(create_coverage_map()));
+  vector<uint8_t> container = create_container(animation, sparse_pixels, keyframe_interval);
+
+  if (container.empty())
+    return 1;
+
+  if (!verify_container(container, animation, sparse_pixels))
+  {
+    cerr << "The container doesn't decode back to the frames, this is a bug!\n";
+    return 1;
+  }
+
+  ofstream output(argv[2], ios::binary);
+  output.write((const char*)container.data(), container.size());
+
+  if (!output)
+  {
+    cerr << "Couldn't write " << argv[2] << "\n";
+    return 1;
+  }
+
+  cout << animation.images.size() << " frames, " << data.size() << " -> " << container.size()
+       << " bytes (" << (double)data.size() / container.size() << "x smaller)\n";
+
+  return 0;
+}
+
+// Reads headerless RGB data files as well as indexed ones.
+bool read_animation(const vector<uint8_t> &data, Animation &animation)
+{
+  size_t position = 0;
+  size_t frame_count = data.size() / RGB_RECORD_SIZE_BYTES;
+
+  if (data.size() >= INDEXED_HEADER_SIZE_BYTES && memcmp(data.data(), INDEXED_MAGIC, 4) == 0)
+  {
+    animation.format = CONTAINER_FORMAT_INDEXED;
+    animation.global_palette = data[5] & INDEXED_GLOBAL_PALETTE;
+    frame_count = data[6] | (data[7] << 8);
+    position = INDEXED_HEADER_SIZE_BYTES;
+
+    if (animation.global_palette)
+    {
+      if (data.size() < position + PALETTE_SIZE_BYTES)
+        return false;
+
+      animation.palette.assign(data.begin() + position, data.begin() + position + PALETTE_SIZE_BYTES);
+      position += PALETTE_SIZE_BYTES;
+    }
+  }
+
+  bool indexed = animation.format == CONTAINER_FORMAT_INDEXED;
+  size_t palette_size = indexed && !animation.global_palette ? PALETTE_SIZE_BYTES : 0;
+  size_t image_size = indexed ? IMAGE_SIZE_PIXELS : IMAGE_SIZE_PIXELS * 3;
+
+  for (size_t frame = 0; frame < frame_count; frame++)
+  {
+    if (data.size() < position + 2 + palette_size + image_size)
+      break;
+
+    animation.delays.push_back(data[position] | (data[position + 1] << 8));
+    position += 2;
+
+    animation.palettes.emplace_back(data.begin() + position, data.begin() + position + palette_size);
+    position += palette_size;
+
+    animation.images.emplace_back(data.begin() + position, data.begin() + position + image_size);
+    position += image_size;
+  }
+
+  return !animation.images.empty() && animation.images.size() <= CONTAINER_MAX_FRAMES;
+}
+
+// Greedily picks whatever covers the next pixels with the fewest bytes:
+// Pixels that didn't change, a run of the same pixel, a match further back or literals.
+vector<uint8_t> encode_frame(const uint8_t *pixels, const uint8_t *previous, int count, int pixel_size)
+{
+  vector<uint8_t> output;
+  vector<int> head(1 << HASH_BITS, -1);
+  vector<int> chain(count, -1);
+  int literal_start = 0;
+  int position = 0;
+
+  auto equal = [&](int first, int second)
+  {
+    return memcmp(pixels + first * pixel_size, pixels + second * pixel_size, pixel_size) == 0;
+  };
+
+  auto hash = [&](int at)
+  {
+    uint32_t value = 2166136261u;
+
+    for (int byte = 0; byte < MIN_MATCH_PIXELS * pixel_size; byte++)
+      value = (value ^ pixels[at * pixel_size + byte]) * 16777619u;
+
+    return value >> (32 - HASH_BITS);
+  };
+
+  auto insert = [&](int at)
+  {
+    if (at + MIN_MATCH_PIXELS > count)
+      return;
+
+    uint32_t key = hash(at);
+    chain[at] = head[key];
+    head[key] = at;
+  };
+
+  auto flush_literals = [&]()
+  {
+    if (literal_start == position)
+      return;
+
+    write_token(output, CODEC_LITERAL, position - literal_start);
+    output.insert(output.end(), pixels + literal_start * pixel_size, pixels + position * pixel_size);
+  };
+
+  while (position < count)
+  {
+    int keep = 0, run = 1, match = 0, distance = 0;
+
+    if (previous != NULL)
+      while (position + keep < count
+        && memcmp(pixels + (position + keep) * pixel_size, previous + (position + keep) * pixel_size, pixel_size) == 0)
+        keep++;
+
+    while (position + run < count && equal(position + run, position))
+      run++;
+
+    if (position + MIN_MATCH_PIXELS <= count)
+    {
+      int candidate = head[hash(position)];
+
+      for (int tries = 0; candidate >= 0 && tries < MAX_MATCH_CANDIDATES; tries++, candidate = chain[candidate])
+      {
+        if (position - candidate > MAX_MATCH_DISTANCE)
+          break;
+
+        int length = 0;
+
+        while (position + length < count && equal(candidate + length, position + length))
+          length++;
+
+        if (length > match)
+        {
+          match = length;
+          distance = position - candidate;
+        }
+      }
+    }
+
+    // How many bytes every option saves compared to literals.
+    int keep_saving = keep * pixel_size - 1;
+    int run_saving = run >= MIN_MATCH_PIXELS ? (run - 1) * pixel_size - 1 : 0;
+    int match_saving = match >= MIN_MATCH_PIXELS ? match * pixel_size - 3 : 0;
+    int best = max(keep_saving, max(run_saving, match_saving));
+
+    if (best <= 0)
+    {
+      insert(position);
+      position++;
+      continue;
+    }
+
+    flush_literals();
+
+    int length;
+
+    if (best == keep_saving)
+    {
+      length = keep;
+      write_token(output, CODEC_KEEP, length);
+    }
+    else if (best == run_saving)
+    {
+      length = run;
+      write_token(output, CODEC_RUN, length);
+      output.insert(output.end(), pixels + position * pixel_size, pixels + (position + 1) * pixel_size);
+    }
+    else
+    {
+      length = match;
+      write_token(output, CODEC_MATCH, length);
+      output.push_back(distance & 0xFF);
+      output.push_back(distance >> 8);
+    }
+
+    for (int at = position; at < position + length; at++)
+      insert(at);
+
+    position += length;
+    literal_start = position;
+  }
+
+  flush_literals();
+
+  return output;
+}
+
+// The count - 1 goes into the token, whatever doesn't fit into the bytes after it.
+void write_token(vector<uint8_t> &output, uint8_t operation, int count)
+{
+  int stored = count - 1;
+
+  if (stored < CODEC_COUNT_MASK)
+  {
+    output.push_back((operation << CODEC_COUNT_BITS) | stored);
+    return;
+  }
+
+  output.push_back((operation << CODEC_COUNT_BITS) | CODEC_COUNT_MASK);
+  stored -= CODEC_COUNT_MASK;
+
+  for (; stored >= 255; stored -= 255)
+    output.push_back(255);
+
+  output.push_back(stored);
+}
+
+vector<uint8_t> create_container(const Animation &animation, const vector<uint16_t> &sparse_pixels, int keyframe_interval)
+{
+  int pixel_size = animation.format == CONTAINER_FORMAT_INDEXED ? 1 : 3;
+  uint16_t frame_count = animation.images.size();
+  vector<vector<uint8_t>> frames;
+  vector<uint8_t> previous;
+
+  for (uint16_t frame = 0; frame < frame_count; frame++)
+  {
+    // Only the pixels the firmware stores, in its order.
+    vector<uint8_t> pixels(sparse_pixels.size() * pixel_size);
+
+    for (size_t index = 0; index < sparse_pixels.size(); index++)
+      memcpy(&pixels[index * pixel_size], &animation.images[frame][sparse_pixels[index] * pixel_size], pixel_size);
+
+    bool keyframe = frame == 0 || (keyframe_interval > 0 && frame % keyframe_interval == 0);
+    vector<uint8_t> encoded = animation.palettes[frame];
+    vector<uint8_t> tokens = encode_frame(pixels.data(), keyframe ? NULL : previous.data(), sparse_pixels.size(), pixel_size);
+
+    encoded.insert(encoded.end(), tokens.begin(), tokens.end());
+    frames.push_back(encoded);
+    previous = pixels;
+  }
+
+  ContainerHeader header = {};
+  memcpy(header.magic, CONTAINER_MAGIC, 4);
+  header.version = CONTAINER_VERSION;
+  header.format = animation.format;
+  header.flags = animation.global_palette ? CONTAINER_GLOBAL_PALETTE : 0;
+  header.width = IMAGE_LENGTH_PIXELS;
+  header.height = IMAGE_LENGTH_PIXELS;
+  header.pixel_count = sparse_pixels.size();
+  header.frame_count = frame_count;
+  header.layout_hash = get_layout_hash(sparse_pixels.data(), sparse_pixels.size());
+
+  vector<uint8_t> container((const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+  container.insert(container.end(), animation.palette.begin(), animation.palette.end());
+
+  uint32_t offset = container.size() + frame_count * sizeof(ContainerFrame);
+
+  for (uint16_t frame = 0; frame < frame_count; frame++)
+  {
+    // The upload buffer of the firmware only fits a raw frame.
+    if (frames[frame].size() > (size_t)IMAGE_SIZE_PIXELS * 3)
+    {
+      cerr << "Frame " << frame << " got bigger than a raw frame!\n";
+      return {};
+    }
+
+    ContainerFrame entry = {};
+    entry.offset = offset;
+    entry.size = frames[frame].size();
+    entry.delay = animation.delays[frame];
+    entry.flags = frame == 0 || (keyframe_interval > 0 && frame % keyframe_interval == 0) ? CONTAINER_KEYFRAME : 0;
+
+    container.insert(container.end(), (const uint8_t*)&entry, (const uint8_t*)&entry + sizeof(entry));
+    offset += get_container_span(entry.size);
+  }
+
+  for (const vector<uint8_t> &frame : frames)
+  {
+    container.insert(container.end(), frame.begin(), frame.end());
+    container.resize(get_container_span(container.size()), 0);
+  }
+
+  return container;
+}
+
+// Decodes everything again with the decoder of the firmware and reports how fast that was.
+bool verify_container(const vector<uint8_t> &container, const Animation &animation, const vector<uint16_t> &sparse_pixels)
+{
+  ContainerHeader header;
+  memcpy(&header, container.data(), sizeof(header));
+
+  int pixel_size = header.format == CONTAINER_FORMAT_INDEXED ? 1 : 3;
+  size_t palette_size = header.format == CONTAINER_FORMAT_INDEXED && !(header.flags & CONTAINER_GLOBAL_PALETTE) ? PALETTE_SIZE_BYTES : 0;
+  size_t index_offset = sizeof(header) + (header.flags & CONTAINER_GLOBAL_PALETTE ? PALETTE_SIZE_BYTES : 0);
+  vector<uint8_t> pixels(sparse_pixels.size() * pixel_size);
+  double decode_seconds = 0;
+
+  for (uint16_t frame = 0; frame < header.frame_count; frame++)
+  {
+    ContainerFrame entry;
+    memcpy(&entry, &container[index_offset + frame * sizeof(entry)], sizeof(entry));
+
+    if (memcmp(&container[entry.offset], animation.palettes[frame].data(), palette_size) != 0)
+      return false;
+
+    // Decoded in place, just like polar frames on the device.
+    const uint8_t* reference = entry.flags & CONTAINER_KEYFRAME ? NULL : pixels.data();
+
+    auto start = chrono::steady_clock::now();
+    bool valid = decode_frame(&container[entry.offset + palette_size], entry.size - palette_size,
+      pixels.data(), reference, sparse_pixels.size(), pixel_size);
+    decode_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (!valid)
+      return false;
+
+    for (size_t index = 0; index < sparse_pixels.size(); index++)
+      if (memcmp(&pixels[index * pixel_size], &animation.images[frame][sparse_pixels[index] * pixel_size], pixel_size) != 0)
+        return false;
+  }
+
+  cout << "Decoding: " << pixels.size() * header.frame_count / decode_seconds / 1e6
+       << " MB of frames per second on this machine\n";
+
+  return true;
+}
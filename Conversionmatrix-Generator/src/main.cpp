@@ -4,6 +4,9 @@
 #include <cstdint>
 #include <cstring>
 #include <utility>
+#include <algorithm>
+#include <string>
+#include "sparse_layout.hpp"
 
 using namespace std;
 
@@ -11,7 +14,6 @@ using namespace std;
 //  - - - - - - - - - - Constants - - - - - - - - - -
 
 const int ANGLES_PER_ROTATION = 360;
-const int LEDS_PER_STRIP = 64;
 
 //  - - - - - - - - - - Function Declarations - - - - - - - - - -
 
@@ -19,12 +21,28 @@ vector<vector<pair<int, int>>> create_conversion_matrix(int center_x, int center
 void print_conversion_matrix_pretty(vector<vector<pair<int, int>>> *conversion_matrix);
 void print_conversion_matrix_array(vector<vector<pair<int, int>>> *conversion_matrix);
 void print_shown_coordinates(vector<vector<pair<int, int>>> *conversion_matrix);
+void print_coverage_map(const vector<bool> &coverage_map);
+void print_pixel_remap_array(const vector<uint16_t> &pixel_remap);
 
 //  - - - - - - - - - - Function Definitons - - - - - - - - - -
 
-int main() 
+int main(int argc, char **argv) 
 {
   int center_x = LEDS_PER_STRIP, center_y = LEDS_PER_STRIP;
+  string mode = argc > 1 ? argv[1] : "";
+
+  // The pixels of the image the LEDs ever show, and where they are stored in sparse frames.
+  if (mode == "--coverage" || mode == "--remap")
+  {
+    vector<bool> coverage_map = create_coverage_map();
+
+    if (mode == "--coverage")
+      print_coverage_map(coverage_map);
+    else
+      print_pixel_remap_array(create_pixel_remap(coverage_map));
+
+    return 0;
+  }
 
   auto conversion_matrix = create_conversion_matrix(center_x, center_y);
 
@@ -134,3 +152,41 @@ vector<vector<pair<int, int>>> create_conversion_matrix(int center_x, int center
   
   return conversion_matrix;
 }
+
+// Prints out the stored pixels in a 2D Array, in the same orientation as the image.
+void print_coverage_map(const vector<bool> &coverage_map)
+{
+  int count = 0;
+
+  for (int y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+  {
+    for (int column = 0; column < IMAGE_LENGTH_PIXELS; column++)
+    {
+      bool covered = coverage_map[y * IMAGE_LENGTH_PIXELS + column];
+      count += covered;
+
+      // Print every character twice, because every character has about a 2:1 ratio.
+      cout << (covered ? "##" : "  ");
+    }
+    cout << "\n";
+  }
+
+  cout << count << " of " << IMAGE_SIZE_PIXELS << " pixels are stored.\n";
+}
+
+// Prints out the remap usable in cpp, SPARSE_NO_PIXEL for pixels that aren't stored.
+void print_pixel_remap_array(const vector<uint16_t> &pixel_remap)
+{
+  cout << "const uint16_t pixel_remap[IMAGE_SIZE_PIXELS] PROGMEM = \n{\n";
+
+  for (int y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+  {
+    cout << "  ";
+    for (int column = 0; column < IMAGE_LENGTH_PIXELS; column++)
+      cout << pixel_remap[y * IMAGE_LENGTH_PIXELS + column] << ", ";
+
+    cout << "\n";
+  }
+
+  cout << "};";
+}
@@ -0,0 +1,143 @@
+/*
+ * @file sparse_layout.hpp
+ * @authors mia
+ * @brief The sparse frame layout of the firmware, shared by the host tools.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+
+
+//  - - - - - - - - - - Constants - - - - - - - - - -
+
+const int LEDS_PER_STRIP = 64;
+
+// Has to match the config of the firmware, it builds the same sparse layout on the device.
+const int MAX_ANGLES_PER_ROTATION = 720;
+const int PIXEL_OFFSET_ROWS = MAX_ANGLES_PER_ROTATION / 2;
+const int IMAGE_LENGTH_PIXELS = LEDS_PER_STRIP * 2;
+const int IMAGE_SIZE_PIXELS = IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS;
+const double SPARSE_PIXEL_RADIUS = LEDS_PER_STRIP - 0.5 + 0.7072;
+const uint16_t SPARSE_NO_PIXEL = 0xFFFF;
+
+//  - - - - - - - - - - Function Declarations - - - - - - - - - -
+
+vector<bool> create_coverage_map();
+vector<uint16_t> create_pixel_remap(const vector<bool> &coverage_map);
+vector<uint16_t> create_sparse_pixels(const vector<uint16_t> &pixel_remap);
+uint32_t get_sparse_order(int offset);
+
+//  - - - - - - - - - - Function Definitons - - - - - - - - - -
+
+// Marks every pixel the firmware stores in sparse frames. That's all the pixels the 
+// pixel offset table of the highest resolution references, for both arms of the strip,
+// and everything anti-aliasing reaches, up to half a pixel further out.
+// Uses the offsets of the firmware, the image is mirrored horizontally there.
+inline vector<bool> create_coverage_map()
+{
+  vector<bool> coverage_map(IMAGE_SIZE_PIXELS, false);
+
+  for (int row = 0; row < PIXEL_OFFSET_ROWS; row++)
+  {
+    double degrees = row * 360.0 / MAX_ANGLES_PER_ROTATION;
+
+    for (double arm_degrees : { degrees, degrees + 180.0 })
+    {
+      double theta = arm_degrees * M_PI / 180.0;
+
+      for (int radius = 0; radius < LEDS_PER_STRIP; radius++)
+      {
+        int x = static_cast<int>(round(LEDS_PER_STRIP + radius * cos(theta)));
+        int y = static_cast<int>(round(LEDS_PER_STRIP + radius * sin(theta)));
+
+        coverage_map[y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - x)] = true;
+      }
+    }
+  }
+
+  for (int offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+  {
+    double dx = (double)(IMAGE_LENGTH_PIXELS - offset % IMAGE_LENGTH_PIXELS) - LEDS_PER_STRIP;
+    double dy = (double)(offset / IMAGE_LENGTH_PIXELS) - LEDS_PER_STRIP;
+
+    if (dx * dx + dy * dy <= SPARSE_PIXEL_RADIUS * SPARSE_PIXEL_RADIUS)
+      coverage_map[offset] = true;
+  }
+
+  return coverage_map;
+}
+
+// Maps every pixel of the image to its index inside of a sparse frame.
+inline vector<uint16_t> create_pixel_remap(const vector<bool> &coverage_map)
+{
+  vector<uint32_t> order;
+  vector<uint16_t> pixel_remap(IMAGE_SIZE_PIXELS, SPARSE_NO_PIXEL);
+
+  for (int offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+    if (coverage_map[offset])
+      order.push_back(get_sparse_order(offset) * IMAGE_SIZE_PIXELS + offset);
+
+  sort(order.begin(), order.end());
+
+  for (size_t index = 0; index < order.size(); index++)
+    pixel_remap[order[index] % IMAGE_SIZE_PIXELS] = index;
+
+  return pixel_remap;
+}
+
+// Sorts pixels by the row of the pixel offset table closest to them, 
+// then by the LED of that row that passes over them.
+inline uint32_t get_sparse_order(int offset)
+{
+  double dx = (double)(IMAGE_LENGTH_PIXELS - offset % IMAGE_LENGTH_PIXELS) - LEDS_PER_STRIP;
+  double dy = (double)(offset / IMAGE_LENGTH_PIXELS) - LEDS_PER_STRIP;
+  double degrees = atan2(dy, dx) * 180.0 / M_PI;
+  int radius = static_cast<int>(min(round(sqrt(dx * dx + dy * dy)), (double)LEDS_PER_STRIP));
+  int position;
+
+  if (degrees < 0)
+    degrees += 360.0;
+
+  if (degrees < 180.0)
+  {
+    position = LEDS_PER_STRIP - radius;
+  }
+  else
+  {
+    position = LEDS_PER_STRIP + radius;
+    degrees -= 180.0;
+  }
+
+  int row = static_cast<int>(round(degrees * MAX_ANGLES_PER_ROTATION / 360.0)) % PIXEL_OFFSET_ROWS;
+
+  return row * (LEDS_PER_STRIP * 2 + 1) + position;
+}
+
+// The image offset of every pixel stored in sparse frames, in the order they are stored in.
+inline vector<uint16_t> create_sparse_pixels(const vector<uint16_t> &pixel_remap)
+{
+  vector<uint16_t> sparse_pixels;
+
+  for (int offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+  {
+    if (pixel_remap[offset] == SPARSE_NO_PIXEL)
+      continue;
+
+    if (pixel_remap[offset] >= sparse_pixels.size())
+      sparse_pixels.resize(pixel_remap[offset] + 1);
+
+    sparse_pixels[pixel_remap[offset]] = offset;
+  }
+
+  return sparse_pixels;
+}
@@ -6,7 +6,9 @@ Chart.register(LineController, LineElement, PointElement, LinearScale, CategoryS
 
 // - - - - - - - - - - - - Constants - - - - - - - - - - - - //
 
-const maxUploadSize = 8000000;
+// Animations that don't fit into the PSRAM get streamed from the flash,
+// so only the file system (~14MB minus the site) limits uploads.
+const maxUploadSize = 12000000;
 const imageSize = 128;
 
 const canvas = document.createElement('canvas');
@@ -132,12 +134,27 @@ window.handleGIFFile = async function handleGIFFile(file) {
   const frames = await extractFramesFromGIF(file);
   const frameCount = frames.length;
 
+  // GIFs only have 256 colors per frame, so try to keep them indexed.
+  // That takes a third of the space on the display.
+  const indexedFrames = [];
+
+  for (const frame of frames) {
+    indexedFrames.push(await processGIFFrame(frame, false));
+  }
+
+  const indexedData = encodeIndexedFrames(indexedFrames);
+
+  if (indexedData !== null) {
+    await uploadBinary(new Blob([indexedData], { type: 'application/octet-stream' }), 'data.bin');
+    return;
+  }
+
   // Allocate binary buffer (RGB data + delay per frame)
   const binaryData = new Uint8Array((imageSize * imageSize * 3 * frameCount) + (frameCount * 2));
   let index = 0;
 
   for (const frame of frames) {
-    const processedFrame = await processGIFFrame(frame);
+    const processedFrame = await processGIFFrame(frame, true);
     binaryData[index++] = processedFrame.delay & 0xff;
     binaryData[index++] = (processedFrame.delay >> 8) & 0xff;
 
@@ -221,7 +238,8 @@ window.extractFramesFromGIF = async function extractFramesFromGIF(file) {
 };
 
 // Update processGIFFrame to accept reconstructed frames
-window.processGIFFrame = async function processGIFFrame(frame) {
+// Without smoothing, the resized frame only has colors that were already in the GIF.
+window.processGIFFrame = async function processGIFFrame(frame, smoothing) {
   const canvas = document.createElement('canvas');
   canvas.width = frame.imageData.width;
   canvas.height = frame.imageData.height;
@@ -234,6 +252,7 @@ window.processGIFFrame = async function processGIFFrame(frame) {
   resizedCanvas.width = imageSize;
   resizedCanvas.height = imageSize;
   const resizedCtx = resizedCanvas.getContext('2d');
+  resizedCtx.imageSmoothingEnabled = smoothing;
   resizedCtx.drawImage(canvas, 0, 0, imageSize, imageSize);
 
   // Extract resized pixel data
@@ -252,17 +271,92 @@ window.processGIFFrame = async function processGIFFrame(frame) {
 };
 
 
+// Builds indexed frames, with one palette for all of them if they fit into it.
+// Returns null if any frame has more than 256 colors.
+window.encodeIndexedFrames = function encodeIndexedFrames(frames) {
+  const paletteSize = 256 * 3;
+  const frameColors = [];
+  const sharedColors = new Map();
+
+  for (const frame of frames) {
+    const colors = new Map();
+
+    for (let i = 0; i < frame.data.length; i += 3) {
+      const color = (frame.data[i] << 16) | (frame.data[i + 1] << 8) | frame.data[i + 2];
+
+      if (!colors.has(color)) {
+        colors.set(color, colors.size);
+      }
+
+      if (!sharedColors.has(color)) {
+        sharedColors.set(color, sharedColors.size);
+      }
+    }
+
+    if (colors.size > 256) {
+      return null;
+    }
+
+    frameColors.push(colors);
+  }
+
+  const shared = sharedColors.size <= 256;
+  const recordSize = 2 + (shared ? 0 : paletteSize) + imageSize * imageSize;
+  const binaryData = new Uint8Array(8 + (shared ? paletteSize : 0) + recordSize * frames.length);
+  let index = 0;
+
+  const writePalette = (colors) => {
+    for (const [color, colorIndex] of colors) {
+      binaryData[index + colorIndex * 3] = (color >> 16) & 0xff;
+      binaryData[index + colorIndex * 3 + 1] = (color >> 8) & 0xff;
+      binaryData[index + colorIndex * 3 + 2] = color & 0xff;
+    }
+
+    index += paletteSize;
+  };
+
+  // Header: magic, version, flags and the frame count.
+  for (const character of 'HIDX') {
+    binaryData[index++] = character.charCodeAt(0);
+  }
+
+  binaryData[index++] = 1;
+  binaryData[index++] = shared ? 0x01 : 0x00;
+  binaryData[index++] = frames.length & 0xff;
+  binaryData[index++] = (frames.length >> 8) & 0xff;
+
+  if (shared) {
+    writePalette(sharedColors);
+  }
+
+  frames.forEach((frame, frameIndex) => {
+    const colors = shared ? sharedColors : frameColors[frameIndex];
+
+    binaryData[index++] = frame.delay & 0xff;
+    binaryData[index++] = (frame.delay >> 8) & 0xff;
+
+    if (!shared) {
+      writePalette(colors);
+    }
+
+    for (let i = 0; i < frame.data.length; i += 3) {
+      binaryData[index++] = colors.get((frame.data[i] << 16) | (frame.data[i + 1] << 8) | frame.data[i + 2]);
+    }
+  });
+
+  return binaryData;
+};
+
 window.uploadBinary = async function uploadBinary(binaryBlob, fileName) {
   if (binaryBlob.size > maxUploadSize) {
-    alert('File is too large! Maximum frame count is 162!');
+    alert('File is too large!');
     return;
   }
 
-  const formData = new FormData();
-  formData.append('file', binaryBlob, fileName);
-
+  // The raw data file as the body, the display decodes it while it comes in.
   const xhr = new XMLHttpRequest();
   xhr.open('POST', '/upload', true);
+  xhr.setRequestHeader('Content-Type', 'application/octet-stream');
 
   xhr.upload.onprogress = (event) => {
     if (event.lengthComputable) {
@@ -281,50 +375,111 @@ window.uploadBinary = async function uploadBinary(binaryBlob, fileName) {
     }
   };
 
-  xhr.send(formData);
+  xhr.send(binaryBlob);
 }
 
-// - - - - - - - - - - - - CurrentRPM - - - - - - - - - - - - //
-
-window.updateCurrentRPM = function updateCurrentRPM() {
-  fetch('/CurrentRPM')
-    .then(response => response.text())
-    .then(data => {
-      // Update the width of the progress bar based on the value received
-      const rpm = parseInt(data);
-      addNewRPMValue(rpm)
-      document.getElementById('currentRPMLabel').innerText = rpm + " RPM";
-    })
-    .catch(error => {
-      console.error('Error:', error)
-      addNewRPMValue(0)
-    });
+// - - - - - - - - - - - - Control Socket - - - - - - - - - - - - //
+
+// Layout of the messages, see ControlRecord and ControlState in webserver.hpp.
+const controlRecordSize = 6;
+const controlMessageState = 1;
+const controlFlags = { l1: 1 << 0, l2: 1 << 1, l3: 1 << 2, l4: 1 << 3 };
+
+let controlSocket = null;
+let latestRPM = 0;
+const pendingControls = new Map();
+
+window.connectControlSocket = function connectControlSocket() {
+  controlSocket = new WebSocket(`ws://${location.host}/control`);
+  controlSocket.binaryType = 'arraybuffer';
+
+  controlSocket.onmessage = (event) => {
+    const view = new DataView(event.data);
+
+    if (view.byteLength > 0 && view.getUint8(0) === controlMessageState) {
+      handleState(view);
+    }
+  };
+
+  // Keep trying, the display might just be rebooting.
+  controlSocket.onclose = () => {
+    latestRPM = 0;
+    setTimeout(connectControlSocket, 1000);
+  };
+}
+
+connectControlSocket();
+
+// Doesn't touch the input the user is currently using, the state might lag behind it.
+window.setControl = function setControl(name, value) {
+  document.querySelectorAll(`#dataForm [name="${name}"]`).forEach(element => {
+    if (element === document.activeElement) {
+      return;
+    }
+
+    if (element.type === 'checkbox') {
+      element.checked = value;
+    } else {
+      element.value = value;
+    }
+  });
+}
+
+window.handleState = function handleState(view) {
+  const flags = view.getUint8(1);
+
+  latestRPM = view.getUint16(2, true);
+  document.getElementById('currentRPMLabel').innerText = latestRPM + " RPM";
+  document.getElementById('currentSlicesLabel').innerText = view.getUint16(4, true);
+
+  for (const [name, flag] of Object.entries(controlFlags)) {
+    setControl(name, (flags & flag) !== 0);
+  }
+
+  setControl('s1', view.getUint8(16));
+  setControl('s2', view.getUint8(17));
+  setControl('s3', view.getInt16(18, true));
+  setControl('s4', view.getInt16(20, true));
+  setControl('s5', view.getInt16(22, true));
+  setControl('s6', view.getUint16(24, true));
+  setControl('s7', view.getUint8(26));
+  setControl('r1', view.getUint16(27, true));
 }
 
-setInterval(updateCurrentRPM, 1000);
+// The chart keeps its one point per second, whatever the rate of the updates.
+setInterval(() => addNewRPMValue(latestRPM), 1000);
 
 // - - - - - - - - - - - - Data Sending - - - - - - - - - - - - //
 
-let timeout;
+// Everything that changed in the meantime goes out as a single message.
+window.flushControls = function flushControls() {
+  if (pendingControls.size === 0 || controlSocket.readyState !== WebSocket.OPEN) {
+    return;
+  }
 
-// Function to send data to the server
+  const message = new DataView(new ArrayBuffer(pendingControls.size * controlRecordSize));
+  let offset = 0;
+
+  for (const [name, value] of pendingControls) {
+    message.setUint8(offset, name.charCodeAt(0));
+    message.setUint8(offset + 1, parseInt(name.substring(1)));
+    message.setInt32(offset + 2, value, true);
+    offset += controlRecordSize;
+  }
+
+  pendingControls.clear();
+  controlSocket.send(message.buffer);
+}
+
+setInterval(flushControls, 50);
+
+// Only the latest value of every input gets sent.
 window.sendData = function sendData(input) {
-  clearTimeout(timeout); // Clear the previous timeout
-
-  timeout = setTimeout(() => {
-    var formData = new FormData();
-    formData.append(input.name, input.type === 'checkbox' ? input.checked : input.value);
-    console.log(formData)
-    var xhr = new XMLHttpRequest();
-    xhr.open("POST", "/post", true);
-    xhr.setRequestHeader("Content-Type", "application/x-www-form-urlencoded");
-    xhr.onreadystatechange = function() {
-      if (xhr.readyState == 4 && xhr.status == 200) {
-        console.log("Data sent and response loaded");
-      }
-    };
-    xhr.send(new URLSearchParams(formData).toString());
-  }, 80); // Delay sending the request.
+  const value = input.type === 'checkbox' ? (input.checked ? 1 : 0) : parseInt(input.value);
+
+  if (!isNaN(value)) {
+    pendingControls.set(input.name, value);
+  }
 }
 
 // Add event listeners to all form elements
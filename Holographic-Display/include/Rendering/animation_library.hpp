@@ -0,0 +1,110 @@
+/*
+ * @file animation_library.hpp
+ * @authors mia
+ * @brief Keeps track of the named animations in the file system and plays them one after another.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.hpp"
+#include "esp_log.h"
+#include "Rendering/rendering.hpp"
+
+
+namespace Rendering
+{
+
+struct LibraryEntry
+{
+    char name[LIBRARY_NAME_LENGTH];
+    uint16_t frame_count;
+    size_t file_size;
+    // How much of the frame memory the frames took up when they were uploaded.
+    size_t memory_size;
+};
+
+struct PlaylistEntry
+{
+    char name[LIBRARY_NAME_LENGTH];
+    uint32_t duration_ms;
+};
+
+// The animations of the library live in LIBRARY_DIRECTORY, the index lists them.
+// The scheduler task switches to the next animation of the playlist once it's due,
+// and preloads the one after that in the meantime, so the switch doesn't have to read the flash.
+// Single calls into the renderer are serialized by its loader mutex. Uploads and live frames
+// take many of them, so the scheduler leaves the renderer alone while they come in.
+class AnimationLibrary
+{
+private:
+    Renderer* _renderer;
+    SemaphoreHandle_t _mutex = NULL;
+    TaskHandle_t _scheduler_task = NULL;
+
+    LibraryEntry _entries[LIBRARY_MAX_ANIMATIONS];
+    uint8_t _entry_count = 0;
+
+    PlaylistEntry _playlist[PLAYLIST_MAX_ENTRIES];
+    uint8_t _playlist_count = 0;
+    uint8_t _playlist_position = 0;
+    bool _playing = false;
+    unsigned long _next_switch_ms = 0;
+    // Only try once per switch, whatever doesn't fit now won't fit a tick later either.
+    bool _preload_attempted = false;
+
+    // Selected animations get shown on the next tick.
+    char _selected[LIBRARY_NAME_LENGTH] = "";
+    bool _select_pending = false;
+
+    // Set while an upload is coming in, until it ends or hasn't sent anything for LIBRARY_HOLD_TIMEOUT_MS.
+    bool _held = false;
+    unsigned long _held_since_ms = 0;
+
+    uint32_t _switches = 0;
+    uint32_t _instant_switches = 0;
+#ifdef RENDER_METRICS
+    TaskLoad _load;
+#endif
+
+    static void _scheduler_loop(void *parameter);
+    void _tick();
+    void _switch_to(const char* name);
+    int8_t _find_entry(const char* name);
+    void _load_index();
+    void _save_index();
+public:
+    AnimationLibrary(Renderer* renderer);
+
+    void begin();
+    static bool is_valid_name(const char* name);
+
+    bool add(const char* name, uint16_t frame_count, size_t file_size, size_t memory_size);
+    bool remove(const char* name);
+
+    bool select(const char* name);
+    bool queue(const char* name, uint32_t duration_ms);
+    void clear();
+    void stop();
+    void hold();
+    void release();
+
+    uint8_t get_entry_count();
+    const LibraryEntry& get_entry(uint8_t index);
+    uint8_t get_playlist_count();
+    const PlaylistEntry& get_playlist_entry(uint8_t index);
+    uint8_t get_playlist_position();
+    bool is_playing();
+    uint32_t get_switches();
+    uint32_t get_instant_switches();
+#ifdef RENDER_METRICS
+    const TaskLoad& get_load();
+#endif
+};
+
+}
@@ -1,387 +0,0 @@
-/*
- * @file conversion_matrix.hpp
- * @authors mia
- * @brief Used for storing the very lengthy conversion matrix.
- * @version 0.1.0
- * @date 2024-11-09
- *
- * Copyright Deimo Elektronik GmbH (c) 2024
-*/
-
-#include <Arduino.h>
-#include "config.h"
-
-
-namespace Rendering
-{
-
-struct Coordinates {
-  uint8_t x;
-  uint8_t y;
-};
-
-const Coordinates conversion_matrix[ANGLES_PER_ROTATION][LEDS_PER_SIDE] PROGMEM = 
-{
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 64}, {75, 64}, {76, 64}, {77, 64}, {78, 64}, {79, 64}, {80, 64}, {81, 64}, {82, 64}, {83, 64}, {84, 64}, {85, 64}, {86, 64}, {87, 64}, {88, 64}, {89, 64}, {90, 64}, {91, 64}, {92, 64}, {93, 64}, {94, 64}, {95, 64}, {96, 64}, {97, 64}, {98, 64}, {99, 64}, {100, 64}, {101, 64}, {102, 64}, {103, 64}, {104, 64}, {105, 64}, {106, 64}, {107, 64}, {108, 64}, {109, 64}, {110, 64}, {111, 64}, {112, 64}, {113, 64}, {114, 64}, {115, 64}, {116, 64}, {117, 64}, {118, 64}, {119, 64}, {120, 64}, {121, 64}, {122, 64}, {123, 64}, {124, 64}, {125, 64}, {126, 64}, {127, 64},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 64}, {75, 64}, {76, 64}, {77, 64}, {78, 64}, {79, 64}, {80, 64}, {81, 64}, {82, 64}, {83, 64}, {84, 64}, {85, 64}, {86, 64}, {87, 64}, {88, 64}, {89, 64}, {90, 64}, {91, 64}, {92, 64}, {93, 65}, {94, 65}, {95, 65}, {96, 65}, {97, 65}, {98, 65}, {99, 65}, {100, 65}, {101, 65}, {102, 65}, {103, 65}, {104, 65}, {105, 65}, {106, 65}, {107, 65}, {108, 65}, {109, 65}, {110, 65}, {111, 65}, {112, 65}, {113, 65}, {114, 65}, {115, 65}, {116, 65}, {117, 65}, {118, 65}, {119, 65}, {120, 65}, {121, 65}, {122, 65}, {123, 65}, {124, 65}, {125, 65}, {126, 65}, {127, 65},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 64}, {75, 64}, {76, 64}, {77, 64}, {78, 64}, {79, 65}, {80, 65}, {81, 65}, {82, 65}, {83, 65}, {84, 65}, {85, 65}, {86, 65}, {87, 65}, {88, 65}, {89, 65}, {90, 65}, {91, 65}, {92, 65}, {93, 65}, {94, 65}, {95, 65}, {96, 65}, {97, 65}, {98, 65}, {99, 65}, {100, 65}, {101, 65}, {102, 65}, {103, 65}, {104, 65}, {105, 65}, {106, 65}, {107, 66}, {108, 66}, {109, 66}, {110, 66}, {111, 66}, {112, 66}, {113, 66}, {114, 66}, {115, 66}, {116, 66}, {117, 66}, {118, 66}, {119, 66}, {120, 66}, {121, 66}, {122, 66}, {123, 66}, {124, 66}, {125, 66}, {126, 66}, {127, 66},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 65}, {75, 65}, {76, 65}, {77, 65}, {78, 65}, {79, 65}, {80, 65}, {81, 65}, {82, 65}, {83, 65}, {84, 65}, {85, 65}, {86, 65}, {87, 65}, {88, 65}, {89, 65}, {90, 65}, {91, 65}, {92, 65}, {93, 66}, {94, 66}, {95, 66}, {96, 66}, {97, 66}, {98, 66}, {99, 66}, {100, 66}, {101, 66}, {102, 66}, {103, 66}, {104, 66}, {105, 66}, {106, 66}, {107, 66}, {108, 66}, {109, 66}, {110, 66}, {111, 66}, {112, 67}, {113, 67}, {114, 67}, {115, 67}, {116, 67}, {117, 67}, {118, 67}, {119, 67}, {120, 67}, {121, 67}, {122, 67}, {123, 67}, {124, 67}, {125, 67}, {126, 67}, {127, 67},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 65}, {73, 65}, {74, 65}, {75, 65}, {76, 65}, {77, 65}, {78, 65}, {79, 65}, {80, 65}, {81, 65}, {82, 65}, {83, 65}, {84, 65}, {85, 65}, {86, 66}, {87, 66}, {88, 66}, {89, 66}, {90, 66}, {91, 66}, {92, 66}, {93, 66}, {94, 66}, {95, 66}, {96, 66}, {97, 66}, {98, 66}, {99, 66}, {100, 67}, {101, 67}, {102, 67}, {103, 67}, {104, 67}, {105, 67}, {106, 67}, {107, 67}, {108, 67}, {109, 67}, {110, 67}, {111, 67}, {112, 67}, {113, 67}, {114, 67}, {115, 68}, {116, 68}, {117, 68}, {118, 68}, {119, 68}, {120, 68}, {121, 68}, {122, 68}, {123, 68}, {124, 68}, {125, 68}, {126, 68}, {127, 68},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 65}, {71, 65}, {72, 65}, {73, 65}, {74, 65}, {75, 65}, {76, 65}, {77, 65}, {78, 65}, {79, 65}, {80, 65}, {81, 65}, {82, 66}, {83, 66}, {84, 66}, {85, 66}, {86, 66}, {87, 66}, {88, 66}, {89, 66}, {90, 66}, {91, 66}, {92, 66}, {93, 67}, {94, 67}, {95, 67}, {96, 67}, {97, 67}, {98, 67}, {99, 67}, {100, 67}, {101, 67}, {102, 67}, {103, 67}, {104, 67}, {105, 68}, {106, 68}, {107, 68}, {108, 68}, {109, 68}, {110, 68}, {111, 68}, {112, 68}, {113, 68}, {114, 68}, {115, 68}, {116, 69}, {117, 69}, {118, 69}, {119, 69}, {120, 69}, {121, 69}, {122, 69}, {123, 69}, {124, 69}, {125, 69}, {126, 69}, {127, 69},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 65}, {70, 65}, {71, 65}, {72, 65}, {73, 65}, {74, 65}, {75, 65}, {76, 65}, {77, 65}, {78, 65}, {79, 66}, {80, 66}, {81, 66}, {82, 66}, {83, 66}, {84, 66}, {85, 66}, {86, 66}, {87, 66}, {88, 67}, {89, 67}, {90, 67}, {91, 67}, {92, 67}, {93, 67}, {94, 67}, {95, 67}, {96, 67}, {97, 67}, {98, 68}, {99, 68}, {100, 68}, {101, 68}, {102, 68}, {103, 68}, {104, 68}, {105, 68}, {106, 68}, {107, 68}, {108, 69}, {109, 69}, {110, 69}, {111, 69}, {112, 69}, {113, 69}, {114, 69}, {115, 69}, {116, 69}, {117, 70}, {118, 70}, {119, 70}, {120, 70}, {121, 70}, {122, 70}, {123, 70}, {124, 70}, {125, 70}, {126, 70}, {127, 71},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 65}, {70, 65}, {71, 65}, {72, 65}, {73, 65}, {74, 65}, {75, 65}, {76, 65}, {77, 66}, {78, 66}, {79, 66}, {80, 66}, {81, 66}, {82, 66}, {83, 66}, {84, 66}, {85, 67}, {86, 67}, {87, 67}, {88, 67}, {89, 67}, {90, 67}, {91, 67}, {92, 67}, {93, 68}, {94, 68}, {95, 68}, {96, 68}, {97, 68}, {98, 68}, {99, 68}, {100, 68}, {101, 69}, {102, 69}, {103, 69}, {104, 69}, {105, 69}, {106, 69}, {107, 69}, {108, 69}, {109, 69}, {110, 70}, {111, 70}, {112, 70}, {113, 70}, {114, 70}, {115, 70}, {116, 70}, {117, 70}, {118, 71}, {119, 71}, {120, 71}, {121, 71}, {122, 71}, {123, 71}, {124, 71}, {125, 71}, {126, 72}, {127, 72},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 65}, {69, 65}, {70, 65}, {71, 65}, {72, 65}, {73, 65}, {74, 65}, {75, 66}, {76, 66}, {77, 66}, {78, 66}, {79, 66}, {80, 66}, {81, 66}, {82, 67}, {83, 67}, {84, 67}, {85, 67}, {86, 67}, {87, 67}, {88, 67}, {89, 67}, {90, 68}, {91, 68}, {92, 68}, {93, 68}, {94, 68}, {95, 68}, {96, 68}, {97, 69}, {98, 69}, {99, 69}, {100, 69}, {101, 69}, {102, 69}, {103, 69}, {104, 70}, {105, 70}, {106, 70}, {107, 70}, {108, 70}, {109, 70}, {110, 70}, {111, 71}, {112, 71}, {113, 71}, {114, 71}, {115, 71}, {115, 71}, {116, 71}, {117, 72}, {118, 72}, {119, 72}, {120, 72}, {121, 72}, {122, 72}, {123, 72}, {124, 72}, {125, 73}, {126, 73},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 65}, {69, 65}, {70, 65}, {71, 65}, {72, 65}, {73, 65}, {74, 66}, {75, 66}, {76, 66}, {77, 66}, {78, 66}, {79, 66}, {80, 67}, {81, 67}, {82, 67}, {83, 67}, {84, 67}, {85, 67}, {86, 67}, {87, 68}, {88, 68}, {89, 68}, {90, 68}, {91, 68}, {92, 68}, {93, 69}, {94, 69}, {95, 69}, {96, 69}, {97, 69}, {98, 69}, {99, 69}, {100, 70}, {101, 70}, {102, 70}, {103, 70}, {104, 70}, {104, 70}, {105, 71}, {106, 71}, {107, 71}, {108, 71}, {109, 71}, {110, 71}, {111, 72}, {112, 72}, {113, 72}, {114, 72}, {115, 72}, {116, 72}, {117, 72}, {118, 73}, {119, 73}, {120, 73}, {121, 73}, {122, 73}, {123, 73}, {124, 74}, {125, 74}, {126, 74},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 65}, {68, 65}, {69, 65}, {70, 65}, {71, 65}, {72, 65}, {73, 66}, {74, 66}, {75, 66}, {76, 66}, {77, 66}, {78, 66}, {79, 67}, {80, 67}, {81, 67}, {82, 67}, {83, 67}, {84, 67}, {85, 68}, {86, 68}, {87, 68}, {88, 68}, {89, 68}, {90, 69}, {91, 69}, {92, 69}, {93, 69}, {94, 69}, {95, 69}, {96, 70}, {96, 70}, {97, 70}, {98, 70}, {99, 70}, {100, 70}, {101, 71}, {102, 71}, {103, 71}, {104, 71}, {105, 71}, {106, 71}, {107, 72}, {108, 72}, {109, 72}, {110, 72}, {111, 72}, {112, 73}, {113, 73}, {114, 73}, {115, 73}, {116, 73}, {117, 73}, {118, 74}, {119, 74}, {120, 74}, {121, 74}, {122, 74}, {123, 74}, {124, 75}, {125, 75}, {126, 75},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 65}, {68, 65}, {69, 65}, {70, 65}, {71, 65}, {72, 66}, {73, 66}, {74, 66}, {75, 66}, {76, 66}, {77, 66}, {78, 67}, {79, 67}, {80, 67}, {81, 67}, {82, 67}, {83, 68}, {84, 68}, {85, 68}, {86, 68}, {87, 68}, {88, 69}, {89, 69}, {90, 69}, {91, 69}, {91, 69}, {92, 70}, {93, 70}, {94, 70}, {95, 70}, {96, 70}, {97, 70}, {98, 71}, {99, 71}, {100, 71}, {101, 71}, {102, 71}, {103, 72}, {104, 72}, {105, 72}, {106, 72}, {107, 72}, {108, 73}, {109, 73}, {110, 73}, {111, 73}, {112, 73}, {113, 74}, {114, 74}, {115, 74}, {116, 74}, {117, 74}, {118, 74}, {119, 75}, {120, 75}, {121, 75}, {122, 75}, {123, 75}, {124, 76}, {125, 76}, {126, 76},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 65}, {68, 65}, {69, 65}, {70, 65}, {71, 65}, {72, 66}, {73, 66}, {74, 66}, {75, 66}, {76, 66}, {77, 67}, {78, 67}, {79, 67}, {80, 67}, {81, 68}, {82, 68}, {83, 68}, {84, 68}, {85, 68}, {86, 69}, {86, 69}, {87, 69}, {88, 69}, {89, 69}, {90, 70}, {91, 70}, {92, 70}, {93, 70}, {94, 70}, {95, 71}, {96, 71}, {97, 71}, {98, 71}, {99, 71}, {100, 72}, {101, 72}, {102, 72}, {103, 72}, {104, 73}, {105, 73}, {106, 73}, {107, 73}, {108, 73}, {109, 74}, {110, 74}, {111, 74}, {112, 74}, {113, 74}, {114, 75}, {115, 75}, {116, 75}, {117, 75}, {118, 75}, {119, 76}, {120, 76}, {121, 76}, {122, 76}, {123, 76}, {124, 77}, {125, 77}, {126, 77},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 65}, {68, 65}, {69, 65}, {70, 65}, {71, 66}, {72, 66}, {73, 66}, {74, 66}, {75, 66}, {76, 67}, {77, 67}, {78, 67}, {79, 67}, {80, 68}, {81, 68}, {82, 68}, {83, 68}, {83, 68}, {84, 69}, {85, 69}, {86, 69}, {87, 69}, {88, 70}, {89, 70}, {90, 70}, {91, 70}, {92, 71}, {93, 71}, {94, 71}, {95, 71}, {96, 71}, {97, 72}, {98, 72}, {99, 72}, {100, 72}, {101, 73}, {102, 73}, {103, 73}, {104, 73}, {105, 73}, {106, 74}, {107, 74}, {108, 74}, {109, 74}, {110, 75}, {111, 75}, {112, 75}, {113, 75}, {114, 75}, {115, 76}, {116, 76}, {117, 76}, {118, 76}, {119, 77}, {120, 77}, {121, 77}, {121, 77}, {122, 77}, {123, 78}, {124, 78}, {125, 78},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 65}, {68, 65}, {69, 65}, {70, 65}, {71, 66}, {72, 66}, {73, 66}, {74, 66}, {75, 67}, {76, 67}, {77, 67}, {78, 67}, {79, 68}, {80, 68}, {80, 68}, {81, 68}, {82, 69}, {83, 69}, {84, 69}, {85, 69}, {86, 70}, {87, 70}, {88, 70}, {89, 70}, {90, 71}, {91, 71}, {92, 71}, {93, 71}, {94, 71}, {95, 72}, {96, 72}, {97, 72}, {98, 72}, {99, 73}, {100, 73}, {101, 73}, {102, 73}, {103, 74}, {104, 74}, {105, 74}, {106, 74}, {107, 75}, {108, 75}, {109, 75}, {110, 75}, {111, 76}, {112, 76}, {113, 76}, {113, 76}, {114, 77}, {115, 77}, {116, 77}, {117, 77}, {118, 78}, {119, 78}, {120, 78}, {121, 78}, {122, 79}, {123, 79}, {124, 79}, {125, 79},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 65}, {70, 66}, {71, 66}, {72, 66}, {73, 66}, {74, 67}, {75, 67}, {76, 67}, {77, 67}, {78, 68}, {78, 68}, {79, 68}, {80, 68}, {81, 69}, {82, 69}, {83, 69}, {84, 69}, {85, 70}, {86, 70}, {87, 70}, {88, 70}, {89, 71}, {90, 71}, {91, 71}, {92, 72}, {93, 72}, {94, 72}, {95, 72}, {96, 73}, {97, 73}, {98, 73}, {99, 73}, {100, 74}, {101, 74}, {102, 74}, {103, 74}, {104, 75}, {105, 75}, {106, 75}, {107, 75}, {107, 76}, {108, 76}, {109, 76}, {110, 76}, {111, 77}, {112, 77}, {113, 77}, {114, 77}, {115, 78}, {116, 78}, {117, 78}, {118, 78}, {119, 79}, {120, 79}, {121, 79}, {122, 80}, {123, 80}, {124, 80}, {125, 80},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 65}, {70, 66}, {71, 66}, {72, 66}, {73, 66}, {74, 67}, {75, 67}, {76, 67}, {76, 68}, {77, 68}, {78, 68}, {79, 68}, {80, 69}, {81, 69}, {82, 69}, {83, 70}, {84, 70}, {85, 70}, {86, 70}, {87, 71}, {88, 71}, {89, 71}, {90, 71}, {91, 72}, {92, 72}, {93, 72}, {94, 73}, {95, 73}, {96, 73}, {97, 73}, {98, 74}, {99, 74}, {100, 74}, {101, 74}, {101, 75}, {102, 75}, {103, 75}, {104, 76}, {105, 76}, {106, 76}, {107, 76}, {108, 77}, {109, 77}, {110, 77}, {111, 78}, {112, 78}, {113, 78}, {114, 78}, {115, 79}, {116, 79}, {117, 79}, {118, 79}, {119, 80}, {120, 80}, {121, 80}, {122, 81}, {123, 81}, {124, 81}, {125, 81},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 65}, {70, 66}, {71, 66}, {72, 66}, {73, 67}, {74, 67}, {75, 67}, {75, 68}, {76, 68}, {77, 68}, {78, 68}, {79, 69}, {80, 69}, {81, 69}, {82, 70}, {83, 70}, {84, 70}, {85, 70}, {86, 71}, {87, 71}, {88, 71}, {89, 72}, {90, 72}, {91, 72}, {92, 72}, {93, 73}, {94, 73}, {95, 73}, {96, 74}, {97, 74}, {97, 74}, {98, 75}, {99, 75}, {100, 75}, {101, 75}, {102, 76}, {103, 76}, {104, 76}, {105, 77}, {106, 77}, {107, 77}, {108, 77}, {109, 78}, {110, 78}, {111, 78}, {112, 79}, {113, 79}, {114, 79}, {115, 79}, {116, 80}, {117, 80}, {118, 80}, {119, 81}, {119, 81}, {120, 81}, {121, 82}, {122, 82}, {123, 82}, {124, 82},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 66}, {70, 66}, {71, 66}, {72, 66}, {73, 67}, {74, 67}, {74, 67}, {75, 68}, {76, 68}, {77, 68}, {78, 69}, {79, 69}, {80, 69}, {81, 70}, {82, 70}, {83, 70}, {84, 70}, {85, 71}, {86, 71}, {87, 71}, {88, 72}, {89, 72}, {90, 72}, {91, 73}, {92, 73}, {93, 73}, {93, 74}, {94, 74}, {95, 74}, {96, 75}, {97, 75}, {98, 75}, {99, 75}, {100, 76}, {101, 76}, {102, 76}, {103, 77}, {104, 77}, {105, 77}, {106, 78}, {107, 78}, {108, 78}, {109, 79}, {110, 79}, {111, 79}, {112, 79}, {113, 80}, {113, 80}, {114, 80}, {115, 81}, {116, 81}, {117, 81}, {118, 82}, {119, 82}, {120, 82}, {121, 83}, {122, 83}, {123, 83}, {124, 83},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 66}, {70, 66}, {71, 66}, {72, 67}, {73, 67}, {73, 67}, {74, 68}, {75, 68}, {76, 68}, {77, 69}, {78, 69}, {79, 69}, {80, 70}, {81, 70}, {82, 70}, {83, 71}, {84, 71}, {85, 71}, {86, 71}, {87, 72}, {88, 72}, {89, 72}, {90, 73}, {90, 73}, {91, 73}, {92, 74}, {93, 74}, {94, 74}, {95, 75}, {96, 75}, {97, 75}, {98, 76}, {99, 76}, {100, 76}, {101, 77}, {102, 77}, {103, 77}, {104, 78}, {105, 78}, {106, 78}, {107, 79}, {107, 79}, {108, 79}, {109, 80}, {110, 80}, {111, 80}, {112, 81}, {113, 81}, {114, 81}, {115, 82}, {116, 82}, {117, 82}, {118, 83}, {119, 83}, {120, 83}, {121, 84}, {122, 84}, {123, 84}, {124, 85},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 66}, {70, 66}, {71, 66}, {72, 67}, {72, 67}, {73, 67}, {74, 68}, {75, 68}, {76, 68}, {77, 69}, {78, 69}, {79, 69}, {80, 70}, {81, 70}, {82, 70}, {83, 71}, {84, 71}, {85, 72}, {86, 72}, {87, 72}, {87, 73}, {88, 73}, {89, 73}, {90, 74}, {91, 74}, {92, 74}, {93, 75}, {94, 75}, {95, 75}, {96, 76}, {97, 76}, {98, 76}, {99, 77}, {100, 77}, {101, 77}, {102, 78}, {103, 78}, {103, 78}, {104, 79}, {105, 79}, {106, 79}, {107, 80}, {108, 80}, {109, 80}, {110, 81}, {111, 81}, {112, 81}, {113, 82}, {114, 82}, {115, 82}, {116, 83}, {117, 83}, {118, 83}, {119, 84}, {119, 84}, {120, 85}, {121, 85}, {122, 85}, {123, 86},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 66}, {70, 66}, {71, 67}, {71, 67}, {72, 67}, {73, 68}, {74, 68}, {75, 68}, {76, 69}, {77, 69}, {78, 69}, {79, 70}, {80, 70}, {81, 70}, {82, 71}, {83, 71}, {84, 72}, {85, 72}, {85, 72}, {86, 73}, {87, 73}, {88, 73}, {89, 74}, {90, 74}, {91, 74}, {92, 75}, {93, 75}, {94, 75}, {95, 76}, {96, 76}, {97, 77}, {98, 77}, {99, 77}, {99, 78}, {100, 78}, {101, 78}, {102, 79}, {103, 79}, {104, 79}, {105, 80}, {106, 80}, {107, 80}, {108, 81}, {109, 81}, {110, 82}, {111, 82}, {112, 82}, {113, 83}, {113, 83}, {114, 83}, {115, 84}, {116, 84}, {117, 84}, {118, 85}, {119, 85}, {120, 86}, {121, 86}, {122, 86}, {123, 87},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 65}, {69, 66}, {70, 66}, {70, 67}, {71, 67}, {72, 67}, {73, 68}, {74, 68}, {75, 68}, {76, 69}, {77, 69}, {78, 70}, {79, 70}, {80, 70}, {81, 71}, {82, 71}, {83, 71}, {83, 72}, {84, 72}, {85, 73}, {86, 73}, {87, 73}, {88, 74}, {89, 74}, {90, 74}, {91, 75}, {92, 75}, {93, 76}, {94, 76}, {95, 76}, {96, 77}, {96, 77}, {97, 77}, {98, 78}, {99, 78}, {100, 79}, {101, 79}, {102, 79}, {103, 80}, {104, 80}, {105, 80}, {106, 81}, {107, 81}, {108, 82}, {109, 82}, {109, 82}, {110, 83}, {111, 83}, {112, 83}, {113, 84}, {114, 84}, {115, 85}, {116, 85}, {117, 85}, {118, 86}, {119, 86}, {120, 86}, {121, 87}, {121, 87}, {122, 88},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {69, 66}, {70, 66}, {70, 67}, {71, 67}, {72, 68}, {73, 68}, {74, 68}, {75, 69}, {76, 69}, {77, 69}, {78, 70}, {79, 70}, {80, 71}, {81, 71}, {81, 71}, {82, 72}, {83, 72}, {84, 73}, {85, 73}, {86, 73}, {87, 74}, {88, 74}, {89, 75}, {90, 75}, {91, 75}, {92, 76}, {93, 76}, {93, 77}, {94, 77}, {95, 77}, {96, 78}, {97, 78}, {98, 78}, {99, 79}, {100, 79}, {101, 80}, {102, 80}, {103, 80}, {104, 81}, {105, 81}, {105, 82}, {106, 82}, {107, 82}, {108, 83}, {109, 83}, {110, 84}, {111, 84}, {112, 84}, {113, 85}, {114, 85}, {115, 85}, {116, 86}, {116, 86}, {117, 87}, {118, 87}, {119, 87}, {120, 88}, {121, 88}, {122, 89},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {69, 66}, {69, 66}, {70, 67}, {71, 67}, {72, 68}, {73, 68}, {74, 68}, {75, 69}, {76, 69}, {77, 70}, {78, 70}, {79, 71}, {80, 71}, {80, 71}, {81, 72}, {82, 72}, {83, 73}, {84, 73}, {85, 73}, {86, 74}, {87, 74}, {88, 75}, {89, 75}, {90, 75}, {90, 76}, {91, 76}, {92, 77}, {93, 77}, {94, 77}, {95, 78}, {96, 78}, {97, 79}, {98, 79}, {99, 79}, {100, 80}, {101, 80}, {101, 81}, {102, 81}, {103, 81}, {104, 82}, {105, 82}, {106, 83}, {107, 83}, {108, 84}, {109, 84}, {110, 84}, {111, 85}, {112, 85}, {112, 86}, {113, 86}, {114, 86}, {115, 87}, {116, 87}, {117, 88}, {118, 88}, {119, 88}, {120, 89}, {121, 89}, {122, 90},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {69, 66}, {69, 67}, {70, 67}, {71, 67}, {72, 68}, {73, 68}, {74, 69}, {75, 69}, {76, 69}, {77, 70}, {78, 70}, {79, 71}, {79, 71}, {80, 72}, {81, 72}, {82, 72}, {83, 73}, {84, 73}, {85, 74}, {86, 74}, {87, 75}, {88, 75}, {88, 75}, {89, 76}, {90, 76}, {91, 77}, {92, 77}, {93, 78}, {94, 78}, {95, 78}, {96, 79}, {97, 79}, {98, 80}, {98, 80}, {99, 80}, {100, 81}, {101, 81}, {102, 82}, {103, 82}, {104, 83}, {105, 83}, {106, 83}, {107, 84}, {108, 84}, {108, 85}, {109, 85}, {110, 86}, {111, 86}, {112, 86}, {113, 87}, {114, 87}, {115, 88}, {116, 88}, {117, 89}, {117, 89}, {118, 89}, {119, 90}, {120, 90}, {121, 91},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {68, 66}, {69, 67}, {70, 67}, {71, 68}, {72, 68}, {73, 68}, {74, 69}, {75, 69}, {76, 70}, {77, 70}, {77, 71}, {78, 71}, {79, 71}, {80, 72}, {81, 72}, {82, 73}, {83, 73}, {84, 74}, {85, 74}, {86, 75}, {86, 75}, {87, 75}, {88, 76}, {89, 76}, {90, 77}, {91, 77}, {92, 78}, {93, 78}, {94, 78}, {95, 79}, {95, 79}, {96, 80}, {97, 80}, {98, 81}, {99, 81}, {100, 82}, {101, 82}, {102, 82}, {103, 83}, {104, 83}, {104, 84}, {105, 84}, {106, 85}, {107, 85}, {108, 85}, {109, 86}, {110, 86}, {111, 87}, {112, 87}, {113, 88}, {113, 88}, {114, 89}, {115, 89}, {116, 89}, {117, 90}, {118, 90}, {119, 91}, {120, 91}, {121, 92},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {68, 66}, {69, 67}, {70, 67}, {71, 68}, {72, 68}, {73, 69}, {74, 69}, {75, 69}, {76, 70}, {76, 70}, {77, 71}, {78, 71}, {79, 72}, {80, 72}, {81, 73}, {82, 73}, {83, 74}, {84, 74}, {84, 74}, {85, 75}, {86, 75}, {87, 76}, {88, 76}, {89, 77}, {90, 77}, {91, 78}, {92, 78}, {93, 79}, {93, 79}, {94, 79}, {95, 80}, {96, 80}, {97, 81}, {98, 81}, {99, 82}, {100, 82}, {101, 83}, {101, 83}, {102, 84}, {103, 84}, {104, 84}, {105, 85}, {106, 85}, {107, 86}, {108, 86}, {109, 87}, {109, 87}, {110, 88}, {111, 88}, {112, 89}, {113, 89}, {114, 89}, {115, 90}, {116, 90}, {117, 91}, {117, 91}, {118, 92}, {119, 92}, {120, 93},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {68, 66}, {68, 66}, {69, 67}, {70, 67}, {71, 68}, {72, 68}, {73, 69}, {74, 69}, {75, 70}, {75, 70}, {76, 71}, {77, 71}, {78, 72}, {79, 72}, {80, 72}, {81, 73}, {82, 73}, {83, 74}, {83, 74}, {84, 75}, {85, 75}, {86, 76}, {87, 76}, {88, 77}, {89, 77}, {90, 78}, {90, 78}, {91, 79}, {92, 79}, {93, 79}, {94, 80}, {95, 80}, {96, 81}, {97, 81}, {98, 82}, {98, 82}, {99, 83}, {100, 83}, {101, 84}, {102, 84}, {103, 85}, {104, 85}, {105, 86}, {105, 86}, {106, 87}, {107, 87}, {108, 87}, {109, 88}, {110, 88}, {111, 89}, {112, 89}, {113, 90}, {113, 90}, {114, 91}, {115, 91}, {116, 92}, {117, 92}, {118, 93}, {119, 93}, {120, 94},  },
-  { {64, 64}, {65, 64}, {66, 65}, {67, 65}, {67, 66}, {68, 66}, {69, 67}, {70, 67}, {71, 68}, {72, 68}, {73, 69}, {74, 69}, {74, 70}, {75, 70}, {76, 71}, {77, 71}, {78, 72}, {79, 72}, {80, 73}, {81, 73}, {81, 74}, {82, 74}, {83, 75}, {84, 75}, {85, 76}, {86, 76}, {87, 77}, {88, 77}, {88, 78}, {89, 78}, {90, 79}, {91, 79}, {92, 80}, {93, 80}, {94, 80}, {95, 81}, {95, 81}, {96, 82}, {97, 82}, {98, 83}, {99, 83}, {100, 84}, {101, 84}, {102, 85}, {102, 85}, {103, 86}, {104, 86}, {105, 87}, {106, 87}, {107, 88}, {108, 88}, {109, 89}, {109, 89}, {110, 90}, {111, 90}, {112, 91}, {113, 91}, {114, 92}, {115, 92}, {116, 93}, {116, 93}, {117, 94}, {118, 94}, {119, 95},  },
-  { {64, 64}, {65, 65}, {66, 65}, {67, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 68}, {72, 69}, {73, 69}, {74, 70}, {74, 70}, {75, 71}, {76, 71}, {77, 72}, {78, 72}, {79, 73}, {80, 73}, {80, 74}, {81, 74}, {82, 75}, {83, 75}, {84, 76}, {85, 76}, {86, 77}, {87, 77}, {87, 78}, {88, 78}, {89, 79}, {90, 79}, {91, 80}, {92, 80}, {93, 81}, {93, 81}, {94, 82}, {95, 82}, {96, 83}, {97, 83}, {98, 84}, {99, 84}, {100, 85}, {100, 85}, {101, 86}, {102, 86}, {103, 87}, {104, 87}, {105, 88}, {106, 88}, {106, 89}, {107, 89}, {108, 90}, {109, 90}, {110, 91}, {111, 91}, {112, 92}, {112, 92}, {113, 93}, {114, 93}, {115, 94}, {116, 94}, {117, 95}, {118, 95}, {119, 96},  },
-  { {64, 64}, {65, 65}, {66, 65}, {67, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 68}, {72, 69}, {73, 69}, {73, 70}, {74, 70}, {75, 71}, {76, 71}, {77, 72}, {78, 72}, {79, 73}, {79, 73}, {80, 74}, {81, 74}, {82, 75}, {83, 75}, {84, 76}, {85, 76}, {85, 77}, {86, 77}, {87, 78}, {88, 78}, {89, 79}, {90, 79}, {91, 80}, {91, 80}, {92, 81}, {93, 82}, {94, 82}, {95, 83}, {96, 83}, {97, 84}, {97, 84}, {98, 85}, {99, 85}, {100, 86}, {101, 86}, {102, 87}, {103, 87}, {103, 88}, {104, 88}, {105, 89}, {106, 89}, {107, 90}, {108, 90}, {109, 91}, {109, 91}, {110, 92}, {111, 92}, {112, 93}, {113, 93}, {114, 94}, {115, 94}, {115, 95}, {116, 95}, {117, 96}, {118, 96},  },
-  { {64, 64}, {65, 65}, {66, 65}, {67, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 68}, {72, 69}, {72, 69}, {73, 70}, {74, 70}, {75, 71}, {76, 71}, {77, 72}, {78, 72}, {78, 73}, {79, 74}, {80, 74}, {81, 75}, {82, 75}, {83, 76}, {84, 76}, {84, 77}, {85, 77}, {86, 78}, {87, 78}, {88, 79}, {89, 79}, {89, 80}, {90, 80}, {91, 81}, {92, 81}, {93, 82}, {94, 83}, {95, 83}, {95, 84}, {96, 84}, {97, 85}, {98, 85}, {99, 86}, {100, 86}, {100, 87}, {101, 87}, {102, 88}, {103, 88}, {104, 89}, {105, 89}, {106, 90}, {106, 90}, {107, 91}, {108, 92}, {109, 92}, {110, 93}, {111, 93}, {111, 94}, {112, 94}, {113, 95}, {114, 95}, {115, 96}, {116, 96}, {117, 97}, {117, 97},  },
-  { {64, 64}, {65, 65}, {66, 65}, {67, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 68}, {72, 69}, {72, 69}, {73, 70}, {74, 71}, {75, 71}, {76, 72}, {77, 72}, {77, 73}, {78, 73}, {79, 74}, {80, 74}, {81, 75}, {82, 75}, {82, 76}, {83, 77}, {84, 77}, {85, 78}, {86, 78}, {87, 79}, {87, 79}, {88, 80}, {89, 80}, {90, 81}, {91, 81}, {92, 82}, {93, 83}, {93, 83}, {94, 84}, {95, 84}, {96, 85}, {97, 85}, {98, 86}, {98, 86}, {99, 87}, {100, 87}, {101, 88}, {102, 89}, {103, 89}, {103, 90}, {104, 90}, {105, 91}, {106, 91}, {107, 92}, {108, 92}, {108, 93}, {109, 93}, {110, 94}, {111, 94}, {112, 95}, {113, 96}, {113, 96}, {114, 97}, {115, 97}, {116, 98}, {117, 98},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 68}, {71, 69}, {72, 70}, {73, 70}, {74, 71}, {75, 71}, {76, 72}, {76, 72}, {77, 73}, {78, 74}, {79, 74}, {80, 75}, {81, 75}, {81, 76}, {82, 76}, {83, 77}, {84, 77}, {85, 78}, {86, 79}, {86, 79}, {87, 80}, {88, 80}, {89, 81}, {90, 81}, {91, 82}, {91, 82}, {92, 83}, {93, 84}, {94, 84}, {95, 85}, {96, 85}, {96, 86}, {97, 86}, {98, 87}, {99, 87}, {100, 88}, {100, 89}, {101, 89}, {102, 90}, {103, 90}, {104, 91}, {105, 91}, {105, 92}, {106, 93}, {107, 93}, {108, 94}, {109, 94}, {110, 95}, {110, 95}, {111, 96}, {112, 96}, {113, 97}, {114, 98}, {115, 98}, {115, 99}, {116, 99},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 66}, {68, 67}, {69, 67}, {70, 68}, {71, 69}, {71, 69}, {72, 70}, {73, 70}, {74, 71}, {75, 71}, {75, 72}, {76, 73}, {77, 73}, {78, 74}, {79, 74}, {80, 75}, {80, 75}, {81, 76}, {82, 77}, {83, 77}, {84, 78}, {84, 78}, {85, 79}, {86, 79}, {87, 80}, {88, 81}, {89, 81}, {89, 82}, {90, 82}, {91, 83}, {92, 84}, {93, 84}, {93, 85}, {94, 85}, {95, 86}, {96, 86}, {97, 87}, {98, 88}, {98, 88}, {99, 89}, {100, 89}, {101, 90}, {102, 90}, {103, 91}, {103, 92}, {104, 92}, {105, 93}, {106, 93}, {107, 94}, {107, 94}, {108, 95}, {109, 96}, {110, 96}, {111, 97}, {112, 97}, {112, 98}, {113, 98}, {114, 99}, {115, 100}, {116, 100},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 66}, {68, 67}, {69, 68}, {70, 68}, {70, 69}, {71, 69}, {72, 70}, {73, 70}, {74, 71}, {75, 72}, {75, 72}, {76, 73}, {77, 73}, {78, 74}, {79, 75}, {79, 75}, {80, 76}, {81, 76}, {82, 77}, {83, 78}, {83, 78}, {84, 79}, {85, 79}, {86, 80}, {87, 80}, {87, 81}, {88, 82}, {89, 82}, {90, 83}, {91, 83}, {92, 84}, {92, 85}, {93, 85}, {94, 86}, {95, 86}, {96, 87}, {96, 88}, {97, 88}, {98, 89}, {99, 89}, {100, 90}, {100, 90}, {101, 91}, {102, 92}, {103, 92}, {104, 93}, {104, 93}, {105, 94}, {106, 95}, {107, 95}, {108, 96}, {108, 96}, {109, 97}, {110, 98}, {111, 98}, {112, 99}, {113, 99}, {113, 100}, {114, 100}, {115, 101},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 66}, {68, 67}, {69, 68}, {70, 68}, {70, 69}, {71, 69}, {72, 70}, {73, 71}, {74, 71}, {74, 72}, {75, 72}, {76, 73}, {77, 74}, {78, 74}, {78, 75}, {79, 75}, {80, 76}, {81, 77}, {82, 77}, {82, 78}, {83, 78}, {84, 79}, {85, 80}, {86, 80}, {86, 81}, {87, 81}, {88, 82}, {89, 83}, {90, 83}, {90, 84}, {91, 84}, {92, 85}, {93, 86}, {94, 86}, {94, 87}, {95, 87}, {96, 88}, {97, 89}, {98, 89}, {98, 90}, {99, 90}, {100, 91}, {101, 92}, {102, 92}, {102, 93}, {103, 93}, {104, 94}, {105, 95}, {106, 95}, {106, 96}, {107, 96}, {108, 97}, {109, 98}, {110, 98}, {110, 99}, {111, 100}, {112, 100}, {113, 101}, {114, 101}, {114, 102},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 66}, {68, 67}, {69, 68}, {70, 68}, {70, 69}, {71, 70}, {72, 70}, {73, 71}, {73, 71}, {74, 72}, {75, 73}, {76, 73}, {77, 74}, {77, 74}, {78, 75}, {79, 76}, {80, 76}, {81, 77}, {81, 78}, {82, 78}, {83, 79}, {84, 79}, {84, 80}, {85, 81}, {86, 81}, {87, 82}, {88, 82}, {88, 83}, {89, 84}, {90, 84}, {91, 85}, {92, 86}, {92, 86}, {93, 87}, {94, 87}, {95, 88}, {96, 89}, {96, 89}, {97, 90}, {98, 90}, {99, 91}, {99, 92}, {100, 92}, {101, 93}, {102, 94}, {103, 94}, {103, 95}, {104, 95}, {105, 96}, {106, 97}, {107, 97}, {107, 98}, {108, 98}, {109, 99}, {110, 100}, {110, 100}, {111, 101}, {112, 102}, {113, 102}, {114, 103},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 67}, {68, 67}, {69, 68}, {69, 68}, {70, 69}, {71, 70}, {72, 70}, {73, 71}, {73, 72}, {74, 72}, {75, 73}, {76, 73}, {76, 74}, {77, 75}, {78, 75}, {79, 76}, {80, 77}, {80, 77}, {81, 78}, {82, 78}, {83, 79}, {83, 80}, {84, 80}, {85, 81}, {86, 82}, {87, 82}, {87, 83}, {88, 84}, {89, 84}, {90, 85}, {90, 85}, {91, 86}, {92, 87}, {93, 87}, {94, 88}, {94, 89}, {95, 89}, {96, 90}, {97, 90}, {97, 91}, {98, 92}, {99, 92}, {100, 93}, {101, 94}, {101, 94}, {102, 95}, {103, 95}, {104, 96}, {104, 97}, {105, 97}, {106, 98}, {107, 99}, {108, 99}, {108, 100}, {109, 101}, {110, 101}, {111, 102}, {111, 102}, {112, 103}, {113, 104},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 67}, {68, 67}, {69, 68}, {69, 68}, {70, 69}, {71, 70}, {72, 70}, {72, 71}, {73, 72}, {74, 72}, {75, 73}, {75, 74}, {76, 74}, {77, 75}, {78, 76}, {79, 76}, {79, 77}, {80, 77}, {81, 78}, {82, 79}, {82, 79}, {83, 80}, {84, 81}, {85, 81}, {85, 82}, {86, 83}, {87, 83}, {88, 84}, {89, 85}, {89, 85}, {90, 86}, {91, 86}, {92, 87}, {92, 88}, {93, 88}, {94, 89}, {95, 90}, {95, 90}, {96, 91}, {97, 92}, {98, 92}, {98, 93}, {99, 94}, {100, 94}, {101, 95}, {102, 95}, {102, 96}, {103, 97}, {104, 97}, {105, 98}, {105, 99}, {106, 99}, {107, 100}, {108, 101}, {108, 101}, {109, 102}, {110, 103}, {111, 103}, {111, 104}, {112, 104},  },
-  { {64, 64}, {65, 65}, {66, 65}, {66, 66}, {67, 67}, {68, 67}, {69, 68}, {69, 69}, {70, 69}, {71, 70}, {72, 71}, {72, 71}, {73, 72}, {74, 73}, {75, 73}, {75, 74}, {76, 74}, {77, 75}, {78, 76}, {78, 76}, {79, 77}, {80, 78}, {81, 78}, {81, 79}, {82, 80}, {83, 80}, {84, 81}, {84, 82}, {85, 82}, {86, 83}, {87, 84}, {87, 84}, {88, 85}, {89, 86}, {90, 86}, {90, 87}, {91, 88}, {92, 88}, {93, 89}, {93, 90}, {94, 90}, {95, 91}, {96, 92}, {96, 92}, {97, 93}, {98, 94}, {99, 94}, {99, 95}, {100, 95}, {101, 96}, {102, 97}, {102, 97}, {103, 98}, {104, 99}, {105, 99}, {106, 100}, {106, 101}, {107, 101}, {108, 102}, {109, 103}, {109, 103}, {110, 104}, {111, 105}, {112, 105},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {68, 67}, {68, 68}, {69, 69}, {70, 69}, {71, 70}, {71, 71}, {72, 71}, {73, 72}, {74, 73}, {74, 73}, {75, 74}, {76, 75}, {77, 75}, {77, 76}, {78, 77}, {79, 77}, {80, 78}, {80, 79}, {81, 79}, {82, 80}, {83, 81}, {83, 81}, {84, 82}, {85, 83}, {86, 83}, {86, 84}, {87, 85}, {88, 85}, {89, 86}, {89, 87}, {90, 87}, {91, 88}, {91, 89}, {92, 89}, {93, 90}, {94, 91}, {94, 91}, {95, 92}, {96, 93}, {97, 93}, {97, 94}, {98, 95}, {99, 95}, {100, 96}, {100, 97}, {101, 97}, {102, 98}, {103, 99}, {103, 99}, {104, 100}, {105, 101}, {106, 101}, {106, 102}, {107, 103}, {108, 103}, {109, 104}, {109, 105}, {110, 105}, {111, 106},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {68, 67}, {68, 68}, {69, 69}, {70, 69}, {71, 70}, {71, 71}, {72, 72}, {73, 72}, {74, 73}, {74, 74}, {75, 74}, {76, 75}, {76, 76}, {77, 76}, {78, 77}, {79, 78}, {79, 78}, {80, 79}, {81, 80}, {82, 80}, {82, 81}, {83, 82}, {84, 82}, {84, 83}, {85, 84}, {86, 84}, {87, 85}, {87, 86}, {88, 87}, {89, 87}, {90, 88}, {90, 89}, {91, 89}, {92, 90}, {93, 91}, {93, 91}, {94, 92}, {95, 93}, {95, 93}, {96, 94}, {97, 95}, {98, 95}, {98, 96}, {99, 97}, {100, 97}, {101, 98}, {101, 99}, {102, 99}, {103, 100}, {103, 101}, {104, 102}, {105, 102}, {106, 103}, {106, 104}, {107, 104}, {108, 105}, {109, 106}, {109, 106}, {110, 107},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {68, 67}, {68, 68}, {69, 69}, {70, 70}, {70, 70}, {71, 71}, {72, 72}, {73, 72}, {73, 73}, {74, 74}, {75, 74}, {76, 75}, {76, 76}, {77, 77}, {78, 77}, {78, 78}, {79, 79}, {80, 79}, {81, 80}, {81, 81}, {82, 81}, {83, 82}, {83, 83}, {84, 83}, {85, 84}, {86, 85}, {86, 86}, {87, 86}, {88, 87}, {88, 88}, {89, 88}, {90, 89}, {91, 90}, {91, 90}, {92, 91}, {93, 92}, {93, 92}, {94, 93}, {95, 94}, {96, 95}, {96, 95}, {97, 96}, {98, 97}, {99, 97}, {99, 98}, {100, 99}, {101, 99}, {101, 100}, {102, 101}, {103, 102}, {104, 102}, {104, 103}, {105, 104}, {106, 104}, {106, 105}, {107, 106}, {108, 106}, {109, 107}, {109, 108},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {68, 68}, {69, 69}, {70, 70}, {70, 70}, {71, 71}, {72, 72}, {72, 72}, {73, 73}, {74, 74}, {75, 75}, {75, 75}, {76, 76}, {77, 77}, {77, 77}, {78, 78}, {79, 79}, {80, 80}, {80, 80}, {81, 81}, {82, 82}, {82, 82}, {83, 83}, {84, 84}, {85, 85}, {85, 85}, {86, 86}, {87, 87}, {87, 87}, {88, 88}, {89, 89}, {89, 89}, {90, 90}, {91, 91}, {92, 92}, {92, 92}, {93, 93}, {94, 94}, {94, 94}, {95, 95}, {96, 96}, {97, 97}, {97, 97}, {98, 98}, {99, 99}, {99, 99}, {100, 100}, {101, 101}, {101, 101}, {102, 102}, {103, 103}, {104, 104}, {104, 104}, {105, 105}, {106, 106}, {106, 106}, {107, 107}, {108, 108}, {109, 109},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {67, 68}, {68, 68}, {69, 69}, {70, 70}, {70, 70}, {71, 71}, {72, 72}, {72, 73}, {73, 73}, {74, 74}, {74, 75}, {75, 76}, {76, 76}, {77, 77}, {77, 78}, {78, 78}, {79, 79}, {79, 80}, {80, 81}, {81, 81}, {81, 82}, {82, 83}, {83, 83}, {83, 84}, {84, 85}, {85, 86}, {86, 86}, {86, 87}, {87, 88}, {88, 88}, {88, 89}, {89, 90}, {90, 91}, {90, 91}, {91, 92}, {92, 93}, {92, 93}, {93, 94}, {94, 95}, {95, 96}, {95, 96}, {96, 97}, {97, 98}, {97, 99}, {98, 99}, {99, 100}, {99, 101}, {100, 101}, {101, 102}, {102, 103}, {102, 104}, {103, 104}, {104, 105}, {104, 106}, {105, 106}, {106, 107}, {106, 108}, {107, 109}, {108, 109},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {67, 68}, {68, 68}, {69, 69}, {69, 70}, {70, 71}, {71, 71}, {72, 72}, {72, 73}, {73, 74}, {74, 74}, {74, 75}, {75, 76}, {76, 76}, {76, 77}, {77, 78}, {78, 79}, {78, 79}, {79, 80}, {80, 81}, {80, 82}, {81, 82}, {82, 83}, {82, 84}, {83, 84}, {84, 85}, {84, 86}, {85, 87}, {86, 87}, {87, 88}, {87, 89}, {88, 90}, {89, 90}, {89, 91}, {90, 92}, {91, 93}, {91, 93}, {92, 94}, {93, 95}, {93, 95}, {94, 96}, {95, 97}, {95, 98}, {96, 98}, {97, 99}, {97, 100}, {98, 101}, {99, 101}, {99, 102}, {100, 103}, {101, 103}, {102, 104}, {102, 105}, {103, 106}, {104, 106}, {104, 107}, {105, 108}, {106, 109}, {106, 109}, {107, 110},  },
-  { {64, 64}, {65, 65}, {65, 65}, {66, 66}, {67, 67}, {67, 68}, {68, 68}, {69, 69}, {69, 70}, {70, 71}, {71, 71}, {71, 72}, {72, 73}, {73, 74}, {73, 74}, {74, 75}, {75, 76}, {75, 77}, {76, 77}, {77, 78}, {77, 79}, {78, 80}, {79, 80}, {79, 81}, {80, 82}, {81, 83}, {81, 83}, {82, 84}, {83, 85}, {83, 86}, {84, 86}, {85, 87}, {85, 88}, {86, 89}, {87, 89}, {87, 90}, {88, 91}, {89, 91}, {89, 92}, {90, 93}, {91, 94}, {91, 94}, {92, 95}, {93, 96}, {93, 97}, {94, 97}, {95, 98}, {95, 99}, {96, 100}, {97, 100}, {97, 101}, {98, 102}, {99, 103}, {99, 103}, {100, 104}, {101, 105}, {101, 106}, {102, 106}, {103, 107}, {103, 108}, {104, 109}, {105, 109}, {105, 110}, {106, 111},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {67, 67}, {67, 68}, {68, 69}, {69, 69}, {69, 70}, {70, 71}, {71, 72}, {71, 72}, {72, 73}, {73, 74}, {73, 75}, {74, 75}, {74, 76}, {75, 77}, {76, 78}, {76, 78}, {77, 79}, {78, 80}, {78, 81}, {79, 81}, {80, 82}, {80, 83}, {81, 84}, {82, 84}, {82, 85}, {83, 86}, {84, 87}, {84, 87}, {85, 88}, {86, 89}, {86, 90}, {87, 90}, {88, 91}, {88, 92}, {89, 93}, {90, 93}, {90, 94}, {91, 95}, {92, 96}, {92, 96}, {93, 97}, {94, 98}, {94, 99}, {95, 99}, {95, 100}, {96, 101}, {97, 102}, {97, 102}, {98, 103}, {99, 104}, {99, 105}, {100, 106}, {101, 106}, {101, 107}, {102, 108}, {103, 109}, {103, 109}, {104, 110}, {105, 111}, {105, 112},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {67, 67}, {67, 68}, {68, 69}, {68, 69}, {69, 70}, {70, 71}, {70, 72}, {71, 72}, {72, 73}, {72, 74}, {73, 75}, {74, 75}, {74, 76}, {75, 77}, {76, 78}, {76, 79}, {77, 79}, {77, 80}, {78, 81}, {79, 82}, {79, 82}, {80, 83}, {81, 84}, {81, 85}, {82, 85}, {83, 86}, {83, 87}, {84, 88}, {85, 89}, {85, 89}, {86, 90}, {86, 91}, {87, 92}, {88, 92}, {88, 93}, {89, 94}, {90, 95}, {90, 95}, {91, 96}, {92, 97}, {92, 98}, {93, 98}, {94, 99}, {94, 100}, {95, 101}, {95, 102}, {96, 102}, {97, 103}, {97, 104}, {98, 105}, {99, 105}, {99, 106}, {100, 107}, {101, 108}, {101, 108}, {102, 109}, {103, 110}, {103, 111}, {104, 111}, {104, 112},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {67, 67}, {67, 68}, {68, 69}, {68, 69}, {69, 70}, {70, 71}, {70, 72}, {71, 73}, {72, 73}, {72, 74}, {73, 75}, {73, 76}, {74, 76}, {75, 77}, {75, 78}, {76, 79}, {77, 80}, {77, 80}, {78, 81}, {78, 82}, {79, 83}, {80, 83}, {80, 84}, {81, 85}, {82, 86}, {82, 87}, {83, 87}, {84, 88}, {84, 89}, {85, 90}, {85, 90}, {86, 91}, {87, 92}, {87, 93}, {88, 94}, {89, 94}, {89, 95}, {90, 96}, {90, 97}, {91, 97}, {92, 98}, {92, 99}, {93, 100}, {94, 101}, {94, 101}, {95, 102}, {95, 103}, {96, 104}, {97, 104}, {97, 105}, {98, 106}, {99, 107}, {99, 108}, {100, 108}, {101, 109}, {101, 110}, {102, 111}, {102, 111}, {103, 112}, {104, 113},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {66, 67}, {67, 68}, {68, 69}, {68, 70}, {69, 70}, {70, 71}, {70, 72}, {71, 73}, {71, 73}, {72, 74}, {73, 75}, {73, 76}, {74, 77}, {74, 77}, {75, 78}, {76, 79}, {76, 80}, {77, 81}, {78, 81}, {78, 82}, {79, 83}, {79, 84}, {80, 84}, {81, 85}, {81, 86}, {82, 87}, {82, 88}, {83, 88}, {84, 89}, {84, 90}, {85, 91}, {86, 92}, {86, 92}, {87, 93}, {87, 94}, {88, 95}, {89, 96}, {89, 96}, {90, 97}, {90, 98}, {91, 99}, {92, 99}, {92, 100}, {93, 101}, {94, 102}, {94, 103}, {95, 103}, {95, 104}, {96, 105}, {97, 106}, {97, 107}, {98, 107}, {98, 108}, {99, 109}, {100, 110}, {100, 110}, {101, 111}, {102, 112}, {102, 113}, {103, 114},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {66, 67}, {67, 68}, {68, 69}, {68, 70}, {69, 70}, {69, 71}, {70, 72}, {71, 73}, {71, 74}, {72, 74}, {72, 75}, {73, 76}, {74, 77}, {74, 78}, {75, 78}, {75, 79}, {76, 80}, {77, 81}, {77, 82}, {78, 82}, {78, 83}, {79, 84}, {80, 85}, {80, 86}, {81, 86}, {81, 87}, {82, 88}, {83, 89}, {83, 90}, {84, 90}, {84, 91}, {85, 92}, {86, 93}, {86, 94}, {87, 94}, {87, 95}, {88, 96}, {89, 97}, {89, 98}, {90, 98}, {90, 99}, {91, 100}, {92, 101}, {92, 102}, {93, 102}, {93, 103}, {94, 104}, {95, 105}, {95, 106}, {96, 106}, {96, 107}, {97, 108}, {98, 109}, {98, 110}, {99, 110}, {100, 111}, {100, 112}, {101, 113}, {101, 114}, {102, 114},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {66, 67}, {67, 68}, {68, 69}, {68, 70}, {69, 70}, {69, 71}, {70, 72}, {70, 73}, {71, 74}, {72, 75}, {72, 75}, {73, 76}, {73, 77}, {74, 78}, {75, 79}, {75, 79}, {76, 80}, {76, 81}, {77, 82}, {78, 83}, {78, 83}, {79, 84}, {79, 85}, {80, 86}, {80, 87}, {81, 87}, {82, 88}, {82, 89}, {83, 90}, {83, 91}, {84, 92}, {85, 92}, {85, 93}, {86, 94}, {86, 95}, {87, 96}, {88, 96}, {88, 97}, {89, 98}, {89, 99}, {90, 100}, {90, 100}, {91, 101}, {92, 102}, {92, 103}, {93, 104}, {93, 104}, {94, 105}, {95, 106}, {95, 107}, {96, 108}, {96, 108}, {97, 109}, {98, 110}, {98, 111}, {99, 112}, {99, 113}, {100, 113}, {100, 114}, {101, 115},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {69, 71}, {69, 71}, {70, 72}, {70, 73}, {71, 74}, {71, 75}, {72, 75}, {73, 76}, {73, 77}, {74, 78}, {74, 79}, {75, 80}, {75, 80}, {76, 81}, {77, 82}, {77, 83}, {78, 84}, {78, 84}, {79, 85}, {79, 86}, {80, 87}, {81, 88}, {81, 89}, {82, 89}, {82, 90}, {83, 91}, {84, 92}, {84, 93}, {85, 93}, {85, 94}, {86, 95}, {86, 96}, {87, 97}, {88, 98}, {88, 98}, {89, 99}, {89, 100}, {90, 101}, {90, 102}, {91, 103}, {92, 103}, {92, 104}, {93, 105}, {93, 106}, {94, 107}, {94, 107}, {95, 108}, {96, 109}, {96, 110}, {97, 111}, {97, 112}, {98, 112}, {98, 113}, {99, 114}, {100, 115}, {100, 116},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 66}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {68, 71}, {69, 71}, {70, 72}, {70, 73}, {71, 74}, {71, 75}, {72, 76}, {72, 76}, {73, 77}, {74, 78}, {74, 79}, {75, 80}, {75, 81}, {76, 81}, {76, 82}, {77, 83}, {77, 84}, {78, 85}, {79, 86}, {79, 86}, {80, 87}, {80, 88}, {81, 89}, {81, 90}, {82, 91}, {82, 91}, {83, 92}, {84, 93}, {84, 94}, {85, 95}, {85, 96}, {86, 96}, {86, 97}, {87, 98}, {87, 99}, {88, 100}, {89, 100}, {89, 101}, {90, 102}, {90, 103}, {91, 104}, {91, 105}, {92, 105}, {93, 106}, {93, 107}, {94, 108}, {94, 109}, {95, 110}, {95, 110}, {96, 111}, {96, 112}, {97, 113}, {98, 114}, {98, 115}, {99, 115}, {99, 116},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 67}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {68, 71}, {69, 72}, {69, 72}, {70, 73}, {71, 74}, {71, 75}, {72, 76}, {72, 77}, {73, 77}, {73, 78}, {74, 79}, {74, 80}, {75, 81}, {75, 82}, {76, 82}, {77, 83}, {77, 84}, {78, 85}, {78, 86}, {79, 87}, {79, 87}, {80, 88}, {80, 89}, {81, 90}, {81, 91}, {82, 92}, {83, 93}, {83, 93}, {84, 94}, {84, 95}, {85, 96}, {85, 97}, {86, 98}, {86, 98}, {87, 99}, {87, 100}, {88, 101}, {89, 102}, {89, 103}, {90, 103}, {90, 104}, {91, 105}, {91, 106}, {92, 107}, {92, 108}, {93, 108}, {93, 109}, {94, 110}, {94, 111}, {95, 112}, {96, 113}, {96, 113}, {97, 114}, {97, 115}, {98, 116}, {98, 117},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 67}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {68, 71}, {69, 72}, {69, 72}, {70, 73}, {70, 74}, {71, 75}, {71, 76}, {72, 77}, {72, 78}, {73, 78}, {74, 79}, {74, 80}, {75, 81}, {75, 82}, {76, 83}, {76, 84}, {77, 84}, {77, 85}, {78, 86}, {78, 87}, {79, 88}, {79, 89}, {80, 89}, {80, 90}, {81, 91}, {81, 92}, {82, 93}, {83, 94}, {83, 95}, {84, 95}, {84, 96}, {85, 97}, {85, 98}, {86, 99}, {86, 100}, {87, 100}, {87, 101}, {88, 102}, {88, 103}, {89, 104}, {89, 105}, {90, 106}, {90, 106}, {91, 107}, {92, 108}, {92, 109}, {93, 110}, {93, 111}, {94, 111}, {94, 112}, {95, 113}, {95, 114}, {96, 115}, {96, 116}, {97, 117}, {97, 117},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 67}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {68, 71}, {69, 72}, {69, 73}, {70, 73}, {70, 74}, {71, 75}, {71, 76}, {72, 77}, {72, 78}, {73, 79}, {73, 79}, {74, 80}, {74, 81}, {75, 82}, {75, 83}, {76, 84}, {76, 85}, {77, 85}, {77, 86}, {78, 87}, {78, 88}, {79, 89}, {79, 90}, {80, 91}, {80, 91}, {81, 92}, {82, 93}, {82, 94}, {83, 95}, {83, 96}, {84, 97}, {84, 97}, {85, 98}, {85, 99}, {86, 100}, {86, 101}, {87, 102}, {87, 103}, {88, 103}, {88, 104}, {89, 105}, {89, 106}, {90, 107}, {90, 108}, {91, 109}, {91, 109}, {92, 110}, {92, 111}, {93, 112}, {93, 113}, {94, 114}, {94, 115}, {95, 115}, {95, 116}, {96, 117}, {96, 118},  },
-  { {64, 64}, {65, 65}, {65, 66}, {66, 67}, {66, 67}, {67, 68}, {67, 69}, {68, 70}, {68, 71}, {69, 72}, {69, 73}, {70, 74}, {70, 74}, {71, 75}, {71, 76}, {72, 77}, {72, 78}, {73, 79}, {73, 80}, {74, 80}, {74, 81}, {75, 82}, {75, 83}, {76, 84}, {76, 85}, {77, 86}, {77, 87}, {78, 87}, {78, 88}, {79, 89}, {79, 90}, {80, 91}, {80, 92}, {81, 93}, {81, 93}, {82, 94}, {82, 95}, {83, 96}, {83, 97}, {84, 98}, {84, 99}, {85, 100}, {85, 100}, {86, 101}, {86, 102}, {87, 103}, {87, 104}, {88, 105}, {88, 106}, {89, 106}, {89, 107}, {90, 108}, {90, 109}, {91, 110}, {91, 111}, {92, 112}, {92, 112}, {93, 113}, {93, 114}, {94, 115}, {94, 116}, {95, 117}, {95, 118}, {96, 119},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 67}, {66, 68}, {67, 69}, {67, 70}, {68, 71}, {68, 72}, {69, 73}, {69, 74}, {70, 74}, {70, 75}, {71, 76}, {71, 77}, {72, 78}, {72, 79}, {73, 80}, {73, 81}, {74, 81}, {74, 82}, {75, 83}, {75, 84}, {76, 85}, {76, 86}, {77, 87}, {77, 88}, {78, 88}, {78, 89}, {79, 90}, {79, 91}, {80, 92}, {80, 93}, {80, 94}, {81, 95}, {81, 95}, {82, 96}, {82, 97}, {83, 98}, {83, 99}, {84, 100}, {84, 101}, {85, 102}, {85, 102}, {86, 103}, {86, 104}, {87, 105}, {87, 106}, {88, 107}, {88, 108}, {89, 109}, {89, 109}, {90, 110}, {90, 111}, {91, 112}, {91, 113}, {92, 114}, {92, 115}, {93, 116}, {93, 116}, {94, 117}, {94, 118}, {95, 119},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 68}, {67, 69}, {67, 70}, {68, 71}, {68, 72}, {69, 73}, {69, 74}, {70, 75}, {70, 75}, {71, 76}, {71, 77}, {72, 78}, {72, 79}, {72, 80}, {73, 81}, {73, 82}, {74, 83}, {74, 83}, {75, 84}, {75, 85}, {76, 86}, {76, 87}, {77, 88}, {77, 89}, {78, 90}, {78, 90}, {79, 91}, {79, 92}, {79, 93}, {80, 94}, {80, 95}, {81, 96}, {81, 97}, {82, 98}, {82, 98}, {83, 99}, {83, 100}, {84, 101}, {84, 102}, {85, 103}, {85, 104}, {86, 105}, {86, 105}, {87, 106}, {87, 107}, {87, 108}, {88, 109}, {88, 110}, {89, 111}, {89, 112}, {90, 113}, {90, 113}, {91, 114}, {91, 115}, {92, 116}, {92, 117}, {93, 118}, {93, 119}, {94, 120},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 68}, {67, 69}, {67, 70}, {68, 71}, {68, 72}, {69, 73}, {69, 74}, {69, 75}, {70, 76}, {70, 76}, {71, 77}, {71, 78}, {72, 79}, {72, 80}, {73, 81}, {73, 82}, {74, 83}, {74, 84}, {74, 84}, {75, 85}, {75, 86}, {76, 87}, {76, 88}, {77, 89}, {77, 90}, {78, 91}, {78, 92}, {79, 93}, {79, 93}, {79, 94}, {80, 95}, {80, 96}, {81, 97}, {81, 98}, {82, 99}, {82, 100}, {83, 101}, {83, 101}, {84, 102}, {84, 103}, {84, 104}, {85, 105}, {85, 106}, {86, 107}, {86, 108}, {87, 109}, {87, 109}, {88, 110}, {88, 111}, {89, 112}, {89, 113}, {89, 114}, {90, 115}, {90, 116}, {91, 117}, {91, 117}, {92, 118}, {92, 119}, {93, 120},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 68}, {67, 69}, {67, 70}, {68, 71}, {68, 72}, {68, 73}, {69, 74}, {69, 75}, {70, 76}, {70, 77}, {71, 77}, {71, 78}, {71, 79}, {72, 80}, {72, 81}, {73, 82}, {73, 83}, {74, 84}, {74, 85}, {75, 86}, {75, 86}, {75, 87}, {76, 88}, {76, 89}, {77, 90}, {77, 91}, {78, 92}, {78, 93}, {78, 94}, {79, 95}, {79, 95}, {80, 96}, {80, 97}, {81, 98}, {81, 99}, {82, 100}, {82, 101}, {82, 102}, {83, 103}, {83, 104}, {84, 104}, {84, 105}, {85, 106}, {85, 107}, {85, 108}, {86, 109}, {86, 110}, {87, 111}, {87, 112}, {88, 113}, {88, 113}, {89, 114}, {89, 115}, {89, 116}, {90, 117}, {90, 118}, {91, 119}, {91, 120}, {92, 121},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 69}, {67, 69}, {67, 70}, {67, 71}, {68, 72}, {68, 73}, {69, 74}, {69, 75}, {69, 76}, {70, 77}, {70, 78}, {71, 79}, {71, 79}, {72, 80}, {72, 81}, {72, 82}, {73, 83}, {73, 84}, {74, 85}, {74, 86}, {75, 87}, {75, 88}, {75, 88}, {76, 89}, {76, 90}, {77, 91}, {77, 92}, {78, 93}, {78, 94}, {78, 95}, {79, 96}, {79, 97}, {80, 98}, {80, 98}, {80, 99}, {81, 100}, {81, 101}, {82, 102}, {82, 103}, {83, 104}, {83, 105}, {83, 106}, {84, 107}, {84, 108}, {85, 108}, {85, 109}, {86, 110}, {86, 111}, {86, 112}, {87, 113}, {87, 114}, {88, 115}, {88, 116}, {89, 117}, {89, 117}, {89, 118}, {90, 119}, {90, 120}, {91, 121},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 69}, {66, 69}, {67, 70}, {67, 71}, {68, 72}, {68, 73}, {68, 74}, {69, 75}, {69, 76}, {70, 77}, {70, 78}, {71, 79}, {71, 80}, {71, 80}, {72, 81}, {72, 82}, {73, 83}, {73, 84}, {73, 85}, {74, 86}, {74, 87}, {75, 88}, {75, 89}, {75, 90}, {76, 90}, {76, 91}, {77, 92}, {77, 93}, {77, 94}, {78, 95}, {78, 96}, {79, 97}, {79, 98}, {79, 99}, {80, 100}, {80, 101}, {81, 101}, {81, 102}, {81, 103}, {82, 104}, {82, 105}, {83, 106}, {83, 107}, {84, 108}, {84, 109}, {84, 110}, {85, 111}, {85, 112}, {86, 112}, {86, 113}, {86, 114}, {87, 115}, {87, 116}, {88, 117}, {88, 118}, {88, 119}, {89, 120}, {89, 121}, {90, 122},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {66, 68}, {66, 69}, {66, 70}, {67, 70}, {67, 71}, {68, 72}, {68, 73}, {68, 74}, {69, 75}, {69, 76}, {69, 77}, {70, 78}, {70, 79}, {71, 80}, {71, 81}, {71, 81}, {72, 82}, {72, 83}, {73, 84}, {73, 85}, {73, 86}, {74, 87}, {74, 88}, {75, 89}, {75, 90}, {75, 91}, {76, 92}, {76, 93}, {77, 93}, {77, 94}, {77, 95}, {78, 96}, {78, 97}, {78, 98}, {79, 99}, {79, 100}, {80, 101}, {80, 102}, {80, 103}, {81, 104}, {81, 105}, {82, 105}, {82, 106}, {82, 107}, {83, 108}, {83, 109}, {84, 110}, {84, 111}, {84, 112}, {85, 113}, {85, 114}, {85, 115}, {86, 116}, {86, 116}, {87, 117}, {87, 118}, {87, 119}, {88, 120}, {88, 121}, {89, 122},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {66, 69}, {66, 70}, {67, 70}, {67, 71}, {67, 72}, {68, 73}, {68, 74}, {68, 75}, {69, 76}, {69, 77}, {70, 78}, {70, 79}, {70, 80}, {71, 81}, {71, 82}, {71, 83}, {72, 83}, {72, 84}, {73, 85}, {73, 86}, {73, 87}, {74, 88}, {74, 89}, {74, 90}, {75, 91}, {75, 92}, {76, 93}, {76, 94}, {76, 95}, {77, 96}, {77, 96}, {77, 97}, {78, 98}, {78, 99}, {79, 100}, {79, 101}, {79, 102}, {80, 103}, {80, 104}, {80, 105}, {81, 106}, {81, 107}, {82, 108}, {82, 109}, {82, 109}, {83, 110}, {83, 111}, {83, 112}, {84, 113}, {84, 114}, {85, 115}, {85, 116}, {85, 117}, {86, 118}, {86, 119}, {86, 120}, {87, 121}, {87, 121}, {88, 122},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {66, 69}, {66, 70}, {67, 71}, {67, 71}, {67, 72}, {68, 73}, {68, 74}, {68, 75}, {69, 76}, {69, 77}, {69, 78}, {70, 79}, {70, 80}, {70, 81}, {71, 82}, {71, 83}, {72, 84}, {72, 85}, {72, 85}, {73, 86}, {73, 87}, {73, 88}, {74, 89}, {74, 90}, {74, 91}, {75, 92}, {75, 93}, {75, 94}, {76, 95}, {76, 96}, {77, 97}, {77, 98}, {77, 99}, {78, 99}, {78, 100}, {78, 101}, {79, 102}, {79, 103}, {79, 104}, {80, 105}, {80, 106}, {80, 107}, {81, 108}, {81, 109}, {82, 110}, {82, 111}, {82, 112}, {83, 113}, {83, 113}, {83, 114}, {84, 115}, {84, 116}, {84, 117}, {85, 118}, {85, 119}, {86, 120}, {86, 121}, {86, 122}, {87, 123},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {66, 69}, {66, 70}, {66, 71}, {67, 72}, {67, 72}, {67, 73}, {68, 74}, {68, 75}, {68, 76}, {69, 77}, {69, 78}, {69, 79}, {70, 80}, {70, 81}, {70, 82}, {71, 83}, {71, 84}, {72, 85}, {72, 86}, {72, 87}, {73, 87}, {73, 88}, {73, 89}, {74, 90}, {74, 91}, {74, 92}, {75, 93}, {75, 94}, {75, 95}, {76, 96}, {76, 97}, {76, 98}, {77, 99}, {77, 100}, {77, 101}, {78, 102}, {78, 103}, {78, 103}, {79, 104}, {79, 105}, {79, 106}, {80, 107}, {80, 108}, {80, 109}, {81, 110}, {81, 111}, {81, 112}, {82, 113}, {82, 114}, {82, 115}, {83, 116}, {83, 117}, {83, 118}, {84, 119}, {84, 119}, {85, 120}, {85, 121}, {85, 122}, {86, 123},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {66, 69}, {66, 70}, {66, 71}, {67, 72}, {67, 73}, {67, 73}, {68, 74}, {68, 75}, {68, 76}, {69, 77}, {69, 78}, {69, 79}, {70, 80}, {70, 81}, {70, 82}, {71, 83}, {71, 84}, {71, 85}, {71, 86}, {72, 87}, {72, 88}, {72, 89}, {73, 90}, {73, 90}, {73, 91}, {74, 92}, {74, 93}, {74, 94}, {75, 95}, {75, 96}, {75, 97}, {76, 98}, {76, 99}, {76, 100}, {77, 101}, {77, 102}, {77, 103}, {78, 104}, {78, 105}, {78, 106}, {79, 107}, {79, 107}, {79, 108}, {80, 109}, {80, 110}, {80, 111}, {81, 112}, {81, 113}, {81, 114}, {82, 115}, {82, 116}, {82, 117}, {83, 118}, {83, 119}, {83, 120}, {84, 121}, {84, 122}, {84, 123}, {85, 124},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {66, 69}, {66, 70}, {66, 71}, {66, 72}, {67, 73}, {67, 74}, {67, 74}, {68, 75}, {68, 76}, {68, 77}, {69, 78}, {69, 79}, {69, 80}, {70, 81}, {70, 82}, {70, 83}, {70, 84}, {71, 85}, {71, 86}, {71, 87}, {72, 88}, {72, 89}, {72, 90}, {73, 91}, {73, 92}, {73, 93}, {74, 93}, {74, 94}, {74, 95}, {75, 96}, {75, 97}, {75, 98}, {75, 99}, {76, 100}, {76, 101}, {76, 102}, {77, 103}, {77, 104}, {77, 105}, {78, 106}, {78, 107}, {78, 108}, {79, 109}, {79, 110}, {79, 111}, {79, 112}, {80, 113}, {80, 113}, {80, 114}, {81, 115}, {81, 116}, {81, 117}, {82, 118}, {82, 119}, {82, 120}, {83, 121}, {83, 122}, {83, 123}, {83, 124},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {65, 69}, {66, 70}, {66, 71}, {66, 72}, {67, 73}, {67, 74}, {67, 75}, {68, 75}, {68, 76}, {68, 77}, {68, 78}, {69, 79}, {69, 80}, {69, 81}, {70, 82}, {70, 83}, {70, 84}, {70, 85}, {71, 86}, {71, 87}, {71, 88}, {72, 89}, {72, 90}, {72, 91}, {72, 92}, {73, 93}, {73, 94}, {73, 95}, {74, 96}, {74, 97}, {74, 97}, {75, 98}, {75, 99}, {75, 100}, {75, 101}, {76, 102}, {76, 103}, {76, 104}, {77, 105}, {77, 106}, {77, 107}, {77, 108}, {78, 109}, {78, 110}, {78, 111}, {79, 112}, {79, 113}, {79, 114}, {79, 115}, {80, 116}, {80, 117}, {80, 118}, {81, 119}, {81, 119}, {81, 120}, {82, 121}, {82, 122}, {82, 123}, {82, 124},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {65, 69}, {66, 70}, {66, 71}, {66, 72}, {66, 73}, {67, 74}, {67, 75}, {67, 76}, {68, 76}, {68, 77}, {68, 78}, {68, 79}, {69, 80}, {69, 81}, {69, 82}, {70, 83}, {70, 84}, {70, 85}, {70, 86}, {71, 87}, {71, 88}, {71, 89}, {71, 90}, {72, 91}, {72, 92}, {72, 93}, {73, 94}, {73, 95}, {73, 96}, {73, 97}, {74, 98}, {74, 99}, {74, 100}, {74, 101}, {75, 101}, {75, 102}, {75, 103}, {76, 104}, {76, 105}, {76, 106}, {76, 107}, {77, 108}, {77, 109}, {77, 110}, {78, 111}, {78, 112}, {78, 113}, {78, 114}, {79, 115}, {79, 116}, {79, 117}, {79, 118}, {80, 119}, {80, 120}, {80, 121}, {81, 122}, {81, 123}, {81, 124}, {81, 125},  },
-  { {64, 64}, {64, 65}, {65, 66}, {65, 67}, {65, 68}, {65, 69}, {66, 70}, {66, 71}, {66, 72}, {66, 73}, {67, 74}, {67, 75}, {67, 76}, {67, 77}, {68, 78}, {68, 78}, {68, 79}, {68, 80}, {69, 81}, {69, 82}, {69, 83}, {69, 84}, {70, 85}, {70, 86}, {70, 87}, {70, 88}, {71, 89}, {71, 90}, {71, 91}, {72, 92}, {72, 93}, {72, 94}, {72, 95}, {73, 96}, {73, 97}, {73, 98}, {73, 99}, {74, 100}, {74, 101}, {74, 102}, {74, 103}, {75, 104}, {75, 105}, {75, 106}, {75, 107}, {76, 107}, {76, 108}, {76, 109}, {76, 110}, {77, 111}, {77, 112}, {77, 113}, {77, 114}, {78, 115}, {78, 116}, {78, 117}, {78, 118}, {79, 119}, {79, 120}, {79, 121}, {80, 122}, {80, 123}, {80, 124}, {80, 125},  },
-  { {64, 64}, {64, 65}, {64, 66}, {65, 67}, {65, 68}, {65, 69}, {65, 70}, {66, 71}, {66, 72}, {66, 73}, {66, 74}, {67, 75}, {67, 76}, {67, 77}, {67, 78}, {68, 79}, {68, 80}, {68, 80}, {68, 81}, {69, 82}, {69, 83}, {69, 84}, {69, 85}, {70, 86}, {70, 87}, {70, 88}, {70, 89}, {71, 90}, {71, 91}, {71, 92}, {71, 93}, {71, 94}, {72, 95}, {72, 96}, {72, 97}, {72, 98}, {73, 99}, {73, 100}, {73, 101}, {73, 102}, {74, 103}, {74, 104}, {74, 105}, {74, 106}, {75, 107}, {75, 108}, {75, 109}, {75, 110}, {76, 111}, {76, 112}, {76, 113}, {76, 113}, {77, 114}, {77, 115}, {77, 116}, {77, 117}, {78, 118}, {78, 119}, {78, 120}, {78, 121}, {79, 122}, {79, 123}, {79, 124}, {79, 125},  },
-  { {64, 64}, {64, 65}, {64, 66}, {65, 67}, {65, 68}, {65, 69}, {65, 70}, {66, 71}, {66, 72}, {66, 73}, {66, 74}, {66, 75}, {67, 76}, {67, 77}, {67, 78}, {67, 79}, {68, 80}, {68, 81}, {68, 82}, {68, 83}, {68, 83}, {69, 84}, {69, 85}, {69, 86}, {69, 87}, {70, 88}, {70, 89}, {70, 90}, {70, 91}, {71, 92}, {71, 93}, {71, 94}, {71, 95}, {71, 96}, {72, 97}, {72, 98}, {72, 99}, {72, 100}, {73, 101}, {73, 102}, {73, 103}, {73, 104}, {73, 105}, {74, 106}, {74, 107}, {74, 108}, {74, 109}, {75, 110}, {75, 111}, {75, 112}, {75, 113}, {75, 114}, {76, 115}, {76, 116}, {76, 117}, {76, 118}, {77, 119}, {77, 120}, {77, 121}, {77, 121}, {77, 122}, {78, 123}, {78, 124}, {78, 125},  },
-  { {64, 64}, {64, 65}, {64, 66}, {65, 67}, {65, 68}, {65, 69}, {65, 70}, {65, 71}, {66, 72}, {66, 73}, {66, 74}, {66, 75}, {66, 76}, {67, 77}, {67, 78}, {67, 79}, {67, 80}, {68, 81}, {68, 82}, {68, 83}, {68, 84}, {68, 85}, {69, 86}, {69, 86}, {69, 87}, {69, 88}, {69, 89}, {70, 90}, {70, 91}, {70, 92}, {70, 93}, {70, 94}, {71, 95}, {71, 96}, {71, 97}, {71, 98}, {71, 99}, {72, 100}, {72, 101}, {72, 102}, {72, 103}, {73, 104}, {73, 105}, {73, 106}, {73, 107}, {73, 108}, {74, 109}, {74, 110}, {74, 111}, {74, 112}, {74, 113}, {75, 114}, {75, 115}, {75, 116}, {75, 117}, {75, 118}, {76, 119}, {76, 120}, {76, 121}, {76, 122}, {76, 123}, {77, 124}, {77, 125}, {77, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {65, 67}, {65, 68}, {65, 69}, {65, 70}, {65, 71}, {66, 72}, {66, 73}, {66, 74}, {66, 75}, {66, 76}, {66, 77}, {67, 78}, {67, 79}, {67, 80}, {67, 81}, {67, 82}, {68, 83}, {68, 84}, {68, 85}, {68, 86}, {68, 87}, {69, 88}, {69, 89}, {69, 90}, {69, 91}, {69, 91}, {70, 92}, {70, 93}, {70, 94}, {70, 95}, {70, 96}, {70, 97}, {71, 98}, {71, 99}, {71, 100}, {71, 101}, {71, 102}, {72, 103}, {72, 104}, {72, 105}, {72, 106}, {72, 107}, {73, 108}, {73, 109}, {73, 110}, {73, 111}, {73, 112}, {74, 113}, {74, 114}, {74, 115}, {74, 116}, {74, 117}, {74, 118}, {75, 119}, {75, 120}, {75, 121}, {75, 122}, {75, 123}, {76, 124}, {76, 125}, {76, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {65, 67}, {65, 68}, {65, 69}, {65, 70}, {65, 71}, {65, 72}, {66, 73}, {66, 74}, {66, 75}, {66, 76}, {66, 77}, {66, 78}, {67, 79}, {67, 80}, {67, 81}, {67, 82}, {67, 83}, {67, 84}, {68, 85}, {68, 86}, {68, 87}, {68, 88}, {68, 89}, {69, 90}, {69, 91}, {69, 92}, {69, 93}, {69, 94}, {69, 95}, {70, 96}, {70, 96}, {70, 97}, {70, 98}, {70, 99}, {70, 100}, {71, 101}, {71, 102}, {71, 103}, {71, 104}, {71, 105}, {71, 106}, {72, 107}, {72, 108}, {72, 109}, {72, 110}, {72, 111}, {73, 112}, {73, 113}, {73, 114}, {73, 115}, {73, 116}, {73, 117}, {74, 118}, {74, 119}, {74, 120}, {74, 121}, {74, 122}, {74, 123}, {75, 124}, {75, 125}, {75, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {65, 68}, {65, 69}, {65, 70}, {65, 71}, {65, 72}, {65, 73}, {66, 74}, {66, 75}, {66, 76}, {66, 77}, {66, 78}, {66, 79}, {67, 80}, {67, 81}, {67, 82}, {67, 83}, {67, 84}, {67, 85}, {67, 86}, {68, 87}, {68, 88}, {68, 89}, {68, 90}, {68, 91}, {68, 92}, {69, 93}, {69, 94}, {69, 95}, {69, 96}, {69, 97}, {69, 98}, {69, 99}, {70, 100}, {70, 101}, {70, 102}, {70, 103}, {70, 104}, {70, 104}, {71, 105}, {71, 106}, {71, 107}, {71, 108}, {71, 109}, {71, 110}, {72, 111}, {72, 112}, {72, 113}, {72, 114}, {72, 115}, {72, 116}, {72, 117}, {73, 118}, {73, 119}, {73, 120}, {73, 121}, {73, 122}, {73, 123}, {74, 124}, {74, 125}, {74, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {65, 68}, {65, 69}, {65, 70}, {65, 71}, {65, 72}, {65, 73}, {65, 74}, {66, 75}, {66, 76}, {66, 77}, {66, 78}, {66, 79}, {66, 80}, {66, 81}, {67, 82}, {67, 83}, {67, 84}, {67, 85}, {67, 86}, {67, 87}, {67, 88}, {67, 89}, {68, 90}, {68, 91}, {68, 92}, {68, 93}, {68, 94}, {68, 95}, {68, 96}, {69, 97}, {69, 98}, {69, 99}, {69, 100}, {69, 101}, {69, 102}, {69, 103}, {70, 104}, {70, 105}, {70, 106}, {70, 107}, {70, 108}, {70, 109}, {70, 110}, {71, 111}, {71, 112}, {71, 113}, {71, 114}, {71, 115}, {71, 115}, {71, 116}, {72, 117}, {72, 118}, {72, 119}, {72, 120}, {72, 121}, {72, 122}, {72, 123}, {72, 124}, {73, 125}, {73, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {65, 69}, {65, 70}, {65, 71}, {65, 72}, {65, 73}, {65, 74}, {65, 75}, {65, 76}, {66, 77}, {66, 78}, {66, 79}, {66, 80}, {66, 81}, {66, 82}, {66, 83}, {66, 84}, {67, 85}, {67, 86}, {67, 87}, {67, 88}, {67, 89}, {67, 90}, {67, 91}, {67, 92}, {68, 93}, {68, 94}, {68, 95}, {68, 96}, {68, 97}, {68, 98}, {68, 99}, {68, 100}, {69, 101}, {69, 102}, {69, 103}, {69, 104}, {69, 105}, {69, 106}, {69, 107}, {69, 108}, {69, 109}, {70, 110}, {70, 111}, {70, 112}, {70, 113}, {70, 114}, {70, 115}, {70, 116}, {70, 117}, {71, 118}, {71, 119}, {71, 120}, {71, 121}, {71, 122}, {71, 123}, {71, 124}, {71, 125}, {72, 126}, {72, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {65, 69}, {65, 70}, {65, 71}, {65, 72}, {65, 73}, {65, 74}, {65, 75}, {65, 76}, {65, 77}, {65, 78}, {66, 79}, {66, 80}, {66, 81}, {66, 82}, {66, 83}, {66, 84}, {66, 85}, {66, 86}, {66, 87}, {67, 88}, {67, 89}, {67, 90}, {67, 91}, {67, 92}, {67, 93}, {67, 94}, {67, 95}, {67, 96}, {67, 97}, {68, 98}, {68, 99}, {68, 100}, {68, 101}, {68, 102}, {68, 103}, {68, 104}, {68, 105}, {68, 106}, {68, 107}, {69, 108}, {69, 109}, {69, 110}, {69, 111}, {69, 112}, {69, 113}, {69, 114}, {69, 115}, {69, 116}, {70, 117}, {70, 118}, {70, 119}, {70, 120}, {70, 121}, {70, 122}, {70, 123}, {70, 124}, {70, 125}, {70, 126}, {71, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {65, 70}, {65, 71}, {65, 72}, {65, 73}, {65, 74}, {65, 75}, {65, 76}, {65, 77}, {65, 78}, {65, 79}, {65, 80}, {65, 81}, {66, 82}, {66, 83}, {66, 84}, {66, 85}, {66, 86}, {66, 87}, {66, 88}, {66, 89}, {66, 90}, {66, 91}, {66, 92}, {67, 93}, {67, 94}, {67, 95}, {67, 96}, {67, 97}, {67, 98}, {67, 99}, {67, 100}, {67, 101}, {67, 102}, {67, 103}, {67, 104}, {68, 105}, {68, 106}, {68, 107}, {68, 108}, {68, 109}, {68, 110}, {68, 111}, {68, 112}, {68, 113}, {68, 114}, {68, 115}, {69, 116}, {69, 117}, {69, 118}, {69, 119}, {69, 120}, {69, 121}, {69, 122}, {69, 123}, {69, 124}, {69, 125}, {69, 126}, {69, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {65, 72}, {65, 73}, {65, 74}, {65, 75}, {65, 76}, {65, 77}, {65, 78}, {65, 79}, {65, 80}, {65, 81}, {65, 82}, {65, 83}, {65, 84}, {65, 85}, {66, 86}, {66, 87}, {66, 88}, {66, 89}, {66, 90}, {66, 91}, {66, 92}, {66, 93}, {66, 94}, {66, 95}, {66, 96}, {66, 97}, {66, 98}, {66, 99}, {67, 100}, {67, 101}, {67, 102}, {67, 103}, {67, 104}, {67, 105}, {67, 106}, {67, 107}, {67, 108}, {67, 109}, {67, 110}, {67, 111}, {67, 112}, {67, 113}, {67, 114}, {68, 115}, {68, 116}, {68, 117}, {68, 118}, {68, 119}, {68, 120}, {68, 121}, {68, 122}, {68, 123}, {68, 124}, {68, 125}, {68, 126}, {68, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {65, 74}, {65, 75}, {65, 76}, {65, 77}, {65, 78}, {65, 79}, {65, 80}, {65, 81}, {65, 82}, {65, 83}, {65, 84}, {65, 85}, {65, 86}, {65, 87}, {65, 88}, {65, 89}, {65, 90}, {65, 91}, {65, 92}, {66, 93}, {66, 94}, {66, 95}, {66, 96}, {66, 97}, {66, 98}, {66, 99}, {66, 100}, {66, 101}, {66, 102}, {66, 103}, {66, 104}, {66, 105}, {66, 106}, {66, 107}, {66, 108}, {66, 109}, {66, 110}, {66, 111}, {67, 112}, {67, 113}, {67, 114}, {67, 115}, {67, 116}, {67, 117}, {67, 118}, {67, 119}, {67, 120}, {67, 121}, {67, 122}, {67, 123}, {67, 124}, {67, 125}, {67, 126}, {67, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {64, 74}, {64, 75}, {64, 76}, {64, 77}, {64, 78}, {65, 79}, {65, 80}, {65, 81}, {65, 82}, {65, 83}, {65, 84}, {65, 85}, {65, 86}, {65, 87}, {65, 88}, {65, 89}, {65, 90}, {65, 91}, {65, 92}, {65, 93}, {65, 94}, {65, 95}, {65, 96}, {65, 97}, {65, 98}, {65, 99}, {65, 100}, {65, 101}, {65, 102}, {65, 103}, {65, 104}, {65, 105}, {65, 106}, {66, 107}, {66, 108}, {66, 109}, {66, 110}, {66, 111}, {66, 112}, {66, 113}, {66, 114}, {66, 115}, {66, 116}, {66, 117}, {66, 118}, {66, 119}, {66, 120}, {66, 121}, {66, 122}, {66, 123}, {66, 124}, {66, 125}, {66, 126}, {66, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {64, 74}, {64, 75}, {64, 76}, {64, 77}, {64, 78}, {64, 79}, {64, 80}, {64, 81}, {64, 82}, {64, 83}, {64, 84}, {64, 85}, {64, 86}, {64, 87}, {64, 88}, {64, 89}, {64, 90}, {64, 91}, {64, 92}, {65, 93}, {65, 94}, {65, 95}, {65, 96}, {65, 97}, {65, 98}, {65, 99}, {65, 100}, {65, 101}, {65, 102}, {65, 103}, {65, 104}, {65, 105}, {65, 106}, {65, 107}, {65, 108}, {65, 109}, {65, 110}, {65, 111}, {65, 112}, {65, 113}, {65, 114}, {65, 115}, {65, 116}, {65, 117}, {65, 118}, {65, 119}, {65, 120}, {65, 121}, {65, 122}, {65, 123}, {65, 124}, {65, 125}, {65, 126}, {65, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {64, 74}, {64, 75}, {64, 76}, {64, 77}, {64, 78}, {64, 79}, {64, 80}, {64, 81}, {64, 82}, {64, 83}, {64, 84}, {64, 85}, {64, 86}, {64, 87}, {64, 88}, {64, 89}, {64, 90}, {64, 91}, {64, 92}, {64, 93}, {64, 94}, {64, 95}, {64, 96}, {64, 97}, {64, 98}, {64, 99}, {64, 100}, {64, 101}, {64, 102}, {64, 103}, {64, 104}, {64, 105}, {64, 106}, {64, 107}, {64, 108}, {64, 109}, {64, 110}, {64, 111}, {64, 112}, {64, 113}, {64, 114}, {64, 115}, {64, 116}, {64, 117}, {64, 118}, {64, 119}, {64, 120}, {64, 121}, {64, 122}, {64, 123}, {64, 124}, {64, 125}, {64, 126}, {64, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {64, 74}, {64, 75}, {64, 76}, {64, 77}, {64, 78}, {64, 79}, {64, 80}, {64, 81}, {64, 82}, {64, 83}, {64, 84}, {64, 85}, {64, 86}, {64, 87}, {64, 88}, {64, 89}, {64, 90}, {64, 91}, {64, 92}, {63, 93}, {63, 94}, {63, 95}, {63, 96}, {63, 97}, {63, 98}, {63, 99}, {63, 100}, {63, 101}, {63, 102}, {63, 103}, {63, 104}, {63, 105}, {63, 106}, {63, 107}, {63, 108}, {63, 109}, {63, 110}, {63, 111}, {63, 112}, {63, 113}, {63, 114}, {63, 115}, {63, 116}, {63, 117}, {63, 118}, {63, 119}, {63, 120}, {63, 121}, {63, 122}, {63, 123}, {63, 124}, {63, 125}, {63, 126}, {63, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {64, 74}, {64, 75}, {64, 76}, {64, 77}, {64, 78}, {63, 79}, {63, 80}, {63, 81}, {63, 82}, {63, 83}, {63, 84}, {63, 85}, {63, 86}, {63, 87}, {63, 88}, {63, 89}, {63, 90}, {63, 91}, {63, 92}, {63, 93}, {63, 94}, {63, 95}, {63, 96}, {63, 97}, {63, 98}, {63, 99}, {63, 100}, {63, 101}, {63, 102}, {63, 103}, {63, 104}, {63, 105}, {63, 106}, {62, 107}, {62, 108}, {62, 109}, {62, 110}, {62, 111}, {62, 112}, {62, 113}, {62, 114}, {62, 115}, {62, 116}, {62, 117}, {62, 118}, {62, 119}, {62, 120}, {62, 121}, {62, 122}, {62, 123}, {62, 124}, {62, 125}, {62, 126}, {62, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {64, 72}, {64, 73}, {63, 74}, {63, 75}, {63, 76}, {63, 77}, {63, 78}, {63, 79}, {63, 80}, {63, 81}, {63, 82}, {63, 83}, {63, 84}, {63, 85}, {63, 86}, {63, 87}, {63, 88}, {63, 89}, {63, 90}, {63, 91}, {63, 92}, {62, 93}, {62, 94}, {62, 95}, {62, 96}, {62, 97}, {62, 98}, {62, 99}, {62, 100}, {62, 101}, {62, 102}, {62, 103}, {62, 104}, {62, 105}, {62, 106}, {62, 107}, {62, 108}, {62, 109}, {62, 110}, {62, 111}, {61, 112}, {61, 113}, {61, 114}, {61, 115}, {61, 116}, {61, 117}, {61, 118}, {61, 119}, {61, 120}, {61, 121}, {61, 122}, {61, 123}, {61, 124}, {61, 125}, {61, 126}, {61, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {64, 70}, {64, 71}, {63, 72}, {63, 73}, {63, 74}, {63, 75}, {63, 76}, {63, 77}, {63, 78}, {63, 79}, {63, 80}, {63, 81}, {63, 82}, {63, 83}, {63, 84}, {63, 85}, {62, 86}, {62, 87}, {62, 88}, {62, 89}, {62, 90}, {62, 91}, {62, 92}, {62, 93}, {62, 94}, {62, 95}, {62, 96}, {62, 97}, {62, 98}, {62, 99}, {61, 100}, {61, 101}, {61, 102}, {61, 103}, {61, 104}, {61, 105}, {61, 106}, {61, 107}, {61, 108}, {61, 109}, {61, 110}, {61, 111}, {61, 112}, {61, 113}, {61, 114}, {60, 115}, {60, 116}, {60, 117}, {60, 118}, {60, 119}, {60, 120}, {60, 121}, {60, 122}, {60, 123}, {60, 124}, {60, 125}, {60, 126}, {60, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {64, 69}, {63, 70}, {63, 71}, {63, 72}, {63, 73}, {63, 74}, {63, 75}, {63, 76}, {63, 77}, {63, 78}, {63, 79}, {63, 80}, {63, 81}, {62, 82}, {62, 83}, {62, 84}, {62, 85}, {62, 86}, {62, 87}, {62, 88}, {62, 89}, {62, 90}, {62, 91}, {62, 92}, {61, 93}, {61, 94}, {61, 95}, {61, 96}, {61, 97}, {61, 98}, {61, 99}, {61, 100}, {61, 101}, {61, 102}, {61, 103}, {61, 104}, {60, 105}, {60, 106}, {60, 107}, {60, 108}, {60, 109}, {60, 110}, {60, 111}, {60, 112}, {60, 113}, {60, 114}, {60, 115}, {59, 116}, {59, 117}, {59, 118}, {59, 119}, {59, 120}, {59, 121}, {59, 122}, {59, 123}, {59, 124}, {59, 125}, {59, 126}, {59, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {63, 69}, {63, 70}, {63, 71}, {63, 72}, {63, 73}, {63, 74}, {63, 75}, {63, 76}, {63, 77}, {63, 78}, {62, 79}, {62, 80}, {62, 81}, {62, 82}, {62, 83}, {62, 84}, {62, 85}, {62, 86}, {62, 87}, {61, 88}, {61, 89}, {61, 90}, {61, 91}, {61, 92}, {61, 93}, {61, 94}, {61, 95}, {61, 96}, {61, 97}, {60, 98}, {60, 99}, {60, 100}, {60, 101}, {60, 102}, {60, 103}, {60, 104}, {60, 105}, {60, 106}, {60, 107}, {59, 108}, {59, 109}, {59, 110}, {59, 111}, {59, 112}, {59, 113}, {59, 114}, {59, 115}, {59, 116}, {58, 117}, {58, 118}, {58, 119}, {58, 120}, {58, 121}, {58, 122}, {58, 123}, {58, 124}, {58, 125}, {58, 126}, {57, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {64, 68}, {63, 69}, {63, 70}, {63, 71}, {63, 72}, {63, 73}, {63, 74}, {63, 75}, {63, 76}, {62, 77}, {62, 78}, {62, 79}, {62, 80}, {62, 81}, {62, 82}, {62, 83}, {62, 84}, {61, 85}, {61, 86}, {61, 87}, {61, 88}, {61, 89}, {61, 90}, {61, 91}, {61, 92}, {60, 93}, {60, 94}, {60, 95}, {60, 96}, {60, 97}, {60, 98}, {60, 99}, {60, 100}, {59, 101}, {59, 102}, {59, 103}, {59, 104}, {59, 105}, {59, 106}, {59, 107}, {59, 108}, {59, 109}, {58, 110}, {58, 111}, {58, 112}, {58, 113}, {58, 114}, {58, 115}, {58, 116}, {58, 117}, {57, 118}, {57, 119}, {57, 120}, {57, 121}, {57, 122}, {57, 123}, {57, 124}, {57, 125}, {56, 126}, {56, 127},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {63, 68}, {63, 69}, {63, 70}, {63, 71}, {63, 72}, {63, 73}, {63, 74}, {62, 75}, {62, 76}, {62, 77}, {62, 78}, {62, 79}, {62, 80}, {62, 81}, {61, 82}, {61, 83}, {61, 84}, {61, 85}, {61, 86}, {61, 87}, {61, 88}, {61, 89}, {60, 90}, {60, 91}, {60, 92}, {60, 93}, {60, 94}, {60, 95}, {60, 96}, {59, 97}, {59, 98}, {59, 99}, {59, 100}, {59, 101}, {59, 102}, {59, 103}, {58, 104}, {58, 105}, {58, 106}, {58, 107}, {58, 108}, {58, 109}, {58, 110}, {57, 111}, {57, 112}, {57, 113}, {57, 114}, {57, 115}, {57, 115}, {57, 116}, {56, 117}, {56, 118}, {56, 119}, {56, 120}, {56, 121}, {56, 122}, {56, 123}, {56, 124}, {55, 125}, {55, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {64, 67}, {63, 68}, {63, 69}, {63, 70}, {63, 71}, {63, 72}, {63, 73}, {62, 74}, {62, 75}, {62, 76}, {62, 77}, {62, 78}, {62, 79}, {61, 80}, {61, 81}, {61, 82}, {61, 83}, {61, 84}, {61, 85}, {61, 86}, {60, 87}, {60, 88}, {60, 89}, {60, 90}, {60, 91}, {60, 92}, {59, 93}, {59, 94}, {59, 95}, {59, 96}, {59, 97}, {59, 98}, {59, 99}, {58, 100}, {58, 101}, {58, 102}, {58, 103}, {58, 104}, {58, 104}, {57, 105}, {57, 106}, {57, 107}, {57, 108}, {57, 109}, {57, 110}, {56, 111}, {56, 112}, {56, 113}, {56, 114}, {56, 115}, {56, 116}, {56, 117}, {55, 118}, {55, 119}, {55, 120}, {55, 121}, {55, 122}, {55, 123}, {54, 124}, {54, 125}, {54, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {63, 67}, {63, 68}, {63, 69}, {63, 70}, {63, 71}, {63, 72}, {62, 73}, {62, 74}, {62, 75}, {62, 76}, {62, 77}, {62, 78}, {61, 79}, {61, 80}, {61, 81}, {61, 82}, {61, 83}, {61, 84}, {60, 85}, {60, 86}, {60, 87}, {60, 88}, {60, 89}, {59, 90}, {59, 91}, {59, 92}, {59, 93}, {59, 94}, {59, 95}, {58, 96}, {58, 96}, {58, 97}, {58, 98}, {58, 99}, {58, 100}, {57, 101}, {57, 102}, {57, 103}, {57, 104}, {57, 105}, {57, 106}, {56, 107}, {56, 108}, {56, 109}, {56, 110}, {56, 111}, {55, 112}, {55, 113}, {55, 114}, {55, 115}, {55, 116}, {55, 117}, {54, 118}, {54, 119}, {54, 120}, {54, 121}, {54, 122}, {54, 123}, {53, 124}, {53, 125}, {53, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {63, 67}, {63, 68}, {63, 69}, {63, 70}, {63, 71}, {62, 72}, {62, 73}, {62, 74}, {62, 75}, {62, 76}, {62, 77}, {61, 78}, {61, 79}, {61, 80}, {61, 81}, {61, 82}, {60, 83}, {60, 84}, {60, 85}, {60, 86}, {60, 87}, {59, 88}, {59, 89}, {59, 90}, {59, 91}, {59, 91}, {58, 92}, {58, 93}, {58, 94}, {58, 95}, {58, 96}, {58, 97}, {57, 98}, {57, 99}, {57, 100}, {57, 101}, {57, 102}, {56, 103}, {56, 104}, {56, 105}, {56, 106}, {56, 107}, {55, 108}, {55, 109}, {55, 110}, {55, 111}, {55, 112}, {54, 113}, {54, 114}, {54, 115}, {54, 116}, {54, 117}, {54, 118}, {53, 119}, {53, 120}, {53, 121}, {53, 122}, {53, 123}, {52, 124}, {52, 125}, {52, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {63, 67}, {63, 68}, {63, 69}, {63, 70}, {63, 71}, {62, 72}, {62, 73}, {62, 74}, {62, 75}, {62, 76}, {61, 77}, {61, 78}, {61, 79}, {61, 80}, {60, 81}, {60, 82}, {60, 83}, {60, 84}, {60, 85}, {59, 86}, {59, 86}, {59, 87}, {59, 88}, {59, 89}, {58, 90}, {58, 91}, {58, 92}, {58, 93}, {58, 94}, {57, 95}, {57, 96}, {57, 97}, {57, 98}, {57, 99}, {56, 100}, {56, 101}, {56, 102}, {56, 103}, {55, 104}, {55, 105}, {55, 106}, {55, 107}, {55, 108}, {54, 109}, {54, 110}, {54, 111}, {54, 112}, {54, 113}, {53, 114}, {53, 115}, {53, 116}, {53, 117}, {53, 118}, {52, 119}, {52, 120}, {52, 121}, {52, 122}, {52, 123}, {51, 124}, {51, 125}, {51, 126},  },
-  { {64, 64}, {64, 65}, {64, 66}, {63, 67}, {63, 68}, {63, 69}, {63, 70}, {62, 71}, {62, 72}, {62, 73}, {62, 74}, {62, 75}, {61, 76}, {61, 77}, {61, 78}, {61, 79}, {60, 80}, {60, 81}, {60, 82}, {60, 83}, {60, 83}, {59, 84}, {59, 85}, {59, 86}, {59, 87}, {58, 88}, {58, 89}, {58, 90}, {58, 91}, {57, 92}, {57, 93}, {57, 94}, {57, 95}, {57, 96}, {56, 97}, {56, 98}, {56, 99}, {56, 100}, {55, 101}, {55, 102}, {55, 103}, {55, 104}, {55, 105}, {54, 106}, {54, 107}, {54, 108}, {54, 109}, {53, 110}, {53, 111}, {53, 112}, {53, 113}, {53, 114}, {52, 115}, {52, 116}, {52, 117}, {52, 118}, {51, 119}, {51, 120}, {51, 121}, {51, 121}, {51, 122}, {50, 123}, {50, 124}, {50, 125},  },
-  { {64, 64}, {64, 65}, {64, 66}, {63, 67}, {63, 68}, {63, 69}, {63, 70}, {62, 71}, {62, 72}, {62, 73}, {62, 74}, {61, 75}, {61, 76}, {61, 77}, {61, 78}, {60, 79}, {60, 80}, {60, 80}, {60, 81}, {59, 82}, {59, 83}, {59, 84}, {59, 85}, {58, 86}, {58, 87}, {58, 88}, {58, 89}, {57, 90}, {57, 91}, {57, 92}, {57, 93}, {57, 94}, {56, 95}, {56, 96}, {56, 97}, {56, 98}, {55, 99}, {55, 100}, {55, 101}, {55, 102}, {54, 103}, {54, 104}, {54, 105}, {54, 106}, {53, 107}, {53, 108}, {53, 109}, {53, 110}, {52, 111}, {52, 112}, {52, 113}, {52, 113}, {51, 114}, {51, 115}, {51, 116}, {51, 117}, {50, 118}, {50, 119}, {50, 120}, {50, 121}, {49, 122}, {49, 123}, {49, 124}, {49, 125},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {63, 69}, {62, 70}, {62, 71}, {62, 72}, {62, 73}, {61, 74}, {61, 75}, {61, 76}, {61, 77}, {60, 78}, {60, 78}, {60, 79}, {60, 80}, {59, 81}, {59, 82}, {59, 83}, {59, 84}, {58, 85}, {58, 86}, {58, 87}, {58, 88}, {57, 89}, {57, 90}, {57, 91}, {56, 92}, {56, 93}, {56, 94}, {56, 95}, {55, 96}, {55, 97}, {55, 98}, {55, 99}, {54, 100}, {54, 101}, {54, 102}, {54, 103}, {53, 104}, {53, 105}, {53, 106}, {53, 107}, {52, 107}, {52, 108}, {52, 109}, {52, 110}, {51, 111}, {51, 112}, {51, 113}, {51, 114}, {50, 115}, {50, 116}, {50, 117}, {50, 118}, {49, 119}, {49, 120}, {49, 121}, {48, 122}, {48, 123}, {48, 124}, {48, 125},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {63, 69}, {62, 70}, {62, 71}, {62, 72}, {62, 73}, {61, 74}, {61, 75}, {61, 76}, {60, 76}, {60, 77}, {60, 78}, {60, 79}, {59, 80}, {59, 81}, {59, 82}, {58, 83}, {58, 84}, {58, 85}, {58, 86}, {57, 87}, {57, 88}, {57, 89}, {57, 90}, {56, 91}, {56, 92}, {56, 93}, {55, 94}, {55, 95}, {55, 96}, {55, 97}, {54, 98}, {54, 99}, {54, 100}, {54, 101}, {53, 101}, {53, 102}, {53, 103}, {52, 104}, {52, 105}, {52, 106}, {52, 107}, {51, 108}, {51, 109}, {51, 110}, {50, 111}, {50, 112}, {50, 113}, {50, 114}, {49, 115}, {49, 116}, {49, 117}, {49, 118}, {48, 119}, {48, 120}, {48, 121}, {47, 122}, {47, 123}, {47, 124}, {47, 125},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {63, 69}, {62, 70}, {62, 71}, {62, 72}, {61, 73}, {61, 74}, {61, 75}, {60, 75}, {60, 76}, {60, 77}, {60, 78}, {59, 79}, {59, 80}, {59, 81}, {58, 82}, {58, 83}, {58, 84}, {58, 85}, {57, 86}, {57, 87}, {57, 88}, {56, 89}, {56, 90}, {56, 91}, {56, 92}, {55, 93}, {55, 94}, {55, 95}, {54, 96}, {54, 97}, {54, 97}, {53, 98}, {53, 99}, {53, 100}, {53, 101}, {52, 102}, {52, 103}, {52, 104}, {51, 105}, {51, 106}, {51, 107}, {51, 108}, {50, 109}, {50, 110}, {50, 111}, {49, 112}, {49, 113}, {49, 114}, {49, 115}, {48, 116}, {48, 117}, {48, 118}, {47, 119}, {47, 119}, {47, 120}, {46, 121}, {46, 122}, {46, 123}, {46, 124},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {62, 69}, {62, 70}, {62, 71}, {62, 72}, {61, 73}, {61, 74}, {61, 74}, {60, 75}, {60, 76}, {60, 77}, {59, 78}, {59, 79}, {59, 80}, {58, 81}, {58, 82}, {58, 83}, {58, 84}, {57, 85}, {57, 86}, {57, 87}, {56, 88}, {56, 89}, {56, 90}, {55, 91}, {55, 92}, {55, 93}, {54, 93}, {54, 94}, {54, 95}, {53, 96}, {53, 97}, {53, 98}, {53, 99}, {52, 100}, {52, 101}, {52, 102}, {51, 103}, {51, 104}, {51, 105}, {50, 106}, {50, 107}, {50, 108}, {49, 109}, {49, 110}, {49, 111}, {49, 112}, {48, 113}, {48, 113}, {48, 114}, {47, 115}, {47, 116}, {47, 117}, {46, 118}, {46, 119}, {46, 120}, {45, 121}, {45, 122}, {45, 123}, {45, 124},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {62, 69}, {62, 70}, {62, 71}, {61, 72}, {61, 73}, {61, 73}, {60, 74}, {60, 75}, {60, 76}, {59, 77}, {59, 78}, {59, 79}, {58, 80}, {58, 81}, {58, 82}, {57, 83}, {57, 84}, {57, 85}, {57, 86}, {56, 87}, {56, 88}, {56, 89}, {55, 90}, {55, 90}, {55, 91}, {54, 92}, {54, 93}, {54, 94}, {53, 95}, {53, 96}, {53, 97}, {52, 98}, {52, 99}, {52, 100}, {51, 101}, {51, 102}, {51, 103}, {50, 104}, {50, 105}, {50, 106}, {49, 107}, {49, 107}, {49, 108}, {48, 109}, {48, 110}, {48, 111}, {47, 112}, {47, 113}, {47, 114}, {46, 115}, {46, 116}, {46, 117}, {45, 118}, {45, 119}, {45, 120}, {44, 121}, {44, 122}, {44, 123}, {43, 124},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {62, 69}, {62, 70}, {62, 71}, {61, 72}, {61, 72}, {61, 73}, {60, 74}, {60, 75}, {60, 76}, {59, 77}, {59, 78}, {59, 79}, {58, 80}, {58, 81}, {58, 82}, {57, 83}, {57, 84}, {56, 85}, {56, 86}, {56, 87}, {55, 87}, {55, 88}, {55, 89}, {54, 90}, {54, 91}, {54, 92}, {53, 93}, {53, 94}, {53, 95}, {52, 96}, {52, 97}, {52, 98}, {51, 99}, {51, 100}, {51, 101}, {50, 102}, {50, 103}, {50, 103}, {49, 104}, {49, 105}, {49, 106}, {48, 107}, {48, 108}, {48, 109}, {47, 110}, {47, 111}, {47, 112}, {46, 113}, {46, 114}, {46, 115}, {45, 116}, {45, 117}, {45, 118}, {44, 119}, {44, 119}, {43, 120}, {43, 121}, {43, 122}, {42, 123},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {62, 69}, {62, 70}, {61, 71}, {61, 71}, {61, 72}, {60, 73}, {60, 74}, {60, 75}, {59, 76}, {59, 77}, {59, 78}, {58, 79}, {58, 80}, {58, 81}, {57, 82}, {57, 83}, {56, 84}, {56, 85}, {56, 85}, {55, 86}, {55, 87}, {55, 88}, {54, 89}, {54, 90}, {54, 91}, {53, 92}, {53, 93}, {53, 94}, {52, 95}, {52, 96}, {51, 97}, {51, 98}, {51, 99}, {50, 99}, {50, 100}, {50, 101}, {49, 102}, {49, 103}, {49, 104}, {48, 105}, {48, 106}, {48, 107}, {47, 108}, {47, 109}, {46, 110}, {46, 111}, {46, 112}, {45, 113}, {45, 113}, {45, 114}, {44, 115}, {44, 116}, {44, 117}, {43, 118}, {43, 119}, {42, 120}, {42, 121}, {42, 122}, {41, 123},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {63, 68}, {62, 69}, {62, 70}, {61, 70}, {61, 71}, {61, 72}, {60, 73}, {60, 74}, {60, 75}, {59, 76}, {59, 77}, {58, 78}, {58, 79}, {58, 80}, {57, 81}, {57, 82}, {57, 83}, {56, 83}, {56, 84}, {55, 85}, {55, 86}, {55, 87}, {54, 88}, {54, 89}, {54, 90}, {53, 91}, {53, 92}, {52, 93}, {52, 94}, {52, 95}, {51, 96}, {51, 96}, {51, 97}, {50, 98}, {50, 99}, {49, 100}, {49, 101}, {49, 102}, {48, 103}, {48, 104}, {48, 105}, {47, 106}, {47, 107}, {46, 108}, {46, 109}, {46, 109}, {45, 110}, {45, 111}, {45, 112}, {44, 113}, {44, 114}, {43, 115}, {43, 116}, {43, 117}, {42, 118}, {42, 119}, {42, 120}, {41, 121}, {41, 121}, {40, 122},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 69}, {62, 70}, {61, 70}, {61, 71}, {60, 72}, {60, 73}, {60, 74}, {59, 75}, {59, 76}, {59, 77}, {58, 78}, {58, 79}, {57, 80}, {57, 81}, {57, 81}, {56, 82}, {56, 83}, {55, 84}, {55, 85}, {55, 86}, {54, 87}, {54, 88}, {53, 89}, {53, 90}, {53, 91}, {52, 92}, {52, 93}, {51, 93}, {51, 94}, {51, 95}, {50, 96}, {50, 97}, {50, 98}, {49, 99}, {49, 100}, {48, 101}, {48, 102}, {48, 103}, {47, 104}, {47, 105}, {46, 105}, {46, 106}, {46, 107}, {45, 108}, {45, 109}, {44, 110}, {44, 111}, {44, 112}, {43, 113}, {43, 114}, {43, 115}, {42, 116}, {42, 116}, {41, 117}, {41, 118}, {41, 119}, {40, 120}, {40, 121}, {39, 122},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 69}, {62, 69}, {61, 70}, {61, 71}, {60, 72}, {60, 73}, {60, 74}, {59, 75}, {59, 76}, {58, 77}, {58, 78}, {57, 79}, {57, 80}, {57, 80}, {56, 81}, {56, 82}, {55, 83}, {55, 84}, {55, 85}, {54, 86}, {54, 87}, {53, 88}, {53, 89}, {53, 90}, {52, 90}, {52, 91}, {51, 92}, {51, 93}, {51, 94}, {50, 95}, {50, 96}, {49, 97}, {49, 98}, {49, 99}, {48, 100}, {48, 101}, {47, 101}, {47, 102}, {47, 103}, {46, 104}, {46, 105}, {45, 106}, {45, 107}, {44, 108}, {44, 109}, {44, 110}, {43, 111}, {43, 112}, {42, 112}, {42, 113}, {42, 114}, {41, 115}, {41, 116}, {40, 117}, {40, 118}, {40, 119}, {39, 120}, {39, 121}, {38, 122},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 69}, {61, 69}, {61, 70}, {61, 71}, {60, 72}, {60, 73}, {59, 74}, {59, 75}, {59, 76}, {58, 77}, {58, 78}, {57, 79}, {57, 79}, {56, 80}, {56, 81}, {56, 82}, {55, 83}, {55, 84}, {54, 85}, {54, 86}, {53, 87}, {53, 88}, {53, 88}, {52, 89}, {52, 90}, {51, 91}, {51, 92}, {50, 93}, {50, 94}, {50, 95}, {49, 96}, {49, 97}, {48, 98}, {48, 98}, {48, 99}, {47, 100}, {47, 101}, {46, 102}, {46, 103}, {45, 104}, {45, 105}, {45, 106}, {44, 107}, {44, 108}, {43, 108}, {43, 109}, {42, 110}, {42, 111}, {42, 112}, {41, 113}, {41, 114}, {40, 115}, {40, 116}, {39, 117}, {39, 117}, {39, 118}, {38, 119}, {38, 120}, {37, 121},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 68}, {61, 69}, {61, 70}, {60, 71}, {60, 72}, {60, 73}, {59, 74}, {59, 75}, {58, 76}, {58, 77}, {57, 77}, {57, 78}, {57, 79}, {56, 80}, {56, 81}, {55, 82}, {55, 83}, {54, 84}, {54, 85}, {53, 86}, {53, 86}, {53, 87}, {52, 88}, {52, 89}, {51, 90}, {51, 91}, {50, 92}, {50, 93}, {50, 94}, {49, 95}, {49, 95}, {48, 96}, {48, 97}, {47, 98}, {47, 99}, {46, 100}, {46, 101}, {46, 102}, {45, 103}, {45, 104}, {44, 104}, {44, 105}, {43, 106}, {43, 107}, {43, 108}, {42, 109}, {42, 110}, {41, 111}, {41, 112}, {40, 113}, {40, 113}, {39, 114}, {39, 115}, {39, 116}, {38, 117}, {38, 118}, {37, 119}, {37, 120}, {36, 121},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 68}, {61, 69}, {61, 70}, {60, 71}, {60, 72}, {59, 73}, {59, 74}, {59, 75}, {58, 76}, {58, 76}, {57, 77}, {57, 78}, {56, 79}, {56, 80}, {55, 81}, {55, 82}, {54, 83}, {54, 84}, {54, 84}, {53, 85}, {53, 86}, {52, 87}, {52, 88}, {51, 89}, {51, 90}, {50, 91}, {50, 92}, {49, 93}, {49, 93}, {49, 94}, {48, 95}, {48, 96}, {47, 97}, {47, 98}, {46, 99}, {46, 100}, {45, 101}, {45, 101}, {44, 102}, {44, 103}, {44, 104}, {43, 105}, {43, 106}, {42, 107}, {42, 108}, {41, 109}, {41, 109}, {40, 110}, {40, 111}, {39, 112}, {39, 113}, {39, 114}, {38, 115}, {38, 116}, {37, 117}, {37, 117}, {36, 118}, {36, 119}, {35, 120},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 68}, {62, 68}, {61, 69}, {61, 70}, {60, 71}, {60, 72}, {59, 73}, {59, 74}, {58, 75}, {58, 75}, {57, 76}, {57, 77}, {56, 78}, {56, 79}, {56, 80}, {55, 81}, {55, 82}, {54, 83}, {54, 83}, {53, 84}, {53, 85}, {52, 86}, {52, 87}, {51, 88}, {51, 89}, {50, 90}, {50, 90}, {49, 91}, {49, 92}, {49, 93}, {48, 94}, {48, 95}, {47, 96}, {47, 97}, {46, 98}, {46, 98}, {45, 99}, {45, 100}, {44, 101}, {44, 102}, {43, 103}, {43, 104}, {42, 105}, {42, 105}, {41, 106}, {41, 107}, {41, 108}, {40, 109}, {40, 110}, {39, 111}, {39, 112}, {38, 113}, {38, 113}, {37, 114}, {37, 115}, {36, 116}, {36, 117}, {35, 118}, {35, 119}, {34, 120},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 67}, {62, 68}, {61, 69}, {61, 70}, {60, 71}, {60, 72}, {59, 73}, {59, 74}, {58, 74}, {58, 75}, {57, 76}, {57, 77}, {56, 78}, {56, 79}, {55, 80}, {55, 81}, {54, 81}, {54, 82}, {53, 83}, {53, 84}, {52, 85}, {52, 86}, {51, 87}, {51, 88}, {50, 88}, {50, 89}, {49, 90}, {49, 91}, {48, 92}, {48, 93}, {48, 94}, {47, 95}, {47, 95}, {46, 96}, {46, 97}, {45, 98}, {45, 99}, {44, 100}, {44, 101}, {43, 102}, {43, 102}, {42, 103}, {42, 104}, {41, 105}, {41, 106}, {40, 107}, {40, 108}, {39, 109}, {39, 109}, {38, 110}, {38, 111}, {37, 112}, {37, 113}, {36, 114}, {36, 115}, {35, 116}, {35, 116}, {34, 117}, {34, 118}, {33, 119},  },
-  { {64, 64}, {64, 65}, {63, 66}, {63, 67}, {62, 67}, {62, 68}, {61, 69}, {61, 70}, {60, 71}, {60, 72}, {59, 73}, {59, 74}, {58, 74}, {58, 75}, {57, 76}, {57, 77}, {56, 78}, {56, 79}, {55, 80}, {55, 80}, {54, 81}, {54, 82}, {53, 83}, {53, 84}, {52, 85}, {52, 86}, {51, 87}, {51, 87}, {50, 88}, {50, 89}, {49, 90}, {49, 91}, {48, 92}, {48, 93}, {47, 93}, {47, 94}, {46, 95}, {46, 96}, {45, 97}, {45, 98}, {44, 99}, {44, 100}, {43, 100}, {43, 101}, {42, 102}, {42, 103}, {41, 104}, {41, 105}, {40, 106}, {40, 106}, {39, 107}, {39, 108}, {38, 109}, {38, 110}, {37, 111}, {37, 112}, {36, 112}, {36, 113}, {35, 114}, {35, 115}, {34, 116}, {34, 117}, {33, 118}, {33, 119},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 67}, {62, 67}, {61, 68}, {61, 69}, {60, 70}, {60, 71}, {59, 72}, {59, 73}, {58, 73}, {58, 74}, {57, 75}, {57, 76}, {56, 77}, {56, 78}, {55, 79}, {55, 79}, {54, 80}, {54, 81}, {53, 82}, {53, 83}, {52, 84}, {52, 85}, {51, 85}, {51, 86}, {50, 87}, {50, 88}, {49, 89}, {49, 90}, {48, 91}, {48, 91}, {47, 92}, {46, 93}, {46, 94}, {45, 95}, {45, 96}, {44, 97}, {44, 97}, {43, 98}, {43, 99}, {42, 100}, {42, 101}, {41, 102}, {41, 103}, {40, 103}, {40, 104}, {39, 105}, {39, 106}, {38, 107}, {38, 108}, {37, 109}, {37, 109}, {36, 110}, {36, 111}, {35, 112}, {35, 113}, {34, 114}, {34, 115}, {33, 115}, {33, 116}, {32, 117}, {32, 118},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 67}, {62, 67}, {61, 68}, {61, 69}, {60, 70}, {60, 71}, {59, 72}, {59, 72}, {58, 73}, {58, 74}, {57, 75}, {57, 76}, {56, 77}, {56, 78}, {55, 78}, {54, 79}, {54, 80}, {53, 81}, {53, 82}, {52, 83}, {52, 84}, {51, 84}, {51, 85}, {50, 86}, {50, 87}, {49, 88}, {49, 89}, {48, 89}, {48, 90}, {47, 91}, {47, 92}, {46, 93}, {45, 94}, {45, 95}, {44, 95}, {44, 96}, {43, 97}, {43, 98}, {42, 99}, {42, 100}, {41, 100}, {41, 101}, {40, 102}, {40, 103}, {39, 104}, {39, 105}, {38, 106}, {38, 106}, {37, 107}, {36, 108}, {36, 109}, {35, 110}, {35, 111}, {34, 111}, {34, 112}, {33, 113}, {33, 114}, {32, 115}, {32, 116}, {31, 117}, {31, 117},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 67}, {62, 67}, {61, 68}, {61, 69}, {60, 70}, {60, 71}, {59, 72}, {59, 72}, {58, 73}, {57, 74}, {57, 75}, {56, 76}, {56, 77}, {55, 77}, {55, 78}, {54, 79}, {54, 80}, {53, 81}, {53, 82}, {52, 82}, {51, 83}, {51, 84}, {50, 85}, {50, 86}, {49, 87}, {49, 87}, {48, 88}, {48, 89}, {47, 90}, {47, 91}, {46, 92}, {45, 93}, {45, 93}, {44, 94}, {44, 95}, {43, 96}, {43, 97}, {42, 98}, {42, 98}, {41, 99}, {41, 100}, {40, 101}, {39, 102}, {39, 103}, {38, 103}, {38, 104}, {37, 105}, {37, 106}, {36, 107}, {36, 108}, {35, 108}, {35, 109}, {34, 110}, {34, 111}, {33, 112}, {32, 113}, {32, 113}, {31, 114}, {31, 115}, {30, 116}, {30, 117},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {62, 67}, {61, 68}, {61, 69}, {60, 70}, {60, 71}, {59, 71}, {58, 72}, {58, 73}, {57, 74}, {57, 75}, {56, 76}, {56, 76}, {55, 77}, {54, 78}, {54, 79}, {53, 80}, {53, 81}, {52, 81}, {52, 82}, {51, 83}, {51, 84}, {50, 85}, {49, 86}, {49, 86}, {48, 87}, {48, 88}, {47, 89}, {47, 90}, {46, 91}, {46, 91}, {45, 92}, {44, 93}, {44, 94}, {43, 95}, {43, 96}, {42, 96}, {42, 97}, {41, 98}, {41, 99}, {40, 100}, {39, 100}, {39, 101}, {38, 102}, {38, 103}, {37, 104}, {37, 105}, {36, 105}, {35, 106}, {35, 107}, {34, 108}, {34, 109}, {33, 110}, {33, 110}, {32, 111}, {32, 112}, {31, 113}, {30, 114}, {30, 115}, {29, 115}, {29, 116},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {62, 67}, {61, 68}, {61, 69}, {60, 70}, {59, 71}, {59, 71}, {58, 72}, {58, 73}, {57, 74}, {57, 75}, {56, 75}, {55, 76}, {55, 77}, {54, 78}, {54, 79}, {53, 80}, {53, 80}, {52, 81}, {51, 82}, {51, 83}, {50, 84}, {50, 84}, {49, 85}, {49, 86}, {48, 87}, {47, 88}, {47, 89}, {46, 89}, {46, 90}, {45, 91}, {44, 92}, {44, 93}, {43, 93}, {43, 94}, {42, 95}, {42, 96}, {41, 97}, {40, 98}, {40, 98}, {39, 99}, {39, 100}, {38, 101}, {38, 102}, {37, 103}, {36, 103}, {36, 104}, {35, 105}, {35, 106}, {34, 107}, {34, 107}, {33, 108}, {32, 109}, {32, 110}, {31, 111}, {31, 112}, {30, 112}, {30, 113}, {29, 114}, {28, 115}, {28, 116},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {62, 67}, {61, 68}, {60, 69}, {60, 70}, {59, 70}, {59, 71}, {58, 72}, {58, 73}, {57, 74}, {56, 75}, {56, 75}, {55, 76}, {55, 77}, {54, 78}, {53, 79}, {53, 79}, {52, 80}, {52, 81}, {51, 82}, {50, 83}, {50, 83}, {49, 84}, {49, 85}, {48, 86}, {48, 87}, {47, 87}, {46, 88}, {46, 89}, {45, 90}, {45, 91}, {44, 92}, {43, 92}, {43, 93}, {42, 94}, {42, 95}, {41, 96}, {40, 96}, {40, 97}, {39, 98}, {39, 99}, {38, 100}, {38, 100}, {37, 101}, {36, 102}, {36, 103}, {35, 104}, {35, 104}, {34, 105}, {33, 106}, {33, 107}, {32, 108}, {32, 108}, {31, 109}, {30, 110}, {30, 111}, {29, 112}, {29, 113}, {28, 113}, {28, 114}, {27, 115},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {62, 67}, {61, 68}, {60, 69}, {60, 70}, {59, 70}, {59, 71}, {58, 72}, {57, 73}, {57, 74}, {56, 74}, {56, 75}, {55, 76}, {54, 77}, {54, 78}, {53, 78}, {53, 79}, {52, 80}, {51, 81}, {51, 82}, {50, 82}, {50, 83}, {49, 84}, {48, 85}, {48, 86}, {47, 86}, {47, 87}, {46, 88}, {45, 89}, {45, 90}, {44, 90}, {44, 91}, {43, 92}, {42, 93}, {42, 94}, {41, 94}, {41, 95}, {40, 96}, {39, 97}, {39, 98}, {38, 98}, {38, 99}, {37, 100}, {36, 101}, {36, 102}, {35, 102}, {35, 103}, {34, 104}, {33, 105}, {33, 106}, {32, 106}, {32, 107}, {31, 108}, {30, 109}, {30, 110}, {29, 110}, {28, 111}, {28, 112}, {27, 113}, {27, 114}, {26, 114},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {62, 67}, {61, 68}, {60, 69}, {60, 70}, {59, 70}, {58, 71}, {58, 72}, {57, 73}, {57, 73}, {56, 74}, {55, 75}, {55, 76}, {54, 77}, {54, 77}, {53, 78}, {52, 79}, {52, 80}, {51, 81}, {50, 81}, {50, 82}, {49, 83}, {49, 84}, {48, 84}, {47, 85}, {47, 86}, {46, 87}, {46, 88}, {45, 88}, {44, 89}, {44, 90}, {43, 91}, {42, 92}, {42, 92}, {41, 93}, {41, 94}, {40, 95}, {39, 96}, {39, 96}, {38, 97}, {38, 98}, {37, 99}, {36, 99}, {36, 100}, {35, 101}, {34, 102}, {34, 103}, {33, 103}, {33, 104}, {32, 105}, {31, 106}, {31, 107}, {30, 107}, {30, 108}, {29, 109}, {28, 110}, {28, 110}, {27, 111}, {26, 112}, {26, 113}, {25, 114},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {61, 67}, {61, 68}, {60, 69}, {60, 69}, {59, 70}, {58, 71}, {58, 72}, {57, 73}, {56, 73}, {56, 74}, {55, 75}, {55, 76}, {54, 76}, {53, 77}, {53, 78}, {52, 79}, {51, 80}, {51, 80}, {50, 81}, {50, 82}, {49, 83}, {48, 83}, {48, 84}, {47, 85}, {46, 86}, {46, 87}, {45, 87}, {44, 88}, {44, 89}, {43, 90}, {43, 90}, {42, 91}, {41, 92}, {41, 93}, {40, 94}, {39, 94}, {39, 95}, {38, 96}, {38, 97}, {37, 97}, {36, 98}, {36, 99}, {35, 100}, {34, 101}, {34, 101}, {33, 102}, {33, 103}, {32, 104}, {31, 104}, {31, 105}, {30, 106}, {29, 107}, {29, 108}, {28, 108}, {27, 109}, {27, 110}, {26, 111}, {26, 111}, {25, 112}, {24, 113},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {61, 67}, {61, 68}, {60, 69}, {60, 69}, {59, 70}, {58, 71}, {58, 72}, {57, 72}, {56, 73}, {56, 74}, {55, 75}, {54, 75}, {54, 76}, {53, 77}, {52, 78}, {52, 79}, {51, 79}, {51, 80}, {50, 81}, {49, 82}, {49, 82}, {48, 83}, {47, 84}, {47, 85}, {46, 85}, {45, 86}, {45, 87}, {44, 88}, {43, 89}, {43, 89}, {42, 90}, {42, 91}, {41, 92}, {40, 92}, {40, 93}, {39, 94}, {38, 95}, {38, 95}, {37, 96}, {36, 97}, {36, 98}, {35, 98}, {34, 99}, {34, 100}, {33, 101}, {33, 102}, {32, 102}, {31, 103}, {31, 104}, {30, 105}, {29, 105}, {29, 106}, {28, 107}, {27, 108}, {27, 108}, {26, 109}, {25, 110}, {25, 111}, {24, 111}, {24, 112},  },
-  { {64, 64}, {63, 65}, {63, 66}, {62, 66}, {61, 67}, {61, 68}, {60, 69}, {59, 69}, {59, 70}, {58, 71}, {57, 72}, {57, 72}, {56, 73}, {55, 74}, {55, 75}, {54, 75}, {54, 76}, {53, 77}, {52, 78}, {52, 78}, {51, 79}, {50, 80}, {50, 81}, {49, 81}, {48, 82}, {48, 83}, {47, 84}, {46, 84}, {46, 85}, {45, 86}, {44, 87}, {44, 87}, {43, 88}, {42, 89}, {42, 90}, {41, 90}, {40, 91}, {40, 92}, {39, 93}, {38, 93}, {38, 94}, {37, 95}, {36, 96}, {36, 96}, {35, 97}, {34, 98}, {34, 99}, {33, 99}, {33, 100}, {32, 101}, {31, 102}, {31, 102}, {30, 103}, {29, 104}, {29, 105}, {28, 106}, {27, 106}, {27, 107}, {26, 108}, {25, 109}, {25, 109}, {24, 110}, {23, 111}, {23, 112},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {61, 68}, {60, 68}, {59, 69}, {59, 70}, {58, 71}, {57, 71}, {57, 72}, {56, 73}, {55, 74}, {55, 74}, {54, 75}, {53, 76}, {53, 77}, {52, 77}, {51, 78}, {51, 79}, {50, 80}, {49, 80}, {49, 81}, {48, 82}, {47, 83}, {47, 83}, {46, 84}, {45, 85}, {45, 86}, {44, 86}, {43, 87}, {43, 88}, {42, 89}, {41, 89}, {41, 90}, {40, 91}, {39, 91}, {39, 92}, {38, 93}, {37, 94}, {37, 94}, {36, 95}, {35, 96}, {35, 97}, {34, 97}, {33, 98}, {33, 99}, {32, 100}, {31, 100}, {31, 101}, {30, 102}, {29, 103}, {29, 103}, {28, 104}, {27, 105}, {27, 106}, {26, 106}, {25, 107}, {25, 108}, {24, 109}, {23, 109}, {23, 110}, {22, 111},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {61, 68}, {60, 68}, {59, 69}, {59, 70}, {58, 71}, {57, 71}, {56, 72}, {56, 73}, {55, 74}, {54, 74}, {54, 75}, {53, 76}, {52, 76}, {52, 77}, {51, 78}, {50, 79}, {50, 79}, {49, 80}, {48, 81}, {48, 82}, {47, 82}, {46, 83}, {46, 84}, {45, 84}, {44, 85}, {44, 86}, {43, 87}, {42, 87}, {41, 88}, {41, 89}, {40, 90}, {39, 90}, {39, 91}, {38, 92}, {37, 93}, {37, 93}, {36, 94}, {35, 95}, {35, 95}, {34, 96}, {33, 97}, {33, 98}, {32, 98}, {31, 99}, {31, 100}, {30, 101}, {29, 101}, {29, 102}, {28, 103}, {27, 103}, {26, 104}, {26, 105}, {25, 106}, {24, 106}, {24, 107}, {23, 108}, {22, 109}, {22, 109}, {21, 110},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {61, 68}, {60, 68}, {59, 69}, {58, 70}, {58, 70}, {57, 71}, {56, 72}, {56, 73}, {55, 73}, {54, 74}, {54, 75}, {53, 76}, {52, 76}, {51, 77}, {51, 78}, {50, 78}, {49, 79}, {49, 80}, {48, 81}, {47, 81}, {47, 82}, {46, 83}, {45, 83}, {45, 84}, {44, 85}, {43, 86}, {42, 86}, {42, 87}, {41, 88}, {40, 88}, {40, 89}, {39, 90}, {38, 91}, {38, 91}, {37, 92}, {36, 93}, {36, 93}, {35, 94}, {34, 95}, {33, 96}, {33, 96}, {32, 97}, {31, 98}, {31, 99}, {30, 99}, {29, 100}, {29, 101}, {28, 101}, {27, 102}, {26, 103}, {26, 104}, {25, 104}, {24, 105}, {24, 106}, {23, 106}, {22, 107}, {22, 108}, {21, 109}, {20, 109},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {60, 68}, {60, 68}, {59, 69}, {58, 70}, {58, 70}, {57, 71}, {56, 72}, {56, 72}, {55, 73}, {54, 74}, {53, 75}, {53, 75}, {52, 76}, {51, 77}, {51, 77}, {50, 78}, {49, 79}, {48, 80}, {48, 80}, {47, 81}, {46, 82}, {46, 82}, {45, 83}, {44, 84}, {43, 85}, {43, 85}, {42, 86}, {41, 87}, {41, 87}, {40, 88}, {39, 89}, {39, 89}, {38, 90}, {37, 91}, {36, 92}, {36, 92}, {35, 93}, {34, 94}, {34, 94}, {33, 95}, {32, 96}, {31, 97}, {31, 97}, {30, 98}, {29, 99}, {29, 99}, {28, 100}, {27, 101}, {27, 101}, {26, 102}, {25, 103}, {24, 104}, {24, 104}, {23, 105}, {22, 106}, {22, 106}, {21, 107}, {20, 108}, {19, 109},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {60, 67}, {60, 68}, {59, 69}, {58, 70}, {58, 70}, {57, 71}, {56, 72}, {55, 72}, {55, 73}, {54, 74}, {53, 74}, {52, 75}, {52, 76}, {51, 77}, {50, 77}, {50, 78}, {49, 79}, {48, 79}, {47, 80}, {47, 81}, {46, 81}, {45, 82}, {45, 83}, {44, 83}, {43, 84}, {42, 85}, {42, 86}, {41, 86}, {40, 87}, {40, 88}, {39, 88}, {38, 89}, {37, 90}, {37, 90}, {36, 91}, {35, 92}, {35, 92}, {34, 93}, {33, 94}, {32, 95}, {32, 95}, {31, 96}, {30, 97}, {29, 97}, {29, 98}, {28, 99}, {27, 99}, {27, 100}, {26, 101}, {25, 102}, {24, 102}, {24, 103}, {23, 104}, {22, 104}, {22, 105}, {21, 106}, {20, 106}, {19, 107}, {19, 108},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {60, 67}, {60, 68}, {59, 69}, {58, 69}, {57, 70}, {57, 71}, {56, 72}, {55, 72}, {54, 73}, {54, 74}, {53, 74}, {52, 75}, {52, 76}, {51, 76}, {50, 77}, {49, 78}, {49, 78}, {48, 79}, {47, 80}, {46, 80}, {46, 81}, {45, 82}, {44, 82}, {44, 83}, {43, 84}, {42, 84}, {41, 85}, {41, 86}, {40, 87}, {39, 87}, {38, 88}, {38, 89}, {37, 89}, {36, 90}, {35, 91}, {35, 91}, {34, 92}, {33, 93}, {33, 93}, {32, 94}, {31, 95}, {30, 95}, {30, 96}, {29, 97}, {28, 97}, {27, 98}, {27, 99}, {26, 99}, {25, 100}, {25, 101}, {24, 102}, {23, 102}, {22, 103}, {22, 104}, {21, 104}, {20, 105}, {19, 106}, {19, 106}, {18, 107},  },
-  { {64, 64}, {63, 65}, {63, 65}, {62, 66}, {61, 67}, {60, 67}, {60, 68}, {59, 69}, {58, 69}, {57, 70}, {57, 71}, {56, 71}, {55, 72}, {54, 73}, {54, 73}, {53, 74}, {52, 75}, {51, 75}, {51, 76}, {50, 77}, {49, 77}, {48, 78}, {48, 79}, {47, 79}, {46, 80}, {45, 81}, {45, 81}, {44, 82}, {43, 83}, {42, 83}, {42, 84}, {41, 85}, {40, 85}, {39, 86}, {39, 87}, {38, 87}, {37, 88}, {37, 89}, {36, 89}, {35, 90}, {34, 91}, {34, 91}, {33, 92}, {32, 93}, {31, 93}, {31, 94}, {30, 95}, {29, 95}, {28, 96}, {28, 97}, {27, 97}, {26, 98}, {25, 99}, {25, 99}, {24, 100}, {23, 101}, {22, 101}, {22, 102}, {21, 103}, {20, 103}, {19, 104}, {19, 105}, {18, 105}, {17, 106},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 67}, {60, 67}, {59, 68}, {59, 69}, {58, 69}, {57, 70}, {56, 71}, {56, 71}, {55, 72}, {54, 73}, {53, 73}, {53, 74}, {52, 74}, {51, 75}, {50, 76}, {50, 76}, {49, 77}, {48, 78}, {47, 78}, {47, 79}, {46, 80}, {45, 80}, {44, 81}, {44, 82}, {43, 82}, {42, 83}, {41, 84}, {41, 84}, {40, 85}, {39, 86}, {38, 86}, {38, 87}, {37, 88}, {36, 88}, {35, 89}, {35, 90}, {34, 90}, {33, 91}, {32, 92}, {32, 92}, {31, 93}, {30, 94}, {29, 94}, {29, 95}, {28, 95}, {27, 96}, {26, 97}, {26, 97}, {25, 98}, {24, 99}, {23, 99}, {22, 100}, {22, 101}, {21, 101}, {20, 102}, {19, 103}, {19, 103}, {18, 104}, {17, 105}, {16, 105},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 67}, {60, 67}, {59, 68}, {59, 68}, {58, 69}, {57, 70}, {56, 70}, {56, 71}, {55, 72}, {54, 72}, {53, 73}, {53, 74}, {52, 74}, {51, 75}, {50, 76}, {49, 76}, {49, 77}, {48, 77}, {47, 78}, {46, 79}, {46, 79}, {45, 80}, {44, 81}, {43, 81}, {43, 82}, {42, 83}, {41, 83}, {40, 84}, {39, 85}, {39, 85}, {38, 86}, {37, 86}, {36, 87}, {36, 88}, {35, 88}, {34, 89}, {33, 90}, {33, 90}, {32, 91}, {31, 92}, {30, 92}, {30, 93}, {29, 94}, {28, 94}, {27, 95}, {26, 95}, {26, 96}, {25, 97}, {24, 97}, {23, 98}, {23, 99}, {22, 99}, {21, 100}, {20, 101}, {20, 101}, {19, 102}, {18, 103}, {17, 103}, {17, 104}, {16, 104},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 67}, {60, 67}, {59, 68}, {59, 68}, {58, 69}, {57, 70}, {56, 70}, {55, 71}, {55, 72}, {54, 72}, {53, 73}, {52, 73}, {52, 74}, {51, 75}, {50, 75}, {49, 76}, {48, 77}, {48, 77}, {47, 78}, {46, 78}, {45, 79}, {45, 80}, {44, 80}, {43, 81}, {42, 82}, {41, 82}, {41, 83}, {40, 84}, {39, 84}, {38, 85}, {38, 85}, {37, 86}, {36, 87}, {35, 87}, {34, 88}, {34, 89}, {33, 89}, {32, 90}, {31, 90}, {31, 91}, {30, 92}, {29, 92}, {28, 93}, {27, 94}, {27, 94}, {26, 95}, {25, 95}, {24, 96}, {24, 97}, {23, 97}, {22, 98}, {21, 99}, {20, 99}, {20, 100}, {19, 101}, {18, 101}, {17, 102}, {17, 102}, {16, 103}, {15, 104},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 66}, {60, 67}, {59, 68}, {58, 68}, {58, 69}, {57, 70}, {56, 70}, {55, 71}, {55, 71}, {54, 72}, {53, 73}, {52, 73}, {51, 74}, {51, 74}, {50, 75}, {49, 76}, {48, 76}, {47, 77}, {47, 78}, {46, 78}, {45, 79}, {44, 79}, {44, 80}, {43, 81}, {42, 81}, {41, 82}, {40, 82}, {40, 83}, {39, 84}, {38, 84}, {37, 85}, {36, 86}, {36, 86}, {35, 87}, {34, 87}, {33, 88}, {32, 89}, {32, 89}, {31, 90}, {30, 90}, {29, 91}, {29, 92}, {28, 92}, {27, 93}, {26, 94}, {25, 94}, {25, 95}, {24, 95}, {23, 96}, {22, 97}, {21, 97}, {21, 98}, {20, 98}, {19, 99}, {18, 100}, {18, 100}, {17, 101}, {16, 102}, {15, 102}, {14, 103},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 66}, {60, 67}, {59, 68}, {58, 68}, {58, 69}, {57, 69}, {56, 70}, {55, 71}, {54, 71}, {54, 72}, {53, 72}, {52, 73}, {51, 74}, {50, 74}, {50, 75}, {49, 75}, {48, 76}, {47, 77}, {46, 77}, {46, 78}, {45, 78}, {44, 79}, {43, 80}, {42, 80}, {42, 81}, {41, 81}, {40, 82}, {39, 83}, {38, 83}, {38, 84}, {37, 84}, {36, 85}, {35, 86}, {34, 86}, {34, 87}, {33, 87}, {32, 88}, {31, 89}, {30, 89}, {30, 90}, {29, 90}, {28, 91}, {27, 92}, {26, 92}, {26, 93}, {25, 93}, {24, 94}, {23, 95}, {22, 95}, {22, 96}, {21, 96}, {20, 97}, {19, 98}, {18, 98}, {18, 99}, {17, 100}, {16, 100}, {15, 101}, {14, 101}, {14, 102},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 66}, {60, 67}, {59, 68}, {58, 68}, {58, 69}, {57, 69}, {56, 70}, {55, 70}, {54, 71}, {53, 72}, {53, 72}, {52, 73}, {51, 73}, {50, 74}, {49, 75}, {49, 75}, {48, 76}, {47, 76}, {46, 77}, {45, 78}, {45, 78}, {44, 79}, {43, 79}, {42, 80}, {41, 80}, {41, 81}, {40, 82}, {39, 82}, {38, 83}, {37, 83}, {36, 84}, {36, 85}, {35, 85}, {34, 86}, {33, 86}, {32, 87}, {32, 88}, {31, 88}, {30, 89}, {29, 89}, {28, 90}, {28, 90}, {27, 91}, {26, 92}, {25, 92}, {24, 93}, {24, 93}, {23, 94}, {22, 95}, {21, 95}, {20, 96}, {20, 96}, {19, 97}, {18, 98}, {17, 98}, {16, 99}, {15, 99}, {15, 100}, {14, 100}, {13, 101},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 69}, {57, 69}, {56, 70}, {55, 70}, {54, 71}, {53, 71}, {53, 72}, {52, 73}, {51, 73}, {50, 74}, {49, 74}, {48, 75}, {48, 75}, {47, 76}, {46, 77}, {45, 77}, {44, 78}, {44, 78}, {43, 79}, {42, 79}, {41, 80}, {40, 81}, {39, 81}, {39, 82}, {38, 82}, {37, 83}, {36, 84}, {35, 84}, {35, 85}, {34, 85}, {33, 86}, {32, 86}, {31, 87}, {30, 88}, {30, 88}, {29, 89}, {28, 89}, {27, 90}, {26, 90}, {25, 91}, {25, 92}, {24, 92}, {23, 93}, {22, 93}, {21, 94}, {21, 94}, {20, 95}, {19, 96}, {18, 96}, {17, 97}, {16, 97}, {16, 98}, {15, 98}, {14, 99}, {13, 100}, {12, 100},  },
-  { {64, 64}, {63, 65}, {62, 65}, {62, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 68}, {57, 69}, {56, 70}, {55, 70}, {54, 71}, {53, 71}, {52, 72}, {52, 72}, {51, 73}, {50, 74}, {49, 74}, {48, 75}, {47, 75}, {47, 76}, {46, 76}, {45, 77}, {44, 77}, {43, 78}, {42, 79}, {42, 79}, {41, 80}, {40, 80}, {39, 81}, {38, 81}, {37, 82}, {37, 82}, {36, 83}, {35, 84}, {34, 84}, {33, 85}, {32, 85}, {32, 86}, {31, 86}, {30, 87}, {29, 87}, {28, 88}, {28, 89}, {27, 89}, {26, 90}, {25, 90}, {24, 91}, {23, 91}, {23, 92}, {22, 93}, {21, 93}, {20, 94}, {19, 94}, {18, 95}, {18, 95}, {17, 96}, {16, 96}, {15, 97}, {14, 98}, {13, 98}, {13, 99}, {12, 99},  },
-  { {64, 64}, {63, 65}, {62, 65}, {61, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 68}, {56, 69}, {56, 69}, {55, 70}, {54, 71}, {53, 71}, {52, 72}, {51, 72}, {51, 73}, {50, 73}, {49, 74}, {48, 74}, {47, 75}, {46, 75}, {46, 76}, {45, 77}, {44, 77}, {43, 78}, {42, 78}, {41, 79}, {41, 79}, {40, 80}, {39, 80}, {38, 81}, {37, 81}, {36, 82}, {35, 83}, {35, 83}, {34, 84}, {33, 84}, {32, 85}, {31, 85}, {30, 86}, {30, 86}, {29, 87}, {28, 87}, {27, 88}, {26, 89}, {25, 89}, {25, 90}, {24, 90}, {23, 91}, {22, 91}, {21, 92}, {20, 92}, {20, 93}, {19, 93}, {18, 94}, {17, 94}, {16, 95}, {15, 96}, {15, 96}, {14, 97}, {13, 97}, {12, 98}, {11, 98},  },
-  { {64, 64}, {63, 65}, {62, 65}, {61, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 68}, {56, 69}, {56, 69}, {55, 70}, {54, 70}, {53, 71}, {52, 71}, {51, 72}, {50, 72}, {50, 73}, {49, 74}, {48, 74}, {47, 75}, {46, 75}, {45, 76}, {44, 76}, {44, 77}, {43, 77}, {42, 78}, {41, 78}, {40, 79}, {39, 79}, {39, 80}, {38, 80}, {37, 81}, {36, 81}, {35, 82}, {34, 83}, {33, 83}, {33, 84}, {32, 84}, {31, 85}, {30, 85}, {29, 86}, {28, 86}, {28, 87}, {27, 87}, {26, 88}, {25, 88}, {24, 89}, {23, 89}, {22, 90}, {22, 90}, {21, 91}, {20, 92}, {19, 92}, {18, 93}, {17, 93}, {17, 94}, {16, 94}, {15, 95}, {14, 95}, {13, 96}, {12, 96}, {11, 97}, {11, 97},  },
-  { {64, 64}, {63, 65}, {62, 65}, {61, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 68}, {56, 69}, {55, 69}, {55, 70}, {54, 70}, {53, 71}, {52, 71}, {51, 72}, {50, 72}, {49, 73}, {49, 73}, {48, 74}, {47, 74}, {46, 75}, {45, 75}, {44, 76}, {43, 76}, {43, 77}, {42, 77}, {41, 78}, {40, 78}, {39, 79}, {38, 79}, {37, 80}, {37, 80}, {36, 81}, {35, 82}, {34, 82}, {33, 83}, {32, 83}, {31, 84}, {31, 84}, {30, 85}, {29, 85}, {28, 86}, {27, 86}, {26, 87}, {25, 87}, {25, 88}, {24, 88}, {23, 89}, {22, 89}, {21, 90}, {20, 90}, {19, 91}, {19, 91}, {18, 92}, {17, 92}, {16, 93}, {15, 93}, {14, 94}, {13, 94}, {13, 95}, {12, 95}, {11, 96}, {10, 96},  },
-  { {64, 64}, {63, 65}, {62, 65}, {61, 66}, {61, 66}, {60, 67}, {59, 67}, {58, 68}, {57, 68}, {56, 69}, {55, 69}, {54, 70}, {54, 70}, {53, 71}, {52, 71}, {51, 72}, {50, 72}, {49, 73}, {48, 73}, {48, 74}, {47, 74}, {46, 75}, {45, 75}, {44, 76}, {43, 76}, {42, 77}, {41, 77}, {41, 78}, {40, 78}, {39, 79}, {38, 79}, {37, 80}, {36, 80}, {35, 81}, {35, 81}, {34, 82}, {33, 82}, {32, 83}, {31, 83}, {30, 84}, {29, 84}, {28, 85}, {28, 85}, {27, 86}, {26, 86}, {25, 87}, {24, 87}, {23, 88}, {22, 88}, {22, 89}, {21, 89}, {20, 90}, {19, 90}, {18, 91}, {17, 91}, {16, 92}, {16, 92}, {15, 93}, {14, 93}, {13, 94}, {12, 94}, {11, 95}, {10, 95}, {9, 96},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {61, 66}, {60, 66}, {59, 67}, {58, 67}, {57, 68}, {56, 68}, {55, 69}, {54, 69}, {54, 70}, {53, 70}, {52, 71}, {51, 71}, {50, 72}, {49, 72}, {48, 73}, {47, 73}, {47, 74}, {46, 74}, {45, 75}, {44, 75}, {43, 76}, {42, 76}, {41, 77}, {40, 77}, {40, 78}, {39, 78}, {38, 79}, {37, 79}, {36, 80}, {35, 80}, {34, 80}, {33, 81}, {33, 81}, {32, 82}, {31, 82}, {30, 83}, {29, 83}, {28, 84}, {27, 84}, {26, 85}, {26, 85}, {25, 86}, {24, 86}, {23, 87}, {22, 87}, {21, 88}, {20, 88}, {19, 89}, {19, 89}, {18, 90}, {17, 90}, {16, 91}, {15, 91}, {14, 92}, {13, 92}, {12, 93}, {12, 93}, {11, 94}, {10, 94}, {9, 95},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {60, 66}, {59, 67}, {58, 67}, {57, 68}, {56, 68}, {55, 69}, {54, 69}, {53, 70}, {53, 70}, {52, 71}, {51, 71}, {50, 72}, {49, 72}, {48, 72}, {47, 73}, {46, 73}, {45, 74}, {45, 74}, {44, 75}, {43, 75}, {42, 76}, {41, 76}, {40, 77}, {39, 77}, {38, 78}, {38, 78}, {37, 79}, {36, 79}, {35, 79}, {34, 80}, {33, 80}, {32, 81}, {31, 81}, {30, 82}, {30, 82}, {29, 83}, {28, 83}, {27, 84}, {26, 84}, {25, 85}, {24, 85}, {23, 86}, {23, 86}, {22, 87}, {21, 87}, {20, 87}, {19, 88}, {18, 88}, {17, 89}, {16, 89}, {15, 90}, {15, 90}, {14, 91}, {13, 91}, {12, 92}, {11, 92}, {10, 93}, {9, 93}, {8, 94},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {60, 66}, {59, 67}, {58, 67}, {57, 68}, {56, 68}, {55, 69}, {54, 69}, {53, 69}, {52, 70}, {52, 70}, {51, 71}, {50, 71}, {49, 72}, {48, 72}, {47, 73}, {46, 73}, {45, 74}, {44, 74}, {44, 74}, {43, 75}, {42, 75}, {41, 76}, {40, 76}, {39, 77}, {38, 77}, {37, 78}, {36, 78}, {35, 79}, {35, 79}, {34, 79}, {33, 80}, {32, 80}, {31, 81}, {30, 81}, {29, 82}, {28, 82}, {27, 83}, {27, 83}, {26, 84}, {25, 84}, {24, 84}, {23, 85}, {22, 85}, {21, 86}, {20, 86}, {19, 87}, {19, 87}, {18, 88}, {17, 88}, {16, 89}, {15, 89}, {14, 89}, {13, 90}, {12, 90}, {11, 91}, {11, 91}, {10, 92}, {9, 92}, {8, 93},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {60, 66}, {59, 67}, {58, 67}, {57, 68}, {56, 68}, {55, 68}, {54, 69}, {53, 69}, {52, 70}, {51, 70}, {51, 71}, {50, 71}, {49, 71}, {48, 72}, {47, 72}, {46, 73}, {45, 73}, {44, 74}, {43, 74}, {42, 75}, {42, 75}, {41, 75}, {40, 76}, {39, 76}, {38, 77}, {37, 77}, {36, 78}, {35, 78}, {34, 78}, {33, 79}, {33, 79}, {32, 80}, {31, 80}, {30, 81}, {29, 81}, {28, 82}, {27, 82}, {26, 82}, {25, 83}, {24, 83}, {24, 84}, {23, 84}, {22, 85}, {21, 85}, {20, 85}, {19, 86}, {18, 86}, {17, 87}, {16, 87}, {15, 88}, {15, 88}, {14, 89}, {13, 89}, {12, 89}, {11, 90}, {10, 90}, {9, 91}, {8, 91}, {7, 92},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {59, 66}, {59, 67}, {58, 67}, {57, 67}, {56, 68}, {55, 68}, {54, 69}, {53, 69}, {52, 69}, {51, 70}, {50, 70}, {49, 71}, {49, 71}, {48, 72}, {47, 72}, {46, 72}, {45, 73}, {44, 73}, {43, 74}, {42, 74}, {41, 75}, {40, 75}, {40, 75}, {39, 76}, {38, 76}, {37, 77}, {36, 77}, {35, 78}, {34, 78}, {33, 78}, {32, 79}, {31, 79}, {30, 80}, {30, 80}, {29, 80}, {28, 81}, {27, 81}, {26, 82}, {25, 82}, {24, 83}, {23, 83}, {22, 83}, {21, 84}, {20, 84}, {20, 85}, {19, 85}, {18, 86}, {17, 86}, {16, 86}, {15, 87}, {14, 87}, {13, 88}, {12, 88}, {11, 89}, {11, 89}, {10, 89}, {9, 90}, {8, 90}, {7, 91},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {59, 66}, {59, 66}, {58, 67}, {57, 67}, {56, 68}, {55, 68}, {54, 68}, {53, 69}, {52, 69}, {51, 70}, {50, 70}, {49, 71}, {48, 71}, {48, 71}, {47, 72}, {46, 72}, {45, 73}, {44, 73}, {43, 73}, {42, 74}, {41, 74}, {40, 75}, {39, 75}, {38, 75}, {38, 76}, {37, 76}, {36, 77}, {35, 77}, {34, 77}, {33, 78}, {32, 78}, {31, 79}, {30, 79}, {29, 79}, {28, 80}, {27, 80}, {27, 81}, {26, 81}, {25, 81}, {24, 82}, {23, 82}, {22, 83}, {21, 83}, {20, 84}, {19, 84}, {18, 84}, {17, 85}, {16, 85}, {16, 86}, {15, 86}, {14, 86}, {13, 87}, {12, 87}, {11, 88}, {10, 88}, {9, 88}, {8, 89}, {7, 89}, {6, 90},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 66}, {59, 66}, {58, 66}, {58, 67}, {57, 67}, {56, 68}, {55, 68}, {54, 68}, {53, 69}, {52, 69}, {51, 69}, {50, 70}, {49, 70}, {48, 71}, {47, 71}, {47, 71}, {46, 72}, {45, 72}, {44, 73}, {43, 73}, {42, 73}, {41, 74}, {40, 74}, {39, 75}, {38, 75}, {37, 75}, {36, 76}, {35, 76}, {35, 77}, {34, 77}, {33, 77}, {32, 78}, {31, 78}, {30, 78}, {29, 79}, {28, 79}, {27, 80}, {26, 80}, {25, 80}, {24, 81}, {23, 81}, {23, 82}, {22, 82}, {21, 82}, {20, 83}, {19, 83}, {18, 84}, {17, 84}, {16, 84}, {15, 85}, {14, 85}, {13, 85}, {12, 86}, {12, 86}, {11, 87}, {10, 87}, {9, 87}, {8, 88}, {7, 88}, {6, 89},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 66}, {58, 66}, {58, 67}, {57, 67}, {56, 67}, {55, 68}, {54, 68}, {53, 68}, {52, 69}, {51, 69}, {50, 70}, {49, 70}, {48, 70}, {47, 71}, {46, 71}, {45, 71}, {45, 72}, {44, 72}, {43, 73}, {42, 73}, {41, 73}, {40, 74}, {39, 74}, {38, 74}, {37, 75}, {36, 75}, {35, 76}, {34, 76}, {33, 76}, {32, 77}, {32, 77}, {31, 77}, {30, 78}, {29, 78}, {28, 79}, {27, 79}, {26, 79}, {25, 80}, {24, 80}, {23, 80}, {22, 81}, {21, 81}, {20, 82}, {19, 82}, {19, 82}, {18, 83}, {17, 83}, {16, 83}, {15, 84}, {14, 84}, {13, 85}, {12, 85}, {11, 85}, {10, 86}, {9, 86}, {8, 86}, {7, 87}, {7, 87}, {6, 88},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 66}, {58, 66}, {57, 67}, {57, 67}, {56, 67}, {55, 68}, {54, 68}, {53, 68}, {52, 69}, {51, 69}, {50, 69}, {49, 70}, {48, 70}, {47, 70}, {46, 71}, {45, 71}, {44, 72}, {43, 72}, {43, 72}, {42, 73}, {41, 73}, {40, 73}, {39, 74}, {38, 74}, {37, 74}, {36, 75}, {35, 75}, {34, 75}, {33, 76}, {32, 76}, {31, 77}, {30, 77}, {29, 77}, {29, 78}, {28, 78}, {27, 78}, {26, 79}, {25, 79}, {24, 79}, {23, 80}, {22, 80}, {21, 80}, {20, 81}, {19, 81}, {18, 82}, {17, 82}, {16, 82}, {15, 83}, {15, 83}, {14, 83}, {13, 84}, {12, 84}, {11, 84}, {10, 85}, {9, 85}, {8, 86}, {7, 86}, {6, 86}, {5, 87},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 66}, {58, 66}, {57, 66}, {56, 67}, {56, 67}, {55, 67}, {54, 68}, {53, 68}, {52, 68}, {51, 69}, {50, 69}, {49, 69}, {48, 70}, {47, 70}, {46, 70}, {45, 71}, {44, 71}, {43, 72}, {42, 72}, {41, 72}, {41, 73}, {40, 73}, {39, 73}, {38, 74}, {37, 74}, {36, 74}, {35, 75}, {34, 75}, {33, 75}, {32, 76}, {31, 76}, {30, 76}, {29, 77}, {28, 77}, {27, 77}, {26, 78}, {25, 78}, {25, 78}, {24, 79}, {23, 79}, {22, 79}, {21, 80}, {20, 80}, {19, 80}, {18, 81}, {17, 81}, {16, 81}, {15, 82}, {14, 82}, {13, 82}, {12, 83}, {11, 83}, {10, 83}, {9, 84}, {9, 84}, {8, 85}, {7, 85}, {6, 85}, {5, 86},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 66}, {58, 66}, {57, 66}, {56, 67}, {55, 67}, {55, 67}, {54, 68}, {53, 68}, {52, 68}, {51, 69}, {50, 69}, {49, 69}, {48, 70}, {47, 70}, {46, 70}, {45, 71}, {44, 71}, {43, 71}, {42, 71}, {41, 72}, {40, 72}, {39, 72}, {38, 73}, {38, 73}, {37, 73}, {36, 74}, {35, 74}, {34, 74}, {33, 75}, {32, 75}, {31, 75}, {30, 76}, {29, 76}, {28, 76}, {27, 77}, {26, 77}, {25, 77}, {24, 78}, {23, 78}, {22, 78}, {21, 79}, {21, 79}, {20, 79}, {19, 80}, {18, 80}, {17, 80}, {16, 81}, {15, 81}, {14, 81}, {13, 82}, {12, 82}, {11, 82}, {10, 83}, {9, 83}, {8, 83}, {7, 84}, {6, 84}, {5, 84}, {4, 85},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 66}, {58, 66}, {57, 66}, {56, 66}, {55, 67}, {54, 67}, {54, 67}, {53, 68}, {52, 68}, {51, 68}, {50, 69}, {49, 69}, {48, 69}, {47, 70}, {46, 70}, {45, 70}, {44, 70}, {43, 71}, {42, 71}, {41, 71}, {40, 72}, {39, 72}, {38, 72}, {37, 73}, {36, 73}, {35, 73}, {35, 74}, {34, 74}, {33, 74}, {32, 75}, {31, 75}, {30, 75}, {29, 75}, {28, 76}, {27, 76}, {26, 76}, {25, 77}, {24, 77}, {23, 77}, {22, 78}, {21, 78}, {20, 78}, {19, 79}, {18, 79}, {17, 79}, {16, 79}, {15, 80}, {15, 80}, {14, 80}, {13, 81}, {12, 81}, {11, 81}, {10, 82}, {9, 82}, {8, 82}, {7, 83}, {6, 83}, {5, 83}, {4, 83},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 65}, {58, 66}, {57, 66}, {56, 66}, {55, 67}, {54, 67}, {53, 67}, {53, 68}, {52, 68}, {51, 68}, {50, 68}, {49, 69}, {48, 69}, {47, 69}, {46, 70}, {45, 70}, {44, 70}, {43, 70}, {42, 71}, {41, 71}, {40, 71}, {39, 72}, {38, 72}, {37, 72}, {36, 72}, {35, 73}, {34, 73}, {33, 73}, {32, 74}, {31, 74}, {31, 74}, {30, 75}, {29, 75}, {28, 75}, {27, 75}, {26, 76}, {25, 76}, {24, 76}, {23, 77}, {22, 77}, {21, 77}, {20, 77}, {19, 78}, {18, 78}, {17, 78}, {16, 79}, {15, 79}, {14, 79}, {13, 79}, {12, 80}, {11, 80}, {10, 80}, {9, 81}, {9, 81}, {8, 81}, {7, 82}, {6, 82}, {5, 82}, {4, 82},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 65}, {58, 66}, {57, 66}, {56, 66}, {55, 66}, {54, 67}, {53, 67}, {52, 67}, {52, 68}, {51, 68}, {50, 68}, {49, 68}, {48, 69}, {47, 69}, {46, 69}, {45, 70}, {44, 70}, {43, 70}, {42, 70}, {41, 71}, {40, 71}, {39, 71}, {38, 71}, {37, 72}, {36, 72}, {35, 72}, {34, 73}, {33, 73}, {32, 73}, {31, 73}, {30, 74}, {29, 74}, {28, 74}, {27, 74}, {27, 75}, {26, 75}, {25, 75}, {24, 76}, {23, 76}, {22, 76}, {21, 76}, {20, 77}, {19, 77}, {18, 77}, {17, 78}, {16, 78}, {15, 78}, {14, 78}, {13, 79}, {12, 79}, {11, 79}, {10, 79}, {9, 80}, {8, 80}, {7, 80}, {6, 81}, {5, 81}, {4, 81}, {3, 81},  },
-  { {64, 64}, {63, 64}, {62, 65}, {61, 65}, {60, 65}, {59, 65}, {58, 66}, {57, 66}, {56, 66}, {55, 66}, {54, 67}, {53, 67}, {52, 67}, {51, 67}, {50, 68}, {50, 68}, {49, 68}, {48, 68}, {47, 69}, {46, 69}, {45, 69}, {44, 69}, {43, 70}, {42, 70}, {41, 70}, {40, 70}, {39, 71}, {38, 71}, {37, 71}, {36, 72}, {35, 72}, {34, 72}, {33, 72}, {32, 73}, {31, 73}, {30, 73}, {29, 73}, {28, 74}, {27, 74}, {26, 74}, {25, 74}, {24, 75}, {23, 75}, {22, 75}, {21, 75}, {21, 76}, {20, 76}, {19, 76}, {18, 76}, {17, 77}, {16, 77}, {15, 77}, {14, 77}, {13, 78}, {12, 78}, {11, 78}, {10, 78}, {9, 79}, {8, 79}, {7, 79}, {6, 80}, {5, 80}, {4, 80}, {3, 80},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 65}, {60, 65}, {59, 65}, {58, 65}, {57, 66}, {56, 66}, {55, 66}, {54, 66}, {53, 67}, {52, 67}, {51, 67}, {50, 67}, {49, 68}, {48, 68}, {48, 68}, {47, 68}, {46, 69}, {45, 69}, {44, 69}, {43, 69}, {42, 70}, {41, 70}, {40, 70}, {39, 70}, {38, 71}, {37, 71}, {36, 71}, {35, 71}, {34, 71}, {33, 72}, {32, 72}, {31, 72}, {30, 72}, {29, 73}, {28, 73}, {27, 73}, {26, 73}, {25, 74}, {24, 74}, {23, 74}, {22, 74}, {21, 75}, {20, 75}, {19, 75}, {18, 75}, {17, 76}, {16, 76}, {15, 76}, {15, 76}, {14, 77}, {13, 77}, {12, 77}, {11, 77}, {10, 78}, {9, 78}, {8, 78}, {7, 78}, {6, 79}, {5, 79}, {4, 79}, {3, 79},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 65}, {60, 65}, {59, 65}, {58, 65}, {57, 66}, {56, 66}, {55, 66}, {54, 66}, {53, 66}, {52, 67}, {51, 67}, {50, 67}, {49, 67}, {48, 68}, {47, 68}, {46, 68}, {45, 68}, {45, 68}, {44, 69}, {43, 69}, {42, 69}, {41, 69}, {40, 70}, {39, 70}, {38, 70}, {37, 70}, {36, 71}, {35, 71}, {34, 71}, {33, 71}, {32, 71}, {31, 72}, {30, 72}, {29, 72}, {28, 72}, {27, 73}, {26, 73}, {25, 73}, {24, 73}, {23, 73}, {22, 74}, {21, 74}, {20, 74}, {19, 74}, {18, 75}, {17, 75}, {16, 75}, {15, 75}, {14, 75}, {13, 76}, {12, 76}, {11, 76}, {10, 76}, {9, 77}, {8, 77}, {7, 77}, {7, 77}, {6, 77}, {5, 78}, {4, 78}, {3, 78},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 65}, {60, 65}, {59, 65}, {58, 65}, {57, 65}, {56, 66}, {55, 66}, {54, 66}, {53, 66}, {52, 66}, {51, 67}, {50, 67}, {49, 67}, {48, 67}, {47, 68}, {46, 68}, {45, 68}, {44, 68}, {43, 68}, {42, 69}, {42, 69}, {41, 69}, {40, 69}, {39, 69}, {38, 70}, {37, 70}, {36, 70}, {35, 70}, {34, 70}, {33, 71}, {32, 71}, {31, 71}, {30, 71}, {29, 71}, {28, 72}, {27, 72}, {26, 72}, {25, 72}, {24, 73}, {23, 73}, {22, 73}, {21, 73}, {20, 73}, {19, 74}, {18, 74}, {17, 74}, {16, 74}, {15, 74}, {14, 75}, {13, 75}, {12, 75}, {11, 75}, {10, 75}, {9, 76}, {8, 76}, {7, 76}, {6, 76}, {5, 76}, {4, 77}, {3, 77}, {2, 77},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 65}, {60, 65}, {59, 65}, {58, 65}, {57, 65}, {56, 66}, {55, 66}, {54, 66}, {53, 66}, {52, 66}, {51, 66}, {50, 67}, {49, 67}, {48, 67}, {47, 67}, {46, 67}, {45, 68}, {44, 68}, {43, 68}, {42, 68}, {41, 68}, {40, 69}, {39, 69}, {38, 69}, {37, 69}, {37, 69}, {36, 70}, {35, 70}, {34, 70}, {33, 70}, {32, 70}, {31, 70}, {30, 71}, {29, 71}, {28, 71}, {27, 71}, {26, 71}, {25, 72}, {24, 72}, {23, 72}, {22, 72}, {21, 72}, {20, 73}, {19, 73}, {18, 73}, {17, 73}, {16, 73}, {15, 74}, {14, 74}, {13, 74}, {12, 74}, {11, 74}, {10, 74}, {9, 75}, {8, 75}, {7, 75}, {6, 75}, {5, 75}, {4, 76}, {3, 76}, {2, 76},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 65}, {60, 65}, {59, 65}, {58, 65}, {57, 65}, {56, 65}, {55, 66}, {54, 66}, {53, 66}, {52, 66}, {51, 66}, {50, 66}, {49, 67}, {48, 67}, {47, 67}, {46, 67}, {45, 67}, {44, 67}, {43, 68}, {42, 68}, {41, 68}, {40, 68}, {39, 68}, {38, 69}, {37, 69}, {36, 69}, {35, 69}, {34, 69}, {33, 69}, {32, 70}, {32, 70}, {31, 70}, {30, 70}, {29, 70}, {28, 70}, {27, 71}, {26, 71}, {25, 71}, {24, 71}, {23, 71}, {22, 71}, {21, 72}, {20, 72}, {19, 72}, {18, 72}, {17, 72}, {16, 73}, {15, 73}, {14, 73}, {13, 73}, {12, 73}, {11, 73}, {10, 74}, {9, 74}, {8, 74}, {7, 74}, {6, 74}, {5, 74}, {4, 75}, {3, 75}, {2, 75},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 65}, {59, 65}, {58, 65}, {57, 65}, {56, 65}, {55, 65}, {54, 66}, {53, 66}, {52, 66}, {51, 66}, {50, 66}, {49, 66}, {48, 67}, {47, 67}, {46, 67}, {45, 67}, {44, 67}, {43, 67}, {42, 67}, {41, 68}, {40, 68}, {39, 68}, {38, 68}, {37, 68}, {36, 68}, {35, 69}, {34, 69}, {33, 69}, {32, 69}, {31, 69}, {30, 69}, {29, 69}, {28, 70}, {27, 70}, {26, 70}, {25, 70}, {24, 70}, {24, 70}, {23, 71}, {22, 71}, {21, 71}, {20, 71}, {19, 71}, {18, 71}, {17, 72}, {16, 72}, {15, 72}, {14, 72}, {13, 72}, {12, 72}, {11, 72}, {10, 73}, {9, 73}, {8, 73}, {7, 73}, {6, 73}, {5, 73}, {4, 74}, {3, 74}, {2, 74},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 65}, {59, 65}, {58, 65}, {57, 65}, {56, 65}, {55, 65}, {54, 65}, {53, 66}, {52, 66}, {51, 66}, {50, 66}, {49, 66}, {48, 66}, {47, 66}, {46, 67}, {45, 67}, {44, 67}, {43, 67}, {42, 67}, {41, 67}, {40, 67}, {39, 67}, {38, 68}, {37, 68}, {36, 68}, {35, 68}, {34, 68}, {33, 68}, {32, 68}, {31, 69}, {30, 69}, {29, 69}, {28, 69}, {27, 69}, {26, 69}, {25, 69}, {24, 70}, {23, 70}, {22, 70}, {21, 70}, {20, 70}, {19, 70}, {18, 70}, {17, 71}, {16, 71}, {15, 71}, {14, 71}, {13, 71}, {13, 71}, {12, 71}, {11, 72}, {10, 72}, {9, 72}, {8, 72}, {7, 72}, {6, 72}, {5, 72}, {4, 72}, {3, 73}, {2, 73},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 65}, {58, 65}, {57, 65}, {56, 65}, {55, 65}, {54, 65}, {53, 65}, {52, 65}, {51, 66}, {50, 66}, {49, 66}, {48, 66}, {47, 66}, {46, 66}, {45, 66}, {44, 66}, {43, 67}, {42, 67}, {41, 67}, {40, 67}, {39, 67}, {38, 67}, {37, 67}, {36, 67}, {35, 68}, {34, 68}, {33, 68}, {32, 68}, {31, 68}, {30, 68}, {29, 68}, {28, 68}, {27, 69}, {26, 69}, {25, 69}, {24, 69}, {23, 69}, {22, 69}, {21, 69}, {20, 69}, {19, 69}, {18, 70}, {17, 70}, {16, 70}, {15, 70}, {14, 70}, {13, 70}, {12, 70}, {11, 70}, {10, 71}, {9, 71}, {8, 71}, {7, 71}, {6, 71}, {5, 71}, {4, 71}, {3, 71}, {2, 72}, {1, 72},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 65}, {58, 65}, {57, 65}, {56, 65}, {55, 65}, {54, 65}, {53, 65}, {52, 65}, {51, 65}, {50, 65}, {49, 66}, {48, 66}, {47, 66}, {46, 66}, {45, 66}, {44, 66}, {43, 66}, {42, 66}, {41, 66}, {40, 67}, {39, 67}, {38, 67}, {37, 67}, {36, 67}, {35, 67}, {34, 67}, {33, 67}, {32, 67}, {31, 67}, {30, 68}, {29, 68}, {28, 68}, {27, 68}, {26, 68}, {25, 68}, {24, 68}, {23, 68}, {22, 68}, {21, 68}, {20, 69}, {19, 69}, {18, 69}, {17, 69}, {16, 69}, {15, 69}, {14, 69}, {13, 69}, {12, 69}, {11, 70}, {10, 70}, {9, 70}, {8, 70}, {7, 70}, {6, 70}, {5, 70}, {4, 70}, {3, 70}, {2, 70}, {1, 71},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 65}, {57, 65}, {56, 65}, {55, 65}, {54, 65}, {53, 65}, {52, 65}, {51, 65}, {50, 65}, {49, 65}, {48, 65}, {47, 65}, {46, 66}, {45, 66}, {44, 66}, {43, 66}, {42, 66}, {41, 66}, {40, 66}, {39, 66}, {38, 66}, {37, 66}, {36, 66}, {35, 67}, {34, 67}, {33, 67}, {32, 67}, {31, 67}, {30, 67}, {29, 67}, {28, 67}, {27, 67}, {26, 67}, {25, 67}, {24, 67}, {23, 68}, {22, 68}, {21, 68}, {20, 68}, {19, 68}, {18, 68}, {17, 68}, {16, 68}, {15, 68}, {14, 68}, {13, 68}, {12, 69}, {11, 69}, {10, 69}, {9, 69}, {8, 69}, {7, 69}, {6, 69}, {5, 69}, {4, 69}, {3, 69}, {2, 69}, {1, 69},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 65}, {55, 65}, {54, 65}, {53, 65}, {52, 65}, {51, 65}, {50, 65}, {49, 65}, {48, 65}, {47, 65}, {46, 65}, {45, 65}, {44, 65}, {43, 65}, {42, 66}, {41, 66}, {40, 66}, {39, 66}, {38, 66}, {37, 66}, {36, 66}, {35, 66}, {34, 66}, {33, 66}, {32, 66}, {31, 66}, {30, 66}, {29, 66}, {28, 67}, {27, 67}, {26, 67}, {25, 67}, {24, 67}, {23, 67}, {22, 67}, {21, 67}, {20, 67}, {19, 67}, {18, 67}, {17, 67}, {16, 67}, {15, 67}, {14, 67}, {13, 68}, {12, 68}, {11, 68}, {10, 68}, {9, 68}, {8, 68}, {7, 68}, {6, 68}, {5, 68}, {4, 68}, {3, 68}, {2, 68}, {1, 68},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 65}, {53, 65}, {52, 65}, {51, 65}, {50, 65}, {49, 65}, {48, 65}, {47, 65}, {46, 65}, {45, 65}, {44, 65}, {43, 65}, {42, 65}, {41, 65}, {40, 65}, {39, 65}, {38, 65}, {37, 65}, {36, 65}, {35, 66}, {34, 66}, {33, 66}, {32, 66}, {31, 66}, {30, 66}, {29, 66}, {28, 66}, {27, 66}, {26, 66}, {25, 66}, {24, 66}, {23, 66}, {22, 66}, {21, 66}, {20, 66}, {19, 66}, {18, 66}, {17, 66}, {16, 67}, {15, 67}, {14, 67}, {13, 67}, {12, 67}, {11, 67}, {10, 67}, {9, 67}, {8, 67}, {7, 67}, {6, 67}, {5, 67}, {4, 67}, {3, 67}, {2, 67}, {1, 67},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 64}, {53, 64}, {52, 64}, {51, 64}, {50, 64}, {49, 65}, {48, 65}, {47, 65}, {46, 65}, {45, 65}, {44, 65}, {43, 65}, {42, 65}, {41, 65}, {40, 65}, {39, 65}, {38, 65}, {37, 65}, {36, 65}, {35, 65}, {34, 65}, {33, 65}, {32, 65}, {31, 65}, {30, 65}, {29, 65}, {28, 65}, {27, 65}, {26, 65}, {25, 65}, {24, 65}, {23, 65}, {22, 65}, {21, 66}, {20, 66}, {19, 66}, {18, 66}, {17, 66}, {16, 66}, {15, 66}, {14, 66}, {13, 66}, {12, 66}, {11, 66}, {10, 66}, {9, 66}, {8, 66}, {7, 66}, {6, 66}, {5, 66}, {4, 66}, {3, 66}, {2, 66}, {1, 66},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 64}, {53, 64}, {52, 64}, {51, 64}, {50, 64}, {49, 64}, {48, 64}, {47, 64}, {46, 64}, {45, 64}, {44, 64}, {43, 64}, {42, 64}, {41, 64}, {40, 64}, {39, 64}, {38, 64}, {37, 64}, {36, 64}, {35, 65}, {34, 65}, {33, 65}, {32, 65}, {31, 65}, {30, 65}, {29, 65}, {28, 65}, {27, 65}, {26, 65}, {25, 65}, {24, 65}, {23, 65}, {22, 65}, {21, 65}, {20, 65}, {19, 65}, {18, 65}, {17, 65}, {16, 65}, {15, 65}, {14, 65}, {13, 65}, {12, 65}, {11, 65}, {10, 65}, {9, 65}, {8, 65}, {7, 65}, {6, 65}, {5, 65}, {4, 65}, {3, 65}, {2, 65}, {1, 65},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 64}, {53, 64}, {52, 64}, {51, 64}, {50, 64}, {49, 64}, {48, 64}, {47, 64}, {46, 64}, {45, 64}, {44, 64}, {43, 64}, {42, 64}, {41, 64}, {40, 64}, {39, 64}, {38, 64}, {37, 64}, {36, 64}, {35, 64}, {34, 64}, {33, 64}, {32, 64}, {31, 64}, {30, 64}, {29, 64}, {28, 64}, {27, 64}, {26, 64}, {25, 64}, {24, 64}, {23, 64}, {22, 64}, {21, 64}, {20, 64}, {19, 64}, {18, 64}, {17, 64}, {16, 64}, {15, 64}, {14, 64}, {13, 64}, {12, 64}, {11, 64}, {10, 64}, {9, 64}, {8, 64}, {7, 64}, {6, 64}, {5, 64}, {4, 64}, {3, 64}, {2, 64}, {1, 64},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 64}, {53, 64}, {52, 64}, {51, 64}, {50, 64}, {49, 64}, {48, 64}, {47, 64}, {46, 64}, {45, 64}, {44, 64}, {43, 64}, {42, 64}, {41, 64}, {40, 64}, {39, 64}, {38, 64}, {37, 64}, {36, 64}, {35, 63}, {34, 63}, {33, 63}, {32, 63}, {31, 63}, {30, 63}, {29, 63}, {28, 63}, {27, 63}, {26, 63}, {25, 63}, {24, 63}, {23, 63}, {22, 63}, {21, 63}, {20, 63}, {19, 63}, {18, 63}, {17, 63}, {16, 63}, {15, 63}, {14, 63}, {13, 63}, {12, 63}, {11, 63}, {10, 63}, {9, 63}, {8, 63}, {7, 63}, {6, 63}, {5, 63}, {4, 63}, {3, 63}, {2, 63}, {1, 63},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 64}, {53, 64}, {52, 64}, {51, 64}, {50, 64}, {49, 63}, {48, 63}, {47, 63}, {46, 63}, {45, 63}, {44, 63}, {43, 63}, {42, 63}, {41, 63}, {40, 63}, {39, 63}, {38, 63}, {37, 63}, {36, 63}, {35, 63}, {34, 63}, {33, 63}, {32, 63}, {31, 63}, {30, 63}, {29, 63}, {28, 63}, {27, 63}, {26, 63}, {25, 63}, {24, 63}, {23, 63}, {22, 63}, {21, 62}, {20, 62}, {19, 62}, {18, 62}, {17, 62}, {16, 62}, {15, 62}, {14, 62}, {13, 62}, {12, 62}, {11, 62}, {10, 62}, {9, 62}, {8, 62}, {7, 62}, {6, 62}, {5, 62}, {4, 62}, {3, 62}, {2, 62}, {1, 62},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 64}, {55, 64}, {54, 63}, {53, 63}, {52, 63}, {51, 63}, {50, 63}, {49, 63}, {48, 63}, {47, 63}, {46, 63}, {45, 63}, {44, 63}, {43, 63}, {42, 63}, {41, 63}, {40, 63}, {39, 63}, {38, 63}, {37, 63}, {36, 63}, {35, 62}, {34, 62}, {33, 62}, {32, 62}, {31, 62}, {30, 62}, {29, 62}, {28, 62}, {27, 62}, {26, 62}, {25, 62}, {24, 62}, {23, 62}, {22, 62}, {21, 62}, {20, 62}, {19, 62}, {18, 62}, {17, 62}, {16, 61}, {15, 61}, {14, 61}, {13, 61}, {12, 61}, {11, 61}, {10, 61}, {9, 61}, {8, 61}, {7, 61}, {6, 61}, {5, 61}, {4, 61}, {3, 61}, {2, 61}, {1, 61},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 64}, {57, 64}, {56, 63}, {55, 63}, {54, 63}, {53, 63}, {52, 63}, {51, 63}, {50, 63}, {49, 63}, {48, 63}, {47, 63}, {46, 63}, {45, 63}, {44, 63}, {43, 63}, {42, 62}, {41, 62}, {40, 62}, {39, 62}, {38, 62}, {37, 62}, {36, 62}, {35, 62}, {34, 62}, {33, 62}, {32, 62}, {31, 62}, {30, 62}, {29, 62}, {28, 61}, {27, 61}, {26, 61}, {25, 61}, {24, 61}, {23, 61}, {22, 61}, {21, 61}, {20, 61}, {19, 61}, {18, 61}, {17, 61}, {16, 61}, {15, 61}, {14, 61}, {13, 60}, {12, 60}, {11, 60}, {10, 60}, {9, 60}, {8, 60}, {7, 60}, {6, 60}, {5, 60}, {4, 60}, {3, 60}, {2, 60}, {1, 60},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 64}, {58, 63}, {57, 63}, {56, 63}, {55, 63}, {54, 63}, {53, 63}, {52, 63}, {51, 63}, {50, 63}, {49, 63}, {48, 63}, {47, 63}, {46, 62}, {45, 62}, {44, 62}, {43, 62}, {42, 62}, {41, 62}, {40, 62}, {39, 62}, {38, 62}, {37, 62}, {36, 62}, {35, 61}, {34, 61}, {33, 61}, {32, 61}, {31, 61}, {30, 61}, {29, 61}, {28, 61}, {27, 61}, {26, 61}, {25, 61}, {24, 61}, {23, 60}, {22, 60}, {21, 60}, {20, 60}, {19, 60}, {18, 60}, {17, 60}, {16, 60}, {15, 60}, {14, 60}, {13, 60}, {12, 59}, {11, 59}, {10, 59}, {9, 59}, {8, 59}, {7, 59}, {6, 59}, {5, 59}, {4, 59}, {3, 59}, {2, 59}, {1, 59},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 63}, {58, 63}, {57, 63}, {56, 63}, {55, 63}, {54, 63}, {53, 63}, {52, 63}, {51, 63}, {50, 63}, {49, 62}, {48, 62}, {47, 62}, {46, 62}, {45, 62}, {44, 62}, {43, 62}, {42, 62}, {41, 62}, {40, 61}, {39, 61}, {38, 61}, {37, 61}, {36, 61}, {35, 61}, {34, 61}, {33, 61}, {32, 61}, {31, 61}, {30, 60}, {29, 60}, {28, 60}, {27, 60}, {26, 60}, {25, 60}, {24, 60}, {23, 60}, {22, 60}, {21, 60}, {20, 59}, {19, 59}, {18, 59}, {17, 59}, {16, 59}, {15, 59}, {14, 59}, {13, 59}, {12, 59}, {11, 58}, {10, 58}, {9, 58}, {8, 58}, {7, 58}, {6, 58}, {5, 58}, {4, 58}, {3, 58}, {2, 58}, {1, 57},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 64}, {59, 63}, {58, 63}, {57, 63}, {56, 63}, {55, 63}, {54, 63}, {53, 63}, {52, 63}, {51, 62}, {50, 62}, {49, 62}, {48, 62}, {47, 62}, {46, 62}, {45, 62}, {44, 62}, {43, 61}, {42, 61}, {41, 61}, {40, 61}, {39, 61}, {38, 61}, {37, 61}, {36, 61}, {35, 60}, {34, 60}, {33, 60}, {32, 60}, {31, 60}, {30, 60}, {29, 60}, {28, 60}, {27, 59}, {26, 59}, {25, 59}, {24, 59}, {23, 59}, {22, 59}, {21, 59}, {20, 59}, {19, 59}, {18, 58}, {17, 58}, {16, 58}, {15, 58}, {14, 58}, {13, 58}, {12, 58}, {11, 58}, {10, 57}, {9, 57}, {8, 57}, {7, 57}, {6, 57}, {5, 57}, {4, 57}, {3, 57}, {2, 56}, {1, 56},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 63}, {59, 63}, {58, 63}, {57, 63}, {56, 63}, {55, 63}, {54, 63}, {53, 62}, {52, 62}, {51, 62}, {50, 62}, {49, 62}, {48, 62}, {47, 62}, {46, 61}, {45, 61}, {44, 61}, {43, 61}, {42, 61}, {41, 61}, {40, 61}, {39, 61}, {38, 60}, {37, 60}, {36, 60}, {35, 60}, {34, 60}, {33, 60}, {32, 60}, {31, 59}, {30, 59}, {29, 59}, {28, 59}, {27, 59}, {26, 59}, {25, 59}, {24, 58}, {23, 58}, {22, 58}, {21, 58}, {20, 58}, {19, 58}, {18, 58}, {17, 57}, {16, 57}, {15, 57}, {14, 57}, {13, 57}, {13, 57}, {12, 57}, {11, 56}, {10, 56}, {9, 56}, {8, 56}, {7, 56}, {6, 56}, {5, 56}, {4, 56}, {3, 55}, {2, 55},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 64}, {60, 63}, {59, 63}, {58, 63}, {57, 63}, {56, 63}, {55, 63}, {54, 62}, {53, 62}, {52, 62}, {51, 62}, {50, 62}, {49, 62}, {48, 61}, {47, 61}, {46, 61}, {45, 61}, {44, 61}, {43, 61}, {42, 61}, {41, 60}, {40, 60}, {39, 60}, {38, 60}, {37, 60}, {36, 60}, {35, 59}, {34, 59}, {33, 59}, {32, 59}, {31, 59}, {30, 59}, {29, 59}, {28, 58}, {27, 58}, {26, 58}, {25, 58}, {24, 58}, {24, 58}, {23, 57}, {22, 57}, {21, 57}, {20, 57}, {19, 57}, {18, 57}, {17, 56}, {16, 56}, {15, 56}, {14, 56}, {13, 56}, {12, 56}, {11, 56}, {10, 55}, {9, 55}, {8, 55}, {7, 55}, {6, 55}, {5, 55}, {4, 54}, {3, 54}, {2, 54},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 63}, {60, 63}, {59, 63}, {58, 63}, {57, 63}, {56, 63}, {55, 62}, {54, 62}, {53, 62}, {52, 62}, {51, 62}, {50, 62}, {49, 61}, {48, 61}, {47, 61}, {46, 61}, {45, 61}, {44, 61}, {43, 60}, {42, 60}, {41, 60}, {40, 60}, {39, 60}, {38, 59}, {37, 59}, {36, 59}, {35, 59}, {34, 59}, {33, 59}, {32, 58}, {32, 58}, {31, 58}, {30, 58}, {29, 58}, {28, 58}, {27, 57}, {26, 57}, {25, 57}, {24, 57}, {23, 57}, {22, 57}, {21, 56}, {20, 56}, {19, 56}, {18, 56}, {17, 56}, {16, 55}, {15, 55}, {14, 55}, {13, 55}, {12, 55}, {11, 55}, {10, 54}, {9, 54}, {8, 54}, {7, 54}, {6, 54}, {5, 54}, {4, 53}, {3, 53}, {2, 53},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 63}, {60, 63}, {59, 63}, {58, 63}, {57, 63}, {56, 62}, {55, 62}, {54, 62}, {53, 62}, {52, 62}, {51, 62}, {50, 61}, {49, 61}, {48, 61}, {47, 61}, {46, 61}, {45, 60}, {44, 60}, {43, 60}, {42, 60}, {41, 60}, {40, 59}, {39, 59}, {38, 59}, {37, 59}, {37, 59}, {36, 58}, {35, 58}, {34, 58}, {33, 58}, {32, 58}, {31, 58}, {30, 57}, {29, 57}, {28, 57}, {27, 57}, {26, 57}, {25, 56}, {24, 56}, {23, 56}, {22, 56}, {21, 56}, {20, 55}, {19, 55}, {18, 55}, {17, 55}, {16, 55}, {15, 54}, {14, 54}, {13, 54}, {12, 54}, {11, 54}, {10, 54}, {9, 53}, {8, 53}, {7, 53}, {6, 53}, {5, 53}, {4, 52}, {3, 52}, {2, 52},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 63}, {60, 63}, {59, 63}, {58, 63}, {57, 63}, {56, 62}, {55, 62}, {54, 62}, {53, 62}, {52, 62}, {51, 61}, {50, 61}, {49, 61}, {48, 61}, {47, 60}, {46, 60}, {45, 60}, {44, 60}, {43, 60}, {42, 59}, {42, 59}, {41, 59}, {40, 59}, {39, 59}, {38, 58}, {37, 58}, {36, 58}, {35, 58}, {34, 58}, {33, 57}, {32, 57}, {31, 57}, {30, 57}, {29, 57}, {28, 56}, {27, 56}, {26, 56}, {25, 56}, {24, 55}, {23, 55}, {22, 55}, {21, 55}, {20, 55}, {19, 54}, {18, 54}, {17, 54}, {16, 54}, {15, 54}, {14, 53}, {13, 53}, {12, 53}, {11, 53}, {10, 53}, {9, 52}, {8, 52}, {7, 52}, {6, 52}, {5, 52}, {4, 51}, {3, 51}, {2, 51},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 63}, {60, 63}, {59, 63}, {58, 63}, {57, 62}, {56, 62}, {55, 62}, {54, 62}, {53, 62}, {52, 61}, {51, 61}, {50, 61}, {49, 61}, {48, 60}, {47, 60}, {46, 60}, {45, 60}, {45, 60}, {44, 59}, {43, 59}, {42, 59}, {41, 59}, {40, 58}, {39, 58}, {38, 58}, {37, 58}, {36, 57}, {35, 57}, {34, 57}, {33, 57}, {32, 57}, {31, 56}, {30, 56}, {29, 56}, {28, 56}, {27, 55}, {26, 55}, {25, 55}, {24, 55}, {23, 55}, {22, 54}, {21, 54}, {20, 54}, {19, 54}, {18, 53}, {17, 53}, {16, 53}, {15, 53}, {14, 53}, {13, 52}, {12, 52}, {11, 52}, {10, 52}, {9, 51}, {8, 51}, {7, 51}, {7, 51}, {6, 51}, {5, 50}, {4, 50}, {3, 50},  },
-  { {64, 64}, {63, 64}, {62, 64}, {61, 63}, {60, 63}, {59, 63}, {58, 63}, {57, 62}, {56, 62}, {55, 62}, {54, 62}, {53, 61}, {52, 61}, {51, 61}, {50, 61}, {49, 60}, {48, 60}, {48, 60}, {47, 60}, {46, 59}, {45, 59}, {44, 59}, {43, 59}, {42, 58}, {41, 58}, {40, 58}, {39, 58}, {38, 57}, {37, 57}, {36, 57}, {35, 57}, {34, 57}, {33, 56}, {32, 56}, {31, 56}, {30, 56}, {29, 55}, {28, 55}, {27, 55}, {26, 55}, {25, 54}, {24, 54}, {23, 54}, {22, 54}, {21, 53}, {20, 53}, {19, 53}, {18, 53}, {17, 52}, {16, 52}, {15, 52}, {15, 52}, {14, 51}, {13, 51}, {12, 51}, {11, 51}, {10, 50}, {9, 50}, {8, 50}, {7, 50}, {6, 49}, {5, 49}, {4, 49}, {3, 49},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 63}, {58, 62}, {57, 62}, {56, 62}, {55, 62}, {54, 61}, {53, 61}, {52, 61}, {51, 61}, {50, 60}, {50, 60}, {49, 60}, {48, 60}, {47, 59}, {46, 59}, {45, 59}, {44, 59}, {43, 58}, {42, 58}, {41, 58}, {40, 58}, {39, 57}, {38, 57}, {37, 57}, {36, 56}, {35, 56}, {34, 56}, {33, 56}, {32, 55}, {31, 55}, {30, 55}, {29, 55}, {28, 54}, {27, 54}, {26, 54}, {25, 54}, {24, 53}, {23, 53}, {22, 53}, {21, 53}, {21, 52}, {20, 52}, {19, 52}, {18, 52}, {17, 51}, {16, 51}, {15, 51}, {14, 51}, {13, 50}, {12, 50}, {11, 50}, {10, 50}, {9, 49}, {8, 49}, {7, 49}, {6, 48}, {5, 48}, {4, 48}, {3, 48},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 63}, {58, 62}, {57, 62}, {56, 62}, {55, 62}, {54, 61}, {53, 61}, {52, 61}, {52, 60}, {51, 60}, {50, 60}, {49, 60}, {48, 59}, {47, 59}, {46, 59}, {45, 58}, {44, 58}, {43, 58}, {42, 58}, {41, 57}, {40, 57}, {39, 57}, {38, 57}, {37, 56}, {36, 56}, {35, 56}, {34, 55}, {33, 55}, {32, 55}, {31, 55}, {30, 54}, {29, 54}, {28, 54}, {27, 54}, {27, 53}, {26, 53}, {25, 53}, {24, 52}, {23, 52}, {22, 52}, {21, 52}, {20, 51}, {19, 51}, {18, 51}, {17, 50}, {16, 50}, {15, 50}, {14, 50}, {13, 49}, {12, 49}, {11, 49}, {10, 49}, {9, 48}, {8, 48}, {7, 48}, {6, 47}, {5, 47}, {4, 47}, {3, 47},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 63}, {58, 62}, {57, 62}, {56, 62}, {55, 61}, {54, 61}, {53, 61}, {53, 60}, {52, 60}, {51, 60}, {50, 60}, {49, 59}, {48, 59}, {47, 59}, {46, 58}, {45, 58}, {44, 58}, {43, 58}, {42, 57}, {41, 57}, {40, 57}, {39, 56}, {38, 56}, {37, 56}, {36, 56}, {35, 55}, {34, 55}, {33, 55}, {32, 54}, {31, 54}, {31, 54}, {30, 53}, {29, 53}, {28, 53}, {27, 53}, {26, 52}, {25, 52}, {24, 52}, {23, 51}, {22, 51}, {21, 51}, {20, 51}, {19, 50}, {18, 50}, {17, 50}, {16, 49}, {15, 49}, {14, 49}, {13, 49}, {12, 48}, {11, 48}, {10, 48}, {9, 47}, {9, 47}, {8, 47}, {7, 46}, {6, 46}, {5, 46}, {4, 46},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 62}, {58, 62}, {57, 62}, {56, 62}, {55, 61}, {54, 61}, {54, 61}, {53, 60}, {52, 60}, {51, 60}, {50, 59}, {49, 59}, {48, 59}, {47, 58}, {46, 58}, {45, 58}, {44, 58}, {43, 57}, {42, 57}, {41, 57}, {40, 56}, {39, 56}, {38, 56}, {37, 55}, {36, 55}, {35, 55}, {35, 54}, {34, 54}, {33, 54}, {32, 53}, {31, 53}, {30, 53}, {29, 53}, {28, 52}, {27, 52}, {26, 52}, {25, 51}, {24, 51}, {23, 51}, {22, 50}, {21, 50}, {20, 50}, {19, 49}, {18, 49}, {17, 49}, {16, 49}, {15, 48}, {15, 48}, {14, 48}, {13, 47}, {12, 47}, {11, 47}, {10, 46}, {9, 46}, {8, 46}, {7, 45}, {6, 45}, {5, 45}, {4, 45},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 62}, {58, 62}, {57, 62}, {56, 61}, {55, 61}, {55, 61}, {54, 60}, {53, 60}, {52, 60}, {51, 59}, {50, 59}, {49, 59}, {48, 58}, {47, 58}, {46, 58}, {45, 57}, {44, 57}, {43, 57}, {42, 57}, {41, 56}, {40, 56}, {39, 56}, {38, 55}, {38, 55}, {37, 55}, {36, 54}, {35, 54}, {34, 54}, {33, 53}, {32, 53}, {31, 53}, {30, 52}, {29, 52}, {28, 52}, {27, 51}, {26, 51}, {25, 51}, {24, 50}, {23, 50}, {22, 50}, {21, 49}, {21, 49}, {20, 49}, {19, 48}, {18, 48}, {17, 48}, {16, 47}, {15, 47}, {14, 47}, {13, 46}, {12, 46}, {11, 46}, {10, 45}, {9, 45}, {8, 45}, {7, 44}, {6, 44}, {5, 44}, {4, 43},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 62}, {58, 62}, {57, 62}, {56, 61}, {56, 61}, {55, 61}, {54, 60}, {53, 60}, {52, 60}, {51, 59}, {50, 59}, {49, 59}, {48, 58}, {47, 58}, {46, 58}, {45, 57}, {44, 57}, {43, 56}, {42, 56}, {41, 56}, {41, 55}, {40, 55}, {39, 55}, {38, 54}, {37, 54}, {36, 54}, {35, 53}, {34, 53}, {33, 53}, {32, 52}, {31, 52}, {30, 52}, {29, 51}, {28, 51}, {27, 51}, {26, 50}, {25, 50}, {25, 50}, {24, 49}, {23, 49}, {22, 49}, {21, 48}, {20, 48}, {19, 48}, {18, 47}, {17, 47}, {16, 47}, {15, 46}, {14, 46}, {13, 46}, {12, 45}, {11, 45}, {10, 45}, {9, 44}, {9, 44}, {8, 43}, {7, 43}, {6, 43}, {5, 42},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 62}, {58, 62}, {57, 61}, {57, 61}, {56, 61}, {55, 60}, {54, 60}, {53, 60}, {52, 59}, {51, 59}, {50, 59}, {49, 58}, {48, 58}, {47, 58}, {46, 57}, {45, 57}, {44, 56}, {43, 56}, {43, 56}, {42, 55}, {41, 55}, {40, 55}, {39, 54}, {38, 54}, {37, 54}, {36, 53}, {35, 53}, {34, 53}, {33, 52}, {32, 52}, {31, 51}, {30, 51}, {29, 51}, {29, 50}, {28, 50}, {27, 50}, {26, 49}, {25, 49}, {24, 49}, {23, 48}, {22, 48}, {21, 48}, {20, 47}, {19, 47}, {18, 46}, {17, 46}, {16, 46}, {15, 45}, {15, 45}, {14, 45}, {13, 44}, {12, 44}, {11, 44}, {10, 43}, {9, 43}, {8, 42}, {7, 42}, {6, 42}, {5, 41},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 63}, {59, 62}, {58, 62}, {58, 61}, {57, 61}, {56, 61}, {55, 60}, {54, 60}, {53, 60}, {52, 59}, {51, 59}, {50, 58}, {49, 58}, {48, 58}, {47, 57}, {46, 57}, {45, 57}, {45, 56}, {44, 56}, {43, 55}, {42, 55}, {41, 55}, {40, 54}, {39, 54}, {38, 54}, {37, 53}, {36, 53}, {35, 52}, {34, 52}, {33, 52}, {32, 51}, {32, 51}, {31, 51}, {30, 50}, {29, 50}, {28, 49}, {27, 49}, {26, 49}, {25, 48}, {24, 48}, {23, 48}, {22, 47}, {21, 47}, {20, 46}, {19, 46}, {19, 46}, {18, 45}, {17, 45}, {16, 45}, {15, 44}, {14, 44}, {13, 43}, {12, 43}, {11, 43}, {10, 42}, {9, 42}, {8, 42}, {7, 41}, {7, 41}, {6, 40},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {59, 62}, {58, 62}, {58, 61}, {57, 61}, {56, 60}, {55, 60}, {54, 60}, {53, 59}, {52, 59}, {51, 59}, {50, 58}, {49, 58}, {48, 57}, {47, 57}, {47, 57}, {46, 56}, {45, 56}, {44, 55}, {43, 55}, {42, 55}, {41, 54}, {40, 54}, {39, 53}, {38, 53}, {37, 53}, {36, 52}, {35, 52}, {35, 51}, {34, 51}, {33, 51}, {32, 50}, {31, 50}, {30, 50}, {29, 49}, {28, 49}, {27, 48}, {26, 48}, {25, 48}, {24, 47}, {23, 47}, {23, 46}, {22, 46}, {21, 46}, {20, 45}, {19, 45}, {18, 44}, {17, 44}, {16, 44}, {15, 43}, {14, 43}, {13, 43}, {12, 42}, {12, 42}, {11, 41}, {10, 41}, {9, 41}, {8, 40}, {7, 40}, {6, 39},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {59, 62}, {59, 62}, {58, 61}, {57, 61}, {56, 60}, {55, 60}, {54, 60}, {53, 59}, {52, 59}, {51, 58}, {50, 58}, {49, 57}, {48, 57}, {48, 57}, {47, 56}, {46, 56}, {45, 55}, {44, 55}, {43, 55}, {42, 54}, {41, 54}, {40, 53}, {39, 53}, {38, 53}, {38, 52}, {37, 52}, {36, 51}, {35, 51}, {34, 51}, {33, 50}, {32, 50}, {31, 49}, {30, 49}, {29, 49}, {28, 48}, {27, 48}, {27, 47}, {26, 47}, {25, 47}, {24, 46}, {23, 46}, {22, 45}, {21, 45}, {20, 44}, {19, 44}, {18, 44}, {17, 43}, {16, 43}, {16, 42}, {15, 42}, {14, 42}, {13, 41}, {12, 41}, {11, 40}, {10, 40}, {9, 40}, {8, 39}, {7, 39}, {6, 38},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {59, 62}, {59, 61}, {58, 61}, {57, 61}, {56, 60}, {55, 60}, {54, 59}, {53, 59}, {52, 59}, {51, 58}, {50, 58}, {49, 57}, {49, 57}, {48, 56}, {47, 56}, {46, 56}, {45, 55}, {44, 55}, {43, 54}, {42, 54}, {41, 53}, {40, 53}, {40, 53}, {39, 52}, {38, 52}, {37, 51}, {36, 51}, {35, 50}, {34, 50}, {33, 50}, {32, 49}, {31, 49}, {30, 48}, {30, 48}, {29, 48}, {28, 47}, {27, 47}, {26, 46}, {25, 46}, {24, 45}, {23, 45}, {22, 45}, {21, 44}, {20, 44}, {20, 43}, {19, 43}, {18, 42}, {17, 42}, {16, 42}, {15, 41}, {14, 41}, {13, 40}, {12, 40}, {11, 39}, {11, 39}, {10, 39}, {9, 38}, {8, 38}, {7, 37},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {60, 62}, {59, 61}, {58, 61}, {57, 60}, {56, 60}, {55, 60}, {54, 59}, {53, 59}, {52, 58}, {51, 58}, {51, 57}, {50, 57}, {49, 57}, {48, 56}, {47, 56}, {46, 55}, {45, 55}, {44, 54}, {43, 54}, {42, 53}, {42, 53}, {41, 53}, {40, 52}, {39, 52}, {38, 51}, {37, 51}, {36, 50}, {35, 50}, {34, 50}, {33, 49}, {33, 49}, {32, 48}, {31, 48}, {30, 47}, {29, 47}, {28, 46}, {27, 46}, {26, 46}, {25, 45}, {24, 45}, {24, 44}, {23, 44}, {22, 43}, {21, 43}, {20, 43}, {19, 42}, {18, 42}, {17, 41}, {16, 41}, {15, 40}, {15, 40}, {14, 39}, {13, 39}, {12, 39}, {11, 38}, {10, 38}, {9, 37}, {8, 37}, {7, 36},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {60, 62}, {59, 61}, {58, 61}, {57, 60}, {56, 60}, {55, 59}, {54, 59}, {53, 59}, {52, 58}, {52, 58}, {51, 57}, {50, 57}, {49, 56}, {48, 56}, {47, 55}, {46, 55}, {45, 54}, {44, 54}, {44, 54}, {43, 53}, {42, 53}, {41, 52}, {40, 52}, {39, 51}, {38, 51}, {37, 50}, {36, 50}, {35, 49}, {35, 49}, {34, 49}, {33, 48}, {32, 48}, {31, 47}, {30, 47}, {29, 46}, {28, 46}, {27, 45}, {27, 45}, {26, 44}, {25, 44}, {24, 44}, {23, 43}, {22, 43}, {21, 42}, {20, 42}, {19, 41}, {19, 41}, {18, 40}, {17, 40}, {16, 39}, {15, 39}, {14, 39}, {13, 38}, {12, 38}, {11, 37}, {11, 37}, {10, 36}, {9, 36}, {8, 35},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {60, 62}, {60, 62}, {59, 61}, {58, 61}, {57, 60}, {56, 60}, {55, 59}, {54, 59}, {53, 58}, {53, 58}, {52, 57}, {51, 57}, {50, 56}, {49, 56}, {48, 56}, {47, 55}, {46, 55}, {45, 54}, {45, 54}, {44, 53}, {43, 53}, {42, 52}, {41, 52}, {40, 51}, {39, 51}, {38, 50}, {38, 50}, {37, 49}, {36, 49}, {35, 49}, {34, 48}, {33, 48}, {32, 47}, {31, 47}, {30, 46}, {30, 46}, {29, 45}, {28, 45}, {27, 44}, {26, 44}, {25, 43}, {24, 43}, {23, 42}, {23, 42}, {22, 41}, {21, 41}, {20, 41}, {19, 40}, {18, 40}, {17, 39}, {16, 39}, {15, 38}, {15, 38}, {14, 37}, {13, 37}, {12, 36}, {11, 36}, {10, 35}, {9, 35}, {8, 34},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {61, 62}, {60, 62}, {59, 61}, {58, 61}, {57, 60}, {56, 60}, {55, 59}, {54, 59}, {54, 58}, {53, 58}, {52, 57}, {51, 57}, {50, 56}, {49, 56}, {48, 55}, {47, 55}, {47, 54}, {46, 54}, {45, 53}, {44, 53}, {43, 52}, {42, 52}, {41, 51}, {40, 51}, {40, 50}, {39, 50}, {38, 49}, {37, 49}, {36, 48}, {35, 48}, {34, 48}, {33, 47}, {33, 47}, {32, 46}, {31, 46}, {30, 45}, {29, 45}, {28, 44}, {27, 44}, {26, 43}, {26, 43}, {25, 42}, {24, 42}, {23, 41}, {22, 41}, {21, 40}, {20, 40}, {19, 39}, {19, 39}, {18, 38}, {17, 38}, {16, 37}, {15, 37}, {14, 36}, {13, 36}, {12, 35}, {12, 35}, {11, 34}, {10, 34}, {9, 33},  },
-  { {64, 64}, {63, 64}, {62, 63}, {61, 63}, {61, 62}, {60, 62}, {59, 61}, {58, 61}, {57, 60}, {56, 60}, {55, 59}, {54, 59}, {54, 58}, {53, 58}, {52, 57}, {51, 57}, {50, 56}, {49, 56}, {48, 55}, {48, 55}, {47, 54}, {46, 54}, {45, 53}, {44, 53}, {43, 52}, {42, 52}, {41, 51}, {41, 51}, {40, 50}, {39, 50}, {38, 49}, {37, 49}, {36, 48}, {35, 48}, {35, 47}, {34, 47}, {33, 46}, {32, 46}, {31, 45}, {30, 45}, {29, 44}, {28, 44}, {28, 43}, {27, 43}, {26, 42}, {25, 42}, {24, 41}, {23, 41}, {22, 40}, {22, 39}, {21, 39}, {20, 38}, {19, 38}, {18, 37}, {17, 37}, {16, 36}, {16, 36}, {15, 35}, {14, 35}, {13, 34}, {12, 34}, {11, 33}, {10, 33}, {9, 32},  },
-  { {64, 64}, {63, 63}, {62, 63}, {61, 62}, {61, 62}, {60, 61}, {59, 61}, {58, 60}, {57, 60}, {56, 59}, {55, 59}, {55, 58}, {54, 58}, {53, 57}, {52, 57}, {51, 56}, {50, 56}, {49, 55}, {49, 55}, {48, 54}, {47, 54}, {46, 53}, {45, 53}, {44, 52}, {43, 52}, {43, 51}, {42, 51}, {41, 50}, {40, 50}, {39, 49}, {38, 49}, {37, 48}, {37, 48}, {36, 47}, {35, 46}, {34, 46}, {33, 45}, {32, 45}, {31, 44}, {31, 44}, {30, 43}, {29, 43}, {28, 42}, {27, 42}, {26, 41}, {25, 41}, {25, 40}, {24, 40}, {23, 39}, {22, 39}, {21, 38}, {20, 38}, {19, 37}, {19, 37}, {18, 36}, {17, 36}, {16, 35}, {15, 35}, {14, 34}, {13, 34}, {13, 33}, {12, 33}, {11, 32}, {10, 32},  },
-  { {64, 64}, {63, 63}, {62, 63}, {61, 62}, {61, 62}, {60, 61}, {59, 61}, {58, 60}, {57, 60}, {56, 59}, {56, 59}, {55, 58}, {54, 58}, {53, 57}, {52, 57}, {51, 56}, {50, 56}, {50, 55}, {49, 54}, {48, 54}, {47, 53}, {46, 53}, {45, 52}, {44, 52}, {44, 51}, {43, 51}, {42, 50}, {41, 50}, {40, 49}, {39, 49}, {39, 48}, {38, 48}, {37, 47}, {36, 47}, {35, 46}, {34, 45}, {33, 45}, {33, 44}, {32, 44}, {31, 43}, {30, 43}, {29, 42}, {28, 42}, {28, 41}, {27, 41}, {26, 40}, {25, 40}, {24, 39}, {23, 39}, {22, 38}, {22, 38}, {21, 37}, {20, 36}, {19, 36}, {18, 35}, {17, 35}, {17, 34}, {16, 34}, {15, 33}, {14, 33}, {13, 32}, {12, 32}, {11, 31}, {11, 31},  },
-  { {64, 64}, {63, 63}, {62, 63}, {61, 62}, {61, 62}, {60, 61}, {59, 61}, {58, 60}, {57, 60}, {56, 59}, {56, 59}, {55, 58}, {54, 57}, {53, 57}, {52, 56}, {51, 56}, {51, 55}, {50, 55}, {49, 54}, {48, 54}, {47, 53}, {46, 53}, {46, 52}, {45, 51}, {44, 51}, {43, 50}, {42, 50}, {41, 49}, {41, 49}, {40, 48}, {39, 48}, {38, 47}, {37, 47}, {36, 46}, {35, 45}, {35, 45}, {34, 44}, {33, 44}, {32, 43}, {31, 43}, {30, 42}, {30, 42}, {29, 41}, {28, 41}, {27, 40}, {26, 39}, {25, 39}, {25, 38}, {24, 38}, {23, 37}, {22, 37}, {21, 36}, {20, 36}, {20, 35}, {19, 35}, {18, 34}, {17, 34}, {16, 33}, {15, 32}, {15, 32}, {14, 31}, {13, 31}, {12, 30}, {11, 30},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 62}, {60, 61}, {59, 61}, {58, 60}, {57, 60}, {57, 59}, {56, 58}, {55, 58}, {54, 57}, {53, 57}, {52, 56}, {52, 56}, {51, 55}, {50, 54}, {49, 54}, {48, 53}, {47, 53}, {47, 52}, {46, 52}, {45, 51}, {44, 51}, {43, 50}, {42, 49}, {42, 49}, {41, 48}, {40, 48}, {39, 47}, {38, 47}, {37, 46}, {37, 46}, {36, 45}, {35, 44}, {34, 44}, {33, 43}, {32, 43}, {32, 42}, {31, 42}, {30, 41}, {29, 41}, {28, 40}, {28, 39}, {27, 39}, {26, 38}, {25, 38}, {24, 37}, {23, 37}, {23, 36}, {22, 35}, {21, 35}, {20, 34}, {19, 34}, {18, 33}, {18, 33}, {17, 32}, {16, 32}, {15, 31}, {14, 30}, {13, 30}, {13, 29}, {12, 29},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 62}, {60, 61}, {59, 61}, {58, 60}, {57, 59}, {57, 59}, {56, 58}, {55, 58}, {54, 57}, {53, 57}, {53, 56}, {52, 55}, {51, 55}, {50, 54}, {49, 54}, {48, 53}, {48, 53}, {47, 52}, {46, 51}, {45, 51}, {44, 50}, {44, 50}, {43, 49}, {42, 49}, {41, 48}, {40, 47}, {39, 47}, {39, 46}, {38, 46}, {37, 45}, {36, 44}, {35, 44}, {35, 43}, {34, 43}, {33, 42}, {32, 42}, {31, 41}, {30, 40}, {30, 40}, {29, 39}, {28, 39}, {27, 38}, {26, 38}, {25, 37}, {25, 36}, {24, 36}, {23, 35}, {22, 35}, {21, 34}, {21, 34}, {20, 33}, {19, 32}, {18, 32}, {17, 31}, {16, 31}, {16, 30}, {15, 30}, {14, 29}, {13, 28}, {12, 28},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 62}, {60, 61}, {59, 60}, {58, 60}, {58, 59}, {57, 59}, {56, 58}, {55, 58}, {54, 57}, {53, 56}, {53, 56}, {52, 55}, {51, 55}, {50, 54}, {49, 53}, {49, 53}, {48, 52}, {47, 52}, {46, 51}, {45, 50}, {45, 50}, {44, 49}, {43, 49}, {42, 48}, {41, 48}, {41, 47}, {40, 46}, {39, 46}, {38, 45}, {37, 45}, {36, 44}, {36, 43}, {35, 43}, {34, 42}, {33, 42}, {32, 41}, {32, 40}, {31, 40}, {30, 39}, {29, 39}, {28, 38}, {28, 38}, {27, 37}, {26, 36}, {25, 36}, {24, 35}, {24, 35}, {23, 34}, {22, 33}, {21, 33}, {20, 32}, {20, 32}, {19, 31}, {18, 30}, {17, 30}, {16, 29}, {15, 29}, {15, 28}, {14, 28}, {13, 27},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 62}, {60, 61}, {59, 60}, {58, 60}, {58, 59}, {57, 59}, {56, 58}, {55, 57}, {54, 57}, {54, 56}, {53, 56}, {52, 55}, {51, 54}, {50, 54}, {50, 53}, {49, 53}, {48, 52}, {47, 51}, {46, 51}, {46, 50}, {45, 50}, {44, 49}, {43, 48}, {42, 48}, {42, 47}, {41, 47}, {40, 46}, {39, 45}, {38, 45}, {38, 44}, {37, 44}, {36, 43}, {35, 42}, {34, 42}, {34, 41}, {33, 41}, {32, 40}, {31, 39}, {30, 39}, {30, 38}, {29, 38}, {28, 37}, {27, 36}, {26, 36}, {26, 35}, {25, 35}, {24, 34}, {23, 33}, {22, 33}, {22, 32}, {21, 32}, {20, 31}, {19, 30}, {18, 30}, {18, 29}, {17, 28}, {16, 28}, {15, 27}, {14, 27}, {14, 26},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 62}, {60, 61}, {59, 60}, {58, 60}, {58, 59}, {57, 58}, {56, 58}, {55, 57}, {55, 57}, {54, 56}, {53, 55}, {52, 55}, {51, 54}, {51, 54}, {50, 53}, {49, 52}, {48, 52}, {47, 51}, {47, 50}, {46, 50}, {45, 49}, {44, 49}, {44, 48}, {43, 47}, {42, 47}, {41, 46}, {40, 46}, {40, 45}, {39, 44}, {38, 44}, {37, 43}, {36, 42}, {36, 42}, {35, 41}, {34, 41}, {33, 40}, {32, 39}, {32, 39}, {31, 38}, {30, 38}, {29, 37}, {29, 36}, {28, 36}, {27, 35}, {26, 34}, {25, 34}, {25, 33}, {24, 33}, {23, 32}, {22, 31}, {21, 31}, {21, 30}, {20, 30}, {19, 29}, {18, 28}, {18, 28}, {17, 27}, {16, 26}, {15, 26}, {14, 25},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 61}, {60, 61}, {59, 60}, {59, 60}, {58, 59}, {57, 58}, {56, 58}, {55, 57}, {55, 56}, {54, 56}, {53, 55}, {52, 55}, {52, 54}, {51, 53}, {50, 53}, {49, 52}, {48, 51}, {48, 51}, {47, 50}, {46, 50}, {45, 49}, {45, 48}, {44, 48}, {43, 47}, {42, 46}, {41, 46}, {41, 45}, {40, 44}, {39, 44}, {38, 43}, {38, 43}, {37, 42}, {36, 41}, {35, 41}, {34, 40}, {34, 39}, {33, 39}, {32, 38}, {31, 38}, {31, 37}, {30, 36}, {29, 36}, {28, 35}, {27, 34}, {27, 34}, {26, 33}, {25, 33}, {24, 32}, {24, 31}, {23, 31}, {22, 30}, {21, 29}, {20, 29}, {20, 28}, {19, 27}, {18, 27}, {17, 26}, {17, 26}, {16, 25}, {15, 24},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 61}, {60, 61}, {59, 60}, {59, 60}, {58, 59}, {57, 58}, {56, 58}, {56, 57}, {55, 56}, {54, 56}, {53, 55}, {53, 54}, {52, 54}, {51, 53}, {50, 52}, {49, 52}, {49, 51}, {48, 51}, {47, 50}, {46, 49}, {46, 49}, {45, 48}, {44, 47}, {43, 47}, {43, 46}, {42, 45}, {41, 45}, {40, 44}, {39, 43}, {39, 43}, {38, 42}, {37, 42}, {36, 41}, {36, 40}, {35, 40}, {34, 39}, {33, 38}, {33, 38}, {32, 37}, {31, 36}, {30, 36}, {30, 35}, {29, 34}, {28, 34}, {27, 33}, {26, 33}, {26, 32}, {25, 31}, {24, 31}, {23, 30}, {23, 29}, {22, 29}, {21, 28}, {20, 27}, {20, 27}, {19, 26}, {18, 25}, {17, 25}, {17, 24}, {16, 24},  },
-  { {64, 64}, {63, 63}, {62, 63}, {62, 62}, {61, 61}, {60, 61}, {59, 60}, {59, 59}, {58, 59}, {57, 58}, {56, 57}, {56, 57}, {55, 56}, {54, 55}, {53, 55}, {53, 54}, {52, 54}, {51, 53}, {50, 52}, {50, 52}, {49, 51}, {48, 50}, {47, 50}, {47, 49}, {46, 48}, {45, 48}, {44, 47}, {44, 46}, {43, 46}, {42, 45}, {41, 44}, {41, 44}, {40, 43}, {39, 42}, {38, 42}, {38, 41}, {37, 40}, {36, 40}, {35, 39}, {35, 38}, {34, 38}, {33, 37}, {32, 36}, {32, 36}, {31, 35}, {30, 34}, {29, 34}, {29, 33}, {28, 33}, {27, 32}, {26, 31}, {26, 31}, {25, 30}, {24, 29}, {23, 29}, {22, 28}, {22, 27}, {21, 27}, {20, 26}, {19, 25}, {19, 25}, {18, 24}, {17, 23}, {16, 23},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {60, 61}, {60, 60}, {59, 59}, {58, 59}, {57, 58}, {57, 57}, {56, 57}, {55, 56}, {54, 55}, {54, 55}, {53, 54}, {52, 53}, {51, 53}, {51, 52}, {50, 51}, {49, 51}, {48, 50}, {48, 49}, {47, 49}, {46, 48}, {45, 47}, {45, 47}, {44, 46}, {43, 45}, {42, 45}, {42, 44}, {41, 43}, {40, 43}, {39, 42}, {39, 41}, {38, 41}, {37, 40}, {37, 39}, {36, 39}, {35, 38}, {34, 37}, {34, 37}, {33, 36}, {32, 35}, {31, 35}, {31, 34}, {30, 33}, {29, 33}, {28, 32}, {28, 31}, {27, 31}, {26, 30}, {25, 29}, {25, 29}, {24, 28}, {23, 27}, {22, 27}, {22, 26}, {21, 25}, {20, 25}, {19, 24}, {19, 23}, {18, 23}, {17, 22},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {60, 61}, {60, 60}, {59, 59}, {58, 59}, {57, 58}, {57, 57}, {56, 56}, {55, 56}, {54, 55}, {54, 54}, {53, 54}, {52, 53}, {52, 52}, {51, 52}, {50, 51}, {49, 50}, {49, 50}, {48, 49}, {47, 48}, {46, 48}, {46, 47}, {45, 46}, {44, 46}, {44, 45}, {43, 44}, {42, 44}, {41, 43}, {41, 42}, {40, 41}, {39, 41}, {38, 40}, {38, 39}, {37, 39}, {36, 38}, {35, 37}, {35, 37}, {34, 36}, {33, 35}, {33, 35}, {32, 34}, {31, 33}, {30, 33}, {30, 32}, {29, 31}, {28, 31}, {27, 30}, {27, 29}, {26, 29}, {25, 28}, {25, 27}, {24, 26}, {23, 26}, {22, 25}, {22, 24}, {21, 24}, {20, 23}, {19, 22}, {19, 22}, {18, 21},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {60, 61}, {60, 60}, {59, 59}, {58, 58}, {58, 58}, {57, 57}, {56, 56}, {55, 56}, {55, 55}, {54, 54}, {53, 54}, {52, 53}, {52, 52}, {51, 51}, {50, 51}, {50, 50}, {49, 49}, {48, 49}, {47, 48}, {47, 47}, {46, 47}, {45, 46}, {45, 45}, {44, 45}, {43, 44}, {42, 43}, {42, 42}, {41, 42}, {40, 41}, {40, 40}, {39, 40}, {38, 39}, {37, 38}, {37, 38}, {36, 37}, {35, 36}, {35, 36}, {34, 35}, {33, 34}, {32, 33}, {32, 33}, {31, 32}, {30, 31}, {29, 31}, {29, 30}, {28, 29}, {27, 29}, {27, 28}, {26, 27}, {25, 26}, {24, 26}, {24, 25}, {23, 24}, {22, 24}, {22, 23}, {21, 22}, {20, 22}, {19, 21}, {19, 20},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {60, 60}, {60, 60}, {59, 59}, {58, 58}, {58, 58}, {57, 57}, {56, 56}, {56, 56}, {55, 55}, {54, 54}, {53, 53}, {53, 53}, {52, 52}, {51, 51}, {51, 51}, {50, 50}, {49, 49}, {48, 48}, {48, 48}, {47, 47}, {46, 46}, {46, 46}, {45, 45}, {44, 44}, {43, 43}, {43, 43}, {42, 42}, {41, 41}, {41, 41}, {40, 40}, {39, 39}, {39, 39}, {38, 38}, {37, 37}, {36, 36}, {36, 36}, {35, 35}, {34, 34}, {34, 34}, {33, 33}, {32, 32}, {31, 31}, {31, 31}, {30, 30}, {29, 29}, {29, 29}, {28, 28}, {27, 27}, {27, 27}, {26, 26}, {25, 25}, {24, 24}, {24, 24}, {23, 23}, {22, 22}, {22, 22}, {21, 21}, {20, 20}, {19, 19},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {61, 60}, {60, 60}, {59, 59}, {58, 58}, {58, 58}, {57, 57}, {56, 56}, {56, 55}, {55, 55}, {54, 54}, {54, 53}, {53, 52}, {52, 52}, {51, 51}, {51, 50}, {50, 50}, {49, 49}, {49, 48}, {48, 47}, {47, 47}, {47, 46}, {46, 45}, {45, 45}, {45, 44}, {44, 43}, {43, 42}, {42, 42}, {42, 41}, {41, 40}, {40, 40}, {40, 39}, {39, 38}, {38, 37}, {38, 37}, {37, 36}, {36, 35}, {36, 35}, {35, 34}, {34, 33}, {33, 32}, {33, 32}, {32, 31}, {31, 30}, {31, 29}, {30, 29}, {29, 28}, {29, 27}, {28, 27}, {27, 26}, {26, 25}, {26, 24}, {25, 24}, {24, 23}, {24, 22}, {23, 22}, {22, 21}, {22, 20}, {21, 19}, {20, 19},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {61, 60}, {60, 60}, {59, 59}, {59, 58}, {58, 57}, {57, 57}, {56, 56}, {56, 55}, {55, 54}, {54, 54}, {54, 53}, {53, 52}, {52, 52}, {52, 51}, {51, 50}, {50, 49}, {50, 49}, {49, 48}, {48, 47}, {48, 46}, {47, 46}, {46, 45}, {46, 44}, {45, 44}, {44, 43}, {44, 42}, {43, 41}, {42, 41}, {41, 40}, {41, 39}, {40, 38}, {39, 38}, {39, 37}, {38, 36}, {37, 35}, {37, 35}, {36, 34}, {35, 33}, {35, 33}, {34, 32}, {33, 31}, {33, 30}, {32, 30}, {31, 29}, {31, 28}, {30, 27}, {29, 27}, {29, 26}, {28, 25}, {27, 25}, {26, 24}, {26, 23}, {25, 22}, {24, 22}, {24, 21}, {23, 20}, {22, 19}, {22, 19}, {21, 18},  },
-  { {64, 64}, {63, 63}, {63, 63}, {62, 62}, {61, 61}, {61, 60}, {60, 60}, {59, 59}, {59, 58}, {58, 57}, {57, 57}, {57, 56}, {56, 55}, {55, 54}, {55, 54}, {54, 53}, {53, 52}, {53, 51}, {52, 51}, {51, 50}, {51, 49}, {50, 48}, {49, 48}, {49, 47}, {48, 46}, {47, 45}, {47, 45}, {46, 44}, {45, 43}, {45, 42}, {44, 42}, {43, 41}, {43, 40}, {42, 39}, {41, 39}, {41, 38}, {40, 37}, {39, 37}, {39, 36}, {38, 35}, {37, 34}, {37, 34}, {36, 33}, {35, 32}, {35, 31}, {34, 31}, {33, 30}, {33, 29}, {32, 28}, {31, 28}, {31, 27}, {30, 26}, {29, 25}, {29, 25}, {28, 24}, {27, 23}, {27, 22}, {26, 22}, {25, 21}, {25, 20}, {24, 19}, {23, 19}, {23, 18}, {22, 17},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {61, 61}, {61, 60}, {60, 59}, {59, 59}, {59, 58}, {58, 57}, {57, 56}, {57, 56}, {56, 55}, {55, 54}, {55, 53}, {54, 53}, {54, 52}, {53, 51}, {52, 50}, {52, 50}, {51, 49}, {50, 48}, {50, 47}, {49, 47}, {48, 46}, {48, 45}, {47, 44}, {46, 44}, {46, 43}, {45, 42}, {44, 41}, {44, 41}, {43, 40}, {42, 39}, {42, 38}, {41, 38}, {40, 37}, {40, 36}, {39, 35}, {38, 35}, {38, 34}, {37, 33}, {36, 32}, {36, 32}, {35, 31}, {34, 30}, {34, 29}, {33, 29}, {33, 28}, {32, 27}, {31, 26}, {31, 26}, {30, 25}, {29, 24}, {29, 23}, {28, 22}, {27, 22}, {27, 21}, {26, 20}, {25, 19}, {25, 19}, {24, 18}, {23, 17}, {23, 16},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {61, 61}, {61, 60}, {60, 59}, {60, 59}, {59, 58}, {58, 57}, {58, 56}, {57, 56}, {56, 55}, {56, 54}, {55, 53}, {54, 53}, {54, 52}, {53, 51}, {52, 50}, {52, 49}, {51, 49}, {51, 48}, {50, 47}, {49, 46}, {49, 46}, {48, 45}, {47, 44}, {47, 43}, {46, 43}, {45, 42}, {45, 41}, {44, 40}, {43, 39}, {43, 39}, {42, 38}, {42, 37}, {41, 36}, {40, 36}, {40, 35}, {39, 34}, {38, 33}, {38, 33}, {37, 32}, {36, 31}, {36, 30}, {35, 30}, {34, 29}, {34, 28}, {33, 27}, {33, 26}, {32, 26}, {31, 25}, {31, 24}, {30, 23}, {29, 23}, {29, 22}, {28, 21}, {27, 20}, {27, 20}, {26, 19}, {25, 18}, {25, 17}, {24, 17}, {24, 16},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {61, 61}, {61, 60}, {60, 59}, {60, 59}, {59, 58}, {58, 57}, {58, 56}, {57, 55}, {56, 55}, {56, 54}, {55, 53}, {55, 52}, {54, 52}, {53, 51}, {53, 50}, {52, 49}, {51, 48}, {51, 48}, {50, 47}, {50, 46}, {49, 45}, {48, 45}, {48, 44}, {47, 43}, {46, 42}, {46, 41}, {45, 41}, {44, 40}, {44, 39}, {43, 38}, {43, 38}, {42, 37}, {41, 36}, {41, 35}, {40, 34}, {39, 34}, {39, 33}, {38, 32}, {38, 31}, {37, 31}, {36, 30}, {36, 29}, {35, 28}, {34, 27}, {34, 27}, {33, 26}, {33, 25}, {32, 24}, {31, 24}, {31, 23}, {30, 22}, {29, 21}, {29, 20}, {28, 20}, {27, 19}, {27, 18}, {26, 17}, {26, 17}, {25, 16}, {24, 15},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {62, 61}, {61, 60}, {60, 59}, {60, 58}, {59, 58}, {58, 57}, {58, 56}, {57, 55}, {57, 55}, {56, 54}, {55, 53}, {55, 52}, {54, 51}, {54, 51}, {53, 50}, {52, 49}, {52, 48}, {51, 47}, {50, 47}, {50, 46}, {49, 45}, {49, 44}, {48, 44}, {47, 43}, {47, 42}, {46, 41}, {46, 40}, {45, 40}, {44, 39}, {44, 38}, {43, 37}, {42, 36}, {42, 36}, {41, 35}, {41, 34}, {40, 33}, {39, 32}, {39, 32}, {38, 31}, {38, 30}, {37, 29}, {36, 29}, {36, 28}, {35, 27}, {34, 26}, {34, 25}, {33, 25}, {33, 24}, {32, 23}, {31, 22}, {31, 21}, {30, 21}, {30, 20}, {29, 19}, {28, 18}, {28, 18}, {27, 17}, {26, 16}, {26, 15}, {25, 14},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {62, 61}, {61, 60}, {60, 59}, {60, 58}, {59, 58}, {59, 57}, {58, 56}, {57, 55}, {57, 54}, {56, 54}, {56, 53}, {55, 52}, {54, 51}, {54, 50}, {53, 50}, {53, 49}, {52, 48}, {51, 47}, {51, 46}, {50, 46}, {50, 45}, {49, 44}, {48, 43}, {48, 42}, {47, 42}, {47, 41}, {46, 40}, {45, 39}, {45, 38}, {44, 38}, {44, 37}, {43, 36}, {42, 35}, {42, 34}, {41, 34}, {41, 33}, {40, 32}, {39, 31}, {39, 30}, {38, 30}, {38, 29}, {37, 28}, {36, 27}, {36, 26}, {35, 26}, {35, 25}, {34, 24}, {33, 23}, {33, 22}, {32, 22}, {32, 21}, {31, 20}, {30, 19}, {30, 18}, {29, 18}, {28, 17}, {28, 16}, {27, 15}, {27, 14}, {26, 14},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {62, 61}, {61, 60}, {60, 59}, {60, 58}, {59, 58}, {59, 57}, {58, 56}, {58, 55}, {57, 54}, {56, 53}, {56, 53}, {55, 52}, {55, 51}, {54, 50}, {53, 49}, {53, 49}, {52, 48}, {52, 47}, {51, 46}, {50, 45}, {50, 45}, {49, 44}, {49, 43}, {48, 42}, {48, 41}, {47, 41}, {46, 40}, {46, 39}, {45, 38}, {45, 37}, {44, 36}, {43, 36}, {43, 35}, {42, 34}, {42, 33}, {41, 32}, {40, 32}, {40, 31}, {39, 30}, {39, 29}, {38, 28}, {38, 28}, {37, 27}, {36, 26}, {36, 25}, {35, 24}, {35, 24}, {34, 23}, {33, 22}, {33, 21}, {32, 20}, {32, 20}, {31, 19}, {30, 18}, {30, 17}, {29, 16}, {29, 15}, {28, 15}, {28, 14}, {27, 13},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {62, 61}, {61, 60}, {61, 59}, {60, 58}, {59, 57}, {59, 57}, {58, 56}, {58, 55}, {57, 54}, {57, 53}, {56, 53}, {55, 52}, {55, 51}, {54, 50}, {54, 49}, {53, 48}, {53, 48}, {52, 47}, {51, 46}, {51, 45}, {50, 44}, {50, 44}, {49, 43}, {49, 42}, {48, 41}, {47, 40}, {47, 39}, {46, 39}, {46, 38}, {45, 37}, {44, 36}, {44, 35}, {43, 35}, {43, 34}, {42, 33}, {42, 32}, {41, 31}, {40, 30}, {40, 30}, {39, 29}, {39, 28}, {38, 27}, {38, 26}, {37, 25}, {36, 25}, {36, 24}, {35, 23}, {35, 22}, {34, 21}, {34, 21}, {33, 20}, {32, 19}, {32, 18}, {31, 17}, {31, 16}, {30, 16}, {30, 15}, {29, 14}, {28, 13}, {28, 12},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 62}, {62, 61}, {61, 60}, {61, 59}, {60, 58}, {60, 57}, {59, 57}, {58, 56}, {58, 55}, {57, 54}, {57, 53}, {56, 52}, {56, 52}, {55, 51}, {54, 50}, {54, 49}, {53, 48}, {53, 47}, {52, 47}, {52, 46}, {51, 45}, {51, 44}, {50, 43}, {49, 42}, {49, 42}, {48, 41}, {48, 40}, {47, 39}, {47, 38}, {46, 37}, {46, 37}, {45, 36}, {44, 35}, {44, 34}, {43, 33}, {43, 32}, {42, 32}, {42, 31}, {41, 30}, {41, 29}, {40, 28}, {39, 28}, {39, 27}, {38, 26}, {38, 25}, {37, 24}, {37, 23}, {36, 23}, {35, 22}, {35, 21}, {34, 20}, {34, 19}, {33, 18}, {33, 18}, {32, 17}, {32, 16}, {31, 15}, {30, 14}, {30, 13}, {29, 13}, {29, 12},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 61}, {62, 61}, {61, 60}, {61, 59}, {60, 58}, {60, 57}, {59, 56}, {59, 56}, {58, 55}, {57, 54}, {57, 53}, {56, 52}, {56, 51}, {55, 51}, {55, 50}, {54, 49}, {54, 48}, {53, 47}, {53, 46}, {52, 46}, {51, 45}, {51, 44}, {50, 43}, {50, 42}, {49, 41}, {49, 41}, {48, 40}, {48, 39}, {47, 38}, {47, 37}, {46, 36}, {45, 35}, {45, 35}, {44, 34}, {44, 33}, {43, 32}, {43, 31}, {42, 30}, {42, 30}, {41, 29}, {41, 28}, {40, 27}, {39, 26}, {39, 25}, {38, 25}, {38, 24}, {37, 23}, {37, 22}, {36, 21}, {36, 20}, {35, 20}, {35, 19}, {34, 18}, {34, 17}, {33, 16}, {32, 15}, {32, 15}, {31, 14}, {31, 13}, {30, 12}, {30, 11},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 61}, {62, 61}, {61, 60}, {61, 59}, {60, 58}, {60, 57}, {59, 56}, {59, 56}, {58, 55}, {58, 54}, {57, 53}, {57, 52}, {56, 51}, {56, 50}, {55, 50}, {54, 49}, {54, 48}, {53, 47}, {53, 46}, {52, 45}, {52, 44}, {51, 44}, {51, 43}, {50, 42}, {50, 41}, {49, 40}, {49, 39}, {48, 39}, {48, 38}, {47, 37}, {47, 36}, {46, 35}, {45, 34}, {45, 33}, {44, 33}, {44, 32}, {43, 31}, {43, 30}, {42, 29}, {42, 28}, {41, 28}, {41, 27}, {40, 26}, {40, 25}, {39, 24}, {39, 23}, {38, 22}, {38, 22}, {37, 21}, {36, 20}, {36, 19}, {35, 18}, {35, 17}, {34, 17}, {34, 16}, {33, 15}, {33, 14}, {32, 13}, {32, 12}, {31, 11}, {31, 11},  },
-  { {64, 64}, {63, 63}, {63, 62}, {62, 61}, {62, 61}, {61, 60}, {61, 59}, {60, 58}, {60, 57}, {59, 56}, {59, 55}, {58, 55}, {58, 54}, {57, 53}, {57, 52}, {56, 51}, {56, 50}, {55, 49}, {55, 49}, {54, 48}, {54, 47}, {53, 46}, {53, 45}, {52, 44}, {52, 43}, {51, 43}, {51, 42}, {50, 41}, {50, 40}, {49, 39}, {49, 38}, {48, 37}, {48, 37}, {47, 36}, {46, 35}, {46, 34}, {45, 33}, {45, 32}, {44, 31}, {44, 31}, {43, 30}, {43, 29}, {42, 28}, {42, 27}, {41, 26}, {41, 25}, {40, 25}, {40, 24}, {39, 23}, {39, 22}, {38, 21}, {38, 20}, {37, 19}, {37, 19}, {36, 18}, {36, 17}, {35, 16}, {35, 15}, {34, 14}, {34, 13}, {33, 13}, {33, 12}, {32, 11}, {32, 10},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 61}, {62, 60}, {61, 59}, {61, 58}, {60, 57}, {60, 56}, {59, 55}, {58, 54}, {58, 54}, {57, 53}, {57, 52}, {56, 51}, {56, 50}, {55, 49}, {55, 48}, {54, 48}, {54, 47}, {53, 46}, {53, 45}, {52, 44}, {52, 43}, {51, 42}, {51, 41}, {50, 41}, {50, 40}, {49, 39}, {49, 38}, {48, 37}, {48, 36}, {47, 35}, {47, 35}, {46, 34}, {46, 33}, {45, 32}, {45, 31}, {44, 30}, {44, 29}, {43, 28}, {43, 28}, {42, 27}, {42, 26}, {41, 25}, {41, 24}, {40, 23}, {40, 22}, {39, 22}, {39, 21}, {38, 20}, {38, 19}, {37, 18}, {37, 17}, {36, 16}, {36, 16}, {35, 15}, {35, 14}, {34, 13}, {34, 12}, {33, 11}, {33, 10}, {32, 9},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 61}, {62, 60}, {61, 59}, {61, 58}, {60, 57}, {60, 56}, {59, 55}, {59, 54}, {58, 54}, {58, 53}, {57, 52}, {57, 51}, {56, 50}, {56, 49}, {55, 48}, {55, 47}, {54, 47}, {54, 46}, {53, 45}, {53, 44}, {52, 43}, {52, 42}, {51, 41}, {51, 40}, {50, 40}, {50, 39}, {49, 38}, {49, 37}, {48, 36}, {48, 35}, {48, 34}, {47, 33}, {47, 33}, {46, 32}, {46, 31}, {45, 30}, {45, 29}, {44, 28}, {44, 27}, {43, 26}, {43, 26}, {42, 25}, {42, 24}, {41, 23}, {41, 22}, {40, 21}, {40, 20}, {39, 19}, {39, 19}, {38, 18}, {38, 17}, {37, 16}, {37, 15}, {36, 14}, {36, 13}, {35, 12}, {35, 12}, {34, 11}, {34, 10}, {33, 9},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 60}, {61, 59}, {61, 58}, {60, 57}, {60, 56}, {59, 55}, {59, 54}, {58, 53}, {58, 53}, {57, 52}, {57, 51}, {56, 50}, {56, 49}, {56, 48}, {55, 47}, {55, 46}, {54, 45}, {54, 45}, {53, 44}, {53, 43}, {52, 42}, {52, 41}, {51, 40}, {51, 39}, {50, 38}, {50, 38}, {49, 37}, {49, 36}, {49, 35}, {48, 34}, {48, 33}, {47, 32}, {47, 31}, {46, 30}, {46, 30}, {45, 29}, {45, 28}, {44, 27}, {44, 26}, {43, 25}, {43, 24}, {42, 23}, {42, 23}, {41, 22}, {41, 21}, {41, 20}, {40, 19}, {40, 18}, {39, 17}, {39, 16}, {38, 15}, {38, 15}, {37, 14}, {37, 13}, {36, 12}, {36, 11}, {35, 10}, {35, 9}, {34, 8},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 60}, {61, 59}, {61, 58}, {60, 57}, {60, 56}, {59, 55}, {59, 54}, {59, 53}, {58, 52}, {58, 52}, {57, 51}, {57, 50}, {56, 49}, {56, 48}, {55, 47}, {55, 46}, {54, 45}, {54, 44}, {54, 44}, {53, 43}, {53, 42}, {52, 41}, {52, 40}, {51, 39}, {51, 38}, {50, 37}, {50, 36}, {49, 35}, {49, 35}, {49, 34}, {48, 33}, {48, 32}, {47, 31}, {47, 30}, {46, 29}, {46, 28}, {45, 27}, {45, 27}, {44, 26}, {44, 25}, {44, 24}, {43, 23}, {43, 22}, {42, 21}, {42, 20}, {41, 19}, {41, 19}, {40, 18}, {40, 17}, {39, 16}, {39, 15}, {39, 14}, {38, 13}, {38, 12}, {37, 11}, {37, 11}, {36, 10}, {36, 9}, {35, 8},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 60}, {61, 59}, {61, 58}, {60, 57}, {60, 56}, {60, 55}, {59, 54}, {59, 53}, {58, 52}, {58, 51}, {57, 51}, {57, 50}, {57, 49}, {56, 48}, {56, 47}, {55, 46}, {55, 45}, {54, 44}, {54, 43}, {53, 42}, {53, 42}, {53, 41}, {52, 40}, {52, 39}, {51, 38}, {51, 37}, {50, 36}, {50, 35}, {50, 34}, {49, 33}, {49, 33}, {48, 32}, {48, 31}, {47, 30}, {47, 29}, {46, 28}, {46, 27}, {46, 26}, {45, 25}, {45, 24}, {44, 24}, {44, 23}, {43, 22}, {43, 21}, {43, 20}, {42, 19}, {42, 18}, {41, 17}, {41, 16}, {40, 15}, {40, 15}, {39, 14}, {39, 13}, {39, 12}, {38, 11}, {38, 10}, {37, 9}, {37, 8}, {36, 7},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 59}, {61, 59}, {61, 58}, {61, 57}, {60, 56}, {60, 55}, {59, 54}, {59, 53}, {59, 52}, {58, 51}, {58, 50}, {57, 49}, {57, 49}, {56, 48}, {56, 47}, {56, 46}, {55, 45}, {55, 44}, {54, 43}, {54, 42}, {53, 41}, {53, 40}, {53, 40}, {52, 39}, {52, 38}, {51, 37}, {51, 36}, {50, 35}, {50, 34}, {50, 33}, {49, 32}, {49, 31}, {48, 30}, {48, 30}, {48, 29}, {47, 28}, {47, 27}, {46, 26}, {46, 25}, {45, 24}, {45, 23}, {45, 22}, {44, 21}, {44, 20}, {43, 20}, {43, 19}, {42, 18}, {42, 17}, {42, 16}, {41, 15}, {41, 14}, {40, 13}, {40, 12}, {39, 11}, {39, 11}, {39, 10}, {38, 9}, {38, 8}, {37, 7},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 59}, {62, 59}, {61, 58}, {61, 57}, {60, 56}, {60, 55}, {60, 54}, {59, 53}, {59, 52}, {58, 51}, {58, 50}, {57, 49}, {57, 48}, {57, 48}, {56, 47}, {56, 46}, {55, 45}, {55, 44}, {55, 43}, {54, 42}, {54, 41}, {53, 40}, {53, 39}, {53, 38}, {52, 38}, {52, 37}, {51, 36}, {51, 35}, {51, 34}, {50, 33}, {50, 32}, {49, 31}, {49, 30}, {49, 29}, {48, 28}, {48, 27}, {47, 27}, {47, 26}, {47, 25}, {46, 24}, {46, 23}, {45, 22}, {45, 21}, {44, 20}, {44, 19}, {44, 18}, {43, 17}, {43, 16}, {42, 16}, {42, 15}, {42, 14}, {41, 13}, {41, 12}, {40, 11}, {40, 10}, {40, 9}, {39, 8}, {39, 7}, {38, 6},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {62, 60}, {62, 59}, {62, 58}, {61, 58}, {61, 57}, {60, 56}, {60, 55}, {60, 54}, {59, 53}, {59, 52}, {59, 51}, {58, 50}, {58, 49}, {57, 48}, {57, 47}, {57, 47}, {56, 46}, {56, 45}, {55, 44}, {55, 43}, {55, 42}, {54, 41}, {54, 40}, {53, 39}, {53, 38}, {53, 37}, {52, 36}, {52, 35}, {51, 35}, {51, 34}, {51, 33}, {50, 32}, {50, 31}, {50, 30}, {49, 29}, {49, 28}, {48, 27}, {48, 26}, {48, 25}, {47, 24}, {47, 23}, {46, 23}, {46, 22}, {46, 21}, {45, 20}, {45, 19}, {44, 18}, {44, 17}, {44, 16}, {43, 15}, {43, 14}, {43, 13}, {42, 12}, {42, 12}, {41, 11}, {41, 10}, {41, 9}, {40, 8}, {40, 7}, {39, 6},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {62, 59}, {62, 58}, {61, 58}, {61, 57}, {61, 56}, {60, 55}, {60, 54}, {60, 53}, {59, 52}, {59, 51}, {58, 50}, {58, 49}, {58, 48}, {57, 47}, {57, 46}, {57, 45}, {56, 45}, {56, 44}, {55, 43}, {55, 42}, {55, 41}, {54, 40}, {54, 39}, {54, 38}, {53, 37}, {53, 36}, {52, 35}, {52, 34}, {52, 33}, {51, 32}, {51, 32}, {51, 31}, {50, 30}, {50, 29}, {49, 28}, {49, 27}, {49, 26}, {48, 25}, {48, 24}, {48, 23}, {47, 22}, {47, 21}, {46, 20}, {46, 19}, {46, 19}, {45, 18}, {45, 17}, {45, 16}, {44, 15}, {44, 14}, {43, 13}, {43, 12}, {43, 11}, {42, 10}, {42, 9}, {42, 8}, {41, 7}, {41, 7}, {40, 6},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {62, 59}, {62, 58}, {61, 57}, {61, 57}, {61, 56}, {60, 55}, {60, 54}, {60, 53}, {59, 52}, {59, 51}, {59, 50}, {58, 49}, {58, 48}, {58, 47}, {57, 46}, {57, 45}, {56, 44}, {56, 43}, {56, 43}, {55, 42}, {55, 41}, {55, 40}, {54, 39}, {54, 38}, {54, 37}, {53, 36}, {53, 35}, {53, 34}, {52, 33}, {52, 32}, {51, 31}, {51, 30}, {51, 29}, {50, 29}, {50, 28}, {50, 27}, {49, 26}, {49, 25}, {49, 24}, {48, 23}, {48, 22}, {48, 21}, {47, 20}, {47, 19}, {46, 18}, {46, 17}, {46, 16}, {45, 15}, {45, 15}, {45, 14}, {44, 13}, {44, 12}, {44, 11}, {43, 10}, {43, 9}, {42, 8}, {42, 7}, {42, 6}, {41, 5},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {62, 59}, {62, 58}, {62, 57}, {61, 56}, {61, 56}, {61, 55}, {60, 54}, {60, 53}, {60, 52}, {59, 51}, {59, 50}, {59, 49}, {58, 48}, {58, 47}, {58, 46}, {57, 45}, {57, 44}, {56, 43}, {56, 42}, {56, 41}, {55, 41}, {55, 40}, {55, 39}, {54, 38}, {54, 37}, {54, 36}, {53, 35}, {53, 34}, {53, 33}, {52, 32}, {52, 31}, {52, 30}, {51, 29}, {51, 28}, {51, 27}, {50, 26}, {50, 25}, {50, 25}, {49, 24}, {49, 23}, {49, 22}, {48, 21}, {48, 20}, {48, 19}, {47, 18}, {47, 17}, {47, 16}, {46, 15}, {46, 14}, {46, 13}, {45, 12}, {45, 11}, {45, 10}, {44, 9}, {44, 9}, {43, 8}, {43, 7}, {43, 6}, {42, 5},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {62, 59}, {62, 58}, {62, 57}, {61, 56}, {61, 55}, {61, 55}, {60, 54}, {60, 53}, {60, 52}, {59, 51}, {59, 50}, {59, 49}, {58, 48}, {58, 47}, {58, 46}, {57, 45}, {57, 44}, {57, 43}, {57, 42}, {56, 41}, {56, 40}, {56, 39}, {55, 38}, {55, 38}, {55, 37}, {54, 36}, {54, 35}, {54, 34}, {53, 33}, {53, 32}, {53, 31}, {52, 30}, {52, 29}, {52, 28}, {51, 27}, {51, 26}, {51, 25}, {50, 24}, {50, 23}, {50, 22}, {49, 21}, {49, 21}, {49, 20}, {48, 19}, {48, 18}, {48, 17}, {47, 16}, {47, 15}, {47, 14}, {46, 13}, {46, 12}, {46, 11}, {45, 10}, {45, 9}, {45, 8}, {44, 7}, {44, 6}, {44, 5}, {43, 4},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {62, 59}, {62, 58}, {62, 57}, {62, 56}, {61, 55}, {61, 54}, {61, 54}, {60, 53}, {60, 52}, {60, 51}, {59, 50}, {59, 49}, {59, 48}, {58, 47}, {58, 46}, {58, 45}, {58, 44}, {57, 43}, {57, 42}, {57, 41}, {56, 40}, {56, 39}, {56, 38}, {55, 37}, {55, 36}, {55, 35}, {54, 35}, {54, 34}, {54, 33}, {53, 32}, {53, 31}, {53, 30}, {53, 29}, {52, 28}, {52, 27}, {52, 26}, {51, 25}, {51, 24}, {51, 23}, {50, 22}, {50, 21}, {50, 20}, {49, 19}, {49, 18}, {49, 17}, {49, 16}, {48, 15}, {48, 15}, {48, 14}, {47, 13}, {47, 12}, {47, 11}, {46, 10}, {46, 9}, {46, 8}, {45, 7}, {45, 6}, {45, 5}, {45, 4},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {63, 59}, {62, 58}, {62, 57}, {62, 56}, {61, 55}, {61, 54}, {61, 53}, {60, 53}, {60, 52}, {60, 51}, {60, 50}, {59, 49}, {59, 48}, {59, 47}, {58, 46}, {58, 45}, {58, 44}, {58, 43}, {57, 42}, {57, 41}, {57, 40}, {56, 39}, {56, 38}, {56, 37}, {56, 36}, {55, 35}, {55, 34}, {55, 33}, {54, 32}, {54, 31}, {54, 31}, {53, 30}, {53, 29}, {53, 28}, {53, 27}, {52, 26}, {52, 25}, {52, 24}, {51, 23}, {51, 22}, {51, 21}, {51, 20}, {50, 19}, {50, 18}, {50, 17}, {49, 16}, {49, 15}, {49, 14}, {49, 13}, {48, 12}, {48, 11}, {48, 10}, {47, 9}, {47, 9}, {47, 8}, {46, 7}, {46, 6}, {46, 5}, {46, 4},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {63, 59}, {62, 58}, {62, 57}, {62, 56}, {62, 55}, {61, 54}, {61, 53}, {61, 52}, {60, 52}, {60, 51}, {60, 50}, {60, 49}, {59, 48}, {59, 47}, {59, 46}, {58, 45}, {58, 44}, {58, 43}, {58, 42}, {57, 41}, {57, 40}, {57, 39}, {57, 38}, {56, 37}, {56, 36}, {56, 35}, {55, 34}, {55, 33}, {55, 32}, {55, 31}, {54, 30}, {54, 29}, {54, 28}, {54, 27}, {53, 27}, {53, 26}, {53, 25}, {52, 24}, {52, 23}, {52, 22}, {52, 21}, {51, 20}, {51, 19}, {51, 18}, {50, 17}, {50, 16}, {50, 15}, {50, 14}, {49, 13}, {49, 12}, {49, 11}, {49, 10}, {48, 9}, {48, 8}, {48, 7}, {47, 6}, {47, 5}, {47, 4}, {47, 3},  },
-  { {64, 64}, {64, 63}, {63, 62}, {63, 61}, {63, 60}, {63, 59}, {62, 58}, {62, 57}, {62, 56}, {62, 55}, {61, 54}, {61, 53}, {61, 52}, {61, 51}, {60, 50}, {60, 50}, {60, 49}, {60, 48}, {59, 47}, {59, 46}, {59, 45}, {59, 44}, {58, 43}, {58, 42}, {58, 41}, {58, 40}, {57, 39}, {57, 38}, {57, 37}, {56, 36}, {56, 35}, {56, 34}, {56, 33}, {55, 32}, {55, 31}, {55, 30}, {55, 29}, {54, 28}, {54, 27}, {54, 26}, {54, 25}, {53, 24}, {53, 23}, {53, 22}, {53, 21}, {52, 21}, {52, 20}, {52, 19}, {52, 18}, {51, 17}, {51, 16}, {51, 15}, {51, 14}, {50, 13}, {50, 12}, {50, 11}, {50, 10}, {49, 9}, {49, 8}, {49, 7}, {48, 6}, {48, 5}, {48, 4}, {48, 3},  },
-  { {64, 64}, {64, 63}, {64, 62}, {63, 61}, {63, 60}, {63, 59}, {63, 58}, {62, 57}, {62, 56}, {62, 55}, {62, 54}, {61, 53}, {61, 52}, {61, 51}, {61, 50}, {60, 49}, {60, 48}, {60, 48}, {60, 47}, {59, 46}, {59, 45}, {59, 44}, {59, 43}, {58, 42}, {58, 41}, {58, 40}, {58, 39}, {57, 38}, {57, 37}, {57, 36}, {57, 35}, {57, 34}, {56, 33}, {56, 32}, {56, 31}, {56, 30}, {55, 29}, {55, 28}, {55, 27}, {55, 26}, {54, 25}, {54, 24}, {54, 23}, {54, 22}, {53, 21}, {53, 20}, {53, 19}, {53, 18}, {52, 17}, {52, 16}, {52, 15}, {52, 15}, {51, 14}, {51, 13}, {51, 12}, {51, 11}, {50, 10}, {50, 9}, {50, 8}, {50, 7}, {49, 6}, {49, 5}, {49, 4}, {49, 3},  },
-  { {64, 64}, {64, 63}, {64, 62}, {63, 61}, {63, 60}, {63, 59}, {63, 58}, {62, 57}, {62, 56}, {62, 55}, {62, 54}, {62, 53}, {61, 52}, {61, 51}, {61, 50}, {61, 49}, {60, 48}, {60, 47}, {60, 46}, {60, 45}, {60, 45}, {59, 44}, {59, 43}, {59, 42}, {59, 41}, {58, 40}, {58, 39}, {58, 38}, {58, 37}, {57, 36}, {57, 35}, {57, 34}, {57, 33}, {57, 32}, {56, 31}, {56, 30}, {56, 29}, {56, 28}, {55, 27}, {55, 26}, {55, 25}, {55, 24}, {55, 23}, {54, 22}, {54, 21}, {54, 20}, {54, 19}, {53, 18}, {53, 17}, {53, 16}, {53, 15}, {53, 14}, {52, 13}, {52, 12}, {52, 11}, {52, 10}, {51, 9}, {51, 8}, {51, 7}, {51, 7}, {51, 6}, {50, 5}, {50, 4}, {50, 3},  },
-  { {64, 64}, {64, 63}, {64, 62}, {63, 61}, {63, 60}, {63, 59}, {63, 58}, {63, 57}, {62, 56}, {62, 55}, {62, 54}, {62, 53}, {62, 52}, {61, 51}, {61, 50}, {61, 49}, {61, 48}, {60, 47}, {60, 46}, {60, 45}, {60, 44}, {60, 43}, {59, 42}, {59, 42}, {59, 41}, {59, 40}, {59, 39}, {58, 38}, {58, 37}, {58, 36}, {58, 35}, {58, 34}, {57, 33}, {57, 32}, {57, 31}, {57, 30}, {57, 29}, {56, 28}, {56, 27}, {56, 26}, {56, 25}, {55, 24}, {55, 23}, {55, 22}, {55, 21}, {55, 20}, {54, 19}, {54, 18}, {54, 17}, {54, 16}, {54, 15}, {53, 14}, {53, 13}, {53, 12}, {53, 11}, {53, 10}, {52, 9}, {52, 8}, {52, 7}, {52, 6}, {52, 5}, {51, 4}, {51, 3}, {51, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {63, 61}, {63, 60}, {63, 59}, {63, 58}, {63, 57}, {62, 56}, {62, 55}, {62, 54}, {62, 53}, {62, 52}, {62, 51}, {61, 50}, {61, 49}, {61, 48}, {61, 47}, {61, 46}, {60, 45}, {60, 44}, {60, 43}, {60, 42}, {60, 41}, {59, 40}, {59, 39}, {59, 38}, {59, 37}, {59, 37}, {58, 36}, {58, 35}, {58, 34}, {58, 33}, {58, 32}, {58, 31}, {57, 30}, {57, 29}, {57, 28}, {57, 27}, {57, 26}, {56, 25}, {56, 24}, {56, 23}, {56, 22}, {56, 21}, {55, 20}, {55, 19}, {55, 18}, {55, 17}, {55, 16}, {54, 15}, {54, 14}, {54, 13}, {54, 12}, {54, 11}, {54, 10}, {53, 9}, {53, 8}, {53, 7}, {53, 6}, {53, 5}, {52, 4}, {52, 3}, {52, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {63, 61}, {63, 60}, {63, 59}, {63, 58}, {63, 57}, {63, 56}, {62, 55}, {62, 54}, {62, 53}, {62, 52}, {62, 51}, {62, 50}, {61, 49}, {61, 48}, {61, 47}, {61, 46}, {61, 45}, {61, 44}, {60, 43}, {60, 42}, {60, 41}, {60, 40}, {60, 39}, {59, 38}, {59, 37}, {59, 36}, {59, 35}, {59, 34}, {59, 33}, {58, 32}, {58, 32}, {58, 31}, {58, 30}, {58, 29}, {58, 28}, {57, 27}, {57, 26}, {57, 25}, {57, 24}, {57, 23}, {57, 22}, {56, 21}, {56, 20}, {56, 19}, {56, 18}, {56, 17}, {55, 16}, {55, 15}, {55, 14}, {55, 13}, {55, 12}, {55, 11}, {54, 10}, {54, 9}, {54, 8}, {54, 7}, {54, 6}, {54, 5}, {53, 4}, {53, 3}, {53, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {63, 60}, {63, 59}, {63, 58}, {63, 57}, {63, 56}, {63, 55}, {62, 54}, {62, 53}, {62, 52}, {62, 51}, {62, 50}, {62, 49}, {61, 48}, {61, 47}, {61, 46}, {61, 45}, {61, 44}, {61, 43}, {61, 42}, {60, 41}, {60, 40}, {60, 39}, {60, 38}, {60, 37}, {60, 36}, {59, 35}, {59, 34}, {59, 33}, {59, 32}, {59, 31}, {59, 30}, {59, 29}, {58, 28}, {58, 27}, {58, 26}, {58, 25}, {58, 24}, {58, 24}, {57, 23}, {57, 22}, {57, 21}, {57, 20}, {57, 19}, {57, 18}, {56, 17}, {56, 16}, {56, 15}, {56, 14}, {56, 13}, {56, 12}, {56, 11}, {55, 10}, {55, 9}, {55, 8}, {55, 7}, {55, 6}, {55, 5}, {54, 4}, {54, 3}, {54, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {63, 60}, {63, 59}, {63, 58}, {63, 57}, {63, 56}, {63, 55}, {63, 54}, {62, 53}, {62, 52}, {62, 51}, {62, 50}, {62, 49}, {62, 48}, {62, 47}, {61, 46}, {61, 45}, {61, 44}, {61, 43}, {61, 42}, {61, 41}, {61, 40}, {61, 39}, {60, 38}, {60, 37}, {60, 36}, {60, 35}, {60, 34}, {60, 33}, {60, 32}, {59, 31}, {59, 30}, {59, 29}, {59, 28}, {59, 27}, {59, 26}, {59, 25}, {58, 24}, {58, 23}, {58, 22}, {58, 21}, {58, 20}, {58, 19}, {58, 18}, {57, 17}, {57, 16}, {57, 15}, {57, 14}, {57, 13}, {57, 13}, {57, 12}, {56, 11}, {56, 10}, {56, 9}, {56, 8}, {56, 7}, {56, 6}, {56, 5}, {56, 4}, {55, 3}, {55, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {63, 59}, {63, 58}, {63, 57}, {63, 56}, {63, 55}, {63, 54}, {63, 53}, {63, 52}, {62, 51}, {62, 50}, {62, 49}, {62, 48}, {62, 47}, {62, 46}, {62, 45}, {62, 44}, {61, 43}, {61, 42}, {61, 41}, {61, 40}, {61, 39}, {61, 38}, {61, 37}, {61, 36}, {60, 35}, {60, 34}, {60, 33}, {60, 32}, {60, 31}, {60, 30}, {60, 29}, {60, 28}, {59, 27}, {59, 26}, {59, 25}, {59, 24}, {59, 23}, {59, 22}, {59, 21}, {59, 20}, {59, 19}, {58, 18}, {58, 17}, {58, 16}, {58, 15}, {58, 14}, {58, 13}, {58, 12}, {58, 11}, {57, 10}, {57, 9}, {57, 8}, {57, 7}, {57, 6}, {57, 5}, {57, 4}, {57, 3}, {56, 2}, {56, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {63, 59}, {63, 58}, {63, 57}, {63, 56}, {63, 55}, {63, 54}, {63, 53}, {63, 52}, {63, 51}, {63, 50}, {62, 49}, {62, 48}, {62, 47}, {62, 46}, {62, 45}, {62, 44}, {62, 43}, {62, 42}, {62, 41}, {61, 40}, {61, 39}, {61, 38}, {61, 37}, {61, 36}, {61, 35}, {61, 34}, {61, 33}, {61, 32}, {61, 31}, {60, 30}, {60, 29}, {60, 28}, {60, 27}, {60, 26}, {60, 25}, {60, 24}, {60, 23}, {60, 22}, {60, 21}, {59, 20}, {59, 19}, {59, 18}, {59, 17}, {59, 16}, {59, 15}, {59, 14}, {59, 13}, {59, 12}, {58, 11}, {58, 10}, {58, 9}, {58, 8}, {58, 7}, {58, 6}, {58, 5}, {58, 4}, {58, 3}, {58, 2}, {57, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {63, 58}, {63, 57}, {63, 56}, {63, 55}, {63, 54}, {63, 53}, {63, 52}, {63, 51}, {63, 50}, {63, 49}, {63, 48}, {63, 47}, {62, 46}, {62, 45}, {62, 44}, {62, 43}, {62, 42}, {62, 41}, {62, 40}, {62, 39}, {62, 38}, {62, 37}, {62, 36}, {61, 35}, {61, 34}, {61, 33}, {61, 32}, {61, 31}, {61, 30}, {61, 29}, {61, 28}, {61, 27}, {61, 26}, {61, 25}, {61, 24}, {60, 23}, {60, 22}, {60, 21}, {60, 20}, {60, 19}, {60, 18}, {60, 17}, {60, 16}, {60, 15}, {60, 14}, {60, 13}, {59, 12}, {59, 11}, {59, 10}, {59, 9}, {59, 8}, {59, 7}, {59, 6}, {59, 5}, {59, 4}, {59, 3}, {59, 2}, {59, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {63, 56}, {63, 55}, {63, 54}, {63, 53}, {63, 52}, {63, 51}, {63, 50}, {63, 49}, {63, 48}, {63, 47}, {63, 46}, {63, 45}, {63, 44}, {63, 43}, {62, 42}, {62, 41}, {62, 40}, {62, 39}, {62, 38}, {62, 37}, {62, 36}, {62, 35}, {62, 34}, {62, 33}, {62, 32}, {62, 31}, {62, 30}, {62, 29}, {61, 28}, {61, 27}, {61, 26}, {61, 25}, {61, 24}, {61, 23}, {61, 22}, {61, 21}, {61, 20}, {61, 19}, {61, 18}, {61, 17}, {61, 16}, {61, 15}, {61, 14}, {60, 13}, {60, 12}, {60, 11}, {60, 10}, {60, 9}, {60, 8}, {60, 7}, {60, 6}, {60, 5}, {60, 4}, {60, 3}, {60, 2}, {60, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {63, 54}, {63, 53}, {63, 52}, {63, 51}, {63, 50}, {63, 49}, {63, 48}, {63, 47}, {63, 46}, {63, 45}, {63, 44}, {63, 43}, {63, 42}, {63, 41}, {63, 40}, {63, 39}, {63, 38}, {63, 37}, {63, 36}, {62, 35}, {62, 34}, {62, 33}, {62, 32}, {62, 31}, {62, 30}, {62, 29}, {62, 28}, {62, 27}, {62, 26}, {62, 25}, {62, 24}, {62, 23}, {62, 22}, {62, 21}, {62, 20}, {62, 19}, {62, 18}, {62, 17}, {61, 16}, {61, 15}, {61, 14}, {61, 13}, {61, 12}, {61, 11}, {61, 10}, {61, 9}, {61, 8}, {61, 7}, {61, 6}, {61, 5}, {61, 4}, {61, 3}, {61, 2}, {61, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {64, 54}, {64, 53}, {64, 52}, {64, 51}, {64, 50}, {63, 49}, {63, 48}, {63, 47}, {63, 46}, {63, 45}, {63, 44}, {63, 43}, {63, 42}, {63, 41}, {63, 40}, {63, 39}, {63, 38}, {63, 37}, {63, 36}, {63, 35}, {63, 34}, {63, 33}, {63, 32}, {63, 31}, {63, 30}, {63, 29}, {63, 28}, {63, 27}, {63, 26}, {63, 25}, {63, 24}, {63, 23}, {63, 22}, {62, 21}, {62, 20}, {62, 19}, {62, 18}, {62, 17}, {62, 16}, {62, 15}, {62, 14}, {62, 13}, {62, 12}, {62, 11}, {62, 10}, {62, 9}, {62, 8}, {62, 7}, {62, 6}, {62, 5}, {62, 4}, {62, 3}, {62, 2}, {62, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {64, 54}, {64, 53}, {64, 52}, {64, 51}, {64, 50}, {64, 49}, {64, 48}, {64, 47}, {64, 46}, {64, 45}, {64, 44}, {64, 43}, {64, 42}, {64, 41}, {64, 40}, {64, 39}, {64, 38}, {64, 37}, {64, 36}, {63, 35}, {63, 34}, {63, 33}, {63, 32}, {63, 31}, {63, 30}, {63, 29}, {63, 28}, {63, 27}, {63, 26}, {63, 25}, {63, 24}, {63, 23}, {63, 22}, {63, 21}, {63, 20}, {63, 19}, {63, 18}, {63, 17}, {63, 16}, {63, 15}, {63, 14}, {63, 13}, {63, 12}, {63, 11}, {63, 10}, {63, 9}, {63, 8}, {63, 7}, {63, 6}, {63, 5}, {63, 4}, {63, 3}, {63, 2}, {63, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {64, 54}, {64, 53}, {64, 52}, {64, 51}, {64, 50}, {64, 49}, {64, 48}, {64, 47}, {64, 46}, {64, 45}, {64, 44}, {64, 43}, {64, 42}, {64, 41}, {64, 40}, {64, 39}, {64, 38}, {64, 37}, {64, 36}, {64, 35}, {64, 34}, {64, 33}, {64, 32}, {64, 31}, {64, 30}, {64, 29}, {64, 28}, {64, 27}, {64, 26}, {64, 25}, {64, 24}, {64, 23}, {64, 22}, {64, 21}, {64, 20}, {64, 19}, {64, 18}, {64, 17}, {64, 16}, {64, 15}, {64, 14}, {64, 13}, {64, 12}, {64, 11}, {64, 10}, {64, 9}, {64, 8}, {64, 7}, {64, 6}, {64, 5}, {64, 4}, {64, 3}, {64, 2}, {64, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {64, 54}, {64, 53}, {64, 52}, {64, 51}, {64, 50}, {64, 49}, {64, 48}, {64, 47}, {64, 46}, {64, 45}, {64, 44}, {64, 43}, {64, 42}, {64, 41}, {64, 40}, {64, 39}, {64, 38}, {64, 37}, {64, 36}, {65, 35}, {65, 34}, {65, 33}, {65, 32}, {65, 31}, {65, 30}, {65, 29}, {65, 28}, {65, 27}, {65, 26}, {65, 25}, {65, 24}, {65, 23}, {65, 22}, {65, 21}, {65, 20}, {65, 19}, {65, 18}, {65, 17}, {65, 16}, {65, 15}, {65, 14}, {65, 13}, {65, 12}, {65, 11}, {65, 10}, {65, 9}, {65, 8}, {65, 7}, {65, 6}, {65, 5}, {65, 4}, {65, 3}, {65, 2}, {65, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {64, 54}, {64, 53}, {64, 52}, {64, 51}, {64, 50}, {65, 49}, {65, 48}, {65, 47}, {65, 46}, {65, 45}, {65, 44}, {65, 43}, {65, 42}, {65, 41}, {65, 40}, {65, 39}, {65, 38}, {65, 37}, {65, 36}, {65, 35}, {65, 34}, {65, 33}, {65, 32}, {65, 31}, {65, 30}, {65, 29}, {65, 28}, {65, 27}, {65, 26}, {65, 25}, {65, 24}, {65, 23}, {65, 22}, {66, 21}, {66, 20}, {66, 19}, {66, 18}, {66, 17}, {66, 16}, {66, 15}, {66, 14}, {66, 13}, {66, 12}, {66, 11}, {66, 10}, {66, 9}, {66, 8}, {66, 7}, {66, 6}, {66, 5}, {66, 4}, {66, 3}, {66, 2}, {66, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {64, 56}, {64, 55}, {65, 54}, {65, 53}, {65, 52}, {65, 51}, {65, 50}, {65, 49}, {65, 48}, {65, 47}, {65, 46}, {65, 45}, {65, 44}, {65, 43}, {65, 42}, {65, 41}, {65, 40}, {65, 39}, {65, 38}, {65, 37}, {65, 36}, {66, 35}, {66, 34}, {66, 33}, {66, 32}, {66, 31}, {66, 30}, {66, 29}, {66, 28}, {66, 27}, {66, 26}, {66, 25}, {66, 24}, {66, 23}, {66, 22}, {66, 21}, {66, 20}, {66, 19}, {66, 18}, {66, 17}, {67, 16}, {67, 15}, {67, 14}, {67, 13}, {67, 12}, {67, 11}, {67, 10}, {67, 9}, {67, 8}, {67, 7}, {67, 6}, {67, 5}, {67, 4}, {67, 3}, {67, 2}, {67, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {64, 58}, {64, 57}, {65, 56}, {65, 55}, {65, 54}, {65, 53}, {65, 52}, {65, 51}, {65, 50}, {65, 49}, {65, 48}, {65, 47}, {65, 46}, {65, 45}, {65, 44}, {65, 43}, {66, 42}, {66, 41}, {66, 40}, {66, 39}, {66, 38}, {66, 37}, {66, 36}, {66, 35}, {66, 34}, {66, 33}, {66, 32}, {66, 31}, {66, 30}, {66, 29}, {67, 28}, {67, 27}, {67, 26}, {67, 25}, {67, 24}, {67, 23}, {67, 22}, {67, 21}, {67, 20}, {67, 19}, {67, 18}, {67, 17}, {67, 16}, {67, 15}, {67, 14}, {68, 13}, {68, 12}, {68, 11}, {68, 10}, {68, 9}, {68, 8}, {68, 7}, {68, 6}, {68, 5}, {68, 4}, {68, 3}, {68, 2}, {68, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {64, 59}, {65, 58}, {65, 57}, {65, 56}, {65, 55}, {65, 54}, {65, 53}, {65, 52}, {65, 51}, {65, 50}, {65, 49}, {65, 48}, {65, 47}, {66, 46}, {66, 45}, {66, 44}, {66, 43}, {66, 42}, {66, 41}, {66, 40}, {66, 39}, {66, 38}, {66, 37}, {66, 36}, {67, 35}, {67, 34}, {67, 33}, {67, 32}, {67, 31}, {67, 30}, {67, 29}, {67, 28}, {67, 27}, {67, 26}, {67, 25}, {67, 24}, {68, 23}, {68, 22}, {68, 21}, {68, 20}, {68, 19}, {68, 18}, {68, 17}, {68, 16}, {68, 15}, {68, 14}, {68, 13}, {69, 12}, {69, 11}, {69, 10}, {69, 9}, {69, 8}, {69, 7}, {69, 6}, {69, 5}, {69, 4}, {69, 3}, {69, 2}, {69, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {65, 59}, {65, 58}, {65, 57}, {65, 56}, {65, 55}, {65, 54}, {65, 53}, {65, 52}, {65, 51}, {65, 50}, {66, 49}, {66, 48}, {66, 47}, {66, 46}, {66, 45}, {66, 44}, {66, 43}, {66, 42}, {66, 41}, {67, 40}, {67, 39}, {67, 38}, {67, 37}, {67, 36}, {67, 35}, {67, 34}, {67, 33}, {67, 32}, {67, 31}, {68, 30}, {68, 29}, {68, 28}, {68, 27}, {68, 26}, {68, 25}, {68, 24}, {68, 23}, {68, 22}, {68, 21}, {69, 20}, {69, 19}, {69, 18}, {69, 17}, {69, 16}, {69, 15}, {69, 14}, {69, 13}, {69, 12}, {70, 11}, {70, 10}, {70, 9}, {70, 8}, {70, 7}, {70, 6}, {70, 5}, {70, 4}, {70, 3}, {70, 2}, {71, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {64, 60}, {65, 59}, {65, 58}, {65, 57}, {65, 56}, {65, 55}, {65, 54}, {65, 53}, {65, 52}, {66, 51}, {66, 50}, {66, 49}, {66, 48}, {66, 47}, {66, 46}, {66, 45}, {66, 44}, {67, 43}, {67, 42}, {67, 41}, {67, 40}, {67, 39}, {67, 38}, {67, 37}, {67, 36}, {68, 35}, {68, 34}, {68, 33}, {68, 32}, {68, 31}, {68, 30}, {68, 29}, {68, 28}, {69, 27}, {69, 26}, {69, 25}, {69, 24}, {69, 23}, {69, 22}, {69, 21}, {69, 20}, {69, 19}, {70, 18}, {70, 17}, {70, 16}, {70, 15}, {70, 14}, {70, 13}, {70, 12}, {70, 11}, {71, 10}, {71, 9}, {71, 8}, {71, 7}, {71, 6}, {71, 5}, {71, 4}, {71, 3}, {72, 2}, {72, 1},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {65, 60}, {65, 59}, {65, 58}, {65, 57}, {65, 56}, {65, 55}, {65, 54}, {66, 53}, {66, 52}, {66, 51}, {66, 50}, {66, 49}, {66, 48}, {66, 47}, {67, 46}, {67, 45}, {67, 44}, {67, 43}, {67, 42}, {67, 41}, {67, 40}, {67, 39}, {68, 38}, {68, 37}, {68, 36}, {68, 35}, {68, 34}, {68, 33}, {68, 32}, {69, 31}, {69, 30}, {69, 29}, {69, 28}, {69, 27}, {69, 26}, {69, 25}, {70, 24}, {70, 23}, {70, 22}, {70, 21}, {70, 20}, {70, 19}, {70, 18}, {71, 17}, {71, 16}, {71, 15}, {71, 14}, {71, 13}, {71, 13}, {71, 12}, {72, 11}, {72, 10}, {72, 9}, {72, 8}, {72, 7}, {72, 6}, {72, 5}, {72, 4}, {73, 3}, {73, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {64, 61}, {65, 60}, {65, 59}, {65, 58}, {65, 57}, {65, 56}, {65, 55}, {66, 54}, {66, 53}, {66, 52}, {66, 51}, {66, 50}, {66, 49}, {67, 48}, {67, 47}, {67, 46}, {67, 45}, {67, 44}, {67, 43}, {67, 42}, {68, 41}, {68, 40}, {68, 39}, {68, 38}, {68, 37}, {68, 36}, {69, 35}, {69, 34}, {69, 33}, {69, 32}, {69, 31}, {69, 30}, {69, 29}, {70, 28}, {70, 27}, {70, 26}, {70, 25}, {70, 24}, {70, 24}, {71, 23}, {71, 22}, {71, 21}, {71, 20}, {71, 19}, {71, 18}, {72, 17}, {72, 16}, {72, 15}, {72, 14}, {72, 13}, {72, 12}, {72, 11}, {73, 10}, {73, 9}, {73, 8}, {73, 7}, {73, 6}, {73, 5}, {74, 4}, {74, 3}, {74, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {65, 61}, {65, 60}, {65, 59}, {65, 58}, {65, 57}, {65, 56}, {66, 55}, {66, 54}, {66, 53}, {66, 52}, {66, 51}, {66, 50}, {67, 49}, {67, 48}, {67, 47}, {67, 46}, {67, 45}, {67, 44}, {68, 43}, {68, 42}, {68, 41}, {68, 40}, {68, 39}, {69, 38}, {69, 37}, {69, 36}, {69, 35}, {69, 34}, {69, 33}, {70, 32}, {70, 32}, {70, 31}, {70, 30}, {70, 29}, {70, 28}, {71, 27}, {71, 26}, {71, 25}, {71, 24}, {71, 23}, {71, 22}, {72, 21}, {72, 20}, {72, 19}, {72, 18}, {72, 17}, {73, 16}, {73, 15}, {73, 14}, {73, 13}, {73, 12}, {73, 11}, {74, 10}, {74, 9}, {74, 8}, {74, 7}, {74, 6}, {74, 5}, {75, 4}, {75, 3}, {75, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {65, 61}, {65, 60}, {65, 59}, {65, 58}, {65, 57}, {66, 56}, {66, 55}, {66, 54}, {66, 53}, {66, 52}, {66, 51}, {67, 50}, {67, 49}, {67, 48}, {67, 47}, {67, 46}, {68, 45}, {68, 44}, {68, 43}, {68, 42}, {68, 41}, {69, 40}, {69, 39}, {69, 38}, {69, 37}, {69, 37}, {70, 36}, {70, 35}, {70, 34}, {70, 33}, {70, 32}, {70, 31}, {71, 30}, {71, 29}, {71, 28}, {71, 27}, {71, 26}, {72, 25}, {72, 24}, {72, 23}, {72, 22}, {72, 21}, {73, 20}, {73, 19}, {73, 18}, {73, 17}, {73, 16}, {74, 15}, {74, 14}, {74, 13}, {74, 12}, {74, 11}, {74, 10}, {75, 9}, {75, 8}, {75, 7}, {75, 6}, {75, 5}, {76, 4}, {76, 3}, {76, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {65, 61}, {65, 60}, {65, 59}, {65, 58}, {65, 57}, {66, 56}, {66, 55}, {66, 54}, {66, 53}, {66, 52}, {67, 51}, {67, 50}, {67, 49}, {67, 48}, {68, 47}, {68, 46}, {68, 45}, {68, 44}, {68, 43}, {69, 42}, {69, 42}, {69, 41}, {69, 40}, {69, 39}, {70, 38}, {70, 37}, {70, 36}, {70, 35}, {70, 34}, {71, 33}, {71, 32}, {71, 31}, {71, 30}, {71, 29}, {72, 28}, {72, 27}, {72, 26}, {72, 25}, {73, 24}, {73, 23}, {73, 22}, {73, 21}, {73, 20}, {74, 19}, {74, 18}, {74, 17}, {74, 16}, {74, 15}, {75, 14}, {75, 13}, {75, 12}, {75, 11}, {75, 10}, {76, 9}, {76, 8}, {76, 7}, {76, 6}, {76, 5}, {77, 4}, {77, 3}, {77, 2},  },
-  { {64, 64}, {64, 63}, {64, 62}, {65, 61}, {65, 60}, {65, 59}, {65, 58}, {66, 57}, {66, 56}, {66, 55}, {66, 54}, {66, 53}, {67, 52}, {67, 51}, {67, 50}, {67, 49}, {68, 48}, {68, 47}, {68, 46}, {68, 45}, {68, 45}, {69, 44}, {69, 43}, {69, 42}, {69, 41}, {70, 40}, {70, 39}, {70, 38}, {70, 37}, {71, 36}, {71, 35}, {71, 34}, {71, 33}, {71, 32}, {72, 31}, {72, 30}, {72, 29}, {72, 28}, {73, 27}, {73, 26}, {73, 25}, {73, 24}, {73, 23}, {74, 22}, {74, 21}, {74, 20}, {74, 19}, {75, 18}, {75, 17}, {75, 16}, {75, 15}, {75, 14}, {76, 13}, {76, 12}, {76, 11}, {76, 10}, {77, 9}, {77, 8}, {77, 7}, {77, 7}, {77, 6}, {78, 5}, {78, 4}, {78, 3},  },
-  { {64, 64}, {64, 63}, {64, 62}, {65, 61}, {65, 60}, {65, 59}, {65, 58}, {66, 57}, {66, 56}, {66, 55}, {66, 54}, {67, 53}, {67, 52}, {67, 51}, {67, 50}, {68, 49}, {68, 48}, {68, 48}, {68, 47}, {69, 46}, {69, 45}, {69, 44}, {69, 43}, {70, 42}, {70, 41}, {70, 40}, {70, 39}, {71, 38}, {71, 37}, {71, 36}, {71, 35}, {71, 34}, {72, 33}, {72, 32}, {72, 31}, {72, 30}, {73, 29}, {73, 28}, {73, 27}, {73, 26}, {74, 25}, {74, 24}, {74, 23}, {74, 22}, {75, 21}, {75, 20}, {75, 19}, {75, 18}, {76, 17}, {76, 16}, {76, 15}, {76, 15}, {77, 14}, {77, 13}, {77, 12}, {77, 11}, {78, 10}, {78, 9}, {78, 8}, {78, 7}, {79, 6}, {79, 5}, {79, 4}, {79, 3},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {65, 59}, {66, 58}, {66, 57}, {66, 56}, {66, 55}, {67, 54}, {67, 53}, {67, 52}, {67, 51}, {68, 50}, {68, 50}, {68, 49}, {68, 48}, {69, 47}, {69, 46}, {69, 45}, {69, 44}, {70, 43}, {70, 42}, {70, 41}, {70, 40}, {71, 39}, {71, 38}, {71, 37}, {72, 36}, {72, 35}, {72, 34}, {72, 33}, {73, 32}, {73, 31}, {73, 30}, {73, 29}, {74, 28}, {74, 27}, {74, 26}, {74, 25}, {75, 24}, {75, 23}, {75, 22}, {75, 21}, {76, 21}, {76, 20}, {76, 19}, {76, 18}, {77, 17}, {77, 16}, {77, 15}, {77, 14}, {78, 13}, {78, 12}, {78, 11}, {78, 10}, {79, 9}, {79, 8}, {79, 7}, {80, 6}, {80, 5}, {80, 4}, {80, 3},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {65, 59}, {66, 58}, {66, 57}, {66, 56}, {66, 55}, {67, 54}, {67, 53}, {67, 52}, {68, 52}, {68, 51}, {68, 50}, {68, 49}, {69, 48}, {69, 47}, {69, 46}, {70, 45}, {70, 44}, {70, 43}, {70, 42}, {71, 41}, {71, 40}, {71, 39}, {71, 38}, {72, 37}, {72, 36}, {72, 35}, {73, 34}, {73, 33}, {73, 32}, {73, 31}, {74, 30}, {74, 29}, {74, 28}, {74, 27}, {75, 27}, {75, 26}, {75, 25}, {76, 24}, {76, 23}, {76, 22}, {76, 21}, {77, 20}, {77, 19}, {77, 18}, {78, 17}, {78, 16}, {78, 15}, {78, 14}, {79, 13}, {79, 12}, {79, 11}, {79, 10}, {80, 9}, {80, 8}, {80, 7}, {81, 6}, {81, 5}, {81, 4}, {81, 3},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {65, 59}, {66, 58}, {66, 57}, {66, 56}, {67, 55}, {67, 54}, {67, 53}, {68, 53}, {68, 52}, {68, 51}, {68, 50}, {69, 49}, {69, 48}, {69, 47}, {70, 46}, {70, 45}, {70, 44}, {70, 43}, {71, 42}, {71, 41}, {71, 40}, {72, 39}, {72, 38}, {72, 37}, {72, 36}, {73, 35}, {73, 34}, {73, 33}, {74, 32}, {74, 31}, {74, 31}, {75, 30}, {75, 29}, {75, 28}, {75, 27}, {76, 26}, {76, 25}, {76, 24}, {77, 23}, {77, 22}, {77, 21}, {77, 20}, {78, 19}, {78, 18}, {78, 17}, {79, 16}, {79, 15}, {79, 14}, {79, 13}, {80, 12}, {80, 11}, {80, 10}, {81, 9}, {81, 9}, {81, 8}, {82, 7}, {82, 6}, {82, 5}, {82, 4},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {66, 59}, {66, 58}, {66, 57}, {66, 56}, {67, 55}, {67, 54}, {67, 54}, {68, 53}, {68, 52}, {68, 51}, {69, 50}, {69, 49}, {69, 48}, {70, 47}, {70, 46}, {70, 45}, {70, 44}, {71, 43}, {71, 42}, {71, 41}, {72, 40}, {72, 39}, {72, 38}, {73, 37}, {73, 36}, {73, 35}, {74, 35}, {74, 34}, {74, 33}, {75, 32}, {75, 31}, {75, 30}, {75, 29}, {76, 28}, {76, 27}, {76, 26}, {77, 25}, {77, 24}, {77, 23}, {78, 22}, {78, 21}, {78, 20}, {79, 19}, {79, 18}, {79, 17}, {79, 16}, {80, 15}, {80, 15}, {80, 14}, {81, 13}, {81, 12}, {81, 11}, {82, 10}, {82, 9}, {82, 8}, {83, 7}, {83, 6}, {83, 5}, {83, 4},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {66, 59}, {66, 58}, {66, 57}, {67, 56}, {67, 55}, {67, 55}, {68, 54}, {68, 53}, {68, 52}, {69, 51}, {69, 50}, {69, 49}, {70, 48}, {70, 47}, {70, 46}, {71, 45}, {71, 44}, {71, 43}, {71, 42}, {72, 41}, {72, 40}, {72, 39}, {73, 38}, {73, 38}, {73, 37}, {74, 36}, {74, 35}, {74, 34}, {75, 33}, {75, 32}, {75, 31}, {76, 30}, {76, 29}, {76, 28}, {77, 27}, {77, 26}, {77, 25}, {78, 24}, {78, 23}, {78, 22}, {79, 21}, {79, 21}, {79, 20}, {80, 19}, {80, 18}, {80, 17}, {81, 16}, {81, 15}, {81, 14}, {82, 13}, {82, 12}, {82, 11}, {83, 10}, {83, 9}, {83, 8}, {84, 7}, {84, 6}, {84, 5}, {85, 4},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {66, 59}, {66, 58}, {66, 57}, {67, 56}, {67, 56}, {67, 55}, {68, 54}, {68, 53}, {68, 52}, {69, 51}, {69, 50}, {69, 49}, {70, 48}, {70, 47}, {70, 46}, {71, 45}, {71, 44}, {72, 43}, {72, 42}, {72, 41}, {73, 41}, {73, 40}, {73, 39}, {74, 38}, {74, 37}, {74, 36}, {75, 35}, {75, 34}, {75, 33}, {76, 32}, {76, 31}, {76, 30}, {77, 29}, {77, 28}, {77, 27}, {78, 26}, {78, 25}, {78, 25}, {79, 24}, {79, 23}, {79, 22}, {80, 21}, {80, 20}, {80, 19}, {81, 18}, {81, 17}, {81, 16}, {82, 15}, {82, 14}, {82, 13}, {83, 12}, {83, 11}, {83, 10}, {84, 9}, {84, 9}, {85, 8}, {85, 7}, {85, 6}, {86, 5},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {66, 59}, {66, 58}, {67, 57}, {67, 57}, {67, 56}, {68, 55}, {68, 54}, {68, 53}, {69, 52}, {69, 51}, {69, 50}, {70, 49}, {70, 48}, {70, 47}, {71, 46}, {71, 45}, {72, 44}, {72, 43}, {72, 43}, {73, 42}, {73, 41}, {73, 40}, {74, 39}, {74, 38}, {74, 37}, {75, 36}, {75, 35}, {75, 34}, {76, 33}, {76, 32}, {77, 31}, {77, 30}, {77, 29}, {78, 29}, {78, 28}, {78, 27}, {79, 26}, {79, 25}, {79, 24}, {80, 23}, {80, 22}, {80, 21}, {81, 20}, {81, 19}, {82, 18}, {82, 17}, {82, 16}, {83, 15}, {83, 15}, {83, 14}, {84, 13}, {84, 12}, {84, 11}, {85, 10}, {85, 9}, {86, 8}, {86, 7}, {86, 6}, {87, 5},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {65, 60}, {66, 59}, {66, 58}, {67, 58}, {67, 57}, {67, 56}, {68, 55}, {68, 54}, {68, 53}, {69, 52}, {69, 51}, {70, 50}, {70, 49}, {70, 48}, {71, 47}, {71, 46}, {71, 45}, {72, 45}, {72, 44}, {73, 43}, {73, 42}, {73, 41}, {74, 40}, {74, 39}, {74, 38}, {75, 37}, {75, 36}, {76, 35}, {76, 34}, {76, 33}, {77, 32}, {77, 32}, {77, 31}, {78, 30}, {78, 29}, {79, 28}, {79, 27}, {79, 26}, {80, 25}, {80, 24}, {80, 23}, {81, 22}, {81, 21}, {82, 20}, {82, 19}, {82, 19}, {83, 18}, {83, 17}, {83, 16}, {84, 15}, {84, 14}, {85, 13}, {85, 12}, {85, 11}, {86, 10}, {86, 9}, {86, 8}, {87, 7}, {87, 7}, {88, 6},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 59}, {66, 58}, {67, 58}, {67, 57}, {68, 56}, {68, 55}, {68, 54}, {69, 53}, {69, 52}, {69, 51}, {70, 50}, {70, 49}, {71, 48}, {71, 47}, {71, 47}, {72, 46}, {72, 45}, {73, 44}, {73, 43}, {73, 42}, {74, 41}, {74, 40}, {75, 39}, {75, 38}, {75, 37}, {76, 36}, {76, 35}, {77, 35}, {77, 34}, {77, 33}, {78, 32}, {78, 31}, {78, 30}, {79, 29}, {79, 28}, {80, 27}, {80, 26}, {80, 25}, {81, 24}, {81, 23}, {82, 23}, {82, 22}, {82, 21}, {83, 20}, {83, 19}, {84, 18}, {84, 17}, {84, 16}, {85, 15}, {85, 14}, {85, 13}, {86, 12}, {86, 12}, {87, 11}, {87, 10}, {87, 9}, {88, 8}, {88, 7}, {89, 6},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 59}, {66, 59}, {67, 58}, {67, 57}, {68, 56}, {68, 55}, {68, 54}, {69, 53}, {69, 52}, {70, 51}, {70, 50}, {71, 49}, {71, 48}, {71, 48}, {72, 47}, {72, 46}, {73, 45}, {73, 44}, {73, 43}, {74, 42}, {74, 41}, {75, 40}, {75, 39}, {75, 38}, {76, 38}, {76, 37}, {77, 36}, {77, 35}, {77, 34}, {78, 33}, {78, 32}, {79, 31}, {79, 30}, {79, 29}, {80, 28}, {80, 27}, {81, 27}, {81, 26}, {81, 25}, {82, 24}, {82, 23}, {83, 22}, {83, 21}, {84, 20}, {84, 19}, {84, 18}, {85, 17}, {85, 16}, {86, 16}, {86, 15}, {86, 14}, {87, 13}, {87, 12}, {88, 11}, {88, 10}, {88, 9}, {89, 8}, {89, 7}, {90, 6},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 59}, {67, 59}, {67, 58}, {67, 57}, {68, 56}, {68, 55}, {69, 54}, {69, 53}, {69, 52}, {70, 51}, {70, 50}, {71, 49}, {71, 49}, {72, 48}, {72, 47}, {72, 46}, {73, 45}, {73, 44}, {74, 43}, {74, 42}, {75, 41}, {75, 40}, {75, 40}, {76, 39}, {76, 38}, {77, 37}, {77, 36}, {78, 35}, {78, 34}, {78, 33}, {79, 32}, {79, 31}, {80, 30}, {80, 30}, {80, 29}, {81, 28}, {81, 27}, {82, 26}, {82, 25}, {83, 24}, {83, 23}, {83, 22}, {84, 21}, {84, 20}, {85, 20}, {85, 19}, {86, 18}, {86, 17}, {86, 16}, {87, 15}, {87, 14}, {88, 13}, {88, 12}, {89, 11}, {89, 11}, {89, 10}, {90, 9}, {90, 8}, {91, 7},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 60}, {67, 59}, {67, 58}, {68, 57}, {68, 56}, {68, 55}, {69, 54}, {69, 53}, {70, 52}, {70, 51}, {71, 51}, {71, 50}, {71, 49}, {72, 48}, {72, 47}, {73, 46}, {73, 45}, {74, 44}, {74, 43}, {75, 42}, {75, 42}, {75, 41}, {76, 40}, {76, 39}, {77, 38}, {77, 37}, {78, 36}, {78, 35}, {78, 34}, {79, 33}, {79, 33}, {80, 32}, {80, 31}, {81, 30}, {81, 29}, {82, 28}, {82, 27}, {82, 26}, {83, 25}, {83, 24}, {84, 24}, {84, 23}, {85, 22}, {85, 21}, {85, 20}, {86, 19}, {86, 18}, {87, 17}, {87, 16}, {88, 15}, {88, 15}, {89, 14}, {89, 13}, {89, 12}, {90, 11}, {90, 10}, {91, 9}, {91, 8}, {92, 7},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 60}, {67, 59}, {67, 58}, {68, 57}, {68, 56}, {69, 55}, {69, 54}, {69, 53}, {70, 52}, {70, 52}, {71, 51}, {71, 50}, {72, 49}, {72, 48}, {73, 47}, {73, 46}, {74, 45}, {74, 44}, {74, 44}, {75, 43}, {75, 42}, {76, 41}, {76, 40}, {77, 39}, {77, 38}, {78, 37}, {78, 36}, {79, 35}, {79, 35}, {79, 34}, {80, 33}, {80, 32}, {81, 31}, {81, 30}, {82, 29}, {82, 28}, {83, 27}, {83, 27}, {84, 26}, {84, 25}, {84, 24}, {85, 23}, {85, 22}, {86, 21}, {86, 20}, {87, 19}, {87, 19}, {88, 18}, {88, 17}, {89, 16}, {89, 15}, {89, 14}, {90, 13}, {90, 12}, {91, 11}, {91, 11}, {92, 10}, {92, 9}, {93, 8},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 60}, {66, 60}, {67, 59}, {67, 58}, {68, 57}, {68, 56}, {69, 55}, {69, 54}, {70, 53}, {70, 53}, {71, 52}, {71, 51}, {72, 50}, {72, 49}, {72, 48}, {73, 47}, {73, 46}, {74, 45}, {74, 45}, {75, 44}, {75, 43}, {76, 42}, {76, 41}, {77, 40}, {77, 39}, {78, 38}, {78, 38}, {79, 37}, {79, 36}, {79, 35}, {80, 34}, {80, 33}, {81, 32}, {81, 31}, {82, 30}, {82, 30}, {83, 29}, {83, 28}, {84, 27}, {84, 26}, {85, 25}, {85, 24}, {86, 23}, {86, 23}, {87, 22}, {87, 21}, {87, 20}, {88, 19}, {88, 18}, {89, 17}, {89, 16}, {90, 15}, {90, 15}, {91, 14}, {91, 13}, {92, 12}, {92, 11}, {93, 10}, {93, 9}, {94, 8},  },
-  { {64, 64}, {64, 63}, {65, 62}, {65, 61}, {66, 61}, {66, 60}, {67, 59}, {67, 58}, {68, 57}, {68, 56}, {69, 55}, {69, 54}, {70, 54}, {70, 53}, {71, 52}, {71, 51}, {72, 50}, {72, 49}, {73, 48}, {73, 47}, {74, 47}, {74, 46}, {75, 45}, {75, 44}, {76, 43}, {76, 42}, {77, 41}, {77, 40}, {78, 40}, {78, 39}, {79, 38}, {79, 37}, {80, 36}, {80, 35}, {80, 34}, {81, 33}, {81, 33}, {82, 32}, {82, 31}, {83, 30}, {83, 29}, {84, 28}, {84, 27}, {85, 26}, {85, 26}, {86, 25}, {86, 24}, {87, 23}, {87, 22}, {88, 21}, {88, 20}, {89, 19}, {89, 19}, {90, 18}, {90, 17}, {91, 16}, {91, 15}, {92, 14}, {92, 13}, {93, 12}, {93, 12}, {94, 11}, {94, 10}, {95, 9},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 61}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {68, 57}, {69, 56}, {69, 55}, {70, 54}, {70, 54}, {71, 53}, {71, 52}, {72, 51}, {72, 50}, {73, 49}, {73, 48}, {74, 48}, {74, 47}, {75, 46}, {75, 45}, {76, 44}, {76, 43}, {77, 42}, {77, 41}, {78, 41}, {78, 40}, {79, 39}, {79, 38}, {80, 37}, {80, 36}, {81, 35}, {81, 35}, {82, 34}, {82, 33}, {83, 32}, {83, 31}, {84, 30}, {84, 29}, {85, 28}, {85, 28}, {86, 27}, {86, 26}, {87, 25}, {87, 24}, {88, 23}, {88, 22}, {89, 22}, {89, 21}, {90, 20}, {90, 19}, {91, 18}, {91, 17}, {92, 16}, {92, 16}, {93, 15}, {93, 14}, {94, 13}, {94, 12}, {95, 11}, {95, 10}, {96, 9},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 61}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {68, 57}, {69, 56}, {69, 55}, {70, 55}, {70, 54}, {71, 53}, {71, 52}, {72, 51}, {72, 50}, {73, 49}, {73, 49}, {74, 48}, {74, 47}, {75, 46}, {75, 45}, {76, 44}, {76, 43}, {77, 43}, {77, 42}, {78, 41}, {78, 40}, {79, 39}, {79, 38}, {80, 37}, {80, 37}, {81, 36}, {82, 35}, {82, 34}, {83, 33}, {83, 32}, {84, 31}, {84, 31}, {85, 30}, {85, 29}, {86, 28}, {86, 27}, {87, 26}, {87, 25}, {88, 25}, {88, 24}, {89, 23}, {89, 22}, {90, 21}, {90, 20}, {91, 19}, {91, 19}, {92, 18}, {92, 17}, {93, 16}, {93, 15}, {94, 14}, {94, 13}, {95, 13}, {95, 12}, {96, 11}, {96, 10},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 61}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {68, 57}, {69, 56}, {69, 56}, {70, 55}, {70, 54}, {71, 53}, {71, 52}, {72, 51}, {72, 50}, {73, 50}, {74, 49}, {74, 48}, {75, 47}, {75, 46}, {76, 45}, {76, 44}, {77, 44}, {77, 43}, {78, 42}, {78, 41}, {79, 40}, {79, 39}, {80, 39}, {80, 38}, {81, 37}, {81, 36}, {82, 35}, {83, 34}, {83, 33}, {84, 33}, {84, 32}, {85, 31}, {85, 30}, {86, 29}, {86, 28}, {87, 28}, {87, 27}, {88, 26}, {88, 25}, {89, 24}, {89, 23}, {90, 22}, {90, 22}, {91, 21}, {92, 20}, {92, 19}, {93, 18}, {93, 17}, {94, 17}, {94, 16}, {95, 15}, {95, 14}, {96, 13}, {96, 12}, {97, 11}, {97, 11},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 61}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {68, 57}, {69, 56}, {69, 56}, {70, 55}, {71, 54}, {71, 53}, {72, 52}, {72, 51}, {73, 51}, {73, 50}, {74, 49}, {74, 48}, {75, 47}, {75, 46}, {76, 46}, {77, 45}, {77, 44}, {78, 43}, {78, 42}, {79, 41}, {79, 41}, {80, 40}, {80, 39}, {81, 38}, {81, 37}, {82, 36}, {83, 35}, {83, 35}, {84, 34}, {84, 33}, {85, 32}, {85, 31}, {86, 30}, {86, 30}, {87, 29}, {87, 28}, {88, 27}, {89, 26}, {89, 25}, {90, 25}, {90, 24}, {91, 23}, {91, 22}, {92, 21}, {92, 20}, {93, 20}, {93, 19}, {94, 18}, {94, 17}, {95, 16}, {96, 15}, {96, 15}, {97, 14}, {97, 13}, {98, 12}, {98, 11},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {68, 57}, {69, 57}, {70, 56}, {70, 55}, {71, 54}, {71, 53}, {72, 52}, {72, 52}, {73, 51}, {74, 50}, {74, 49}, {75, 48}, {75, 47}, {76, 47}, {76, 46}, {77, 45}, {77, 44}, {78, 43}, {79, 42}, {79, 42}, {80, 41}, {80, 40}, {81, 39}, {81, 38}, {82, 37}, {82, 37}, {83, 36}, {84, 35}, {84, 34}, {85, 33}, {85, 32}, {86, 32}, {86, 31}, {87, 30}, {87, 29}, {88, 28}, {89, 28}, {89, 27}, {90, 26}, {90, 25}, {91, 24}, {91, 23}, {92, 23}, {93, 22}, {93, 21}, {94, 20}, {94, 19}, {95, 18}, {95, 18}, {96, 17}, {96, 16}, {97, 15}, {98, 14}, {98, 13}, {99, 13}, {99, 12},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {66, 61}, {67, 60}, {67, 59}, {68, 58}, {69, 57}, {69, 57}, {70, 56}, {70, 55}, {71, 54}, {71, 53}, {72, 53}, {73, 52}, {73, 51}, {74, 50}, {74, 49}, {75, 48}, {75, 48}, {76, 47}, {77, 46}, {77, 45}, {78, 44}, {78, 44}, {79, 43}, {79, 42}, {80, 41}, {81, 40}, {81, 39}, {82, 39}, {82, 38}, {83, 37}, {84, 36}, {84, 35}, {85, 35}, {85, 34}, {86, 33}, {86, 32}, {87, 31}, {88, 30}, {88, 30}, {89, 29}, {89, 28}, {90, 27}, {90, 26}, {91, 25}, {92, 25}, {92, 24}, {93, 23}, {93, 22}, {94, 21}, {94, 21}, {95, 20}, {96, 19}, {96, 18}, {97, 17}, {97, 16}, {98, 16}, {98, 15}, {99, 14}, {100, 13}, {100, 12},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {66, 61}, {67, 60}, {68, 59}, {68, 58}, {69, 58}, {69, 57}, {70, 56}, {70, 55}, {71, 54}, {72, 53}, {72, 53}, {73, 52}, {73, 51}, {74, 50}, {75, 49}, {75, 49}, {76, 48}, {76, 47}, {77, 46}, {78, 45}, {78, 45}, {79, 44}, {79, 43}, {80, 42}, {80, 41}, {81, 41}, {82, 40}, {82, 39}, {83, 38}, {83, 37}, {84, 36}, {85, 36}, {85, 35}, {86, 34}, {86, 33}, {87, 32}, {88, 32}, {88, 31}, {89, 30}, {89, 29}, {90, 28}, {90, 28}, {91, 27}, {92, 26}, {92, 25}, {93, 24}, {93, 24}, {94, 23}, {95, 22}, {95, 21}, {96, 20}, {96, 20}, {97, 19}, {98, 18}, {98, 17}, {99, 16}, {99, 15}, {100, 15}, {100, 14}, {101, 13},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {66, 61}, {67, 60}, {68, 59}, {68, 58}, {69, 58}, {69, 57}, {70, 56}, {71, 55}, {71, 54}, {72, 54}, {72, 53}, {73, 52}, {74, 51}, {74, 50}, {75, 50}, {75, 49}, {76, 48}, {77, 47}, {77, 46}, {78, 46}, {78, 45}, {79, 44}, {80, 43}, {80, 42}, {81, 42}, {81, 41}, {82, 40}, {83, 39}, {83, 38}, {84, 38}, {84, 37}, {85, 36}, {86, 35}, {86, 34}, {87, 34}, {87, 33}, {88, 32}, {89, 31}, {89, 30}, {90, 30}, {90, 29}, {91, 28}, {92, 27}, {92, 26}, {93, 26}, {93, 25}, {94, 24}, {95, 23}, {95, 22}, {96, 22}, {96, 21}, {97, 20}, {98, 19}, {98, 18}, {99, 18}, {100, 17}, {100, 16}, {101, 15}, {101, 14}, {102, 14},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {66, 61}, {67, 60}, {68, 59}, {68, 58}, {69, 58}, {70, 57}, {70, 56}, {71, 55}, {71, 55}, {72, 54}, {73, 53}, {73, 52}, {74, 51}, {74, 51}, {75, 50}, {76, 49}, {76, 48}, {77, 47}, {78, 47}, {78, 46}, {79, 45}, {79, 44}, {80, 44}, {81, 43}, {81, 42}, {82, 41}, {82, 40}, {83, 40}, {84, 39}, {84, 38}, {85, 37}, {86, 36}, {86, 36}, {87, 35}, {87, 34}, {88, 33}, {89, 32}, {89, 32}, {90, 31}, {90, 30}, {91, 29}, {92, 29}, {92, 28}, {93, 27}, {94, 26}, {94, 25}, {95, 25}, {95, 24}, {96, 23}, {97, 22}, {97, 21}, {98, 21}, {98, 20}, {99, 19}, {100, 18}, {100, 18}, {101, 17}, {102, 16}, {102, 15}, {103, 14},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {67, 61}, {67, 60}, {68, 59}, {68, 59}, {69, 58}, {70, 57}, {70, 56}, {71, 55}, {72, 55}, {72, 54}, {73, 53}, {73, 52}, {74, 52}, {75, 51}, {75, 50}, {76, 49}, {77, 48}, {77, 48}, {78, 47}, {78, 46}, {79, 45}, {80, 45}, {80, 44}, {81, 43}, {82, 42}, {82, 41}, {83, 41}, {84, 40}, {84, 39}, {85, 38}, {85, 38}, {86, 37}, {87, 36}, {87, 35}, {88, 34}, {89, 34}, {89, 33}, {90, 32}, {90, 31}, {91, 31}, {92, 30}, {92, 29}, {93, 28}, {94, 27}, {94, 27}, {95, 26}, {95, 25}, {96, 24}, {97, 24}, {97, 23}, {98, 22}, {99, 21}, {99, 20}, {100, 20}, {101, 19}, {101, 18}, {102, 17}, {102, 17}, {103, 16}, {104, 15},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {67, 61}, {67, 60}, {68, 59}, {68, 59}, {69, 58}, {70, 57}, {70, 56}, {71, 56}, {72, 55}, {72, 54}, {73, 53}, {74, 53}, {74, 52}, {75, 51}, {76, 50}, {76, 49}, {77, 49}, {77, 48}, {78, 47}, {79, 46}, {79, 46}, {80, 45}, {81, 44}, {81, 43}, {82, 43}, {83, 42}, {83, 41}, {84, 40}, {85, 39}, {85, 39}, {86, 38}, {86, 37}, {87, 36}, {88, 36}, {88, 35}, {89, 34}, {90, 33}, {90, 33}, {91, 32}, {92, 31}, {92, 30}, {93, 30}, {94, 29}, {94, 28}, {95, 27}, {95, 26}, {96, 26}, {97, 25}, {97, 24}, {98, 23}, {99, 23}, {99, 22}, {100, 21}, {101, 20}, {101, 20}, {102, 19}, {103, 18}, {103, 17}, {104, 17}, {104, 16},  },
-  { {64, 64}, {65, 63}, {65, 62}, {66, 62}, {67, 61}, {67, 60}, {68, 59}, {69, 59}, {69, 58}, {70, 57}, {71, 56}, {71, 56}, {72, 55}, {73, 54}, {73, 53}, {74, 53}, {74, 52}, {75, 51}, {76, 50}, {76, 50}, {77, 49}, {78, 48}, {78, 47}, {79, 47}, {80, 46}, {80, 45}, {81, 44}, {82, 44}, {82, 43}, {83, 42}, {84, 41}, {84, 41}, {85, 40}, {86, 39}, {86, 38}, {87, 38}, {88, 37}, {88, 36}, {89, 35}, {90, 35}, {90, 34}, {91, 33}, {92, 32}, {92, 32}, {93, 31}, {94, 30}, {94, 29}, {95, 29}, {95, 28}, {96, 27}, {97, 26}, {97, 26}, {98, 25}, {99, 24}, {99, 23}, {100, 22}, {101, 22}, {101, 21}, {102, 20}, {103, 19}, {103, 19}, {104, 18}, {105, 17}, {105, 16},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {67, 60}, {68, 60}, {69, 59}, {69, 58}, {70, 57}, {71, 57}, {71, 56}, {72, 55}, {73, 54}, {73, 54}, {74, 53}, {75, 52}, {75, 51}, {76, 51}, {77, 50}, {77, 49}, {78, 48}, {79, 48}, {79, 47}, {80, 46}, {81, 45}, {81, 45}, {82, 44}, {83, 43}, {83, 42}, {84, 42}, {85, 41}, {85, 40}, {86, 39}, {87, 39}, {87, 38}, {88, 37}, {89, 37}, {89, 36}, {90, 35}, {91, 34}, {91, 34}, {92, 33}, {93, 32}, {93, 31}, {94, 31}, {95, 30}, {95, 29}, {96, 28}, {97, 28}, {97, 27}, {98, 26}, {99, 25}, {99, 25}, {100, 24}, {101, 23}, {101, 22}, {102, 22}, {103, 21}, {103, 20}, {104, 19}, {105, 19}, {105, 18}, {106, 17},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {67, 60}, {68, 60}, {69, 59}, {69, 58}, {70, 57}, {71, 57}, {72, 56}, {72, 55}, {73, 54}, {74, 54}, {74, 53}, {75, 52}, {76, 52}, {76, 51}, {77, 50}, {78, 49}, {78, 49}, {79, 48}, {80, 47}, {80, 46}, {81, 46}, {82, 45}, {82, 44}, {83, 44}, {84, 43}, {84, 42}, {85, 41}, {86, 41}, {87, 40}, {87, 39}, {88, 38}, {89, 38}, {89, 37}, {90, 36}, {91, 35}, {91, 35}, {92, 34}, {93, 33}, {93, 33}, {94, 32}, {95, 31}, {95, 30}, {96, 30}, {97, 29}, {97, 28}, {98, 27}, {99, 27}, {99, 26}, {100, 25}, {101, 25}, {102, 24}, {102, 23}, {103, 22}, {104, 22}, {104, 21}, {105, 20}, {106, 19}, {106, 19}, {107, 18},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {67, 60}, {68, 60}, {69, 59}, {70, 58}, {70, 58}, {71, 57}, {72, 56}, {72, 55}, {73, 55}, {74, 54}, {74, 53}, {75, 52}, {76, 52}, {77, 51}, {77, 50}, {78, 50}, {79, 49}, {79, 48}, {80, 47}, {81, 47}, {81, 46}, {82, 45}, {83, 45}, {83, 44}, {84, 43}, {85, 42}, {86, 42}, {86, 41}, {87, 40}, {88, 40}, {88, 39}, {89, 38}, {90, 37}, {90, 37}, {91, 36}, {92, 35}, {92, 35}, {93, 34}, {94, 33}, {95, 32}, {95, 32}, {96, 31}, {97, 30}, {97, 29}, {98, 29}, {99, 28}, {99, 27}, {100, 27}, {101, 26}, {102, 25}, {102, 24}, {103, 24}, {104, 23}, {104, 22}, {105, 22}, {106, 21}, {106, 20}, {107, 19}, {108, 19},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {68, 60}, {68, 60}, {69, 59}, {70, 58}, {70, 58}, {71, 57}, {72, 56}, {72, 56}, {73, 55}, {74, 54}, {75, 53}, {75, 53}, {76, 52}, {77, 51}, {77, 51}, {78, 50}, {79, 49}, {80, 48}, {80, 48}, {81, 47}, {82, 46}, {82, 46}, {83, 45}, {84, 44}, {85, 43}, {85, 43}, {86, 42}, {87, 41}, {87, 41}, {88, 40}, {89, 39}, {89, 39}, {90, 38}, {91, 37}, {92, 36}, {92, 36}, {93, 35}, {94, 34}, {94, 34}, {95, 33}, {96, 32}, {97, 31}, {97, 31}, {98, 30}, {99, 29}, {99, 29}, {100, 28}, {101, 27}, {101, 27}, {102, 26}, {103, 25}, {104, 24}, {104, 24}, {105, 23}, {106, 22}, {106, 22}, {107, 21}, {108, 20}, {109, 19},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {68, 61}, {68, 60}, {69, 59}, {70, 58}, {70, 58}, {71, 57}, {72, 56}, {73, 56}, {73, 55}, {74, 54}, {75, 54}, {76, 53}, {76, 52}, {77, 51}, {78, 51}, {78, 50}, {79, 49}, {80, 49}, {81, 48}, {81, 47}, {82, 47}, {83, 46}, {83, 45}, {84, 45}, {85, 44}, {86, 43}, {86, 42}, {87, 42}, {88, 41}, {88, 40}, {89, 40}, {90, 39}, {91, 38}, {91, 38}, {92, 37}, {93, 36}, {93, 36}, {94, 35}, {95, 34}, {96, 33}, {96, 33}, {97, 32}, {98, 31}, {99, 31}, {99, 30}, {100, 29}, {101, 29}, {101, 28}, {102, 27}, {103, 26}, {104, 26}, {104, 25}, {105, 24}, {106, 24}, {106, 23}, {107, 22}, {108, 22}, {109, 21}, {109, 20},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {68, 61}, {68, 60}, {69, 59}, {70, 59}, {71, 58}, {71, 57}, {72, 56}, {73, 56}, {74, 55}, {74, 54}, {75, 54}, {76, 53}, {76, 52}, {77, 52}, {78, 51}, {79, 50}, {79, 50}, {80, 49}, {81, 48}, {82, 48}, {82, 47}, {83, 46}, {84, 46}, {84, 45}, {85, 44}, {86, 44}, {87, 43}, {87, 42}, {88, 41}, {89, 41}, {90, 40}, {90, 39}, {91, 39}, {92, 38}, {93, 37}, {93, 37}, {94, 36}, {95, 35}, {95, 35}, {96, 34}, {97, 33}, {98, 33}, {98, 32}, {99, 31}, {100, 31}, {101, 30}, {101, 29}, {102, 29}, {103, 28}, {103, 27}, {104, 26}, {105, 26}, {106, 25}, {106, 24}, {107, 24}, {108, 23}, {109, 22}, {109, 22}, {110, 21},  },
-  { {64, 64}, {65, 63}, {65, 63}, {66, 62}, {67, 61}, {68, 61}, {68, 60}, {69, 59}, {70, 59}, {71, 58}, {71, 57}, {72, 57}, {73, 56}, {74, 55}, {74, 55}, {75, 54}, {76, 53}, {77, 53}, {77, 52}, {78, 51}, {79, 51}, {80, 50}, {80, 49}, {81, 49}, {82, 48}, {83, 47}, {83, 47}, {84, 46}, {85, 45}, {86, 45}, {86, 44}, {87, 43}, {88, 43}, {89, 42}, {89, 41}, {90, 41}, {91, 40}, {91, 39}, {92, 39}, {93, 38}, {94, 37}, {94, 37}, {95, 36}, {96, 35}, {97, 35}, {97, 34}, {98, 33}, {99, 33}, {100, 32}, {100, 31}, {101, 31}, {102, 30}, {103, 29}, {103, 29}, {104, 28}, {105, 27}, {106, 27}, {106, 26}, {107, 25}, {108, 25}, {109, 24}, {109, 23}, {110, 23}, {111, 22},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 61}, {68, 61}, {69, 60}, {69, 59}, {70, 59}, {71, 58}, {72, 57}, {72, 57}, {73, 56}, {74, 55}, {75, 55}, {75, 54}, {76, 54}, {77, 53}, {78, 52}, {78, 52}, {79, 51}, {80, 50}, {81, 50}, {81, 49}, {82, 48}, {83, 48}, {84, 47}, {84, 46}, {85, 46}, {86, 45}, {87, 44}, {87, 44}, {88, 43}, {89, 42}, {90, 42}, {90, 41}, {91, 40}, {92, 40}, {93, 39}, {93, 38}, {94, 38}, {95, 37}, {96, 36}, {96, 36}, {97, 35}, {98, 34}, {99, 34}, {99, 33}, {100, 33}, {101, 32}, {102, 31}, {102, 31}, {103, 30}, {104, 29}, {105, 29}, {106, 28}, {106, 27}, {107, 27}, {108, 26}, {109, 25}, {109, 25}, {110, 24}, {111, 23}, {112, 23},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 61}, {68, 61}, {69, 60}, {69, 60}, {70, 59}, {71, 58}, {72, 58}, {72, 57}, {73, 56}, {74, 56}, {75, 55}, {75, 54}, {76, 54}, {77, 53}, {78, 52}, {79, 52}, {79, 51}, {80, 51}, {81, 50}, {82, 49}, {82, 49}, {83, 48}, {84, 47}, {85, 47}, {85, 46}, {86, 45}, {87, 45}, {88, 44}, {89, 43}, {89, 43}, {90, 42}, {91, 42}, {92, 41}, {92, 40}, {93, 40}, {94, 39}, {95, 38}, {95, 38}, {96, 37}, {97, 36}, {98, 36}, {98, 35}, {99, 34}, {100, 34}, {101, 33}, {102, 33}, {102, 32}, {103, 31}, {104, 31}, {105, 30}, {105, 29}, {106, 29}, {107, 28}, {108, 27}, {108, 27}, {109, 26}, {110, 25}, {111, 25}, {111, 24}, {112, 24},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 61}, {68, 61}, {69, 60}, {69, 60}, {70, 59}, {71, 58}, {72, 58}, {73, 57}, {73, 56}, {74, 56}, {75, 55}, {76, 55}, {76, 54}, {77, 53}, {78, 53}, {79, 52}, {80, 51}, {80, 51}, {81, 50}, {82, 50}, {83, 49}, {83, 48}, {84, 48}, {85, 47}, {86, 46}, {87, 46}, {87, 45}, {88, 44}, {89, 44}, {90, 43}, {90, 43}, {91, 42}, {92, 41}, {93, 41}, {94, 40}, {94, 39}, {95, 39}, {96, 38}, {97, 38}, {97, 37}, {98, 36}, {99, 36}, {100, 35}, {101, 34}, {101, 34}, {102, 33}, {103, 33}, {104, 32}, {104, 31}, {105, 31}, {106, 30}, {107, 29}, {108, 29}, {108, 28}, {109, 27}, {110, 27}, {111, 26}, {111, 26}, {112, 25}, {113, 24},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 62}, {68, 61}, {69, 60}, {70, 60}, {70, 59}, {71, 58}, {72, 58}, {73, 57}, {73, 57}, {74, 56}, {75, 55}, {76, 55}, {77, 54}, {77, 54}, {78, 53}, {79, 52}, {80, 52}, {81, 51}, {81, 50}, {82, 50}, {83, 49}, {84, 49}, {84, 48}, {85, 47}, {86, 47}, {87, 46}, {88, 46}, {88, 45}, {89, 44}, {90, 44}, {91, 43}, {92, 42}, {92, 42}, {93, 41}, {94, 41}, {95, 40}, {96, 39}, {96, 39}, {97, 38}, {98, 38}, {99, 37}, {99, 36}, {100, 36}, {101, 35}, {102, 34}, {103, 34}, {103, 33}, {104, 33}, {105, 32}, {106, 31}, {107, 31}, {107, 30}, {108, 30}, {109, 29}, {110, 28}, {110, 28}, {111, 27}, {112, 26}, {113, 26}, {114, 25},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 62}, {68, 61}, {69, 60}, {70, 60}, {70, 59}, {71, 59}, {72, 58}, {73, 57}, {74, 57}, {74, 56}, {75, 56}, {76, 55}, {77, 54}, {78, 54}, {78, 53}, {79, 53}, {80, 52}, {81, 51}, {82, 51}, {82, 50}, {83, 50}, {84, 49}, {85, 48}, {86, 48}, {86, 47}, {87, 47}, {88, 46}, {89, 45}, {90, 45}, {90, 44}, {91, 44}, {92, 43}, {93, 42}, {94, 42}, {94, 41}, {95, 41}, {96, 40}, {97, 39}, {98, 39}, {98, 38}, {99, 38}, {100, 37}, {101, 36}, {102, 36}, {102, 35}, {103, 35}, {104, 34}, {105, 33}, {106, 33}, {106, 32}, {107, 32}, {108, 31}, {109, 30}, {110, 30}, {110, 29}, {111, 28}, {112, 28}, {113, 27}, {114, 27}, {114, 26},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 62}, {68, 61}, {69, 60}, {70, 60}, {70, 59}, {71, 59}, {72, 58}, {73, 58}, {74, 57}, {75, 56}, {75, 56}, {76, 55}, {77, 55}, {78, 54}, {79, 53}, {79, 53}, {80, 52}, {81, 52}, {82, 51}, {83, 50}, {83, 50}, {84, 49}, {85, 49}, {86, 48}, {87, 48}, {87, 47}, {88, 46}, {89, 46}, {90, 45}, {91, 45}, {92, 44}, {92, 43}, {93, 43}, {94, 42}, {95, 42}, {96, 41}, {96, 40}, {97, 40}, {98, 39}, {99, 39}, {100, 38}, {100, 38}, {101, 37}, {102, 36}, {103, 36}, {104, 35}, {104, 35}, {105, 34}, {106, 33}, {107, 33}, {108, 32}, {108, 32}, {109, 31}, {110, 30}, {111, 30}, {112, 29}, {113, 29}, {113, 28}, {114, 28}, {115, 27},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 62}, {68, 61}, {69, 61}, {70, 60}, {71, 59}, {71, 59}, {72, 58}, {73, 58}, {74, 57}, {75, 57}, {75, 56}, {76, 55}, {77, 55}, {78, 54}, {79, 54}, {80, 53}, {80, 53}, {81, 52}, {82, 51}, {83, 51}, {84, 50}, {84, 50}, {85, 49}, {86, 49}, {87, 48}, {88, 47}, {89, 47}, {89, 46}, {90, 46}, {91, 45}, {92, 44}, {93, 44}, {93, 43}, {94, 43}, {95, 42}, {96, 42}, {97, 41}, {98, 40}, {98, 40}, {99, 39}, {100, 39}, {101, 38}, {102, 38}, {103, 37}, {103, 36}, {104, 36}, {105, 35}, {106, 35}, {107, 34}, {107, 34}, {108, 33}, {109, 32}, {110, 32}, {111, 31}, {112, 31}, {112, 30}, {113, 30}, {114, 29}, {115, 28}, {116, 28},  },
-  { {64, 64}, {65, 63}, {66, 63}, {66, 62}, {67, 62}, {68, 61}, {69, 61}, {70, 60}, {71, 60}, {71, 59}, {72, 58}, {73, 58}, {74, 57}, {75, 57}, {76, 56}, {76, 56}, {77, 55}, {78, 54}, {79, 54}, {80, 53}, {81, 53}, {81, 52}, {82, 52}, {83, 51}, {84, 51}, {85, 50}, {86, 49}, {86, 49}, {87, 48}, {88, 48}, {89, 47}, {90, 47}, {91, 46}, {91, 46}, {92, 45}, {93, 44}, {94, 44}, {95, 43}, {96, 43}, {96, 42}, {97, 42}, {98, 41}, {99, 41}, {100, 40}, {100, 39}, {101, 39}, {102, 38}, {103, 38}, {104, 37}, {105, 37}, {105, 36}, {106, 35}, {107, 35}, {108, 34}, {109, 34}, {110, 33}, {110, 33}, {111, 32}, {112, 32}, {113, 31}, {114, 30}, {115, 30}, {115, 29}, {116, 29},  },
-  { {64, 64}, {65, 63}, {66, 63}, {67, 62}, {67, 62}, {68, 61}, {69, 61}, {70, 60}, {71, 60}, {72, 59}, {72, 59}, {73, 58}, {74, 57}, {75, 57}, {76, 56}, {77, 56}, {77, 55}, {78, 55}, {79, 54}, {80, 54}, {81, 53}, {82, 53}, {82, 52}, {83, 51}, {84, 51}, {85, 50}, {86, 50}, {87, 49}, {87, 49}, {88, 48}, {89, 48}, {90, 47}, {91, 47}, {92, 46}, {93, 45}, {93, 45}, {94, 44}, {95, 44}, {96, 43}, {97, 43}, {98, 42}, {98, 42}, {99, 41}, {100, 41}, {101, 40}, {102, 39}, {103, 39}, {103, 38}, {104, 38}, {105, 37}, {106, 37}, {107, 36}, {108, 36}, {108, 35}, {109, 35}, {110, 34}, {111, 34}, {112, 33}, {113, 32}, {113, 32}, {114, 31}, {115, 31}, {116, 30}, {117, 30},  },
-  { {64, 64}, {65, 63}, {66, 63}, {67, 62}, {67, 62}, {68, 61}, {69, 61}, {70, 60}, {71, 60}, {72, 59}, {72, 59}, {73, 58}, {74, 58}, {75, 57}, {76, 57}, {77, 56}, {78, 56}, {78, 55}, {79, 54}, {80, 54}, {81, 53}, {82, 53}, {83, 52}, {84, 52}, {84, 51}, {85, 51}, {86, 50}, {87, 50}, {88, 49}, {89, 49}, {89, 48}, {90, 48}, {91, 47}, {92, 47}, {93, 46}, {94, 45}, {95, 45}, {95, 44}, {96, 44}, {97, 43}, {98, 43}, {99, 42}, {100, 42}, {100, 41}, {101, 41}, {102, 40}, {103, 40}, {104, 39}, {105, 39}, {106, 38}, {106, 38}, {107, 37}, {108, 36}, {109, 36}, {110, 35}, {111, 35}, {111, 34}, {112, 34}, {113, 33}, {114, 33}, {115, 32}, {116, 32}, {117, 31}, {117, 31},  },
-  { {64, 64}, {65, 63}, {66, 63}, {67, 62}, {67, 62}, {68, 61}, {69, 61}, {70, 60}, {71, 60}, {72, 59}, {73, 59}, {73, 58}, {74, 58}, {75, 57}, {76, 57}, {77, 56}, {78, 56}, {79, 55}, {79, 55}, {80, 54}, {81, 54}, {82, 53}, {83, 53}, {84, 52}, {85, 52}, {85, 51}, {86, 51}, {87, 50}, {88, 50}, {89, 49}, {90, 49}, {91, 48}, {91, 48}, {92, 47}, {93, 46}, {94, 46}, {95, 45}, {96, 45}, {97, 44}, {97, 44}, {98, 43}, {99, 43}, {100, 42}, {101, 42}, {102, 41}, {103, 41}, {103, 40}, {104, 40}, {105, 39}, {106, 39}, {107, 38}, {108, 38}, {109, 37}, {109, 37}, {110, 36}, {111, 36}, {112, 35}, {113, 35}, {114, 34}, {115, 34}, {115, 33}, {116, 33}, {117, 32}, {118, 32},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {67, 62}, {68, 62}, {69, 61}, {70, 61}, {71, 60}, {72, 60}, {73, 59}, {74, 58}, {74, 58}, {75, 57}, {76, 57}, {77, 56}, {78, 56}, {79, 55}, {80, 55}, {80, 54}, {81, 54}, {82, 53}, {83, 53}, {84, 52}, {85, 52}, {86, 51}, {87, 51}, {87, 50}, {88, 50}, {89, 49}, {90, 49}, {91, 48}, {92, 48}, {93, 47}, {93, 47}, {94, 46}, {95, 46}, {96, 45}, {97, 45}, {98, 44}, {99, 44}, {100, 43}, {100, 43}, {101, 42}, {102, 42}, {103, 41}, {104, 41}, {105, 40}, {106, 40}, {106, 39}, {107, 39}, {108, 38}, {109, 38}, {110, 37}, {111, 37}, {112, 36}, {112, 36}, {113, 35}, {114, 35}, {115, 34}, {116, 34}, {117, 33}, {118, 33}, {119, 32},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {67, 62}, {68, 62}, {69, 61}, {70, 61}, {71, 60}, {72, 60}, {73, 59}, {74, 59}, {74, 58}, {75, 58}, {76, 57}, {77, 57}, {78, 56}, {79, 56}, {80, 55}, {81, 55}, {81, 54}, {82, 54}, {83, 53}, {84, 53}, {85, 52}, {86, 52}, {87, 51}, {88, 51}, {88, 50}, {89, 50}, {90, 49}, {91, 49}, {92, 48}, {93, 48}, {94, 48}, {95, 47}, {95, 47}, {96, 46}, {97, 46}, {98, 45}, {99, 45}, {100, 44}, {101, 44}, {102, 43}, {102, 43}, {103, 42}, {104, 42}, {105, 41}, {106, 41}, {107, 40}, {108, 40}, {109, 39}, {109, 39}, {110, 38}, {111, 38}, {112, 37}, {113, 37}, {114, 36}, {115, 36}, {116, 35}, {116, 35}, {117, 34}, {118, 34}, {119, 33},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {68, 62}, {69, 61}, {70, 61}, {71, 60}, {72, 60}, {73, 59}, {74, 59}, {75, 58}, {75, 58}, {76, 57}, {77, 57}, {78, 56}, {79, 56}, {80, 56}, {81, 55}, {82, 55}, {83, 54}, {83, 54}, {84, 53}, {85, 53}, {86, 52}, {87, 52}, {88, 51}, {89, 51}, {90, 50}, {90, 50}, {91, 49}, {92, 49}, {93, 49}, {94, 48}, {95, 48}, {96, 47}, {97, 47}, {98, 46}, {98, 46}, {99, 45}, {100, 45}, {101, 44}, {102, 44}, {103, 43}, {104, 43}, {105, 42}, {105, 42}, {106, 41}, {107, 41}, {108, 41}, {109, 40}, {110, 40}, {111, 39}, {112, 39}, {113, 38}, {113, 38}, {114, 37}, {115, 37}, {116, 36}, {117, 36}, {118, 35}, {119, 35}, {120, 34},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {68, 62}, {69, 61}, {70, 61}, {71, 60}, {72, 60}, {73, 59}, {74, 59}, {75, 59}, {76, 58}, {76, 58}, {77, 57}, {78, 57}, {79, 56}, {80, 56}, {81, 55}, {82, 55}, {83, 54}, {84, 54}, {84, 54}, {85, 53}, {86, 53}, {87, 52}, {88, 52}, {89, 51}, {90, 51}, {91, 50}, {92, 50}, {93, 49}, {93, 49}, {94, 49}, {95, 48}, {96, 48}, {97, 47}, {98, 47}, {99, 46}, {100, 46}, {101, 45}, {101, 45}, {102, 44}, {103, 44}, {104, 44}, {105, 43}, {106, 43}, {107, 42}, {108, 42}, {109, 41}, {109, 41}, {110, 40}, {111, 40}, {112, 39}, {113, 39}, {114, 39}, {115, 38}, {116, 38}, {117, 37}, {117, 37}, {118, 36}, {119, 36}, {120, 35},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {68, 62}, {69, 61}, {70, 61}, {71, 60}, {72, 60}, {73, 60}, {74, 59}, {75, 59}, {76, 58}, {77, 58}, {77, 57}, {78, 57}, {79, 57}, {80, 56}, {81, 56}, {82, 55}, {83, 55}, {84, 54}, {85, 54}, {86, 53}, {86, 53}, {87, 53}, {88, 52}, {89, 52}, {90, 51}, {91, 51}, {92, 50}, {93, 50}, {94, 50}, {95, 49}, {95, 49}, {96, 48}, {97, 48}, {98, 47}, {99, 47}, {100, 46}, {101, 46}, {102, 46}, {103, 45}, {104, 45}, {104, 44}, {105, 44}, {106, 43}, {107, 43}, {108, 43}, {109, 42}, {110, 42}, {111, 41}, {112, 41}, {113, 40}, {113, 40}, {114, 39}, {115, 39}, {116, 39}, {117, 38}, {118, 38}, {119, 37}, {120, 37}, {121, 36},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {69, 62}, {69, 61}, {70, 61}, {71, 61}, {72, 60}, {73, 60}, {74, 59}, {75, 59}, {76, 59}, {77, 58}, {78, 58}, {79, 57}, {79, 57}, {80, 56}, {81, 56}, {82, 56}, {83, 55}, {84, 55}, {85, 54}, {86, 54}, {87, 53}, {88, 53}, {88, 53}, {89, 52}, {90, 52}, {91, 51}, {92, 51}, {93, 50}, {94, 50}, {95, 50}, {96, 49}, {97, 49}, {98, 48}, {98, 48}, {99, 48}, {100, 47}, {101, 47}, {102, 46}, {103, 46}, {104, 45}, {105, 45}, {106, 45}, {107, 44}, {108, 44}, {108, 43}, {109, 43}, {110, 42}, {111, 42}, {112, 42}, {113, 41}, {114, 41}, {115, 40}, {116, 40}, {117, 39}, {117, 39}, {118, 39}, {119, 38}, {120, 38}, {121, 37},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {69, 62}, {69, 62}, {70, 61}, {71, 61}, {72, 60}, {73, 60}, {74, 60}, {75, 59}, {76, 59}, {77, 58}, {78, 58}, {79, 57}, {80, 57}, {80, 57}, {81, 56}, {82, 56}, {83, 55}, {84, 55}, {85, 55}, {86, 54}, {87, 54}, {88, 53}, {89, 53}, {90, 53}, {90, 52}, {91, 52}, {92, 51}, {93, 51}, {94, 51}, {95, 50}, {96, 50}, {97, 49}, {98, 49}, {99, 49}, {100, 48}, {101, 48}, {101, 47}, {102, 47}, {103, 47}, {104, 46}, {105, 46}, {106, 45}, {107, 45}, {108, 44}, {109, 44}, {110, 44}, {111, 43}, {112, 43}, {112, 42}, {113, 42}, {114, 42}, {115, 41}, {116, 41}, {117, 40}, {118, 40}, {119, 40}, {120, 39}, {121, 39}, {122, 38},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 62}, {69, 62}, {70, 62}, {70, 61}, {71, 61}, {72, 60}, {73, 60}, {74, 60}, {75, 59}, {76, 59}, {77, 59}, {78, 58}, {79, 58}, {80, 57}, {81, 57}, {81, 57}, {82, 56}, {83, 56}, {84, 55}, {85, 55}, {86, 55}, {87, 54}, {88, 54}, {89, 53}, {90, 53}, {91, 53}, {92, 52}, {93, 52}, {93, 51}, {94, 51}, {95, 51}, {96, 50}, {97, 50}, {98, 50}, {99, 49}, {100, 49}, {101, 48}, {102, 48}, {103, 48}, {104, 47}, {105, 47}, {105, 46}, {106, 46}, {107, 46}, {108, 45}, {109, 45}, {110, 44}, {111, 44}, {112, 44}, {113, 43}, {114, 43}, {115, 43}, {116, 42}, {116, 42}, {117, 41}, {118, 41}, {119, 41}, {120, 40}, {121, 40}, {122, 39},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 62}, {70, 62}, {70, 61}, {71, 61}, {72, 61}, {73, 60}, {74, 60}, {75, 60}, {76, 59}, {77, 59}, {78, 58}, {79, 58}, {80, 58}, {81, 57}, {82, 57}, {83, 57}, {83, 56}, {84, 56}, {85, 55}, {86, 55}, {87, 55}, {88, 54}, {89, 54}, {90, 54}, {91, 53}, {92, 53}, {93, 52}, {94, 52}, {95, 52}, {96, 51}, {96, 51}, {97, 51}, {98, 50}, {99, 50}, {100, 49}, {101, 49}, {102, 49}, {103, 48}, {104, 48}, {105, 48}, {106, 47}, {107, 47}, {108, 46}, {109, 46}, {109, 46}, {110, 45}, {111, 45}, {112, 45}, {113, 44}, {114, 44}, {115, 43}, {116, 43}, {117, 43}, {118, 42}, {119, 42}, {120, 42}, {121, 41}, {121, 41}, {122, 40},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 62}, {70, 62}, {71, 61}, {71, 61}, {72, 61}, {73, 60}, {74, 60}, {75, 60}, {76, 59}, {77, 59}, {78, 59}, {79, 58}, {80, 58}, {81, 58}, {82, 57}, {83, 57}, {84, 56}, {85, 56}, {85, 56}, {86, 55}, {87, 55}, {88, 55}, {89, 54}, {90, 54}, {91, 54}, {92, 53}, {93, 53}, {94, 53}, {95, 52}, {96, 52}, {97, 51}, {98, 51}, {99, 51}, {99, 50}, {100, 50}, {101, 50}, {102, 49}, {103, 49}, {104, 49}, {105, 48}, {106, 48}, {107, 48}, {108, 47}, {109, 47}, {110, 46}, {111, 46}, {112, 46}, {113, 45}, {113, 45}, {114, 45}, {115, 44}, {116, 44}, {117, 44}, {118, 43}, {119, 43}, {120, 42}, {121, 42}, {122, 42}, {123, 41},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 62}, {70, 62}, {71, 62}, {72, 61}, {72, 61}, {73, 61}, {74, 60}, {75, 60}, {76, 60}, {77, 59}, {78, 59}, {79, 59}, {80, 58}, {81, 58}, {82, 58}, {83, 57}, {84, 57}, {85, 56}, {86, 56}, {87, 56}, {87, 55}, {88, 55}, {89, 55}, {90, 54}, {91, 54}, {92, 54}, {93, 53}, {94, 53}, {95, 53}, {96, 52}, {97, 52}, {98, 52}, {99, 51}, {100, 51}, {101, 51}, {102, 50}, {103, 50}, {103, 50}, {104, 49}, {105, 49}, {106, 49}, {107, 48}, {108, 48}, {109, 48}, {110, 47}, {111, 47}, {112, 47}, {113, 46}, {114, 46}, {115, 46}, {116, 45}, {117, 45}, {118, 45}, {119, 44}, {119, 44}, {120, 43}, {121, 43}, {122, 43}, {123, 42},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 62}, {70, 62}, {71, 62}, {72, 61}, {73, 61}, {73, 61}, {74, 60}, {75, 60}, {76, 60}, {77, 59}, {78, 59}, {79, 59}, {80, 58}, {81, 58}, {82, 58}, {83, 57}, {84, 57}, {85, 57}, {86, 57}, {87, 56}, {88, 56}, {89, 56}, {90, 55}, {90, 55}, {91, 55}, {92, 54}, {93, 54}, {94, 54}, {95, 53}, {96, 53}, {97, 53}, {98, 52}, {99, 52}, {100, 52}, {101, 51}, {102, 51}, {103, 51}, {104, 50}, {105, 50}, {106, 50}, {107, 49}, {107, 49}, {108, 49}, {109, 48}, {110, 48}, {111, 48}, {112, 47}, {113, 47}, {114, 47}, {115, 46}, {116, 46}, {117, 46}, {118, 45}, {119, 45}, {120, 45}, {121, 44}, {122, 44}, {123, 44}, {124, 43},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 62}, {70, 62}, {71, 62}, {72, 62}, {73, 61}, {74, 61}, {74, 61}, {75, 60}, {76, 60}, {77, 60}, {78, 59}, {79, 59}, {80, 59}, {81, 58}, {82, 58}, {83, 58}, {84, 58}, {85, 57}, {86, 57}, {87, 57}, {88, 56}, {89, 56}, {90, 56}, {91, 55}, {92, 55}, {93, 55}, {93, 54}, {94, 54}, {95, 54}, {96, 53}, {97, 53}, {98, 53}, {99, 53}, {100, 52}, {101, 52}, {102, 52}, {103, 51}, {104, 51}, {105, 51}, {106, 50}, {107, 50}, {108, 50}, {109, 49}, {110, 49}, {111, 49}, {112, 49}, {113, 48}, {113, 48}, {114, 48}, {115, 47}, {116, 47}, {117, 47}, {118, 46}, {119, 46}, {120, 46}, {121, 45}, {122, 45}, {123, 45}, {124, 45},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 63}, {70, 62}, {71, 62}, {72, 62}, {73, 61}, {74, 61}, {75, 61}, {75, 60}, {76, 60}, {77, 60}, {78, 60}, {79, 59}, {80, 59}, {81, 59}, {82, 58}, {83, 58}, {84, 58}, {85, 58}, {86, 57}, {87, 57}, {88, 57}, {89, 56}, {90, 56}, {91, 56}, {92, 56}, {93, 55}, {94, 55}, {95, 55}, {96, 54}, {97, 54}, {97, 54}, {98, 53}, {99, 53}, {100, 53}, {101, 53}, {102, 52}, {103, 52}, {104, 52}, {105, 51}, {106, 51}, {107, 51}, {108, 51}, {109, 50}, {110, 50}, {111, 50}, {112, 49}, {113, 49}, {114, 49}, {115, 49}, {116, 48}, {117, 48}, {118, 48}, {119, 47}, {119, 47}, {120, 47}, {121, 46}, {122, 46}, {123, 46}, {124, 46},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 63}, {70, 62}, {71, 62}, {72, 62}, {73, 62}, {74, 61}, {75, 61}, {76, 61}, {76, 60}, {77, 60}, {78, 60}, {79, 60}, {80, 59}, {81, 59}, {82, 59}, {83, 58}, {84, 58}, {85, 58}, {86, 58}, {87, 57}, {88, 57}, {89, 57}, {90, 57}, {91, 56}, {92, 56}, {93, 56}, {94, 55}, {95, 55}, {96, 55}, {97, 55}, {98, 54}, {99, 54}, {100, 54}, {101, 54}, {101, 53}, {102, 53}, {103, 53}, {104, 52}, {105, 52}, {106, 52}, {107, 52}, {108, 51}, {109, 51}, {110, 51}, {111, 50}, {112, 50}, {113, 50}, {114, 50}, {115, 49}, {116, 49}, {117, 49}, {118, 49}, {119, 48}, {120, 48}, {121, 48}, {122, 47}, {123, 47}, {124, 47}, {125, 47},  },
-  { {64, 64}, {65, 64}, {66, 63}, {67, 63}, {68, 63}, {69, 63}, {70, 62}, {71, 62}, {72, 62}, {73, 62}, {74, 61}, {75, 61}, {76, 61}, {77, 61}, {78, 60}, {78, 60}, {79, 60}, {80, 60}, {81, 59}, {82, 59}, {83, 59}, {84, 59}, {85, 58}, {86, 58}, {87, 58}, {88, 58}, {89, 57}, {90, 57}, {91, 57}, {92, 56}, {93, 56}, {94, 56}, {95, 56}, {96, 55}, {97, 55}, {98, 55}, {99, 55}, {100, 54}, {101, 54}, {102, 54}, {103, 54}, {104, 53}, {105, 53}, {106, 53}, {107, 53}, {107, 52}, {108, 52}, {109, 52}, {110, 52}, {111, 51}, {112, 51}, {113, 51}, {114, 51}, {115, 50}, {116, 50}, {117, 50}, {118, 50}, {119, 49}, {120, 49}, {121, 49}, {122, 48}, {123, 48}, {124, 48}, {125, 48},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 63}, {68, 63}, {69, 63}, {70, 63}, {71, 62}, {72, 62}, {73, 62}, {74, 62}, {75, 61}, {76, 61}, {77, 61}, {78, 61}, {79, 60}, {80, 60}, {80, 60}, {81, 60}, {82, 59}, {83, 59}, {84, 59}, {85, 59}, {86, 58}, {87, 58}, {88, 58}, {89, 58}, {90, 57}, {91, 57}, {92, 57}, {93, 57}, {94, 57}, {95, 56}, {96, 56}, {97, 56}, {98, 56}, {99, 55}, {100, 55}, {101, 55}, {102, 55}, {103, 54}, {104, 54}, {105, 54}, {106, 54}, {107, 53}, {108, 53}, {109, 53}, {110, 53}, {111, 52}, {112, 52}, {113, 52}, {113, 52}, {114, 51}, {115, 51}, {116, 51}, {117, 51}, {118, 50}, {119, 50}, {120, 50}, {121, 50}, {122, 49}, {123, 49}, {124, 49}, {125, 49},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 63}, {68, 63}, {69, 63}, {70, 63}, {71, 62}, {72, 62}, {73, 62}, {74, 62}, {75, 62}, {76, 61}, {77, 61}, {78, 61}, {79, 61}, {80, 60}, {81, 60}, {82, 60}, {83, 60}, {83, 60}, {84, 59}, {85, 59}, {86, 59}, {87, 59}, {88, 58}, {89, 58}, {90, 58}, {91, 58}, {92, 57}, {93, 57}, {94, 57}, {95, 57}, {96, 57}, {97, 56}, {98, 56}, {99, 56}, {100, 56}, {101, 55}, {102, 55}, {103, 55}, {104, 55}, {105, 55}, {106, 54}, {107, 54}, {108, 54}, {109, 54}, {110, 53}, {111, 53}, {112, 53}, {113, 53}, {114, 53}, {115, 52}, {116, 52}, {117, 52}, {118, 52}, {119, 51}, {120, 51}, {121, 51}, {121, 51}, {122, 51}, {123, 50}, {124, 50}, {125, 50},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 63}, {68, 63}, {69, 63}, {70, 63}, {71, 63}, {72, 62}, {73, 62}, {74, 62}, {75, 62}, {76, 62}, {77, 61}, {78, 61}, {79, 61}, {80, 61}, {81, 60}, {82, 60}, {83, 60}, {84, 60}, {85, 60}, {86, 59}, {86, 59}, {87, 59}, {88, 59}, {89, 59}, {90, 58}, {91, 58}, {92, 58}, {93, 58}, {94, 58}, {95, 57}, {96, 57}, {97, 57}, {98, 57}, {99, 57}, {100, 56}, {101, 56}, {102, 56}, {103, 56}, {104, 55}, {105, 55}, {106, 55}, {107, 55}, {108, 55}, {109, 54}, {110, 54}, {111, 54}, {112, 54}, {113, 54}, {114, 53}, {115, 53}, {116, 53}, {117, 53}, {118, 53}, {119, 52}, {120, 52}, {121, 52}, {122, 52}, {123, 52}, {124, 51}, {125, 51}, {126, 51},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 63}, {68, 63}, {69, 63}, {70, 63}, {71, 63}, {72, 62}, {73, 62}, {74, 62}, {75, 62}, {76, 62}, {77, 62}, {78, 61}, {79, 61}, {80, 61}, {81, 61}, {82, 61}, {83, 60}, {84, 60}, {85, 60}, {86, 60}, {87, 60}, {88, 59}, {89, 59}, {90, 59}, {91, 59}, {91, 59}, {92, 58}, {93, 58}, {94, 58}, {95, 58}, {96, 58}, {97, 58}, {98, 57}, {99, 57}, {100, 57}, {101, 57}, {102, 57}, {103, 56}, {104, 56}, {105, 56}, {106, 56}, {107, 56}, {108, 55}, {109, 55}, {110, 55}, {111, 55}, {112, 55}, {113, 54}, {114, 54}, {115, 54}, {116, 54}, {117, 54}, {118, 54}, {119, 53}, {120, 53}, {121, 53}, {122, 53}, {123, 53}, {124, 52}, {125, 52}, {126, 52},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 63}, {68, 63}, {69, 63}, {70, 63}, {71, 63}, {72, 63}, {73, 62}, {74, 62}, {75, 62}, {76, 62}, {77, 62}, {78, 62}, {79, 61}, {80, 61}, {81, 61}, {82, 61}, {83, 61}, {84, 61}, {85, 60}, {86, 60}, {87, 60}, {88, 60}, {89, 60}, {90, 59}, {91, 59}, {92, 59}, {93, 59}, {94, 59}, {95, 59}, {96, 58}, {96, 58}, {97, 58}, {98, 58}, {99, 58}, {100, 58}, {101, 57}, {102, 57}, {103, 57}, {104, 57}, {105, 57}, {106, 57}, {107, 56}, {108, 56}, {109, 56}, {110, 56}, {111, 56}, {112, 55}, {113, 55}, {114, 55}, {115, 55}, {116, 55}, {117, 55}, {118, 54}, {119, 54}, {120, 54}, {121, 54}, {122, 54}, {123, 54}, {124, 53}, {125, 53}, {126, 53},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 63}, {69, 63}, {70, 63}, {71, 63}, {72, 63}, {73, 63}, {74, 62}, {75, 62}, {76, 62}, {77, 62}, {78, 62}, {79, 62}, {80, 61}, {81, 61}, {82, 61}, {83, 61}, {84, 61}, {85, 61}, {86, 61}, {87, 60}, {88, 60}, {89, 60}, {90, 60}, {91, 60}, {92, 60}, {93, 59}, {94, 59}, {95, 59}, {96, 59}, {97, 59}, {98, 59}, {99, 59}, {100, 58}, {101, 58}, {102, 58}, {103, 58}, {104, 58}, {104, 58}, {105, 57}, {106, 57}, {107, 57}, {108, 57}, {109, 57}, {110, 57}, {111, 56}, {112, 56}, {113, 56}, {114, 56}, {115, 56}, {116, 56}, {117, 56}, {118, 55}, {119, 55}, {120, 55}, {121, 55}, {122, 55}, {123, 55}, {124, 54}, {125, 54}, {126, 54},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 63}, {69, 63}, {70, 63}, {71, 63}, {72, 63}, {73, 63}, {74, 63}, {75, 62}, {76, 62}, {77, 62}, {78, 62}, {79, 62}, {80, 62}, {81, 62}, {82, 61}, {83, 61}, {84, 61}, {85, 61}, {86, 61}, {87, 61}, {88, 61}, {89, 61}, {90, 60}, {91, 60}, {92, 60}, {93, 60}, {94, 60}, {95, 60}, {96, 60}, {97, 59}, {98, 59}, {99, 59}, {100, 59}, {101, 59}, {102, 59}, {103, 59}, {104, 58}, {105, 58}, {106, 58}, {107, 58}, {108, 58}, {109, 58}, {110, 58}, {111, 57}, {112, 57}, {113, 57}, {114, 57}, {115, 57}, {115, 57}, {116, 57}, {117, 56}, {118, 56}, {119, 56}, {120, 56}, {121, 56}, {122, 56}, {123, 56}, {124, 56}, {125, 55}, {126, 55},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 63}, {70, 63}, {71, 63}, {72, 63}, {73, 63}, {74, 63}, {75, 63}, {76, 63}, {77, 62}, {78, 62}, {79, 62}, {80, 62}, {81, 62}, {82, 62}, {83, 62}, {84, 62}, {85, 61}, {86, 61}, {87, 61}, {88, 61}, {89, 61}, {90, 61}, {91, 61}, {92, 61}, {93, 60}, {94, 60}, {95, 60}, {96, 60}, {97, 60}, {98, 60}, {99, 60}, {100, 60}, {101, 59}, {102, 59}, {103, 59}, {104, 59}, {105, 59}, {106, 59}, {107, 59}, {108, 59}, {109, 59}, {110, 58}, {111, 58}, {112, 58}, {113, 58}, {114, 58}, {115, 58}, {116, 58}, {117, 58}, {118, 57}, {119, 57}, {120, 57}, {121, 57}, {122, 57}, {123, 57}, {124, 57}, {125, 57}, {126, 56}, {127, 56},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 63}, {70, 63}, {71, 63}, {72, 63}, {73, 63}, {74, 63}, {75, 63}, {76, 63}, {77, 63}, {78, 63}, {79, 62}, {80, 62}, {81, 62}, {82, 62}, {83, 62}, {84, 62}, {85, 62}, {86, 62}, {87, 62}, {88, 61}, {89, 61}, {90, 61}, {91, 61}, {92, 61}, {93, 61}, {94, 61}, {95, 61}, {96, 61}, {97, 61}, {98, 60}, {99, 60}, {100, 60}, {101, 60}, {102, 60}, {103, 60}, {104, 60}, {105, 60}, {106, 60}, {107, 60}, {108, 59}, {109, 59}, {110, 59}, {111, 59}, {112, 59}, {113, 59}, {114, 59}, {115, 59}, {116, 59}, {117, 58}, {118, 58}, {119, 58}, {120, 58}, {121, 58}, {122, 58}, {123, 58}, {124, 58}, {125, 58}, {126, 58}, {127, 57},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 63}, {71, 63}, {72, 63}, {73, 63}, {74, 63}, {75, 63}, {76, 63}, {77, 63}, {78, 63}, {79, 63}, {80, 63}, {81, 63}, {82, 62}, {83, 62}, {84, 62}, {85, 62}, {86, 62}, {87, 62}, {88, 62}, {89, 62}, {90, 62}, {91, 62}, {92, 62}, {93, 61}, {94, 61}, {95, 61}, {96, 61}, {97, 61}, {98, 61}, {99, 61}, {100, 61}, {101, 61}, {102, 61}, {103, 61}, {104, 61}, {105, 60}, {106, 60}, {107, 60}, {108, 60}, {109, 60}, {110, 60}, {111, 60}, {112, 60}, {113, 60}, {114, 60}, {115, 60}, {116, 59}, {117, 59}, {118, 59}, {119, 59}, {120, 59}, {121, 59}, {122, 59}, {123, 59}, {124, 59}, {125, 59}, {126, 59}, {127, 59},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 63}, {73, 63}, {74, 63}, {75, 63}, {76, 63}, {77, 63}, {78, 63}, {79, 63}, {80, 63}, {81, 63}, {82, 63}, {83, 63}, {84, 63}, {85, 63}, {86, 62}, {87, 62}, {88, 62}, {89, 62}, {90, 62}, {91, 62}, {92, 62}, {93, 62}, {94, 62}, {95, 62}, {96, 62}, {97, 62}, {98, 62}, {99, 62}, {100, 61}, {101, 61}, {102, 61}, {103, 61}, {104, 61}, {105, 61}, {106, 61}, {107, 61}, {108, 61}, {109, 61}, {110, 61}, {111, 61}, {112, 61}, {113, 61}, {114, 61}, {115, 60}, {116, 60}, {117, 60}, {118, 60}, {119, 60}, {120, 60}, {121, 60}, {122, 60}, {123, 60}, {124, 60}, {125, 60}, {126, 60}, {127, 60},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 63}, {75, 63}, {76, 63}, {77, 63}, {78, 63}, {79, 63}, {80, 63}, {81, 63}, {82, 63}, {83, 63}, {84, 63}, {85, 63}, {86, 63}, {87, 63}, {88, 63}, {89, 63}, {90, 63}, {91, 63}, {92, 63}, {93, 62}, {94, 62}, {95, 62}, {96, 62}, {97, 62}, {98, 62}, {99, 62}, {100, 62}, {101, 62}, {102, 62}, {103, 62}, {104, 62}, {105, 62}, {106, 62}, {107, 62}, {108, 62}, {109, 62}, {110, 62}, {111, 62}, {112, 61}, {113, 61}, {114, 61}, {115, 61}, {116, 61}, {117, 61}, {118, 61}, {119, 61}, {120, 61}, {121, 61}, {122, 61}, {123, 61}, {124, 61}, {125, 61}, {126, 61}, {127, 61},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 64}, {75, 64}, {76, 64}, {77, 64}, {78, 64}, {79, 63}, {80, 63}, {81, 63}, {82, 63}, {83, 63}, {84, 63}, {85, 63}, {86, 63}, {87, 63}, {88, 63}, {89, 63}, {90, 63}, {91, 63}, {92, 63}, {93, 63}, {94, 63}, {95, 63}, {96, 63}, {97, 63}, {98, 63}, {99, 63}, {100, 63}, {101, 63}, {102, 63}, {103, 63}, {104, 63}, {105, 63}, {106, 63}, {107, 62}, {108, 62}, {109, 62}, {110, 62}, {111, 62}, {112, 62}, {113, 62}, {114, 62}, {115, 62}, {116, 62}, {117, 62}, {118, 62}, {119, 62}, {120, 62}, {121, 62}, {122, 62}, {123, 62}, {124, 62}, {125, 62}, {126, 62}, {127, 62},  },
-  { {64, 64}, {65, 64}, {66, 64}, {67, 64}, {68, 64}, {69, 64}, {70, 64}, {71, 64}, {72, 64}, {73, 64}, {74, 64}, {75, 64}, {76, 64}, {77, 64}, {78, 64}, {79, 64}, {80, 64}, {81, 64}, {82, 64}, {83, 64}, {84, 64}, {85, 64}, {86, 64}, {87, 64}, {88, 64}, {89, 64}, {90, 64}, {91, 64}, {92, 64}, {93, 63}, {94, 63}, {95, 63}, {96, 63}, {97, 63}, {98, 63}, {99, 63}, {100, 63}, {101, 63}, {102, 63}, {103, 63}, {104, 63}, {105, 63}, {106, 63}, {107, 63}, {108, 63}, {109, 63}, {110, 63}, {111, 63}, {112, 63}, {113, 63}, {114, 63}, {115, 63}, {116, 63}, {117, 63}, {118, 63}, {119, 63}, {120, 63}, {121, 63}, {122, 63}, {123, 63}, {124, 63}, {125, 63}, {126, 63}, {127, 63},  },
-};
-
-}
\ No newline at end of file
@@ -0,0 +1,207 @@
+/*
+ * @file frame_codec.hpp
+ * @authors mia
+ * @brief The compressed animation container and its frame decoder.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <stddef.h>
+
+// Containers start with a fixed header, followed by the shared palette if there is one,
+// the index of all frames and then the frames themselves.
+// Everything is little endian and every frame starts on a 4 byte boundary.
+#define CONTAINER_MAGIC "HANI"
+#define CONTAINER_VERSION 1
+#define CONTAINER_HEADER_SIZE_BYTES 20
+#define CONTAINER_INDEX_ENTRY_SIZE_BYTES 12
+
+// The pixel format of the frames.
+#define CONTAINER_FORMAT_RGB 0
+#define CONTAINER_FORMAT_INDEXED 1
+
+// Header flag: a single palette follows the header, otherwise every frame starts with its own.
+#define CONTAINER_GLOBAL_PALETTE 0x01
+
+// Frame flag: the frame doesn't depend on the previous one.
+#define CONTAINER_KEYFRAME 0x01
+
+// The index has to fit into the upload buffer together with the header and a palette.
+#define CONTAINER_MAX_FRAMES 4000
+
+// The frames only store the pixels of the sparse layout, in that order.
+// Every frame is a sequence of operations, each one covering a number of pixels:
+// The top 2 bits of the token pick the operation, the lower 6 bits are the count - 1.
+// A count of 64 is followed by more bytes that get added to it, until one is below 255.
+#define CODEC_KEEP 0     // The pixels didn't change since the previous frame.
+#define CODEC_RUN 1      // A single pixel follows, repeated count times.
+#define CODEC_LITERAL 2  // count pixels follow as they are.
+#define CODEC_MATCH 3    // A 16 bit distance follows, copy count pixels from that far back.
+#define CODEC_COUNT_BITS 6
+#define CODEC_COUNT_MASK ((1 << CODEC_COUNT_BITS) - 1)
+
+
+namespace Rendering
+{
+
+struct __attribute__((packed)) ContainerHeader
+{
+    char magic[4];
+    uint8_t version;
+    uint8_t format;
+    uint8_t flags;
+    uint8_t reserved;
+    // The size of the source image.
+    uint16_t width;
+    uint16_t height;
+    // The pixels every frame stores, and a hash of which ones, so a container
+    // built for another sparse layout gets rejected.
+    uint16_t pixel_count;
+    uint16_t frame_count;
+    uint32_t layout_hash;
+};
+
+struct __attribute__((packed)) ContainerFrame
+{
+    // From the start of the container.
+    uint32_t offset;
+    uint32_t size;
+    // How long the frame is shown. (in ms)
+    uint16_t delay;
+    uint8_t flags;
+    uint8_t reserved;
+};
+
+static_assert(sizeof(ContainerHeader) == CONTAINER_HEADER_SIZE_BYTES, "The container header has a fixed size!");
+static_assert(sizeof(ContainerFrame) == CONTAINER_INDEX_ENTRY_SIZE_BYTES, "The index entries have a fixed size!");
+
+// Frames are padded, so the next one starts on a 4 byte boundary again.
+inline uint32_t get_container_span(uint32_t size) { return (size + 3) & ~(uint32_t)3; }
+
+// FNV-1a over the image offset of every stored pixel, in the order they are stored in.
+inline uint32_t get_layout_hash(const uint16_t* sparse_pixels, uint16_t pixel_count)
+{
+  uint32_t hash = 2166136261u;
+
+  for (uint16_t index = 0; index < pixel_count; index++)
+  {
+    hash = (hash ^ (sparse_pixels[index] & 0xFF)) * 16777619u;
+    hash = (hash ^ (sparse_pixels[index] >> 8)) * 16777619u;
+  }
+
+  return hash;
+}
+
+// Decodes a single frame of pixel_count pixels of pixel_size bytes each into the destination.
+// The reference is the previous frame, which may be the destination itself.
+// Keyframes don't need one. Returns false if the data is corrupt.
+inline bool decode_frame(const uint8_t* source, size_t source_size, uint8_t* destination,
+  const uint8_t* reference, uint16_t pixel_count, uint8_t pixel_size)
+{
+  const uint8_t* end = source + source_size;
+  size_t position = 0;
+  size_t size = (size_t)pixel_count * pixel_size;
+
+  while (position < size)
+  {
+    if (source >= end)
+      return false;
+
+    uint8_t token = *source++;
+    size_t count = token & CODEC_COUNT_MASK;
+
+    // Long counts continue in the following bytes.
+    if (count == CODEC_COUNT_MASK)
+    {
+      uint8_t addition;
+
+      do
+      {
+        if (source >= end)
+          return false;
+
+        addition = *source++;
+        count += addition;
+      } while (addition == 255);
+    }
+
+    size_t length = (count + 1) * pixel_size;
+
+    if (length > size - position)
+      return false;
+
+    switch (token >> CODEC_COUNT_BITS)
+    {
+      case CODEC_KEEP:
+        if (reference == NULL)
+          return false;
+
+        if (reference != destination)
+          memcpy(destination + position, reference + position, length);
+        break;
+
+      case CODEC_RUN:
+        if ((size_t)(end - source) < pixel_size)
+          return false;
+
+        if (pixel_size == 1)
+        {
+          memset(destination + position, *source, length);
+        }
+        else
+        {
+          for (size_t offset = 0; offset < length; offset += pixel_size)
+            memcpy(destination + position + offset, source, pixel_size);
+        }
+
+        source += pixel_size;
+        break;
+
+      case CODEC_LITERAL:
+        if ((size_t)(end - source) < length)
+          return false;
+
+        memcpy(destination + position, source, length);
+        source += length;
+        break;
+
+      case CODEC_MATCH:
+      {
+        if (end - source < 2)
+          return false;
+
+        size_t distance = (source[0] | (source[1] << 8)) * (size_t)pixel_size;
+        source += 2;
+
+        if (distance == 0 || distance > position)
+          return false;
+
+        uint8_t* target = destination + position;
+
+        // Overlapping matches repeat a pattern, so they have to go front to back.
+        if (distance >= length)
+        {
+          memcpy(target, target - distance, length);
+        }
+        else
+        {
+          for (size_t offset = 0; offset < length; offset++)
+            target[offset] = target[offset - distance];
+        }
+        break;
+      }
+    }
+
+    position += length;
+  }
+
+  return true;
+}
+
+}
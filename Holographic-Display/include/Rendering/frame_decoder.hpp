@@ -0,0 +1,63 @@
+/*
+ * @file frame_decoder.hpp
+ * @authors mia
+ * @brief Decodes uploads chunk by chunk straight into the frame slots.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.hpp"
+#include "Rendering/rendering.hpp"
+#include "Rendering/frame_codec.hpp"
+
+
+namespace Rendering
+{
+
+// Takes an upload in whatever chunks the network hands it over in.
+// The header gets collected until the renderer can pick a format from it,
+// after that every chunk goes straight to the frame slots, without staging whole records.
+// Compressed frames are the exception, they have to be complete before they can be decoded.
+class FrameDecoder
+{
+private:
+    Renderer* _renderer;
+    // The size the upload announced, a bit more than the data for multipart ones.
+    size_t _total_size = 0;
+    // Uploads to the library are named, so their frames can stay resident.
+    char _name[LIBRARY_NAME_LENGTH] = "";
+
+    // The start of the upload, which is enough to tell how big the header is.
+    uint8_t _prefix[CONTAINER_HEADER_SIZE_BYTES];
+    size_t _prefix_size = 0;
+    uint8_t* _header = NULL;
+    size_t _header_size = 0;
+    size_t _header_received = 0;
+    bool _header_read = false;
+    bool _rejected = false;
+
+    size_t _record_size = 0;
+    size_t _record_offset = 0;
+    uint16_t _frame = 0;
+    uint8_t* _record = NULL;
+    size_t _record_capacity = 0;
+
+    bool _read_header(const uint8_t*& data, size_t& length, bool final);
+    void _read_records(const uint8_t* data, size_t length);
+    bool _reserve_record();
+public:
+    FrameDecoder(Renderer* renderer);
+    ~FrameDecoder();
+
+    void begin(size_t total_size, const char* name = "");
+    void write(const uint8_t* data, size_t length, bool final);
+    bool is_rejected();
+    uint16_t get_frame_count();
+};
+
+}
@@ -0,0 +1,127 @@
+/*
+ * @file metrics.hpp
+ * @authors mia
+ * @brief Timing histograms of the render loop.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.hpp"
+#include "esp_timer.h"
+
+#ifdef RENDER_METRICS
+
+// One bucket for 0, then powers of two up to 32768 and one for everything above.
+#define HISTOGRAM_BUCKETS 18
+
+
+namespace Rendering
+{
+
+// Reads the cycle counter of the core we are running on.
+inline uint32_t IRAM_ATTR get_cycle_count()
+{
+#ifdef __XTENSA__
+  uint32_t cycles;
+  asm volatile ("rsr %0, ccount" : "=a" (cycles));
+  return cycles;
+#else
+  return (uint32_t)(esp_timer_get_time() * CPU_FREQUENCY_MHZ);
+#endif
+}
+
+inline uint32_t cycles_to_us(uint32_t cycles) { return cycles / CPU_FREQUENCY_MHZ; }
+
+// Lock-free histogram with power of two buckets.
+// Only a single task ever records into it, everybody else just reads.
+class Histogram
+{
+private:
+    std::atomic<uint32_t> _buckets[HISTOGRAM_BUCKETS] = {};
+    std::atomic<uint32_t> _count { 0 };
+    // Wraps around eventually, which looks like a counter reset to Prometheus.
+    std::atomic<uint32_t> _sum { 0 };
+    std::atomic<uint32_t> _max { 0 };
+
+    static uint8_t _get_bucket(uint32_t value);
+public:
+    void record(uint32_t value);
+
+    // The upper bound of the bucket, the last one doesn't have any.
+    static uint32_t get_bound(uint8_t bucket);
+    uint32_t get_bucket(uint8_t bucket) const { return _buckets[bucket].load(std::memory_order_relaxed); }
+    uint32_t get_count() const { return _count.load(std::memory_order_relaxed); }
+    uint32_t get_sum() const { return _sum.load(std::memory_order_relaxed); }
+    uint32_t get_max() const { return _max.load(std::memory_order_relaxed); }
+};
+
+// The share of the time a task spent working, averaged over TASK_LOAD_WINDOW_MS.
+// Only the task itself records into it, everybody else just reads.
+class TaskLoad
+{
+private:
+    int64_t _window_start_us = 0;
+    uint32_t _busy_us = 0;
+    std::atomic<uint16_t> _load_permille { 0 };
+    std::atomic<uint32_t> _window_end_ms { 0 };
+public:
+    void record(uint32_t busy_us);
+    uint16_t get_load_permille() const;
+};
+
+// Everything the render loop measures about itself.
+class RenderMetrics
+{
+private:
+    // Written by the timer ISR, read by the task it wakes up.
+    volatile uint32_t _tick_cycles = 0;
+    volatile int64_t _tick_time_us = 0;
+    volatile BaseType_t _tick_core = 0;
+
+    uint32_t _wake_cycles = 0;
+    uint16_t _rotation_missed_slices = 0;
+    uint16_t _rotation_late_slices = 0;
+    std::atomic<uint32_t> _slices { 0 };
+    std::atomic<uint32_t> _missed_slices { 0 };
+    std::atomic<uint32_t> _late_slices { 0 };
+    std::atomic<uint32_t> _rotations { 0 };
+public:
+    // From the timer ISR to the display task running. (in μs)
+    Histogram isr_latency;
+    // Assembling a slice, from the slice count to the LED buffer. (in μs)
+    Histogram compute_time;
+    // Queueing a slice and waiting for a free DMA buffer. (in μs)
+    Histogram spi_wait;
+    // Timer ticks the task didn't get to before the next one, per rotation.
+    Histogram missed_per_rotation;
+    // Slices that weren't done before the next tick, per rotation.
+    Histogram late_per_rotation;
+    // How far the middle of the rotation a frame first got shown in was from its start on the timeline. (in μs)
+    Histogram frame_jitter;
+    // Recorded by the loader task, reading a frame from the flash and decoding it. (in μs)
+    Histogram frame_read;
+    Histogram frame_decode;
+    // The time the display task spent on slices, and the loader on frames.
+    TaskLoad display_load;
+    TaskLoad loader_load;
+
+    void IRAM_ATTR on_tick(int64_t time_us);
+    void on_wake(uint32_t notifications);
+    void on_slice_done(uint32_t start_cycles, uint32_t slice_period_us);
+    void on_rotation();
+
+    uint32_t get_slices() const { return _slices.load(std::memory_order_relaxed); }
+    uint32_t get_missed_slices() const { return _missed_slices.load(std::memory_order_relaxed); }
+    uint32_t get_late_slices() const { return _late_slices.load(std::memory_order_relaxed); }
+    uint32_t get_rotations() const { return _rotations.load(std::memory_order_relaxed); }
+};
+
+}
+
+#endif
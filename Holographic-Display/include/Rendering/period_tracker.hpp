@@ -0,0 +1,82 @@
+/*
+ * @file period_tracker.hpp
+ * @authors mia
+ * @brief Extrapolates the rotation period the motor controller reported to the present.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+// How much of a new change of the period goes into the slope, as 1 / x.
+#define PERIOD_SLOPE_SMOOTHING 8
+// The period isn't extrapolated any further than this past the last measurement. (in μs)
+#define PERIOD_MAX_EXTRAPOLATION_US 200000
+
+
+namespace Rendering
+{
+
+// Follows the measured period and how fast it changes, to tell what it is by the
+// time it gets used. The times have to be in the local clock already.
+// Small enough to be published to the render task as a whole.
+class PeriodTracker
+{
+private:
+    uint32_t _period_us = 0;
+    int64_t _time_us = 0;
+    // The change of the period per μs.
+    float _slope = 0;
+public:
+    void update(uint32_t period_us, int64_t time_us)
+    {
+        // The motor just started or stopped, there's nothing to go from.
+        if (period_us == 0 || _period_us == 0)
+            _slope = 0;
+        else if (time_us > _time_us)
+            _slope += (((float)period_us - (float)_period_us) / (float)(time_us - _time_us) - _slope)
+                / PERIOD_SLOPE_SMOOTHING;
+        // Nothing new was measured since the last time.
+        else
+            return;
+
+        _period_us = period_us;
+        _time_us = time_us;
+    }
+
+    void reset() { _period_us = 0; _slope = 0; }
+
+    // 0 if the motor is standing still, or nothing is known about it.
+    uint32_t get_period_us(int64_t now_us) const
+    {
+        if (_period_us == 0)
+            return 0;
+
+        int64_t elapsed_us = now_us - _time_us;
+
+        if (elapsed_us < 0)
+            elapsed_us = 0;
+        else if (elapsed_us > PERIOD_MAX_EXTRAPOLATION_US)
+            elapsed_us = PERIOD_MAX_EXTRAPOLATION_US;
+
+        float period_us = _period_us + _slope * elapsed_us;
+
+        // A slope that went wrong shouldn't be able to take the period anywhere.
+        if (period_us < _period_us / 2)
+            period_us = _period_us / 2;
+        else if (period_us > _period_us * 2.0f)
+            period_us = _period_us * 2.0f;
+
+        return (uint32_t)period_us;
+    }
+
+    uint32_t get_measured_period_us() const { return _period_us; }
+    int64_t get_time_us() const { return _time_us; }
+    float get_slope() const { return _slope; }
+};
+
+}
@@ -18,11 +18,20 @@
 #include <string>
 #include <sstream>
 #include <cstring>
+#include <atomic>
+#include <algorithm>
 #include "config.hpp"
-#include "conversion_matrix.hpp"
 #include "rgb.hpp"
+#include "rotation_pll.hpp"
+#include "vector_math.hpp"
+#include "metrics.hpp"
+#include "frame_codec.hpp"
+#include "seqlock.hpp"
+#include "period_tracker.hpp"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/spi_master.h"
+#include "freertos/semphr.h"
 
 
 using namespace std;
@@ -31,17 +40,122 @@ using namespace std;
 namespace Rendering 
 {
 
-static portMUX_TYPE optionsMUX = portMUX_INITIALIZER_UNLOCKED;
-
+// Everything the webserver can change about rendering. Written as a whole with set_options,
+// the render task takes the new version over between rotations.
 struct Options 
 {
     int16_t red_color_adjust = 0;
     int16_t green_color_adjust = 0;
     int16_t blue_color_adjust = 0;
+    float gamma = 1.0;
     uint16_t offset = 0;
-    unsigned long _delay_between_degrees_us = 5000;
+    // Blend all the pixels an LED covers instead of just taking the nearest one.
+    bool anti_aliasing = false;
+    // The amount of slices per rotation, 0 picks it automatically from the RPM.
+    uint16_t angles_per_rotation = 0;
+    unsigned long _rotation_period_us = IDLE_ROTATION_PERIOD_US;
+};
+
+// Lookup tables mapping every raw color value to its adjusted and gamma corrected one.
+struct ColorTables
+{
+    uint8_t red[256];
+    uint8_t green[256];
+    uint8_t blue[256];
+};
+
+// The pixels every LED of a slice covers and how much of them, for anti-aliasing.
+// Stored tap-major, so every tap is one contiguous vector of lanes.
+struct AntiAliasingRow
+{
+    uint16_t offsets[AA_TAPS][LEDS_PER_SLICE];
+    alignas(VECTOR_ALIGNMENT) int16_t weights[AA_TAPS][LEDS_PER_SLICE];
+};
+
+// Working space for blending a whole slice at once, one lane per LED.
+struct AntiAliasingScratch
+{
+    alignas(VECTOR_ALIGNMENT) int16_t samples[3][LEDS_PER_SLICE];
+    alignas(VECTOR_ALIGNMENT) int16_t accumulators[3][LEDS_PER_SLICE];
+};
+
+// The weights of all AA_TAPS taps add up to a full weight. On top of the rounding half,
+// the brightest color still has to fit, where the PIE kernel saturates and the scalar one wraps around.
+static_assert((1 << (AA_WEIGHT_BITS - 1)) + 255 * (1 << AA_WEIGHT_BITS) <= INT16_MAX, 
+    "The anti-aliasing accumulators would overflow!");
+// The vector loads ignore the lowest bits of the address, so every row has to start on a whole vector.
+static_assert(LEDS_PER_SLICE % VECTOR_LANES == 0, "The slices have to be a whole number of vectors!");
+
+// How the frames are laid out inside of the PSRAM.
+enum class FrameLayout : uint8_t
+{
+    // Cartesian images with only the pixels inside of the disc, 
+    // resampled with the pixel offset table every slice.
+    CARTESIAN,
+    // Converted once when loaded, every slice is one contiguous diameter.
+    POLAR
+};
+
+// How the pixels of a frame are stored.
+enum class FrameFormat : uint8_t
+{
+    // 3 bytes of color per pixel.
+    RGB,
+    // The palette of the frame, followed by 1 byte per pixel indexing into it.
+    INDEXED
+};
+
+// The header in front of indexed data files and uploads.
+struct __attribute__((packed)) IndexedHeader
+{
+    char magic[4];
+    uint8_t version;
+    uint8_t flags;
+    uint16_t frame_count;
 };
 
+// Everything the render task needs to know about the frames it shows.
+// New frames always go into a set the render task isn't showing, which then
+// gets handed over as a whole and is picked up between two rotations.
+struct FrameSet
+{
+    uint8_t* frames = NULL;
+    uint16_t* delays = NULL;
+    size_t frame_size = 0;
+    FrameLayout layout = FrameLayout::POLAR;
+    FrameFormat format = FrameFormat::RGB;
+    // The part of the frame memory the set takes up, in slots of its frame size.
+    size_t offset = 0;
+    uint16_t slot_count = 0;
+    // Frames keep getting added after the set got handed over, up to this one they are complete.
+    std::atomic<uint16_t> max_frame { 0 };
+    // The frames are a ring the loader keeps filling, instead of the whole animation.
+    std::atomic<bool> streamed { false };
+    bool live = false;
+    // The frames are in the file system too, so they can be converted again.
+    bool saved = false;
+};
+
+// An animation of the library that stays in the frame memory after it got loaded,
+// so it can be shown again without reading the flash.
+struct ResidentAnimation
+{
+    char name[LIBRARY_NAME_LENGTH];
+    // Where its frames are in the frame memory. (in bytes)
+    size_t offset;
+    size_t frame_size;
+    uint16_t frame_count;
+    FrameLayout layout;
+    FrameFormat format;
+    // The one that was shown or loaded the longest time ago gets evicted first.
+    uint32_t last_used;
+};
+
+// Marks the ready frame set / live slot as not shown yet.
+#define FRAME_SET_FRESH 0x80
+#define LIVE_FRESH 0x80
+#define LIVE_NO_SLOT 0xFF
+
 
 void IRAM_ATTR _update_timer_ISR();
 void IRAM_ATTR _update_rotation_ISR(void* parameter);
@@ -50,11 +164,42 @@ void IRAM_ATTR _update_rotation_ISR(void* parameter);
 class Renderer
 {
 private:
-    // Allocate the image inside of PSRAM
-    RGB* _image_data;
-    uint16_t _delay_data[MAX_FRAMES];
+    // Allocate the image inside of PSRAM, it takes up whatever is left of it.
+    uint8_t* _image_data = NULL;
+    size_t _image_data_size = 0;
+    // Enough for the smallest frames that fit.
+    uint16_t* _delay_data = NULL;
+    uint16_t _max_frames = 0;
+
+    // The set on display, the one handed over last and the one being built.
+    // The index of the one handed over is marked with FRAME_SET_FRESH, until the 
+    // render task swaps it with the one it shows.
+    FrameSet _frame_sets[3];
+    std::atomic<uint8_t> _ready_frame_set { 1 };
+    uint8_t _back_frame_set = 2;
+    // Only the render task ever changes which set it shows.
+    FrameSet* _frames = &_frame_sets[0];
+    // New frames go in here, even after it got handed over.
+    FrameSet* _loading_frames = &_frame_sets[0];
+    bool _loading_published = true;
+    // Shown before anything is loaded, and while the whole frame memory gets rewritten.
+    uint8_t* _blank_frame = NULL;
+    uint16_t _blank_delay = 0;
+
+    // Animations of the library that are kept in the frame memory, next to the one on display.
+    ResidentAnimation _resident[LIBRARY_MAX_RESIDENT];
+    uint8_t _resident_count = 0;
+    uint32_t _resident_clock = 0;
+    // The animation the frames being loaded belong to, and the one handed over last.
+    // The data file doesn't have a name, so it never stays resident.
+    char _loading_name[LIBRARY_NAME_LENGTH] = "";
+    char _animation_name[LIBRARY_NAME_LENGTH] = "";
+    uint16_t _loading_frame_count = 0;
+    // Loads the frames without handing them over, and never blanks the display to make room.
+    bool _preloading = false;
 
     TaskHandle_t _display_loop_task = NULL;
+    TaskHandle_t _frame_loader_task = NULL;
     hw_timer_t* _render_loop_timer;
     
     spi_device_handle_t _spi;
@@ -65,7 +210,7 @@ private:
         .sclk_io_num = LED_CLOCK_PIN,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = (LEDS_PER_SIDE * 2 * 4) + 8,
+        .max_transfer_sz = SLICE_BUFFER_SIZE_BYTES,
     };
 
     spi_device_interface_config_t _devcfg = {
@@ -73,49 +218,298 @@ private:
         .clock_speed_hz = SPI_FREQUENCY * 1000 * 1000,
         .spics_io_num = -1,
         .flags = SPI_DEVICE_HALFDUPLEX,
-        .queue_size = 1,
+        .queue_size = SLICE_BUFFER_COUNT,
     };
     
-    spi_transaction_t _current_transaction = {
-        .length = ((LEDS_PER_SIDE * 2 * 4) + 8) * 8,  // Bits!
-        .user = NULL,
-        .tx_buffer = _led_buffer
-    };
+    // Ring of DMA buffers and their transactions, one per slice in flight.
+    spi_transaction_t _transactions[SLICE_BUFFER_COUNT];
+    uint8_t* _led_buffers[SLICE_BUFFER_COUNT];
+    uint8_t _next_buffer = 0;
+    uint8_t _transactions_in_flight = 0;
+    uint32_t _spi_overruns = 0;
     
+    // Flat per-slice table of pixel offsets into a frame, stored in internal DRAM.
+    // Only half a rotation is stored, the other half shows the same diameters mirrored.
+    // The offsets already point into the sparse frames.
+    uint16_t* _pixel_offsets = NULL;
+
+    // Where every pixel of the image ends up in cartesian frames and the other way around.
+    // Only needed while building tables and loading frames, so they live in PSRAM.
+    uint16_t* _pixel_remap = NULL;
+    uint16_t* _sparse_pixels = NULL;
+    uint16_t _sparse_pixel_count = 0;
+    uint32_t _sparse_layout_hash = 0;
+    // Polar frames get converted from the sparse ones, this holds them in the meantime.
+    uint8_t* _conversion_buffer = NULL;
+
+    // Built the first time anti-aliasing gets turned on, it's too big to keep around otherwise.
+    // Only has the resolution of polar frames, finer resolutions share rows.
+    std::atomic<const AntiAliasingRow*> _anti_aliasing_table { NULL };
+    // The render task and the frame conversion each need their own.
+    AntiAliasingScratch _render_scratch;
+    AntiAliasingScratch _polarize_scratch;
+    // Turned off if the vectorised kernel doesn't match the scalar one on this chip.
+    bool _use_vector_kernel = true;
+
+    // The buffer of the ring the next slice is assembled in.
     uint8_t* _led_buffer = NULL;
+
+    // The render task only ever reads the active tables, new ones are written 
+    // into the other one and then swapped in.
+    ColorTables _color_tables[2];
+    std::atomic<const ColorTables*> _active_color_tables { &_color_tables[0] };
+
+    Seqlock<Options> _options;
+    // The copy of the options the render task works with, and what's derived from them.
+    Options _render_options;
+    uint32_t _render_options_version = 0;
+    // The speed the motor controller reported, only used while the PLL isn't locked.
+    Seqlock<PeriodTracker> _motor_speed;
+    PeriodTracker _render_motor_speed;
+    uint32_t _motor_speed_version = 0;
+    uint16_t _offset_slices = 0;
     uint8_t _current_brightness = 1;
     uint8_t _saved_brightness = 1;
     uint16_t _current_frame= 0;
-    uint16_t _current_degrees = 0;
-    uint16_t _max_frame = 0;
-    unsigned long _last_frame_switch = 0;
+    RotationPLL _rotation_pll;
+    // The time the last timer tick happened at.
+    int64_t _tick_time_us = 0;
+    // The slice that is being prepared for the next timer tick.
+    uint16_t _current_slice = 0;
+#ifdef SLICE_ONE_SHOT_TIMER
+    // When the slice that is being prepared has to go out.
+    int64_t _slice_deadline_us = 0;
+    // The time of esp_timer_get_time(), when the counter of the render loop timer was at 0.
+    int64_t _timer_offset_us = 0;
+#endif
+    // Without a lock, the HAL sensor might snap the slice back before it ever got to the end of 
+    // the rotation. Every edge then counts as the end of one, so there still is one per rotation.
+    std::atomic<bool> _rotation_ended { false };
+    std::atomic<bool> _rotation_end_missed { false };
+    // The amount of slices the current rotation is cut into.
+    uint16_t _angles_per_rotation = ANGLES_PER_ROTATION;
+    uint32_t _slice_period_us = IDLE_ROTATION_PERIOD_US / ANGLES_PER_ROTATION;
+    // The worst case slice compute time of the last and the current rotation.
+    uint32_t _slice_compute_us = 0;
+    uint32_t _rotation_compute_us = 0;
+    // The layout and format of the frames being loaded.
+    FrameLayout _frame_layout = FrameLayout::CARTESIAN;
+    FrameFormat _frame_format = FrameFormat::RGB;
+    // The palette from the header of the frames currently being loaded, if they share one.
+    RGB _shared_palette[256];
+    bool _has_shared_palette = false;
+    // The frames come from a container, which has an index and compresses them.
+    bool _compressed = false;
+    ContainerFrame* _frame_index = NULL;
+    uint16_t _frame_index_count = 0;
+    // The sparse pixels of the frame decoded last, compressed frames only store what changed.
+    const uint8_t* _previous_frame = NULL;
+
+    // The palette of the frame on display, already run through the color tables.
+    // Kept in internal DRAM and only rebuilt when the frame, its palette or the tables change.
+    RGB _resolved_palette[256];
+    const uint8_t* _resolved_palette_frame = NULL;
+    const ColorTables* _resolved_palette_tables = NULL;
+    uint32_t _resolved_palette_generation = 0;
+    // Counts up every time a palette or the color tables get written.
+    std::atomic<uint32_t> _palette_generation { 1 };
+
+    // When the frame on the timeline ends, the timeline only ever moves on by the delays.
+    int64_t _frame_end_us = 0;
+    // Set when new frames get swapped in, they start in the middle of the next rotation.
+    bool _timeline_reset = true;
+    // Frames that got shown, and frames that were over before a rotation could show them.
+    uint32_t _shown_frames = 0;
+    uint32_t _skipped_frames = 0;
+    uint32_t _frame_rate_shown_frames = 0;
+    int64_t _frame_rate_start_us = 0;
+    float _frame_rate = 0;
+
+    // Animations that don't fit get streamed, the whole frame memory is then a ring 
+    // the loader task keeps filling ahead of the frame on display.
+    // Animations that do fit get loaded the same way, with a ring as big as the animation.
+    std::atomic<bool> _streaming { false };
+    // Held by the loader while it reads a frame, so the stream can't be stopped in the middle.
+    SemaphoreHandle_t _stream_mutex = NULL;
+    // Held by everything that loads, shows, patches or evicts frames. Uploads and live frames
+    // come from the network core and the playlist from the loader core, they'd clash otherwise.
+    SemaphoreHandle_t _loader_mutex = NULL;
+    File _stream_file;
+    uint8_t* _stream_record = NULL;
+    size_t _stream_header_size = 0;
+    size_t _stream_record_size = 0;
+    uint16_t _stream_frame_count = 0;
+    uint16_t _stream_ring_size = 0;
+    int64_t _stream_start_us = 0;
+    // Frames counted from the start of the stream, they wrap around both the animation and the ring.
+    // Everything below the loaded count is resident, the render task only ever writes the position.
+    std::atomic<uint32_t> _stream_position { 0 };
+    std::atomic<uint32_t> _stream_loaded { 0 };
+    // The set the stream loads into, the render task only moves it on while showing that one.
+    std::atomic<const FrameSet*> _stream_frames { NULL };
+    // Frame switches that had to wait, because the next frame wasn't loaded yet.
+    uint32_t _stream_underruns = 0;
+    bool _stream_waiting = false;
+
+    // Patches get applied to a copy of their frame first, which the render task
+    // shows instead of the frame while the frame itself gets overwritten.
+    uint8_t* _patch_buffer = NULL;
+    // Which sparse pixels the patch touched, polar frames have to be updated from them.
+    uint8_t* _patch_dirty = NULL;
+    std::atomic<const uint8_t*> _patched_frame { NULL };
+    std::atomic<const uint8_t*> _patched_target { NULL };
+    // Odd while the render task is assembling a slice.
+    std::atomic<uint32_t> _slice_sequence { 0 };
+
+    // Live frames replace the animation while they come in, in a ring of LIVE_RING_SIZE slots.
+    // The receiving side and the render task swap slots through the ready one, which
+    // is marked with LIVE_FRESH until the render task takes it at the next rotation.
+    std::atomic<bool> _live { false };
+    std::atomic<uint8_t> _live_ready { 0 };
+    // The slot the next frame gets received into, and the one received last.
+    uint8_t _live_back = 0;
+    uint8_t _live_last = LIVE_NO_SLOT;
+    std::atomic<uint32_t> _live_received { 0 };
+    std::atomic<uint32_t> _live_dropped { 0 };
+    std::atomic<uint32_t> _live_displayed { 0 };
+#ifdef RENDER_METRICS
+    RenderMetrics _metrics;
+#endif
 
-    void _clear_image_data();
-    void _print_image_data(uint8_t frame);
+    bool _begin_frame_set(uint16_t slot_count);
+    bool _find_frame_memory(size_t size, size_t& offset);
+    uint16_t* _get_delays(size_t offset);
+    int8_t _find_resident(const char* name);
+    void _add_resident();
+    void _remove_resident(uint8_t index);
+    const FrameSet* _get_published_frame_set();
+    void _show_blank_frames();
+    void _publish_frame_set();
+    void _take_frame_set();
+    void _build_pixel_offsets();
+    void _build_sparse_layout();
+    uint32_t _get_sparse_order(uint16_t offset);
+    uint16_t _get_pixel_offset(double theta, uint8_t radius);
+    bool _build_anti_aliasing_table();
+    void _build_anti_aliasing_taps(float degrees, float radius, AntiAliasingRow* row, uint8_t led_index);
+    void _check_vector_kernel();
+    void _sample_anti_aliased(const uint8_t* frame, const RGB* palette, const AntiAliasingRow* row, AntiAliasingScratch* scratch);
+    RGB _get_sampled_color(const AntiAliasingScratch* scratch, uint8_t led_index);
+    void _print_image_data(uint16_t frame);
     void _print_first_pixel();
     void _load_image_from_flash();
-    void _copy_to_frame_buffer(uint8_t frame, uint8_t* data);
+    bool _load_animation(const char* name);
+    void _copy_to_frame_buffer(uint16_t frame, const uint8_t* data);
+    void _complete_frame(uint16_t frame);
+    void _write_record(uint16_t slot, size_t offset, const uint8_t* data, size_t length);
+    void _finish_record(uint16_t slot);
+    void _decode_frame(uint16_t slot, uint16_t frame, const uint8_t* data);
+    void _decode_compressed_frame(uint16_t slot, uint16_t frame, const uint8_t* data);
+    bool _prepare_container(const uint8_t* data, size_t header_size);
+    bool _start_streaming(File file, uint8_t* record, size_t header_size, size_t record_size, uint16_t frame_count);
+    bool _load_stream_frame();
+    bool _is_stream_resident();
+    void _close_stream();
+    bool _advance_stream();
+    void _take_live_frame();
+    bool _apply_patch(uint8_t* frame, const uint8_t* patch, size_t length);
+    void _wait_for_slice();
+    void _pack_frame(const RGB* source, RGB* destination);
+    void _pack_indices(const uint8_t* source, uint8_t* destination);
+    void _polarize_frame(const RGB* source, RGB* destination);
+    void _polarize_indices(const uint8_t* source, uint8_t* destination);
+    void _choose_frame_layout(uint16_t frame_count);
+    size_t _get_frame_size_bytes();
+    size_t _get_record_size_bytes();
+    size_t _get_max_record_size();
+    uint8_t* _get_frame(uint16_t frame);
+    const RGB* _get_resolved_palette(const uint8_t* frame, const ColorTables* tables);
     void _update_frame_count();
-    void _update_degree_count();
+    void _update_frame_rate();
+    void _update_slice_count();
+#ifdef SLICE_ONE_SHOT_TIMER
+    void _schedule_slice();
+#endif
+    void _update_resolution();
+    uint16_t _pick_angles_per_rotation(uint32_t rotation_period_us);
+    uint32_t _get_rotation_period_us();
     void _update_led_colors();
     void _show();
+    void _acquire_slice_buffer();
     void _change_led(uint8_t index, RGB color);
+    static void _write_led(uint8_t* led, uint8_t global, RGB color);
+    static void _write_led_adjusted(uint8_t* led, uint8_t global, RGB color, const ColorTables* tables);
     static void _display_loop(void *parameter);
+    static void _frame_loader(void *parameter);
 
     // Add the ISR function as friends.
     friend void IRAM_ATTR _update_timer_ISR();
     friend void IRAM_ATTR _update_rotation_ISR(void* parameter);
+#ifdef RENDER_BENCHMARK
+    // The Renderer-Benchmark times the slice kernel on its own.
+    friend class SliceBenchmark;
+#endif
 
     uint8_t _add_colors(uint8_t color, int16_t addition);
+    uint8_t _apply_gamma(uint8_t color, float gamma);
+    void _update_color_tables(const Options& options);
+    void _update_options();
 
 public:
-    Options options;
     
     void begin();
     void set_brightness(uint8_t brightness);
     void set_renderer_state(bool enabled);
+    uint32_t get_spi_overruns();
+    uint16_t get_angles_per_rotation();
+    uint32_t get_slice_period_us();
+    uint32_t get_slice_compute_us();
+    bool is_rotation_locked();
+    uint32_t get_rotation_period_us();
+    uint32_t get_hal_glitches();
+    static bool is_supported_angles_per_rotation(uint16_t angles);
+    Options get_options();
+    void set_options(const Options& options);
+    void set_motor_speed(const PeriodTracker& motor_speed);
+    void set_anti_aliasing(bool enabled);
+    uint16_t get_frame_capacity();
+    void set_frames_saved();
     void refresh_image();
-    void update_frame(uint8_t frame, uint8_t* data);
+    static size_t get_frame_header_size(const uint8_t* data, size_t length);
+    size_t prepare_frames(const uint8_t* header, size_t header_size, size_t total_size, const char* name = "");
+    size_t get_record_size(uint16_t frame);
+    void update_frame(uint16_t frame, const uint8_t* data);
+    bool is_compressed();
+    void write_frame(uint16_t frame, size_t offset, const uint8_t* data, size_t length);
+    void finish_frame(uint16_t frame);
+    const uint8_t* get_frame_data(uint16_t frame);
+    size_t get_frame_size();
+    bool patch_frame(uint16_t frame, const uint8_t* patch, size_t length);
+    static void get_animation_path(const char* name, char* path, size_t size);
+    bool show_animation(const char* name);
+    bool preload_animation(const char* name);
+    bool is_resident(const char* name);
+    void evict_animation(const char* name);
+    const char* get_animation_name();
+    size_t get_frame_memory_size();
+    size_t get_displayed_size();
+    uint8_t get_resident_count();
+    const ResidentAnimation& get_resident(uint8_t index);
+    void stop_streaming();
+    bool is_streaming();
+    uint32_t get_stream_underruns();
+    float get_frame_rate();
+    uint32_t get_skipped_frames();
+    void start_live();
+    bool push_live_frame(const uint8_t* message, size_t length);
+    void stop_live();
+    bool is_live();
+    uint32_t get_live_received();
+    uint32_t get_live_dropped();
+    uint32_t get_live_displayed();
+#ifdef RENDER_METRICS
+    const RenderMetrics& get_metrics();
+#endif
 };
 
 extern Renderer *g_renderer;
@@ -0,0 +1,51 @@
+/*
+ * @file rotation_pll.hpp
+ * @authors mia
+ * @brief Tracks the rotation period and phase from the HAL sensor edges.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.hpp"
+
+
+namespace Rendering 
+{
+
+// Software phase-locked loop following the HAL sensor.
+// Every edge gets compared to the predicted one, and the error slowly pulls 
+// the estimated phase and period towards it. Only integer math is used,
+// since the edges are fed in from an ISR.
+class RotationPLL
+{
+private:
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
+    // The estimated period in μs, with 8 fractional bits.
+    int64_t _period_q8 = 0;
+    // The estimated time of the last edge.
+    int64_t _phase_us = 0;
+    // The time of the last edge that was actually accepted.
+    int64_t _last_edge_us = 0;
+    uint8_t _good_edges = 0;
+    uint32_t _glitches = 0;
+
+    void _restart(int64_t now_us);
+    void _update(int64_t now_us);
+    bool _is_locked(int64_t now_us);
+public:
+    bool IRAM_ATTR on_edge(int64_t now_us);
+
+    bool is_locked(int64_t now_us);
+    uint32_t get_period_us();
+    uint16_t get_slice(int64_t time_us, uint16_t angles_per_rotation);
+    int64_t get_slice_time(uint16_t slice, int64_t near_us, uint16_t angles_per_rotation);
+    uint32_t get_glitches();
+};
+
+}
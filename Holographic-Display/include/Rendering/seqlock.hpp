@@ -0,0 +1,76 @@
+/*
+ * @file seqlock.hpp
+ * @authors mia
+ * @brief Publishes small structs from one task to others, without any locks.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+
+namespace Rendering
+{
+
+// The sequence is odd while the value is being written. Readers copy the value and
+// check the sequence didn't change in the meantime, so they never block the writer.
+// There may only be a single writer at a time.
+template <typename T>
+class Seqlock
+{
+private:
+    std::atomic<uint32_t> _sequence { 0 };
+    T _value;
+public:
+    void write(const T& value)
+    {
+        uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _value = value;
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Copies the value if it changed since the version, and moves the version along.
+    // Returns false if it didn't change, or is being written right now. That never waits
+    // for the writer, so it's fine for the render task, which might have interrupted it.
+    bool read_if_changed(T& value, uint32_t& version) const
+    {
+        uint32_t sequence = _sequence.load(std::memory_order_acquire);
+
+        if (sequence == version || (sequence & 1))
+            return false;
+
+        T copy = _value;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (_sequence.load(std::memory_order_relaxed) != sequence)
+            return false;
+
+        value = copy;
+        version = sequence;
+        return true;
+    }
+
+    // Retries until it got a whole copy. Only for tasks that can't interrupt the writer.
+    T read() const
+    {
+        T value;
+        uint32_t version = 1;
+
+        while (!read_if_changed(value, version))
+            version = 1;
+
+        return value;
+    }
+
+    uint32_t get_version() const { return _sequence.load(std::memory_order_acquire); }
+};
+
+}
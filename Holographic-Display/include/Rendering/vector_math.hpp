@@ -0,0 +1,86 @@
+/*
+ * @file vector_math.hpp
+ * @authors mia
+ * @brief Small vectorised kernels used by the renderer.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+// The ESP32-S3 has 128 bit wide PIE vector registers.
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define VECTOR_MATH_PIE
+#endif
+
+// The amount of 16 bit lanes in a single vector.
+// Buffers handed to the kernels have to be aligned to a whole vector.
+#define VECTOR_LANES 8
+#define VECTOR_ALIGNMENT 16
+
+
+namespace Rendering
+{
+
+// Adds samples * weights onto the accumulators, lane by lane.
+// This is the reference the vectorised version has to match bit for bit.
+// The caller has to make sure the results stay inside of 16 bits, 
+// the PIE version saturates where this one wraps around.
+inline void multiply_accumulate_scalar(int16_t* accumulators, const int16_t* samples, const int16_t* weights, uint16_t count)
+{
+  for (uint16_t lane = 0; lane < count; lane++)
+    accumulators[lane] = (int16_t)(accumulators[lane] + samples[lane] * weights[lane]);
+}
+
+// Same as multiply_accumulate_scalar(), a whole vector at a time.
+// count has to be a multiple of VECTOR_LANES and all buffers have to be aligned.
+inline void multiply_accumulate(int16_t* accumulators, const int16_t* samples, const int16_t* weights, uint16_t count)
+{
+#ifdef VECTOR_MATH_PIE
+  for (uint16_t lane = 0; lane < count; lane += VECTOR_LANES)
+  {
+    // vmul shifts the products right by SAR, they already fit, so don't shift at all.
+    // SAR gets set every time, since the compiler is free to use it in between.
+    asm volatile (
+      "wsr.sar %[zero] \n"
+      "ee.vld.128.ip q0, %[samples], 16 \n"
+      "ee.vld.128.ip q1, %[weights], 16 \n"
+      "ee.vld.128.ip q2, %[accumulators], 0 \n"
+      "ee.vmul.s16 q0, q0, q1 \n"
+      "ee.vadds.s16 q2, q2, q0 \n"
+      "ee.vst.128.ip q2, %[accumulators], 16 \n"
+      : [samples] "+r" (samples), [weights] "+r" (weights), [accumulators] "+r" (accumulators)
+      : [zero] "r" (0)
+      : "memory"
+    );
+  }
+#else
+  // Let the compiler map this onto whatever vector unit the target has.
+  // This is what the host runs, the PIE version only ever runs on the chip.
+  typedef int16_t lanes_t __attribute__((vector_size(VECTOR_ALIGNMENT)));
+
+  for (uint16_t lane = 0; lane < count; lane += VECTOR_LANES)
+  {
+    lanes_t sample, weight, accumulator;
+
+    memcpy(&sample, samples + lane, sizeof(lanes_t));
+    memcpy(&weight, weights + lane, sizeof(lanes_t));
+    memcpy(&accumulator, accumulators + lane, sizeof(lanes_t));
+
+    accumulator += sample * weight;
+
+    memcpy(accumulators + lane, &accumulator, sizeof(lanes_t));
+  }
+#endif
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * @file speed_link.hpp
+ * @authors mia
+ * @brief Exchanges the speed and the power with the motor controller over UDP.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.hpp"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "Wireless/speed_protocol.hpp"
+#include "Rendering/rendering.hpp"
+
+
+namespace Wireless
+{
+
+// For some reason we have to multiply the delay with this magic:tm:
+// number or else it won't work...
+// This was determined using non-scientific testing that we
+// aren't proud of.
+#define MAGIC_VALUE_TM 0.75
+
+// The motor controller finds the display with a broadcast, the answers go
+// to wherever its messages came from. Whatever the motor controller reports
+// gets passed on to the renderer right away, with the pulse time in the local
+// clock, so the renderer can extrapolate the period to when it needs it.
+class SpeedLink
+{
+private:
+    Rendering::Renderer* _renderer;
+    SpeedSocket _socket;
+    LinkState _link;
+    // Only touched by the link task, the renderer gets copies.
+    Rendering::PeriodTracker _motor_speed;
+    TaskHandle_t _link_task = NULL;
+
+    std::atomic<uint8_t> _target_power { 0 };
+    std::atomic<uint32_t> _rotation_period_us { 0 };
+    std::atomic<bool> _connected { false };
+    std::atomic<uint32_t> _round_trip_us { 0 };
+    std::atomic<uint32_t> _lost { 0 };
+
+    void _handle_speed(const SpeedMessage& message, int64_t receive_us);
+    void _send_power();
+    static void _link_loop(void *parameter);
+public:
+    SpeedLink(Rendering::Renderer *renderer);
+    void begin();
+
+    static uint32_t get_rotation_period_us(uint32_t pulse_period_us);
+
+    void set_target_power(uint8_t target_power) { _target_power = target_power; }
+    bool is_connected() { return _connected; }
+    unsigned long get_RPM();
+    uint32_t get_round_trip_us() { return _round_trip_us; }
+    uint32_t get_lost() { return _lost; }
+};
+
+}
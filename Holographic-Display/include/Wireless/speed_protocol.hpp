@@ -0,0 +1,290 @@
+/*
+ * @file speed_protocol.hpp
+ * @authors mia
+ * @brief The UDP protocol between the motor controller and the display, shared by both of them.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <lwip/sockets.h>
+#else
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+// Doesn't depend on anything but the sockets, so the motor controller and the
+// host tools include it straight from here. Nothing of either config.hpp is used.
+
+// Both ends listen on this port.
+#define SPEED_LINK_PORT 4210
+#define SPEED_LINK_MAGIC 0x4C53
+#define SPEED_LINK_VERSION 1
+// The type of a message:
+// Motor controller to display, with the speed of the motor.
+#define SPEED_MESSAGE_SPEED 1
+// Display to motor controller, with the power it should run at.
+#define SPEED_MESSAGE_POWER 2
+
+// The peer counts as gone once nothing came in for this long. (in μs)
+#define SPEED_LINK_TIMEOUT_US 500000
+// The clock offset is taken from the exchange with the shortest round trip
+// out of this many, the others were held up somewhere on the way.
+#define CLOCK_SYNC_SAMPLES 16
+
+
+namespace Wireless
+{
+
+// Starts every message. All values are little-endian, like both ESP32s.
+// The echo lets the peer measure the round trip and the offset of the clocks:
+// It's the send time of the last message received from the peer (in the peer's
+// clock), and how long it was held here before this one went out.
+struct __attribute__((packed)) LinkHeader
+{
+    uint16_t magic;
+    uint8_t version;
+    uint8_t type;
+    uint32_t sequence;
+    // In the clock of the sender.
+    int64_t send_time_us;
+    // 0 as long as nothing came in from the peer.
+    int64_t echo_time_us;
+    uint32_t echo_delay_us;
+};
+
+struct __attribute__((packed)) SpeedMessage
+{
+    LinkHeader header;
+    // The time between the last two pulses, 0 if the motor is standing still.
+    uint32_t pulse_period_us;
+    // When the last pulse came in, in the clock of the motor controller.
+    int64_t pulse_time_us;
+    // The power the motor is running at right now.
+    uint8_t power;
+};
+
+struct __attribute__((packed)) PowerMessage
+{
+    LinkHeader header;
+    uint8_t target_power;
+};
+
+static_assert(sizeof(LinkHeader) == 28, "The link header has a fixed size!");
+static_assert(sizeof(SpeedMessage) == 41, "The speed message has a fixed size!");
+static_assert(sizeof(PowerMessage) == 29, "The power message has a fixed size!");
+
+// NTP-style: half of the difference of the way there and back is the offset,
+// as long as both took the same time. The exchange with the shortest round trip
+// is the one that got held up the least, so the offset of that one is kept.
+class ClockSync
+{
+private:
+    struct Sample
+    {
+        int64_t offset_us;
+        int64_t round_trip_us;
+    };
+
+    Sample _samples[CLOCK_SYNC_SAMPLES];
+    uint8_t _sample_count = 0;
+    uint8_t _next_sample = 0;
+    int64_t _offset_us = 0;
+    int64_t _round_trip_us = 0;
+public:
+    // local_send_us is the echo, so the time this side sent the message the peer answered.
+    void update(int64_t local_send_us, uint32_t peer_delay_us, int64_t peer_send_us, int64_t local_receive_us)
+    {
+        int64_t round_trip_us = local_receive_us - local_send_us - peer_delay_us;
+
+        // The peer hasn't heard from us yet, or the echo is garbage.
+        if (local_send_us == 0 || round_trip_us < 0)
+            return;
+
+        _samples[_next_sample].offset_us = peer_send_us - (local_send_us + local_receive_us + peer_delay_us) / 2;
+        _samples[_next_sample].round_trip_us = round_trip_us;
+        _next_sample = (_next_sample + 1) % CLOCK_SYNC_SAMPLES;
+
+        if (_sample_count < CLOCK_SYNC_SAMPLES)
+            _sample_count++;
+
+        const Sample* best = &_samples[0];
+
+        for (uint8_t sample = 1; sample < _sample_count; sample++)
+        {
+            if (_samples[sample].round_trip_us < best->round_trip_us)
+                best = &_samples[sample];
+        }
+
+        _offset_us = best->offset_us;
+        _round_trip_us = best->round_trip_us;
+    }
+
+    void reset() { _sample_count = 0; _next_sample = 0; }
+    bool is_synced() const { return _sample_count > 0; }
+    // The clock of the peer minus the local one.
+    int64_t get_offset_us() const { return _offset_us; }
+    int64_t get_round_trip_us() const { return _round_trip_us; }
+    int64_t to_local(int64_t peer_time_us) const { return peer_time_us - _offset_us; }
+};
+
+// Numbers the messages going out, and checks the ones coming in. Anything
+// older than what already came in is dropped, the newest state always wins.
+class LinkState
+{
+private:
+    uint32_t _sequence = 0;
+    bool _received = false;
+    uint32_t _peer_sequence = 0;
+    int64_t _peer_send_us = 0;
+    int64_t _last_receive_us = 0;
+    uint32_t _lost = 0;
+    uint32_t _stale = 0;
+    ClockSync _clock;
+public:
+    void fill_header(LinkHeader& header, uint8_t type, int64_t now_us)
+    {
+        header.magic = SPEED_LINK_MAGIC;
+        header.version = SPEED_LINK_VERSION;
+        header.type = type;
+        header.sequence = _sequence++;
+        header.send_time_us = now_us;
+        header.echo_time_us = _received ? _peer_send_us : 0;
+        header.echo_delay_us = _received ? (uint32_t)(now_us - _last_receive_us) : 0;
+    }
+
+    // Returns false if the message should be ignored.
+    bool accept(const LinkHeader& header, uint8_t type, int64_t receive_us)
+    {
+        if (header.magic != SPEED_LINK_MAGIC || header.version != SPEED_LINK_VERSION || header.type != type)
+            return false;
+
+        // After a timeout the peer might have restarted, with its sequence from 0.
+        if (_received && !is_timed_out(receive_us))
+        {
+            int32_t gap = (int32_t)(header.sequence - _peer_sequence);
+
+            if (gap <= 0)
+            {
+                _stale++;
+                return false;
+            }
+
+            _lost += gap - 1;
+        }
+        else
+            _clock.reset();
+
+        _received = true;
+        _peer_sequence = header.sequence;
+        _peer_send_us = header.send_time_us;
+        _last_receive_us = receive_us;
+        _clock.update(header.echo_time_us, header.echo_delay_us, header.send_time_us, receive_us);
+        return true;
+    }
+
+    bool is_timed_out(int64_t now_us) const { return !_received || now_us - _last_receive_us > SPEED_LINK_TIMEOUT_US; }
+    int64_t get_last_receive_us() const { return _last_receive_us; }
+    uint32_t get_lost() const { return _lost; }
+    uint32_t get_stale() const { return _stale; }
+    const ClockSync& get_clock() const { return _clock; }
+};
+
+// A UDP socket that's never blocked on for longer than asked for.
+class SpeedSocket
+{
+private:
+    int _socket = -1;
+    sockaddr_in _peer = {};
+    sockaddr_in _sender = {};
+    bool _has_peer = false;
+public:
+    bool open(uint16_t port)
+    {
+        sockaddr_in address = {};
+        int enable = 1;
+
+        _socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+        if (_socket < 0)
+            return false;
+
+        setsockopt(_socket, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+        setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+
+        if (bind(_socket, (sockaddr*)&address, sizeof(address)) < 0)
+        {
+            close(_socket);
+            _socket = -1;
+            return false;
+        }
+
+        return true;
+    }
+
+    // The address in network order, like in_addr.
+    void set_peer(uint32_t address, uint16_t port)
+    {
+        _peer.sin_family = AF_INET;
+        _peer.sin_addr.s_addr = address;
+        _peer.sin_port = htons(port);
+        _has_peer = true;
+    }
+
+    bool is_open() const { return _socket >= 0; }
+    bool has_peer() const { return _has_peer; }
+
+    bool send(const void* message, size_t length)
+    {
+        if (_socket < 0 || !_has_peer)
+            return false;
+
+        return sendto(_socket, message, length, 0, (sockaddr*)&_peer, sizeof(_peer)) == (ssize_t)length;
+    }
+
+    // Whoever sent the last message is where the next ones go.
+    void answer_sender()
+    {
+        _peer = _sender;
+        _has_peer = true;
+    }
+
+    // Waits for up to the timeout, returns the length of the message or 0 if there was none.
+    size_t receive(void* buffer, size_t size, uint32_t timeout_us)
+    {
+        fd_set sockets;
+        timeval timeout;
+        socklen_t sender_length = sizeof(_sender);
+
+        if (_socket < 0)
+            return 0;
+
+        FD_ZERO(&sockets);
+        FD_SET(_socket, &sockets);
+        timeout.tv_sec = timeout_us / 1000000;
+        timeout.tv_usec = timeout_us % 1000000;
+
+        if (select(_socket + 1, &sockets, NULL, NULL, &timeout) <= 0)
+            return 0;
+
+        ssize_t length = recvfrom(_socket, buffer, size, 0, (sockaddr*)&_sender, &sender_length);
+
+        return length > 0 ? length : 0;
+    }
+};
+
+}
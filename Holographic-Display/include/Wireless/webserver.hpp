@@ -23,10 +23,12 @@
 #include "esp_log.h"
 #include "esp_task_wdt.h"
 #include "Rendering/rendering.hpp"
+#include "Rendering/frame_decoder.hpp"
+#include "Rendering/animation_library.hpp"
+#include "Wireless/speed_link.hpp"
 
 #ifdef OTA_FIRMWARE
-#define ELEGANTOTA_USE_ASYNC_WEBSERVER 1
-
+// ElegantOTA needs ELEGANTOTA_USE_ASYNC_WEBSERVER in its own sources as well, it's set in the platformio.ini.
 #include <ElegantOTA.h>
 #endif
 
@@ -34,36 +36,100 @@
 namespace Wireless
 {
 
-#define MSS 1500
+// One control of the UI, named like the inputs of the form: 's' and 2 is slider s2.
+// Levers are 0 or 1, everything else is the value of the input.
+struct __attribute__((packed)) ControlRecord
+{
+    char type;
+    uint8_t index;
+    int32_t value;
+};
+
+// Flags of the ControlState.
+#define CONTROL_FLAG_MOTOR_ENABLED (1 << 0)
+#define CONTROL_FLAG_RENDERER_ENABLED (1 << 1)
+#define CONTROL_FLAG_DMO_MODE (1 << 2)
+#define CONTROL_FLAG_ANTI_ALIASING (1 << 3)
+#define CONTROL_FLAG_CAN_UPLOAD (1 << 4)
+#define CONTROL_FLAG_PLL_LOCKED (1 << 5)
+#define CONTROL_FLAG_STREAMING (1 << 6)
+#define CONTROL_FLAG_LIVE (1 << 7)
 
-// For some reason we have to multiply the delay with this magic:tm:
-// number or else it won't work... 
-// This was determined using non-scientific testing that we
-// aren't proud of. 
-#define MAGIC_VALUE_TM 0.75
+// Everything the UI shows, in a single message. Little-endian, like the ESP32 itself.
+struct __attribute__((packed)) ControlState
+{
+    uint8_t type = CONTROL_MESSAGE_STATE;
+    uint8_t flags;
+    uint16_t rpm;
+    uint16_t angles_per_rotation;
+    // In tenths of a frame per second.
+    uint16_t frame_rate;
+    uint32_t spi_overruns;
+    uint32_t stream_underruns;
+    // The controls, the way the UI sends them.
+    uint8_t motor_power;
+    uint8_t brightness;
+    int16_t red_color_adjust;
+    int16_t green_color_adjust;
+    int16_t blue_color_adjust;
+    uint16_t offset;
+    // In tenths.
+    uint8_t gamma;
+    // 0 if it's picked automatically.
+    uint16_t angles_mode;
+};
+
+// The UI reads them at fixed offsets.
+static_assert(sizeof(ControlRecord) == 6, "The control records have a fixed size!");
+static_assert(sizeof(ControlState) == 29, "The control state has a fixed size!");
 
 class WebServer
 {
 private:
     AsyncWebServer _server;
     Rendering::Renderer* _renderer;
+    Rendering::AnimationLibrary* _library;
+    // The power goes out over it, and the speed comes in.
+    SpeedLink* _speed_link;
     
     uint16_t _target_power = 0;
+    // The motor power as the UI set it, in percent.
+    uint8_t _motor_power = 0;
     bool _motor_enabled = true;
+    bool _renderer_enabled = true;
     uint8_t _led_brightness = 50;
     uint16_t _current_RPM = 0;
     uint8_t _next_upload_print = 0;
     bool _can_upload = true;
     bool _dmo_mode = true;
-    uint8_t _frame_buffer[IMAGE_SIZE_BYTES + MSS];
-    uint16_t _frame_buffer_index = 0;
-    uint8_t _frame_counter = 0;
+    Rendering::FrameDecoder _upload_decoder;
+    // Uploads to /upload?name=... go to the library instead of replacing the data file.
+    char _upload_name[LIBRARY_NAME_LENGTH] = "";
+    bool _upload_name_invalid = false;
 
-    TaskHandle_t _OTA_loop_task = NULL;
-    
+    // Only a single client can send live frames at a time, they get collected
+    // here until the whole message is in.
+    AsyncWebSocket _live_socket;
+    uint32_t _live_client = 0;
+    uint8_t* _live_message = NULL;
+    size_t _live_message_size = 0;
+
+    // The UIs get the state pushed by the telemetry task, the last one sent
+    // is kept so nothing gets sent while it stays the same.
+    AsyncWebSocket _control_socket;
+    ControlState _sent_state = {};
+    TaskHandle_t _telemetry_task = NULL;
+
+#ifdef RENDER_METRICS
+    // The time the webserver spent on uploads and live frames, on the network core.
+    Rendering::TaskLoad _network_load;
+#endif
 
 #ifdef OTA_FIRMWARE
+    TaskHandle_t _OTA_loop_task = NULL;
+
     void _begin_OTA();
+    static void _OTA_loop(void *parameter);
 #endif
 
 #ifdef MDNS_HOSTNAME
@@ -71,12 +137,27 @@ private:
 #endif
     
     void _setup_webserver_tree();
+
+#ifdef RENDER_METRICS
+    void _send_metrics(AsyncWebServerRequest *request);
+    void _print_histogram(AsyncResponseStream *response, const char* name, const char* help, const Rendering::Histogram& histogram);
+    void _print_histogram_json(AsyncResponseStream *response, const char* name, const Rendering::Histogram& histogram);
+    void _print_task_load(AsyncResponseStream *response, bool json, const char* task, uint8_t core, const Rendering::TaskLoad& load);
+#endif
     
-    void _handle_input(const AsyncWebParameter* parameter);
+    void _send_library(AsyncWebServerRequest *request);
+    void _handle_live_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
+    void _handle_control_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
+    void _handle_input(const AsyncWebParameter* parameter, Rendering::Options& options);
+    void _apply_control(char type, uint8_t index, int32_t value, Rendering::Options& options);
+    void _get_state(ControlState& state);
+    static void _telemetry_loop(void *parameter);
+    void _handle_upload(AsyncWebServerRequest *request, size_t index, uint8_t *data, size_t len, bool final);
+    unsigned long _get_measured_RPM();
     String _format_bytes(const size_t bytes);
 public:
 
-    WebServer(uint16_t port, Rendering::Renderer *renderer);
+    WebServer(uint16_t port, Rendering::Renderer *renderer, Rendering::AnimationLibrary *library, SpeedLink *speed_link);
     void begin();
 };
 
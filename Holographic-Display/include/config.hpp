@@ -14,12 +14,50 @@
 
 #define TAG ""
 
-// The amount of angles the image will be cut into.
+// The default amount of angles the image will be cut into.
+// This is also the resolution pre-polarized frames are stored in.
 #define ANGLES_PER_ROTATION 360
 
+// The highest amount of angles the image can be cut into. The pixel offset table 
+// is generated on the device for this resolution, so every supported resolution 
+// has to divide it evenly.
+#define MAX_ANGLES_PER_ROTATION 720
+
+// The resolutions the renderer can switch between, from lowest to highest.
+#define SUPPORTED_ANGLES_PER_ROTATION { 120, 180, 240, 360, 720 }
+
+// The rotation period that is assumed while the motor is standing still. (in μs)
+#define IDLE_ROTATION_PERIOD_US 1800000
+
 // The amount of LEDs on each strip.
 #define LEDS_PER_SIDE 64
 
+// The amount of LEDs on the whole strip, which spans both arms.
+#define LEDS_PER_SLICE (LEDS_PER_SIDE * 2)
+
+// Every slice shows a full diameter, so after half a rotation the same
+// diameters come around again, just mirrored. 
+#define SLICES_PER_HALF_ROTATION (ANGLES_PER_ROTATION / 2)
+
+// The pixel offset lookup table only stores half of the highest resolution.
+#define PIXEL_OFFSET_ROWS (MAX_ANGLES_PER_ROTATION / 2)
+
+// The size of the pixel offset lookup table in bytes.
+#define PIXEL_OFFSETS_SIZE_BYTES (PIXEL_OFFSET_ROWS * LEDS_PER_SLICE * sizeof(uint16_t))
+
+// The amount of pixels every LED blends together with anti-aliasing enabled.
+// The footprint of an LED is about one pixel wide in both directions at the 
+// outer edge, so it can touch up to 4 of them.
+#define AA_TAPS 4
+
+// The footprint of every LED gets sampled on a grid with this many points 
+// per side, to figure out how much of each pixel it covers.
+#define AA_SUBSAMPLES 8
+
+// The anti-aliasing weights are fixed point numbers with this many fractional bits.
+// The weights of a single LED always add up to exactly 1 << AA_WEIGHT_BITS.
+#define AA_WEIGHT_BITS 7
+
 // The data pin the LEDs are connected to
 #define LED_DATA_PIN 7
 #define LED_CLOCK_PIN 4
@@ -27,6 +65,38 @@
 // The data pin the HAL sensor is connected to
 #define HAL_PIN 20
 
+// The angle of the image the strip is at when the HAL sensor triggers. (in degrees)
+#define HAL_SENSOR_ANGLE 180
+
+// The rotation periods the PLL is able to lock onto. (in μs)
+// 10ms -> 6000 RPM, 2s -> 30 RPM
+#define PLL_MIN_PERIOD_US 10000
+#define PLL_MAX_PERIOD_US 2000000
+
+// HAL edges that come sooner than this part of the predicted period 
+// are treated as glitches and ignored. (in %)
+#define PLL_GLITCH_PERCENT 50
+
+// Edges that are off from the prediction by more than this part of the 
+// period make the PLL start over. (in %)
+#define PLL_MAX_ERROR_PERCENT 25
+
+// How strongly the phase and period follow the measured edges.
+// The error gets divided by 2^shift, so bigger values filter more jitter.
+#define PLL_PHASE_GAIN_SHIFT 2
+#define PLL_PERIOD_GAIN_SHIFT 4
+
+// The amount of edges in a row that have to match the prediction,
+// before the PLL counts as locked.
+#define PLL_LOCK_EDGES 3
+
+// Frames only get switched between rotations, the animation keeps its own timeline.
+// If that's further behind than this, it starts over from the current rotation
+// instead of racing through the frames it missed. (in ms)
+#define FRAME_TIMELINE_MAX_LAG_MS 500
+// The effective frame rate gets measured over this long. (in ms)
+#define FRAME_RATE_WINDOW_MS 1000
+
 // Defines the width/height of the image to create.
 // This is equal to the number of LED's per strip times 2.
 #define IMAGE_LENGTH_PIXELS (LEDS_PER_SIDE * 2)
@@ -35,24 +105,117 @@
 // The image size in pixels.
 #define IMAGE_SIZE_PIXELS (IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS)
 
-// Defines the max number of frames that can be loaded. 
-// The PSRAM size is 8MB! Yes, MB, not MiB. 
-// That means we can store up to 8.000.000 Bytes.
-// 8.000.000/(128*128*3) = 162.76
-// Therefore we can store up to 162 Images in the PSRAM.
-#define MAX_FRAMES 162
+// The frames get all of the PSRAM, except for this much. That leaves room for the
+// anti-aliasing table (~720KB) and the buffers frames are converted in. (in bytes)
+// The PSRAM size is 8MB! Yes, MB, not MiB. So that's 7.000.000 bytes of frames.
+// Cartesian frames only store the ~12.900 pixels inside of the disc:
+// 7.000.000/(12943*3) = 180 RGB frames or
+// 7.000.000/(12943 + 256*3) = 510 indexed frames.
+#define FRAME_MEMORY_RESERVE_BYTES (1000 * 1000)
+
+// Cartesian frames store every pixel the LEDs can reach, nothing in the corners.
+// Anti-aliasing reaches half a pixel further out than the outermost LED, and that 
+// can still round to the pixel diagonally next to it. (in pixels)
+#define SPARSE_PIXEL_RADIUS (LEDS_PER_SIDE - 0.5 + 0.7072)
+
+// Marks pixels of the image that aren't stored at all.
+#define SPARSE_NO_PIXEL 0xFFFF
+
+// Pre-polarized frames store one contiguous diameter for every slice of the first 
+// half rotation, so they take a bit more space than the cartesian image.
+#define POLAR_FRAME_SIZE_PIXELS (SLICES_PER_HALF_ROTATION * LEDS_PER_SLICE)
+#define POLAR_FRAME_SIZE_BYTES (POLAR_FRAME_SIZE_PIXELS * sizeof(RGB))
+
+// Indexed frames store a single byte per pixel, which picks one of the 256 colors
+// of the palette that comes with the frame.
+#define PALETTE_SIZE_BYTES (256 * sizeof(RGB))
+#define INDEXED_IMAGE_SIZE_BYTES IMAGE_SIZE_PIXELS
+
+// The size of a single frame record inside of the data file / upload.
+// (2 bytes of delay followed by the raw image)
+#define FRAME_RECORD_SIZE_BYTES (IMAGE_SIZE_BYTES + 2)
+
+// Indexed data files / uploads start with a header instead:
+// The magic, a version byte, a flags byte and the frame count. (2 bytes)
+// Every frame record is 2 bytes of delay, the palette and then the indices.
+#define INDEXED_MAGIC "HIDX"
+#define INDEXED_VERSION 1
+#define INDEXED_HEADER_SIZE_BYTES 8
+// If this flag is set, a single palette follows the header and the
+// frame records only contain the delay and the indices.
+#define INDEXED_GLOBAL_PALETTE 0x01
 
-#define IMAGE_DATA_SIZE (MAX_FRAMES * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS * sizeof(RGB))
 // Defines the most current image that has been uploaded from the website.
 #define IMAGE_DATA_NAME "/data.bin"
 
+// Named animations live in this directory, one data file each: LIBRARY_DIRECTORY/<name>.bin
+#define LIBRARY_DIRECTORY "/library"
+// Lists the animations of the library, one per line:
+// The name, the frame count, the size of the file and the size of the frames in memory.
+#define LIBRARY_INDEX_NAME "/library/index.txt"
+// Names only consist of letters, digits, '-' and '_', including the terminating 0.
+#define LIBRARY_NAME_LENGTH 24
+#define LIBRARY_MAX_ANIMATIONS 32
+// Animations stay in the frame memory after they were shown, so switching back to them
+// doesn't have to read the flash. The one shown the longest time ago makes room first.
+#define LIBRARY_MAX_RESIDENT 8
+#define PLAYLIST_MAX_ENTRIES 16
+// How often the scheduler checks if the next animation of the playlist is due. (in ms)
+#define PLAYLIST_TICK_MS 20
+// Uploads hold the playlist off, in case one breaks off it resumes after this long without data. (in ms)
+#define LIBRARY_HOLD_TIMEOUT_MS 5000
+
+// Animations with more frames than fit into the PSRAM get streamed from the flash.
+// Reading the flash stalls the cache of both cores, so the loader only reads this 
+// much at once, to keep the render task from missing slices. (in bytes)
+#define STREAM_READ_CHUNK_BYTES 4096
+
+// Patches change the pixels of a frame in memory, without touching the data file.
+// They are a sequence of operations, the pixels in the format of the frames
+// (3 bytes of RGB, or a palette index for indexed frames) and positions in image pixels.
+// A rectangle: x, y, width and height (1 byte each), followed by its pixels row by row.
+#define PATCH_RECT 0
+// A run: the offset of the first pixel and the count (2 bytes each), followed by
+// a single pixel that all of them get set to. Runs continue on the next row.
+#define PATCH_RUN 1
+// Anything bigger should just be uploaded as a whole new frame. (in bytes)
+#define PATCH_MAX_SIZE_BYTES 16384
+
+// Live frames come in over this WebSocket, one binary message per frame.
+// They replace the animation until the client disconnects.
+#define LIVE_SOCKET_PATH "/live"
+// The first byte of every message is the format of the frame:
+// The raw image, like a frame record without the delay.
+#define LIVE_FORMAT_RGB 0
+// The sparse pixels, encoded like the frames of a container.
+// Everything but the first frame may refer to the previous one.
+#define LIVE_FORMAT_CODEC 1
+#define LIVE_MESSAGE_MAX_BYTES (1 + IMAGE_SIZE_BYTES)
+// Live frames take the first few slots of the frame memory: The one on display,
+// the newest complete one and the one being received. Anything older gets dropped.
+#define LIVE_RING_SIZE 3
+
+// The web UI sends its controls and gets the state of the display over this WebSocket.
+// Every binary message from the UI is a run of ControlRecords, one per changed control.
+#define CONTROL_SOCKET_PATH "/control"
+// How often the state gets pushed to the UIs, only if anything changed. (in ms)
+#define TELEMETRY_INTERVAL_MS 250
+// Anything above this many UIs drops the oldest connection.
+#define CONTROL_MAX_CLIENTS 4
+// The first byte of every message to the UI is its type:
+// A ControlState with the telemetry and the current value of every control.
+#define CONTROL_MESSAGE_STATE 1
+
+// The motor controller sends its speed and gets the power over UDP, see speed_protocol.hpp.
+// How often the power goes out, as long as the motor controller is there. (in ms)
+#define SPEED_LINK_INTERVAL_MS 20
+
 // Define this for Over-The-Air sketch/firmware updates.
 // - - - - - - WARNING - - - - - - 
 // If you disable this, then all OTA Updates will be non-functional.
 // Manual reupload with this variable defined is needed to enable OTA again!
 #define OTA_FIRMWARE
-// Make sure to add this this in the ElegantOTA.h file!!
-// #define ELEGANTOTA_USE_ASYNC_WEBSERVER 1
+// ElegantOTA gets built for the async webserver with ELEGANTOTA_USE_ASYNC_WEBSERVER in the platformio.ini.
 
 // Define to enable mDNS with the specified hostname. 
 #define MDNS_HOSTNAME "holo"
@@ -71,11 +234,54 @@
 // LED strip. (in MHz!)
 #define SPI_FREQUENCY 45
 
+// The size of the data for a single slice in bytes.
+// (4 bytes start frame, 4 bytes per LED, 4 bytes end frame)
+#define SLICE_BUFFER_SIZE_BYTES ((LEDS_PER_SLICE * 4) + 8)
+
+// The amount of DMA buffers the slices cycle through. This allows the next slice
+// to be prepared while the previous ones are still being clocked out.
+#define SLICE_BUFFER_COUNT 3
+
+// The time it takes to clock out a single slice. (in μs)
+#define SLICE_TRANSFER_TIME_US ((SLICE_BUFFER_SIZE_BYTES * 8) / SPI_FREQUENCY)
+
+// The time that is kept free on top of every slice for the timer ISR 
+// and the task switch. (in μs)
+#define SLICE_TIME_MARGIN_US 10
+
+// Define to start every slice with a one-shot alarm at the absolute time it's due, 
+// straight from the phase of the PLL, instead of a periodic timer. The alarm goes off
+// SLICE_TIME_MARGIN_US early and the render task waits out the rest, so how long the
+// task switch takes doesn't move the slice, and rounding the period doesn't add up.
+// #define SLICE_ONE_SHOT_TIMER
+
+// How much more time than needed a higher resolution has to leave per slice,
+// before the renderer switches up to it. (in %)
+#define RESOLUTION_HYSTERESIS_PERCENT 25
+
+// Define to record timing histograms of the render loop and serve them on /metrics.
+// Without it, all of the instrumentation gets compiled out.
+#define RENDER_METRICS
+
+// The clock the CPU runs at, used to turn cycle counts into μs. (in MHz)
+#define CPU_FREQUENCY_MHZ 240
+
 // Which of the cores on the ESP the specific tasks are supposed to run on.
-#define RENDERER_CORE 0
+// The render task gets a core of its own, and so do the timer and HAL ISRs, 
+// which are allocated on the core the render task runs on.
+#define RENDERER_CORE 1
+// WiFi, lwIP and mDNS run on core 0 by default, the webserver is pinned there
+// as well with CONFIG_ASYNC_TCP_RUNNING_CORE in the platformio.ini.
+#define NETWORK_CORE 0
+// The loader streaming frames from the flash stays out of the way of the renderer.
+// Writing the flash still stalls both cores, there's nothing a core of its own can do about that.
+#define FRAME_LOADER_CORE NETWORK_CORE
 // #define CONFIG_ESP32_WIFI_TASK_PINNED_TO_CORE_1 0
 // #define CONFIG_MDNS_TASK_AFFINITY 1
 
+// Over how long the time the tasks spend working is averaged into their load. (in ms)
+#define TASK_LOAD_WINDOW_MS 1000
+
 // #define configTICK_RATE_HZ 100
 // #define configUSE_PREEMPTION 1
 
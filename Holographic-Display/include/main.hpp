@@ -16,9 +16,14 @@
 #include "config.hpp"
 #include "Wireless/webserver.hpp"
 #include "Wireless/wifimanager.hpp"
+#include "Wireless/speed_link.hpp"
 #include "Rendering/rendering.hpp"
+#include "Rendering/animation_library.hpp"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 Rendering::Renderer renderer;
-Wireless::WebServer server(WEBSERVER_PORT, &renderer);
+Rendering::AnimationLibrary library(&renderer);
+Wireless::SpeedLink speed_link(&renderer);
+Wireless::WebServer server(WEBSERVER_PORT, &renderer, &library, &speed_link);
 Wireless::WifiManager wifimanager;
\ No newline at end of file
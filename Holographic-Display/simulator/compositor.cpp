@@ -0,0 +1,186 @@
+/*
+ * @file compositor.cpp
+ * @authors mia
+ * @brief Reconstructs the image a viewer perceives from the slices the renderer sent out.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "compositor.hpp"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+
+namespace Simulator
+{
+
+Compositor::Compositor(uint16_t size, std::function<double(int64_t)> get_angle, int64_t start_us)
+  : _size(size), _get_angle(get_angle), _start_us(start_us),
+    _color_time(size * size * 3, 0.0), _time(size * size, 0.0) {}
+
+// Takes the raw SPI data of a slice, which the LEDs show from the given time on.
+void Compositor::add_slice(const uint8_t* slice, size_t length, int64_t time_us)
+{
+  if (length != SLICE_BUFFER_SIZE_BYTES)
+    return;
+
+  if (_previous_time_us >= _start_us)
+    _sweep_slice(_previous_slice, _previous_time_us, time_us);
+
+  memcpy(_previous_slice, slice, SLICE_BUFFER_SIZE_BYTES);
+  _previous_time_us = time_us;
+}
+
+void Compositor::_sweep_slice(const uint8_t* slice, int64_t start_us, int64_t end_us)
+{
+  double scale = (double)_size / IMAGE_LENGTH_PIXELS;
+  double start_angle = _get_angle(start_us);
+  double end_angle = _get_angle(end_us);
+
+  // Small enough steps that the outermost LED never skips over an output pixel.
+  double step_angle = 0.5 / ((LEDS_PER_SIDE - 0.5) * scale) * 180.0 / M_PI;
+  uint32_t steps = std::min(std::max((uint32_t)ceil((end_angle - start_angle) / step_angle), (uint32_t)1), (uint32_t)20000);
+  double step_time = (double)(end_us - start_us) / steps;
+
+  // Every LED covers a whole pixel of the image in the radial direction.
+  uint8_t radial_steps = std::max((uint8_t)ceil(scale), (uint8_t)1);
+
+  for (uint32_t step = 0; step < steps; step++)
+  {
+    double angle = start_angle + (end_angle - start_angle) * (step + 0.5) / steps;
+    double theta = angle * M_PI / 180.0;
+    double cos_theta = cos(theta), sin_theta = sin(theta);
+
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+    {
+      const uint8_t* led = slice + 4 + led_index * 4;
+
+      // A brightness of 0 means the LEDs are turned off.
+      if ((led[0] & 0x1F) == 0)
+        continue;
+
+      // Same layout as the renderer, the first arm from the outer edge inwards,
+      // the second one from the center outwards on the opposite side.
+      double radius = led_index < LEDS_PER_SIDE ?
+        LEDS_PER_SIDE - led_index - 1 : -(double)(led_index - LEDS_PER_SIDE);
+
+      for (uint8_t radial_step = 0; radial_step < radial_steps; radial_step++)
+      {
+        double sample_radius = radius + ((radial_step + 0.5) / radial_steps - 0.5) * (radius < 0 ? -1 : 1);
+
+        // The renderer reads pixel (IMAGE_LENGTH_PIXELS - x, y) for a point (x, y).
+        double x = LEDS_PER_SIDE + sample_radius * cos_theta;
+        double y = LEDS_PER_SIDE + sample_radius * sin_theta;
+        int output_x = (int)floor((IMAGE_LENGTH_PIXELS - x + 0.5) * scale);
+        int output_y = (int)floor((y + 0.5) * scale);
+
+        if (output_x < 0 || output_y < 0 || output_x >= _size || output_y >= _size)
+          continue;
+
+        uint32_t pixel = output_y * _size + output_x;
+
+        _color_time[pixel * 3] += led[3] * step_time;
+        _color_time[pixel * 3 + 1] += led[2] * step_time;
+        _color_time[pixel * 3 + 2] += led[1] * step_time;
+        _time[pixel] += step_time;
+      }
+    }
+  }
+}
+
+// The average color the pixel had while the strip was over it, black if it never was.
+RGB Compositor::get_pixel(uint16_t x, uint16_t y)
+{
+  uint32_t pixel = y * _size + x;
+  double time = _time[pixel];
+
+  if (time <= 0)
+    return RGB::Black;
+
+  return RGB(
+    (uint8_t)round(_color_time[pixel * 3] / time),
+    (uint8_t)round(_color_time[pixel * 3 + 1] / time),
+    (uint8_t)round(_color_time[pixel * 3 + 2] / time)
+  );
+}
+
+bool Compositor::write_ppm(const std::string& path)
+{
+  FILE* file = fopen(path.c_str(), "wb");
+
+  if (file == NULL)
+    return false;
+
+  fprintf(file, "P6\n%d %d\n255\n", _size, _size);
+
+  for (uint16_t y = 0; y < _size; y++)
+  {
+    for (uint16_t x = 0; x < _size; x++)
+    {
+      RGB color = get_pixel(x, y);
+      uint8_t bytes[3] = { color.r, color.g, color.b };
+
+      fwrite(bytes, 1, 3, file);
+    }
+  }
+
+  fclose(file);
+  return true;
+}
+
+// Compares every pixel of the source image inside of the disc
+// against the average of the output pixels covering it.
+double Compositor::get_psnr(const RGB* reference)
+{
+  uint16_t block = _size / IMAGE_LENGTH_PIXELS;
+  double squared_error = 0;
+  uint32_t samples = 0;
+
+  for (uint16_t y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+  {
+    for (uint16_t column = 0; column < IMAGE_LENGTH_PIXELS; column++)
+    {
+      double dx = (IMAGE_LENGTH_PIXELS - column) - LEDS_PER_SIDE, dy = y - LEDS_PER_SIDE;
+
+      if (dx * dx + dy * dy > (LEDS_PER_SIDE - 1) * (LEDS_PER_SIDE - 1))
+        continue;
+
+      double color[3] = { 0, 0, 0 }, time = 0;
+
+      for (uint16_t output_y = y * block; output_y < (y + 1) * block; output_y++)
+      {
+        for (uint16_t output_x = column * block; output_x < (column + 1) * block; output_x++)
+        {
+          uint32_t pixel = output_y * _size + output_x;
+
+          for (uint8_t channel = 0; channel < 3; channel++)
+            color[channel] += _color_time[pixel * 3 + channel];
+
+          time += _time[pixel];
+        }
+      }
+
+      const RGB& expected = reference[y * IMAGE_LENGTH_PIXELS + column];
+      double expected_color[3] = { (double)expected.r, (double)expected.g, (double)expected.b };
+
+      for (uint8_t channel = 0; channel < 3; channel++)
+      {
+        double error = (time > 0 ? color[channel] / time : 0) - expected_color[channel];
+        squared_error += error * error;
+      }
+
+      samples += 3;
+    }
+  }
+
+  if (samples == 0 || squared_error == 0)
+    return INFINITY;
+
+  return 10.0 * log10(255.0 * 255.0 / (squared_error / samples));
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * @file compositor.hpp
+ * @authors mia
+ * @brief Reconstructs the image a viewer perceives from the slices the renderer sent out.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <functional>
+#include "config.hpp"
+#include "Rendering/rgb.hpp"
+
+
+namespace Simulator
+{
+
+// The eye averages whatever the LEDs show while they sweep over a spot.
+// Every slice stays on the LEDs until the next one is latched, so it gets smeared
+// over the whole angle the strip turns through in the meantime.
+class Compositor
+{
+private:
+    uint16_t _size;
+    std::function<double(int64_t)> _get_angle;
+    // Only slices latched after this time end up in the image.
+    int64_t _start_us;
+
+    // The color of every output pixel, summed up over the time it was lit.
+    std::vector<double> _color_time;
+    std::vector<double> _time;
+
+    uint8_t _previous_slice[SLICE_BUFFER_SIZE_BYTES];
+    int64_t _previous_time_us = -1;
+
+    void _sweep_slice(const uint8_t* slice, int64_t start_us, int64_t end_us);
+public:
+    Compositor(uint16_t size, std::function<double(int64_t)> get_angle, int64_t start_us);
+
+    void add_slice(const uint8_t* slice, size_t length, int64_t time_us);
+    RGB get_pixel(uint16_t x, uint16_t y);
+    bool write_ppm(const std::string& path);
+    double get_psnr(const RGB* reference);
+};
+
+}
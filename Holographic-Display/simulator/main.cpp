@@ -0,0 +1,725 @@
+/*
+ * @file main.cpp
+ * @authors mia
+ * @brief Runs the renderer on the host against virtual hardware and reconstructs the perceived image.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Build and run it with PlatformIO:
+ *   pio run -e native && .pio/build/native/program --rpm 300:900 --output disc.ppm
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <random>
+#include <atomic>
+#include <algorithm>
+#include "Rendering/rendering.hpp"
+#include "Rendering/animation_library.hpp"
+#include "Rendering/frame_decoder.hpp"
+#include "virtual_hardware.hpp"
+#include "rotation_profile.hpp"
+#include "compositor.hpp"
+#include "upload_benchmark.hpp"
+
+using namespace Simulator;
+
+
+//  - - - - - - - - - - Options - - - - - - - - - -
+
+struct SimulatorOptions
+{
+    double start_rpm = 600;
+    double end_rpm = 600;
+    double seconds = 2.0;
+    // Nothing before this goes into the image, so the PLL has time to lock.
+    double warmup_seconds = 0.5;
+    int64_t jitter_us = 0;
+    // How much slower the ESP32-S3 runs the renderer than this machine.
+    // Just a rough guess, compare the Renderer-Benchmark on both to get a real one.
+    double cpu_scale = 20.0;
+    // Feed the speed of the motor controller too, like the webserver does.
+    bool motor_speed = true;
+    uint16_t angles_per_rotation = 0;
+    bool anti_aliasing = false;
+    // Upload the image as indexed frames, instead of RGB ones.
+    bool indexed = false;
+    uint16_t size = 512;
+    uint32_t seed = 1;
+    std::string image;
+    // Applied to the first frame halfway through the warmup, like the webserver does it.
+    std::string patch;
+    // Live frames per second sent over the live socket, a moving bar over the image.
+    double live_fps = 0;
+    // Animations of the library to play one after another, FILE:MS,FILE:MS,...
+    std::string playlist;
+    // Only benchmark loading the upload in chunks, nothing gets simulated.
+    bool upload_benchmark = false;
+    // Keep uploading the image from the network core the whole time.
+    bool upload_storm = false;
+    // Let the render task share its core with everything else, like before the tasks got pinned.
+    bool shared_core = false;
+    std::string output = "disc.ppm";
+};
+
+Rendering::Renderer renderer;
+Rendering::AnimationLibrary library(&renderer);
+
+// The chunks uploads come in, about a TCP segment each.
+#define STORM_CHUNK_BYTES 1436
+
+std::atomic<uint32_t> storm_uploads { 0 };
+
+//  - - - - - - - - - - Function Declarations - - - - - - - - - -
+
+void print_usage(const char* program);
+bool parse_options(int argc, char** argv, SimulatorOptions& options);
+std::vector<uint8_t> create_test_pattern();
+std::vector<uint8_t> create_indexed_upload(const std::vector<uint8_t>& record);
+std::vector<uint8_t> get_upload(const SimulatorOptions& options, const std::vector<uint8_t>& record);
+void run_upload_storm(void* parameter);
+bool load_reference(const std::string& path, std::vector<uint8_t>& record);
+bool read_file(const std::string& path, std::vector<uint8_t>& data);
+bool queue_playlist(const std::string& playlist);
+std::vector<uint8_t> create_live_frame(const std::vector<uint8_t>& record, uint32_t frame);
+void print_report(const SimulatorOptions& options, RotationProfile& profile, uint32_t slices, Compositor& compositor, const RGB* reference);
+
+//  - - - - - - - - - - Function Definitons - - - - - - - - - -
+
+int main(int argc, char** argv)
+{
+  SimulatorOptions options;
+
+  if (!parse_options(argc, argv, options))
+  {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  int64_t duration_us = (int64_t)(options.seconds * 1e6);
+  RotationProfile profile(options.start_rpm, options.end_rpm, duration_us);
+  std::mt19937 generator(options.seed);
+  std::vector<int64_t> edges = profile.get_sensor_edges(HAL_SENSOR_ANGLE, options.jitter_us, generator);
+
+  Compositor compositor(
+    options.size,
+    [&profile](int64_t time_us) { return profile.get_angle(time_us); },
+    (int64_t)(options.warmup_seconds * 1e6)
+  );
+  uint32_t slices = 0;
+
+  g_hardware.set_cpu_scale(options.cpu_scale);
+  g_hardware.set_shared_core(options.shared_core);
+  g_hardware.set_transfer_handler([&](const uint8_t* data, size_t length, int64_t time_us)
+  {
+    compositor.add_slice(data, length, time_us);
+    slices++;
+  });
+
+  // The image to show, with the delay of the frame in front, just like in the data file.
+  std::vector<uint8_t> record;
+
+  if (!options.image.empty())
+  {
+    if (!load_reference(options.image, record))
+    {
+      fprintf(stderr, "Couldn't read %s\n", options.image.c_str());
+      return 1;
+    }
+
+    LittleFS.map_file(IMAGE_DATA_NAME, options.image);
+  }
+  else
+  {
+    // Make sure nothing from the data directory gets picked up.
+    LittleFS.map_file(IMAGE_DATA_NAME, "");
+    record = create_test_pattern();
+  }
+
+  renderer.begin();
+  Rendering::Options render_options = renderer.get_options();
+
+  render_options.angles_per_rotation = options.angles_per_rotation;
+  renderer.set_options(render_options);
+  renderer.set_anti_aliasing(options.anti_aliasing);
+
+  // Upload the test pattern, the same way the webserver does it.
+  if (options.indexed)
+  {
+    std::vector<uint8_t> upload = create_indexed_upload(record);
+    size_t header_size = Rendering::Renderer::get_frame_header_size(upload.data(), upload.size());
+
+    renderer.prepare_frames(upload.data(), header_size, upload.size() - header_size);
+    renderer.update_frame(0, upload.data() + header_size);
+  }
+  else if (options.image.empty())
+  {
+    renderer.prepare_frames(record.data(), 0, record.size());
+    renderer.update_frame(0, record.data());
+  }
+
+  std::vector<uint8_t> upload = get_upload(options, record);
+
+  if (options.upload_benchmark)
+  {
+    bool matching = run_upload_benchmark(renderer, upload, options.seed);
+
+    fflush(stdout);
+    _Exit(matching ? 0 : 1);
+  }
+
+  if (!options.playlist.empty() && !queue_playlist(options.playlist))
+  {
+    fprintf(stderr, "Couldn't queue %s\n", options.playlist.c_str());
+    return 1;
+  }
+
+  std::vector<uint8_t> patch;
+
+  if (!options.patch.empty() && !read_file(options.patch, patch))
+  {
+    fprintf(stderr, "Couldn't read %s\n", options.patch.c_str());
+    return 1;
+  }
+
+  size_t next_edge = 0;
+  int64_t next_motor_update_us = 0;
+  Rendering::PeriodTracker motor_speed;
+  int64_t patch_us = patch.empty() ? INT64_MAX : (int64_t)(options.warmup_seconds * 1e6 / 2);
+  int64_t next_live_us = options.live_fps > 0 ? 0 : INT64_MAX;
+  uint32_t live_frame = 0;
+
+  if (options.live_fps > 0)
+    renderer.start_live();
+
+  // The same data that is on display already, so the image stays the same.
+  if (options.upload_storm)
+  {
+    TaskHandle_t storm_task;
+    xTaskCreatePinnedToCore(run_upload_storm, "Upload Storm", 4096, &upload, 1, &storm_task, NETWORK_CORE);
+  }
+
+  while (true)
+  {
+    int64_t edge_us = next_edge < edges.size() ? edges[next_edge] : INT64_MAX;
+    int64_t next_us = std::min(std::min(std::min(edge_us, next_motor_update_us), std::min(patch_us, next_live_us)), duration_us);
+
+    g_hardware.advance_to(next_us);
+
+    if (next_us == duration_us)
+      break;
+
+    if (next_us == edge_us)
+    {
+      g_hardware.trigger_hal();
+      next_edge++;
+    }
+
+    if (next_us == patch_us)
+    {
+      printf("Patch:           %s\n", renderer.patch_frame(0, patch.data(), patch.size()) ? "applied" : "rejected");
+      patch_us = INT64_MAX;
+    }
+
+    if (next_us == next_live_us)
+    {
+      std::vector<uint8_t> message = create_live_frame(record, live_frame++);
+
+      renderer.push_live_frame(message.data(), message.size());
+      next_live_us = (int64_t)(live_frame * 1e6 / options.live_fps);
+    }
+
+    if (next_us == next_motor_update_us)
+    {
+      double rpm = profile.get_rpm(next_us);
+
+      // Like the speed link does it, with the pulse right when the speed comes in.
+      if (options.motor_speed)
+      {
+        if (rpm >= 1.0)
+          motor_speed.update((uint32_t)(60e6 / rpm), next_us);
+        else
+          motor_speed.reset();
+
+        renderer.set_motor_speed(motor_speed);
+      }
+
+      // The motor controller reports its speed about this often.
+      next_motor_update_us += SPEED_LINK_INTERVAL_MS * 1000;
+    }
+  }
+
+  print_report(options, profile, slices, compositor, record.empty() ? NULL : (const RGB*)(record.data() + 2));
+
+  fflush(stdout);
+
+  // The display task is still blocked on its thread, so don't wait for anything.
+  _Exit(0);
+}
+
+void print_usage(const char* program)
+{
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  --rpm START[:END]      Speed, ramping linearly from START to END. (600)\n"
+    "  --seconds S            Simulated time. (2)\n"
+    "  --warmup S             Time before slices go into the image. (0.5)\n"
+    "  --jitter US            Random jitter on every HAL sensor edge. (0)\n"
+    "  --cpu-scale X          How much slower the target computes than the host. (20)\n"
+    "  --no-motor-speed       Only rely on the HAL sensor, not the motor controller.\n"
+    "  --resolution N         Slices per rotation, 0 picks them automatically. (0)\n"
+    "  --anti-aliasing        Turn on anti-aliased sampling.\n"
+    "  --indexed              Upload the image as indexed frames with a shared palette.\n"
+    "  --image FILE           Data file to show, a test pattern otherwise.\n"
+    "  --patch FILE           Patch to apply to the first frame during the warmup.\n"
+    "  --live FPS             Send live frames instead of showing the image. (0)\n"
+    "  --playlist F:MS,...    Play data files from the library one after another.\n"
+    "  --upload-benchmark     Load the upload in chunks of random size and exit.\n"
+    "  --upload-storm         Keep uploading the image from the network core.\n"
+    "  --shared-core          Count the time other threads take from the render task.\n"
+    "  --output FILE          Where to write the perceived image. (disc.ppm)\n"
+    "  --size N               Size of the perceived image, a multiple of %d. (512)\n"
+    "  --seed N               Seed for the jitter and the chunk sizes. (1)\n",
+    program, IMAGE_LENGTH_PIXELS
+  );
+}
+
+bool parse_options(int argc, char** argv, SimulatorOptions& options)
+{
+  for (int index = 1; index < argc; index++)
+  {
+    std::string name = argv[index];
+
+    // Flags without a value.
+    if (name == "--no-motor-speed")
+    {
+      options.motor_speed = false;
+      continue;
+    }
+    else if (name == "--anti-aliasing")
+    {
+      options.anti_aliasing = true;
+      continue;
+    }
+    else if (name == "--indexed")
+    {
+      options.indexed = true;
+      continue;
+    }
+    else if (name == "--upload-benchmark")
+    {
+      options.upload_benchmark = true;
+      continue;
+    }
+    else if (name == "--upload-storm")
+    {
+      options.upload_storm = true;
+      continue;
+    }
+    else if (name == "--shared-core")
+    {
+      options.shared_core = true;
+      continue;
+    }
+
+    if (index + 1 >= argc)
+      return false;
+
+    const char* value = argv[++index];
+
+    if (name == "--rpm")
+    {
+      options.start_rpm = options.end_rpm = atof(value);
+      const char* end = strchr(value, ':');
+
+      if (end != NULL)
+        options.end_rpm = atof(end + 1);
+    }
+    else if (name == "--seconds")
+      options.seconds = atof(value);
+    else if (name == "--warmup")
+      options.warmup_seconds = atof(value);
+    else if (name == "--jitter")
+      options.jitter_us = atoll(value);
+    else if (name == "--cpu-scale")
+      options.cpu_scale = atof(value);
+    else if (name == "--resolution")
+      options.angles_per_rotation = atoi(value);
+    else if (name == "--image")
+      options.image = value;
+    else if (name == "--patch")
+      options.patch = value;
+    else if (name == "--live")
+      options.live_fps = atof(value);
+    else if (name == "--playlist")
+      options.playlist = value;
+    else if (name == "--output")
+      options.output = value;
+    else if (name == "--size")
+      options.size = atoi(value);
+    else if (name == "--seed")
+      options.seed = atoi(value);
+    else
+      return false;
+  }
+
+  if (options.angles_per_rotation != 0
+    && !Rendering::Renderer::is_supported_angles_per_rotation(options.angles_per_rotation))
+  {
+    fprintf(stderr, "Unsupported resolution: %d\n", options.angles_per_rotation);
+    return false;
+  }
+
+  return options.seconds > 0 && options.size >= IMAGE_LENGTH_PIXELS
+    && options.size % IMAGE_LENGTH_PIXELS == 0;
+}
+
+// What the webserver would get for the image, the data file or the test pattern.
+std::vector<uint8_t> get_upload(const SimulatorOptions& options, const std::vector<uint8_t>& record)
+{
+  std::vector<uint8_t> upload = record;
+
+  if (!options.image.empty())
+    read_file(options.image, upload);
+  else if (options.indexed)
+    upload = create_indexed_upload(record);
+
+  return upload;
+}
+
+// Uploads one after another, in chunks like the webserver gets them, without a break in between.
+void run_upload_storm(void* parameter)
+{
+  const std::vector<uint8_t>& upload = *(const std::vector<uint8_t>*)parameter;
+  Rendering::FrameDecoder decoder(&renderer);
+
+  while (true)
+  {
+    renderer.stop_streaming();
+    decoder.begin(upload.size());
+
+    for (size_t offset = 0; offset < upload.size(); offset += STORM_CHUNK_BYTES)
+    {
+      size_t length = std::min(upload.size() - offset, (size_t)STORM_CHUNK_BYTES);
+      decoder.write(upload.data() + offset, length, offset + length == upload.size());
+    }
+
+    if (decoder.get_frame_count() > renderer.get_frame_capacity())
+      renderer.refresh_image();
+
+    storm_uploads++;
+
+    // Every upload takes back the one before, if the render task didn't get to it yet.
+    // Real ones never come in faster than a rotation, so let it take this one.
+    vTaskDelay(1);
+  }
+}
+
+// Adds the data files to the library under their file name, and queues them.
+// The index isn't kept around, the files stay where they are.
+bool queue_playlist(const std::string& playlist)
+{
+  LittleFS.map_file(LIBRARY_INDEX_NAME, "/dev/null");
+  library.begin();
+
+  for (size_t start = 0; start < playlist.size();)
+  {
+    size_t end = std::min(playlist.find(',', start), playlist.size());
+    std::string entry = playlist.substr(start, end - start);
+    size_t separator = entry.rfind(':');
+
+    start = end + 1;
+
+    if (separator == std::string::npos)
+      return false;
+
+    std::string path = entry.substr(0, separator);
+    std::string name = path.substr(path.rfind('/') + 1);
+    std::vector<uint8_t> data;
+
+    name = name.substr(0, name.find('.'));
+
+    if (!Rendering::AnimationLibrary::is_valid_name(name.c_str()) || !read_file(path, data))
+      return false;
+
+    LittleFS.map_file(LIBRARY_DIRECTORY "/" + name + ".bin", path);
+
+    if (!library.add(name.c_str(), 0, data.size(), 0) || !library.queue(name.c_str(), atoi(entry.c_str() + separator + 1)))
+      return false;
+  }
+
+  return true;
+}
+
+// A color wheel with white rings and black spokes, which shows timing errors
+// as bent spokes and aliasing as broken up rings.
+std::vector<uint8_t> create_test_pattern()
+{
+  std::vector<uint8_t> record(FRAME_RECORD_SIZE_BYTES, 0);
+  RGB* pixels = (RGB*)(record.data() + 2);
+
+  for (uint8_t y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+  {
+    for (uint8_t column = 0; column < IMAGE_LENGTH_PIXELS; column++)
+    {
+      double dx = (IMAGE_LENGTH_PIXELS - column) - LEDS_PER_SIDE, dy = y - LEDS_PER_SIDE;
+      double radius = sqrt(dx * dx + dy * dy);
+      double angle = atan2(dy, dx) * 180.0 / M_PI + 180.0;
+      double spoke_distance = fabs(fmod(angle + 22.5, 45.0) - 22.5) * M_PI / 180.0 * radius;
+      RGB& pixel = pixels[y * IMAGE_LENGTH_PIXELS + column];
+
+      if (radius > LEDS_PER_SIDE)
+        pixel = RGB::Black;
+      else if (fmod(radius + 1.0, 16.0) < 2.0)
+        pixel = RGB::White;
+      else if (spoke_distance < 1.0)
+        pixel = RGB::Black;
+      else
+      {
+        // Hue from the angle, fully saturated.
+        double hue = angle / 60.0;
+        double fraction = hue - floor(hue);
+        uint8_t rising = (uint8_t)(255 * fraction), falling = (uint8_t)(255 * (1.0 - fraction));
+
+        switch ((int)hue % 6)
+        {
+          case 0: pixel = RGB(255, rising, 0); break;
+          case 1: pixel = RGB(falling, 255, 0); break;
+          case 2: pixel = RGB(0, 255, rising); break;
+          case 3: pixel = RGB(0, falling, 255); break;
+          case 4: pixel = RGB(rising, 0, 255); break;
+          default: pixel = RGB(255, 0, falling); break;
+        }
+      }
+    }
+  }
+
+  return record;
+}
+
+// Turns an RGB frame record into an indexed upload with a shared palette.
+// Images with more than 256 colors get reduced to a 6x7x6 color cube.
+std::vector<uint8_t> create_indexed_upload(const std::vector<uint8_t>& record)
+{
+  const RGB* pixels = (const RGB*)(record.data() + 2);
+  std::map<uint32_t, uint8_t> colors;
+
+  for (uint32_t pixel = 0; pixel < IMAGE_SIZE_PIXELS && colors.size() <= 256; pixel++)
+    colors.emplace((pixels[pixel].r << 16) | (pixels[pixel].g << 8) | pixels[pixel].b, 0);
+
+  std::vector<uint8_t> upload(INDEXED_HEADER_SIZE_BYTES + PALETTE_SIZE_BYTES + 2 + INDEXED_IMAGE_SIZE_BYTES, 0);
+  Rendering::IndexedHeader* header = (Rendering::IndexedHeader*)upload.data();
+  RGB* palette = (RGB*)(upload.data() + INDEXED_HEADER_SIZE_BYTES);
+  uint8_t* frame = upload.data() + INDEXED_HEADER_SIZE_BYTES + PALETTE_SIZE_BYTES;
+
+  memcpy(header->magic, INDEXED_MAGIC, 4);
+  header->version = INDEXED_VERSION;
+  header->flags = INDEXED_GLOBAL_PALETTE;
+  header->frame_count = 1;
+
+  // Keep the delay of the frame.
+  memcpy(frame, record.data(), 2);
+
+  bool exact = colors.size() <= 256;
+
+  if (exact)
+  {
+    uint16_t index = 0;
+
+    for (auto& color : colors)
+    {
+      palette[index] = RGB(color.first >> 16, (color.first >> 8) & 0xFF, color.first & 0xFF);
+      color.second = index++;
+    }
+  }
+  else
+  {
+    for (uint16_t index = 0; index < 6 * 7 * 6; index++)
+      palette[index] = RGB(index / 42 * 51, index / 6 % 7 * 255 / 6, index % 6 * 51);
+  }
+
+  for (uint32_t pixel = 0; pixel < IMAGE_SIZE_PIXELS; pixel++)
+  {
+    const RGB& color = pixels[pixel];
+
+    frame[2 + pixel] = exact ?
+      colors[(color.r << 16) | (color.g << 8) | color.b] :
+      (color.r + 25) / 51 * 42 + (color.g * 6 + 127) / 255 * 6 + (color.b + 25) / 51;
+  }
+
+  printf("Indexed upload:  %s palette\n", exact ? "exact" : "6x7x6 color cube");
+
+  return upload;
+}
+
+// Reads the first frame of a data file, the perceived image gets compared against it.
+// Indexed frames get turned back into RGB ones.
+bool load_reference(const std::string& path, std::vector<uint8_t>& record)
+{
+  FILE* file = fopen(path.c_str(), "rb");
+
+  if (file == NULL)
+    return false;
+
+  // Big enough for everything up to the end of the first frame, whatever the format.
+  std::vector<uint8_t> data(INDEXED_HEADER_SIZE_BYTES + PALETTE_SIZE_BYTES + FRAME_RECORD_SIZE_BYTES);
+  size_t read = fread(data.data(), 1, data.size(), file);
+  fclose(file);
+
+  size_t header_size = Rendering::Renderer::get_frame_header_size(data.data(), read);
+
+  // Containers only store the sparse pixels, there is nothing to compare against.
+  if (read >= CONTAINER_HEADER_SIZE_BYTES && memcmp(data.data(), CONTAINER_MAGIC, 4) == 0)
+    return true;
+
+  record.resize(FRAME_RECORD_SIZE_BYTES);
+
+  if (header_size == 0)
+  {
+    memcpy(record.data(), data.data(), std::min(read, (size_t)FRAME_RECORD_SIZE_BYTES));
+    return read >= FRAME_RECORD_SIZE_BYTES;
+  }
+
+  bool shared_palette = header_size > INDEXED_HEADER_SIZE_BYTES;
+  const uint8_t* frame = data.data() + header_size;
+  const RGB* palette = shared_palette ? 
+    (const RGB*)(data.data() + INDEXED_HEADER_SIZE_BYTES) : (const RGB*)(frame + 2);
+  const uint8_t* indices = frame + 2 + (shared_palette ? 0 : PALETTE_SIZE_BYTES);
+
+  if (indices + INDEXED_IMAGE_SIZE_BYTES > data.data() + read)
+    return false;
+
+  memcpy(record.data(), frame, 2);
+
+  for (uint32_t pixel = 0; pixel < IMAGE_SIZE_PIXELS; pixel++)
+    ((RGB*)(record.data() + 2))[pixel] = palette[indices[pixel]];
+
+  return true;
+}
+
+// The image with a white bar moving across it, as a raw live frame.
+std::vector<uint8_t> create_live_frame(const std::vector<uint8_t>& record, uint32_t frame)
+{
+  std::vector<uint8_t> message(LIVE_MESSAGE_MAX_BYTES);
+  RGB* pixels = (RGB*)(message.data() + 1);
+  uint16_t column = frame * 4 % IMAGE_LENGTH_PIXELS;
+
+  message[0] = LIVE_FORMAT_RGB;
+  memcpy(pixels, record.data() + 2, IMAGE_SIZE_BYTES);
+
+  for (uint16_t row = 0; row < IMAGE_LENGTH_PIXELS; row++)
+    for (uint16_t x = column; x < column + 4; x++)
+      pixels[row * IMAGE_LENGTH_PIXELS + x] = RGB(255, 255, 255);
+
+  return message;
+}
+
+bool read_file(const std::string& path, std::vector<uint8_t>& data)
+{
+  FILE* file = fopen(path.c_str(), "rb");
+
+  if (file == NULL)
+    return false;
+
+  uint8_t buffer[4096];
+  size_t read;
+
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    data.insert(data.end(), buffer, buffer + read);
+
+  fclose(file);
+
+  return true;
+}
+
+#ifdef RENDER_METRICS
+void print_histogram(const char* name, const Rendering::Histogram& histogram)
+{
+  printf("%-17s%.1f μs on average, %lu μs at most\n", name,
+    histogram.get_count() > 0 ? (double)histogram.get_sum() / histogram.get_count() : 0.0,
+    (unsigned long)histogram.get_max());
+}
+#endif
+
+void print_report(const SimulatorOptions& options, RotationProfile& profile, uint32_t slices, Compositor& compositor, const RGB* reference)
+{
+  const TimingStatistics& statistics = g_hardware.get_statistics();
+  int64_t duration_us = (int64_t)(options.seconds * 1e6);
+
+  printf("\n- - - - - - - - - - Simulation - - - - - - - - - -\n");
+  printf("Simulated:       %.2f s, %.1f rotations, %.0f -> %.0f RPM\n",
+    options.seconds, profile.get_angle(duration_us) / 360.0, options.start_rpm, options.end_rpm);
+  printf("Slices:          %u sent, %.0f per second, %d per rotation at the end\n",
+    slices, slices / options.seconds, renderer.get_angles_per_rotation());
+  printf("Host throughput: %.0f slices per second (%.2f μs per slice)\n",
+    statistics.task_runs / statistics.host_task_seconds,
+    statistics.host_task_seconds * 1e6 / statistics.task_runs);
+  printf("Slice compute:   %lu μs on the target (x%.1f)\n",
+    (unsigned long)renderer.get_slice_compute_us(), options.cpu_scale);
+
+  printf("\n- - - - - - - - - - Timing - - - - - - - - - -\n");
+  printf("Timer ticks:     %u\n", statistics.ticks);
+  printf("Late ticks:      %u, %.1f μs on average, %lld μs at most\n",
+    statistics.late_ticks,
+    statistics.late_ticks > 0 ? (double)statistics.total_lateness_us / statistics.late_ticks : 0.0,
+    (long long)statistics.max_lateness_us);
+  printf("Missed ticks:    %u\n", statistics.missed_ticks);
+  printf("Render core:     %s\n", options.shared_core ? "shared with the other tasks" : "its own (modelled, check /metrics on the device)");
+  printf("SPI overruns:    %lu\n", (unsigned long)renderer.get_spi_overruns());
+  printf("PLL:             %s, %lu μs per rotation, %lu glitches\n",
+    renderer.is_rotation_locked() ? "locked" : "not locked",
+    (unsigned long)renderer.get_rotation_period_us(),
+    (unsigned long)renderer.get_hal_glitches());
+  printf("Live frames:     %lu received, %lu dropped, %lu displayed\n",
+    (unsigned long)renderer.get_live_received(), (unsigned long)renderer.get_live_dropped(),
+    (unsigned long)renderer.get_live_displayed());
+  printf("Frames:          %.1f per second shown, %lu skipped\n",
+    renderer.get_frame_rate(), (unsigned long)renderer.get_skipped_frames());
+  printf("Streaming:       %s, %lu underruns\n",
+    renderer.is_streaming() ? "yes" : "no",
+    (unsigned long)renderer.get_stream_underruns());
+
+  if (!options.playlist.empty())
+    printf("Playlist:        %lu switches, %lu instant, %u resident, %lu of %lu bytes on display\n",
+      (unsigned long)library.get_switches(), (unsigned long)library.get_instant_switches(),
+      renderer.get_resident_count(), (unsigned long)renderer.get_displayed_size(),
+      (unsigned long)renderer.get_frame_memory_size());
+
+  if (options.upload_storm)
+    printf("Upload storm:    %lu uploads\n", (unsigned long)storm_uploads.load());
+
+#ifdef RENDER_METRICS
+  // What the renderer measured about itself, the same numbers /metrics serves.
+  const Rendering::RenderMetrics& metrics = renderer.get_metrics();
+
+  printf("\n- - - - - - - - - - Metrics - - - - - - - - - -\n");
+  printf("Slices:          %lu, %lu missed, %lu late over %lu rotations\n",
+    (unsigned long)metrics.get_slices(), (unsigned long)metrics.get_missed_slices(),
+    (unsigned long)metrics.get_late_slices(), (unsigned long)metrics.get_rotations());
+  print_histogram("ISR latency:", metrics.isr_latency);
+  print_histogram("Compute:", metrics.compute_time);
+  print_histogram("SPI wait:", metrics.spi_wait);
+  print_histogram("Frame jitter:", metrics.frame_jitter);
+  print_histogram("Frame read:", metrics.frame_read);
+  print_histogram("Frame decode:", metrics.frame_decode);
+  // The other tasks take no time at all in here.
+  printf("Display load:    %.1f %% of its core\n", metrics.display_load.get_load_permille() / 10.0);
+#endif
+
+  printf("\n- - - - - - - - - - Image - - - - - - - - - -\n");
+
+  if (compositor.write_ppm(options.output))
+    printf("Perceived image: %s\n", options.output.c_str());
+  else
+    printf("Couldn't write %s\n", options.output.c_str());
+
+  if (reference != NULL)
+    printf("PSNR:            %.2f dB against the first frame\n", compositor.get_psnr(reference));
+}
@@ -0,0 +1,76 @@
+/*
+ * @file rotation_profile.cpp
+ * @authors mia
+ * @brief The speed the simulated display spins at over time.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "rotation_profile.hpp"
+#include <math.h>
+#include <algorithm>
+
+
+namespace Simulator
+{
+
+RotationProfile::RotationProfile(double start_rpm, double end_rpm, int64_t duration_us)
+  : _start_rpm(start_rpm), _end_rpm(end_rpm), _duration_us(duration_us) {}
+
+double RotationProfile::get_rpm(int64_t time_us)
+{
+  return _start_rpm + (_end_rpm - _start_rpm) * time_us / _duration_us;
+}
+
+// The integral of the RPM, the strip starts out at an angle of 0.
+double RotationProfile::_get_rotations(int64_t time_us)
+{
+  double minutes = time_us / 60e6;
+  double slope = (_end_rpm - _start_rpm) / (_duration_us / 60e6);
+
+  return _start_rpm * minutes + slope * minutes * minutes / 2.0;
+}
+
+// The angle of the image the strip is at, in degrees. Keeps counting up past 360.
+double RotationProfile::get_angle(int64_t time_us)
+{
+  return _get_rotations(time_us) * 360.0;
+}
+
+// Finds every time the strip passes the sensor, with some random jitter on top.
+std::vector<int64_t> RotationProfile::get_sensor_edges(double sensor_angle, int64_t jitter_us, std::mt19937& generator)
+{
+  std::vector<int64_t> edges;
+  std::uniform_int_distribution<int64_t> jitter(-jitter_us, jitter_us);
+  double total_rotations = _get_rotations(_duration_us);
+
+  for (double rotations = sensor_angle / 360.0; rotations < total_rotations; rotations += 1.0)
+  {
+    // The angle only ever goes up, so just search for the time.
+    int64_t low_us = edges.empty() ? 0 : edges.back(), high_us = _duration_us;
+
+    while (high_us - low_us > 1)
+    {
+      int64_t middle_us = (low_us + high_us) / 2;
+
+      if (_get_rotations(middle_us) < rotations)
+        low_us = middle_us;
+      else
+        high_us = middle_us;
+    }
+
+    edges.push_back(high_us);
+  }
+
+  // Only add the jitter once all the edges have been found, and keep them in order.
+  for (int64_t& edge_us : edges)
+    edge_us = std::max((int64_t)0, edge_us + jitter(generator));
+
+  std::sort(edges.begin(), edges.end());
+
+  return edges;
+}
+
+}
@@ -0,0 +1,39 @@
+/*
+ * @file rotation_profile.hpp
+ * @authors mia
+ * @brief The speed the simulated display spins at over time.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <random>
+
+
+namespace Simulator
+{
+
+// Ramps linearly from the start to the end RPM over the whole duration.
+// A constant speed is just a ramp with the same start and end.
+class RotationProfile
+{
+private:
+    double _start_rpm;
+    double _end_rpm;
+    int64_t _duration_us;
+
+    double _get_rotations(int64_t time_us);
+public:
+    RotationProfile(double start_rpm, double end_rpm, int64_t duration_us);
+
+    double get_rpm(int64_t time_us);
+    double get_angle(int64_t time_us);
+    std::vector<int64_t> get_sensor_edges(double sensor_angle, int64_t jitter_us, std::mt19937& generator);
+};
+
+}
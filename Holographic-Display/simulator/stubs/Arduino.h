@@ -0,0 +1,48 @@
+/*
+ * @file Arduino.h
+ * @authors mia
+ * @brief Stand-in for the parts of the Arduino core the renderer uses, backed by the virtual hardware.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+
+// Everything runs from regular memory on the host.
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PSTR(s) (s)
+
+#define RISING 0x01
+#define FALLING 0x02
+
+#define constrain(amount, low, high) ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
+
+struct hw_timer_t;
+
+unsigned long micros();
+unsigned long millis();
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_calloc(size_t count, size_t size) { return calloc(count, size); }
+inline bool psramInit() { return true; }
+
+inline int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* argument, int mode);
+
+hw_timer_t* timerBegin(uint8_t timer, uint16_t divider, bool count_up);
+void timerAttachInterrupt(hw_timer_t* timer, void (*handler)(), bool edge);
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarm_value, bool autoreload);
+void timerAlarmEnable(hw_timer_t* timer);
+uint64_t timerRead(hw_timer_t* timer);
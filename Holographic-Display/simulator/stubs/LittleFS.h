@@ -0,0 +1,55 @@
+/*
+ * @file LittleFS.h
+ * @authors mia
+ * @brief Stand-in for LittleFS, reading files from a directory on the host.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <map>
+
+class File
+{
+private:
+    FILE* _file = NULL;
+    size_t _size = 0;
+public:
+    File() {}
+    File(FILE* file);
+
+    operator bool() const { return _file != NULL; }
+    size_t size() { return _size; }
+    int available();
+    size_t readBytes(char* buffer, size_t length);
+    bool seek(uint32_t position);
+    size_t write(const uint8_t* buffer, size_t length);
+    void close();
+};
+
+class LittleFSFS
+{
+private:
+    // The directory on the host that stands in for the root of the file system.
+    std::string _root = "data";
+    // Single files that are mapped somewhere else.
+    std::map<std::string, std::string> _mapped_files;
+
+    std::string _get_host_path(const char* path);
+public:
+    void set_root(const std::string& root) { _root = root; }
+    void map_file(const std::string& path, const std::string& host_path) { _mapped_files[path] = host_path; }
+
+    bool begin(bool format_on_fail = false, const char* base_path = "/littlefs", 
+      uint8_t max_open_files = 10, const char* partition_label = "spiffs") { return true; }
+    File open(const char* path, const char* mode = "r", bool create = false);
+    bool exists(const char* path);
+    bool remove(const char* path);
+};
+
+extern LittleFSFS LittleFS;
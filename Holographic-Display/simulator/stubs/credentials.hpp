@@ -0,0 +1,15 @@
+/*
+ * @file credentials.hpp
+ * @authors mia
+ * @brief Placeholder credentials, so the config can be used without the real ones.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+// Only used if there is no include/credentials.hpp, the simulator never opens an access point.
+#define AP_SSID "simulator"
+#define AP_PASSWORD "simulator"
@@ -0,0 +1,32 @@
+/*
+ * @file esp_heap_caps.h
+ * @authors mia
+ * @brief Stand-in for the capability based heap, there is just one heap on the host.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
+
+inline void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+  // aligned_alloc() wants the size to be a multiple of the alignment.
+  return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+// Same as the PSRAM of the real thing.
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 8 * 1000 * 1000; }
+
+inline void heap_caps_free(void* pointer) { free(pointer); }
@@ -0,0 +1,22 @@
+/*
+ * @file esp_log.h
+ * @authors mia
+ * @brief Stand-in for the ESP-IDF logging macros, printing straight to stdout.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdio.h>
+
+// The tag is always empty in this project, so leave it out.
+#define ESP_LOG_STANDIN(level, tag, format, ...) printf(level " " format "\n", ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...) ESP_LOG_STANDIN("E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_LOG_STANDIN("W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_LOG_STANDIN("I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) do {} while (0)
+#define ESP_LOGV(tag, format, ...) do {} while (0)
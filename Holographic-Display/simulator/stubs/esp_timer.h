@@ -0,0 +1,15 @@
+/*
+ * @file esp_timer.h
+ * @authors mia
+ * @brief Stand-in for the high resolution timer, running on the virtual clock.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
@@ -0,0 +1,36 @@
+/*
+ * @file FreeRTOS.h
+ * @authors mia
+ * @brief Stand-in for the FreeRTOS types and critical sections.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY 0xFFFFFFFF
+// vTaskDelay sleeps for a millisecond per tick.
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+
+// The simulated task and the ISRs never run at the same time, 
+// so the critical sections don't have to do anything.
+struct portMUX_TYPE { uint32_t owner; };
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define taskENTER_CRITICAL(mux) (void)(mux)
+#define taskEXIT_CRITICAL(mux) (void)(mux)
+#define taskENTER_CRITICAL_ISR(mux) (void)(mux)
+#define taskEXIT_CRITICAL_ISR(mux) (void)(mux)
+#define portYIELD_FROM_ISR(woken) (void)(woken)
@@ -0,0 +1,44 @@
+/*
+ * @file semphr.h
+ * @authors mia
+ * @brief Stand-in for the FreeRTOS mutexes, backed by the ones of the host.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <mutex>
+#include "FreeRTOS.h"
+
+// Recursive, so the same type works for both kinds of mutexes.
+typedef std::recursive_mutex* SemaphoreHandle_t;
+
+// Never gets freed, just like on the device.
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::recursive_mutex(); }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new std::recursive_mutex(); }
+
+// Only ever used with portMAX_DELAY.
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+  semaphore->lock();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  semaphore->unlock();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+  return xSemaphoreTake(semaphore, ticks_to_wait);
+}
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore)
+{
+  return xSemaphoreGive(semaphore);
+}
@@ -0,0 +1,173 @@
+/*
+ * @file upload_benchmark.cpp
+ * @authors mia
+ * @brief Feeds uploads through the frame decoder in chunks of random size.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "upload_benchmark.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include "Rendering/frame_decoder.hpp"
+
+
+namespace Simulator
+{
+
+// The ranges the chunk sizes get picked from.
+struct ChunkSizes
+{
+    const char* name;
+    size_t min;
+    size_t max;
+};
+
+static const ChunkSizes chunk_sizes[] = {
+  { "1-64 B", 1, 64 },
+  { "TCP segments", 536, 1436 },
+  { "1-16 KB", 1, 16384 },
+};
+
+// Every upload gets loaded this many times, the best run counts.
+static const int RUNS = 5;
+
+// The webserver used to collect the chunks in a frame buffer of a whole record,
+// plus a segment that might already belong to the next one.
+static const size_t STAGING_EXTRA_BYTES = 1500;
+
+static std::vector<size_t> create_chunks(size_t size, const ChunkSizes& range, std::mt19937& generator)
+{
+  std::uniform_int_distribution<size_t> distribution(range.min, range.max);
+  std::vector<size_t> chunks;
+
+  for (size_t offset = 0; offset < size; offset += chunks.back())
+    chunks.push_back(std::min(distribution(generator), size - offset));
+
+  return chunks;
+}
+
+// Collects whole records before handing them to the renderer, like the webserver did before the decoder.
+static void load_staged(Rendering::Renderer& renderer, const std::vector<uint8_t>& upload,
+  const std::vector<size_t>& chunks, std::vector<uint8_t>& buffer)
+{
+  size_t buffer_index = 0;
+  size_t record_size = 0;
+  bool header_read = false;
+  uint16_t frame = 0;
+  size_t offset = 0;
+
+  for (size_t chunk : chunks)
+  {
+    memcpy(buffer.data() + buffer_index, upload.data() + offset, chunk);
+    buffer_index += chunk;
+    offset += chunk;
+
+    if (!header_read)
+    {
+      // The webserver decided on the first chunk, which didn't always have the whole magic.
+      if (buffer_index < CONTAINER_HEADER_SIZE_BYTES && offset < upload.size())
+        continue;
+
+      size_t header_size = Rendering::Renderer::get_frame_header_size(buffer.data(), buffer_index);
+
+      if (buffer_index < header_size)
+        continue;
+
+      record_size = renderer.prepare_frames(buffer.data(), header_size, upload.size() - header_size);
+      header_read = true;
+      memmove(buffer.data(), buffer.data() + header_size, buffer_index - header_size);
+      buffer_index -= header_size;
+    }
+
+    while (record_size > 0 && buffer_index >= record_size)
+    {
+      if (frame < renderer.get_frame_capacity())
+        renderer.update_frame(frame, buffer.data());
+
+      memmove(buffer.data(), buffer.data() + record_size, buffer_index - record_size);
+      buffer_index -= record_size;
+      frame++;
+      record_size = renderer.get_record_size(frame);
+    }
+  }
+}
+
+static void load_decoded(Rendering::FrameDecoder& decoder, const std::vector<uint8_t>& upload,
+  const std::vector<size_t>& chunks)
+{
+  size_t offset = 0;
+
+  decoder.begin(upload.size());
+
+  for (size_t chunk : chunks)
+  {
+    decoder.write(upload.data() + offset, chunk, offset + chunk == upload.size());
+    offset += chunk;
+  }
+}
+
+// The frames that are in memory now.
+static std::vector<uint8_t> copy_frames(Rendering::Renderer& renderer)
+{
+  std::vector<uint8_t> frames;
+
+  for (uint16_t frame = 0; renderer.get_frame_data(frame) != NULL; frame++)
+    frames.insert(frames.end(), renderer.get_frame_data(frame), renderer.get_frame_data(frame) + renderer.get_frame_size());
+
+  return frames;
+}
+
+bool run_upload_benchmark(Rendering::Renderer& renderer, const std::vector<uint8_t>& upload, uint32_t seed)
+{
+  std::mt19937 generator(seed);
+  Rendering::FrameDecoder decoder(&renderer);
+  std::vector<uint8_t> buffer(upload.size() + STAGING_EXTRA_BYTES);
+  bool matching = true;
+
+  // Whole records first, for the frames everything else gets compared against.
+  load_staged(renderer, upload, { upload.size() }, buffer);
+  std::vector<uint8_t> reference = copy_frames(renderer);
+
+  printf("- - - - - - - - - - Upload - - - - - - - - - -\n");
+  printf("Upload:          %lu bytes, %lu bytes of frames in memory\n",
+    (unsigned long)upload.size(), (unsigned long)reference.size());
+  printf("%-16s %12s %12s  %s\n", "Chunks", "Staged", "Decoder", "Frames");
+
+  for (const ChunkSizes& range : chunk_sizes)
+  {
+    std::vector<size_t> chunks = create_chunks(upload.size(), range, generator);
+    double staged_seconds = 1e9, decoded_seconds = 1e9;
+
+    for (int run = 0; run < RUNS; run++)
+    {
+      auto start = std::chrono::steady_clock::now();
+      load_staged(renderer, upload, chunks, buffer);
+      auto staged = std::chrono::steady_clock::now();
+
+      staged_seconds = std::min(staged_seconds, std::chrono::duration<double>(staged - start).count());
+
+      start = std::chrono::steady_clock::now();
+      load_decoded(decoder, upload, chunks);
+      auto decoded = std::chrono::steady_clock::now();
+
+      decoded_seconds = std::min(decoded_seconds, std::chrono::duration<double>(decoded - start).count());
+    }
+
+    bool match = !decoder.is_rejected() && copy_frames(renderer) == reference;
+    matching &= match;
+
+    printf("%-16s %7.1f MB/s %7.1f MB/s  %s\n", range.name,
+      upload.size() / staged_seconds / 1e6, upload.size() / decoded_seconds / 1e6,
+      match ? "match" : "DIFFER");
+  }
+
+  return matching;
+}
+
+}
@@ -0,0 +1,26 @@
+/*
+ * @file upload_benchmark.hpp
+ * @authors mia
+ * @brief Feeds uploads through the frame decoder in chunks of random size.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "Rendering/rendering.hpp"
+
+
+namespace Simulator
+{
+
+// Loads the upload with the frame decoder, in chunks of random size like they come in
+// over the network, and with the frame buffer the webserver used to collect whole records in.
+// Prints the throughput of both and returns false if the frames don't match.
+bool run_upload_benchmark(Rendering::Renderer& renderer, const std::vector<uint8_t>& upload, uint32_t seed);
+
+}
@@ -0,0 +1,459 @@
+/*
+ * @file virtual_hardware.cpp
+ * @authors mia
+ * @brief Virtual clock, timer, HAL sensor and SPI bus the renderer runs against on the host.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "virtual_hardware.hpp"
+#include <time.h>
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "esp_timer.h"
+#include "driver/spi_master.h"
+#include "config.hpp"
+
+
+namespace Simulator
+{
+
+VirtualHardware g_hardware;
+
+// Set on the thread of the display task, so the clock knows whose time to return.
+static thread_local bool in_task = false;
+
+// The task never runs this long between two readings of the clock on its own. (in μs of host time)
+static const double HOST_PREEMPTION_US = 20;
+
+// The time the calling thread spent running on the host CPU. (in μs)
+static double get_thread_cpu_us()
+{
+  timespec time;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+
+  return time.tv_sec * 1e6 + time.tv_nsec / 1e3;
+}
+
+// How long the task has been running on the host since it got its turn. (in μs)
+double VirtualHardware::_get_task_host_us()
+{
+  double host_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _task_host_start).count();
+
+  // A gap this long means the host gave the CPU to another thread in between. That's no holdup
+  // on a core of its own, so only the time the task itself spent on the CPU counts then.
+  // Reading that is a system call, too slow to do it every time.
+  // This is what makes a core of its own look better than --shared-core, so comparing the two
+  // only shows the model. How late the task really gets is up to the histograms on /metrics.
+  if (!_shared_core && host_us - _task_host_us > HOST_PREEMPTION_US)
+  {
+    double cpu_us = get_thread_cpu_us() - _task_cpu_start_us;
+
+    if (cpu_us < host_us)
+    {
+      _task_host_start += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double, std::micro>(host_us - cpu_us));
+      host_us = cpu_us;
+    }
+  }
+
+  // The time never goes backwards.
+  _task_host_us = std::max(_task_host_us, host_us);
+
+  return _task_host_us;
+}
+
+int64_t VirtualHardware::_get_task_time_us()
+{
+  return _task_start_us + (int64_t)(_get_task_host_us() * _cpu_scale) + _task_waited_us;
+}
+
+int64_t VirtualHardware::get_time_us()
+{
+  return in_task ? _get_task_time_us() : _now_us;
+}
+
+// Processes all the timer ticks and task runs up to the given time.
+void VirtualHardware::advance_to(int64_t time_us)
+{
+  while (true)
+  {
+    bool task_ready = _notifications > 0;
+    int64_t task_time_us = std::max(_task_busy_until_us, _now_us);
+    int64_t alarm_time_us = _alarm_enabled ? _next_alarm_us : INT64_MAX;
+
+    // The ISR always wins against the task if both happen at the same time.
+    if (alarm_time_us <= time_us && (!task_ready || alarm_time_us <= task_time_us))
+    {
+      _now_us = alarm_time_us;
+      _fire_timer();
+    }
+    else if (task_ready && task_time_us <= time_us)
+    {
+      _now_us = task_time_us;
+      _run_task();
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  _now_us = time_us;
+}
+
+void VirtualHardware::_fire_timer()
+{
+  _statistics.ticks++;
+
+  // The task is still busy, so this tick is going to get merged into the pending one.
+  if (_pending_tick_us >= 0)
+    _statistics.missed_ticks++;
+  else
+    _pending_tick_us = _now_us;
+
+  _timer_handler();
+
+  // The ISR may have changed the alarm for the next period already.
+  // Without the reload, the alarm is done until it gets enabled again.
+  if (_alarm_reload)
+    _next_alarm_us = _now_us + _alarm_us;
+  else
+    _alarm_enabled = false;
+}
+
+// Hands control over to the display task, until it blocks again.
+void VirtualHardware::_run_task()
+{
+  if (_pending_tick_us >= 0)
+  {
+    int64_t lateness_us = _now_us - _pending_tick_us;
+
+    if (lateness_us > 0)
+    {
+      _statistics.late_ticks++;
+      _statistics.total_lateness_us += lateness_us;
+      _statistics.max_lateness_us = std::max(_statistics.max_lateness_us, lateness_us);
+    }
+
+    _pending_tick_us = -1;
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  _task_start_us = _now_us;
+  _task_waited_us = 0;
+  _task_turn = true;
+  _turn_changed.notify_all();
+  _turn_changed.wait(lock, [this] { return !_task_turn; });
+}
+
+// Blocks the task thread until the main thread hands control over.
+void VirtualHardware::_wait_for_turn(std::unique_lock<std::mutex>& lock)
+{
+  _turn_changed.wait(lock, [this] { return _task_turn; });
+  _task_host_us = 0;
+  _task_cpu_start_us = get_thread_cpu_us();
+  _task_host_start = std::chrono::steady_clock::now();
+}
+
+void VirtualHardware::trigger_hal()
+{
+  if (_hal_handler != NULL)
+    _hal_handler(_hal_argument);
+}
+
+// With the reload, the counter starts over at every alarm, so the value is the period.
+// Otherwise it's the time the alarm goes off at, the counter is the virtual clock itself.
+void VirtualHardware::write_alarm(uint64_t alarm_value, bool reload)
+{
+  _alarm_us = reload ? std::max(alarm_value, (uint64_t)1) : alarm_value;
+  _alarm_reload = reload;
+}
+
+// An alarm that already passed goes off right away.
+void VirtualHardware::enable_alarm()
+{
+  _alarm_enabled = true;
+  _next_alarm_us = _alarm_reload ? _now_us + _alarm_us : std::max((int64_t)_alarm_us, get_time_us());
+}
+
+void VirtualHardware::attach_hal(void (*handler)(void*), void* argument)
+{
+  _hal_handler = handler;
+  _hal_argument = argument;
+}
+
+// The task has the highest priority, so it runs right away until it blocks for the first time.
+void VirtualHardware::create_task(TaskFunction_t function, void* parameter)
+{
+  _task_function = function;
+  _task_parameter = parameter;
+
+  _task_thread = std::thread([this]
+  {
+    in_task = true;
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wait_for_turn(lock);
+    }
+
+    _task_function(_task_parameter);
+  });
+
+  // The task never returns, it just stays blocked when the simulation ends.
+  _task_thread.detach();
+
+  _notifications = 0;
+  _run_task();
+}
+
+uint32_t VirtualHardware::take_notification()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  _task_busy_until_us = _get_task_time_us();
+  _statistics.host_task_seconds += _task_host_us / 1e6;
+  _statistics.task_runs++;
+  _task_turn = false;
+  _turn_changed.notify_all();
+
+  _wait_for_turn(lock);
+
+  uint32_t notifications = _notifications;
+  _notifications = 0;
+
+  return notifications;
+}
+
+// The bus clocks out one transfer after another, the LEDs show a slice once it's complete.
+void VirtualHardware::queue_transfer(const void* data, size_t length_bits)
+{
+  int64_t start_us = std::max(get_time_us(), _spi_free_at_us);
+  int64_t completion_us = start_us + (int64_t)(length_bits * 1000000ULL / _spi_clock_hz);
+
+  _spi_free_at_us = completion_us;
+  _spi_completions.push_back(completion_us);
+
+  if (!_on_transfer)
+    return;
+
+  // Whatever the handler does doesn't count as compute time of the task.
+  auto handler_start = std::chrono::steady_clock::now();
+  double handler_cpu_start_us = get_thread_cpu_us();
+  _on_transfer((const uint8_t*)data, length_bits / 8, completion_us);
+  _task_cpu_start_us += get_thread_cpu_us() - handler_cpu_start_us;
+  _task_host_start += std::chrono::steady_clock::now() - handler_start;
+}
+
+bool VirtualHardware::get_transfer_result(bool wait)
+{
+  if (_spi_completions.empty())
+    return false;
+
+  int64_t completion_us = _spi_completions.front();
+  int64_t now_us = get_time_us();
+
+  if (completion_us > now_us)
+  {
+    if (!wait)
+      return false;
+
+    // Blocking on the bus just moves the time of the task forward.
+    if (in_task)
+      _task_waited_us += completion_us - now_us;
+  }
+
+  _spi_completions.pop_front();
+  return true;
+}
+
+}
+
+
+//  - - - - - - - - - - Stand-ins - - - - - - - - - -
+
+using Simulator::g_hardware;
+
+struct hw_timer_t { uint8_t number; };
+static hw_timer_t virtual_timer;
+LittleFSFS LittleFS;
+
+// Every other task just runs on a host thread of its own, like on the other core.
+struct HostTask
+{
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t notifications = 0;
+};
+
+static thread_local HostTask* current_host_task = NULL;
+// The main thread runs the ISRs, which are on the core of the render task.
+static thread_local BaseType_t current_core = RENDERER_CORE;
+
+unsigned long micros() { return (unsigned long)g_hardware.get_time_us(); }
+
+unsigned long millis() { return (unsigned long)(g_hardware.get_time_us() / 1000); }
+
+int64_t esp_timer_get_time() { return g_hardware.get_time_us(); }
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* argument, int mode)
+{
+  g_hardware.attach_hal(handler, argument);
+}
+
+// The divider is always set up for 1 tick per μs.
+hw_timer_t* timerBegin(uint8_t timer, uint16_t divider, bool count_up) { return &virtual_timer; }
+
+void timerAttachInterrupt(hw_timer_t* timer, void (*handler)(), bool edge) { g_hardware.attach_timer(handler); }
+
+void timerAlarmWrite(hw_timer_t* timer, uint64_t alarm_value, bool autoreload) { g_hardware.write_alarm(alarm_value, autoreload); }
+
+uint64_t timerRead(hw_timer_t* timer) { return g_hardware.get_time_us(); }
+
+void timerAlarmEnable(hw_timer_t* timer) { g_hardware.enable_alarm(); }
+
+// The task on the core of the renderer is the display task, which runs in lockstep with the virtual hardware.
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth,
+  void* parameter, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core)
+{
+  if (core == RENDERER_CORE)
+  {
+    // The handle is only ever passed back to vTaskNotifyGiveFromISR().
+    *handle = &g_hardware;
+    g_hardware.create_task(function, parameter);
+
+    return pdPASS;
+  }
+
+  HostTask* task = new HostTask();
+  *handle = task;
+
+  std::thread([task, function, parameter, core]
+  {
+    current_host_task = task;
+    current_core = core;
+    function(parameter);
+  }).detach();
+
+  return pdPASS;
+}
+
+BaseType_t xPortGetCoreID() { return current_core; }
+
+// Host tasks always wait for as long as it takes.
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+  if (current_host_task == NULL)
+    return g_hardware.take_notification();
+
+  std::unique_lock<std::mutex> lock(current_host_task->mutex);
+  current_host_task->notified.wait(lock, [] { return current_host_task->notifications > 0; });
+
+  uint32_t notifications = current_host_task->notifications;
+  current_host_task->notifications = clear_on_exit ? 0 : notifications - 1;
+
+  return notifications;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  if (task == &g_hardware)
+  {
+    g_hardware.give_notification();
+    return pdPASS;
+  }
+
+  HostTask* host_task = (HostTask*)task;
+  std::lock_guard<std::mutex> lock(host_task->mutex);
+
+  host_task->notifications++;
+  host_task->notified.notify_all();
+
+  return pdPASS;
+}
+
+// Only the host tasks ever wait like this, the ticks are milliseconds of host time.
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken)
+{
+  g_hardware.give_notification();
+  *higher_priority_task_woken = pdTRUE;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dma_channel) { return ESP_OK; }
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config, spi_device_handle_t* handle)
+{
+  g_hardware.set_spi_clock(config->clock_speed_hz);
+  *handle = NULL;
+
+  return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* transaction, TickType_t ticks_to_wait)
+{
+  g_hardware.queue_transfer(transaction->tx_buffer, transaction->length);
+  return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** transaction, TickType_t ticks_to_wait)
+{
+  return g_hardware.get_transfer_result(ticks_to_wait != 0) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+File::File(FILE* file) : _file(file)
+{
+  fseek(_file, 0, SEEK_END);
+  _size = ftell(_file);
+  fseek(_file, 0, SEEK_SET);
+}
+
+int File::available() { return _file == NULL ? 0 : (int)(_size - ftell(_file)); }
+
+size_t File::readBytes(char* buffer, size_t length) { return fread(buffer, 1, length, _file); }
+
+bool File::seek(uint32_t position) { return _file != NULL && fseek(_file, position, SEEK_SET) == 0; }
+
+size_t File::write(const uint8_t* buffer, size_t length) { return fwrite(buffer, 1, length, _file); }
+
+void File::close()
+{
+  if (_file != NULL)
+    fclose(_file);
+
+  _file = NULL;
+}
+
+std::string LittleFSFS::_get_host_path(const char* path)
+{
+  auto mapped_file = _mapped_files.find(path);
+
+  if (mapped_file != _mapped_files.end())
+    return mapped_file->second;
+
+  return _root + path;
+}
+
+File LittleFSFS::open(const char* path, const char* mode, bool create)
+{
+  FILE* file = fopen(_get_host_path(path).c_str(), mode[0] == 'w' ? "wb" : "rb");
+
+  return file == NULL ? File() : File(file);
+}
+
+bool LittleFSFS::exists(const char* path)
+{
+  FILE* file = fopen(_get_host_path(path).c_str(), "rb");
+
+  if (file != NULL)
+    fclose(file);
+
+  return file != NULL;
+}
+
+bool LittleFSFS::remove(const char* path) { return ::remove(_get_host_path(path).c_str()) == 0; }
@@ -0,0 +1,127 @@
+/*
+ * @file virtual_hardware.hpp
+ * @authors mia
+ * @brief Virtual clock, timer, HAL sensor and SPI bus the renderer runs against on the host.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include "freertos/task.h"
+
+
+namespace Simulator
+{
+
+// How late the display task got to the timer ticks.
+struct TimingStatistics
+{
+    uint32_t ticks = 0;
+    // Ticks the task only got to after the next one already fired, these slices are lost.
+    uint32_t missed_ticks = 0;
+    // Ticks where the task was still busy with the slice before.
+    uint32_t late_ticks = 0;
+    int64_t total_lateness_us = 0;
+    int64_t max_lateness_us = 0;
+    // The time the task spent computing, on the host and scaled to the target.
+    double host_task_seconds = 0;
+    uint32_t task_runs = 0;
+};
+
+// Runs everything on a virtual clock, so the renderer can be driven through any
+// RPM profile faster than real time, and the results don't depend on the host.
+// Only the compute time of the display task is measured on the host and scaled
+// by the given factor, everything else happens in zero time.
+//
+// The display task gets its own thread, but the two never run at the same time.
+// Control is handed back and forth whenever the task blocks or gets notified.
+//
+// With a core of its own, a run of the task only takes as long as the task itself
+// spent on the host CPU, whatever the threads of the other cores do in the meantime.
+// Sharing the core, everything else that got to run in between holds the task up too.
+class VirtualHardware
+{
+private:
+    // The time of the main thread, which the ISRs run on.
+    int64_t _now_us = 0;
+    double _cpu_scale = 1.0;
+    bool _shared_core = false;
+
+    void (*_timer_handler)() = NULL;
+    uint64_t _alarm_us = 0;
+    bool _alarm_reload = true;
+    bool _alarm_enabled = false;
+    int64_t _next_alarm_us = 0;
+
+    void (*_hal_handler)(void*) = NULL;
+    void* _hal_argument = NULL;
+
+    TaskFunction_t _task_function = NULL;
+    void* _task_parameter = NULL;
+    std::thread _task_thread;
+    std::mutex _mutex;
+    std::condition_variable _turn_changed;
+    bool _task_turn = false;
+    uint32_t _notifications = 0;
+    // When the task started running, in virtual and in host time.
+    int64_t _task_start_us = 0;
+    std::chrono::steady_clock::time_point _task_host_start;
+    // The CPU time of the task thread when it got its turn, without the transfer handler.
+    double _task_cpu_start_us = 0;
+    // The last time the task read the clock, in host time since it got its turn.
+    double _task_host_us = 0;
+    // Virtual time the task spent waiting on the SPI bus.
+    int64_t _task_waited_us = 0;
+    // When the task blocked again after its last run.
+    int64_t _task_busy_until_us = 0;
+    // The first tick the task hasn't gotten to yet, -1 if there is none.
+    int64_t _pending_tick_us = -1;
+
+    uint32_t _spi_clock_hz = 1;
+    int64_t _spi_free_at_us = 0;
+    std::deque<int64_t> _spi_completions;
+    std::function<void(const uint8_t* data, size_t length, int64_t time_us)> _on_transfer;
+
+    TimingStatistics _statistics;
+
+    double _get_task_host_us();
+    int64_t _get_task_time_us();
+    void _fire_timer();
+    void _run_task();
+    void _wait_for_turn(std::unique_lock<std::mutex>& lock);
+public:
+    void set_cpu_scale(double cpu_scale) { _cpu_scale = cpu_scale; }
+    void set_shared_core(bool shared_core) { _shared_core = shared_core; }
+    void set_transfer_handler(std::function<void(const uint8_t*, size_t, int64_t)> on_transfer) { _on_transfer = on_transfer; }
+
+    int64_t get_time_us();
+    void advance_to(int64_t time_us);
+    void trigger_hal();
+    const TimingStatistics& get_statistics() { return _statistics; }
+
+    // Called by the stand-ins.
+    void attach_timer(void (*handler)()) { _timer_handler = handler; }
+    void write_alarm(uint64_t alarm_value, bool reload);
+    void enable_alarm();
+    void attach_hal(void (*handler)(void*), void* argument);
+    void create_task(TaskFunction_t function, void* parameter);
+    uint32_t take_notification();
+    void give_notification() { _notifications++; }
+    void set_spi_clock(uint32_t clock_hz) { _spi_clock_hz = clock_hz; }
+    void queue_transfer(const void* data, size_t length_bits);
+    bool get_transfer_result(bool wait);
+};
+
+extern VirtualHardware g_hardware;
+
+}
@@ -0,0 +1,392 @@
+/*
+ * @file animation_library.cpp
+ * @authors mia
+ * @brief Keeps track of the named animations in the file system and plays them one after another.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "Rendering/animation_library.hpp"
+
+namespace Rendering
+{
+
+// A line of the index can't be longer than this.
+#define INDEX_LINE_LENGTH (LIBRARY_NAME_LENGTH + 40)
+
+AnimationLibrary::AnimationLibrary(Renderer* renderer) : _renderer(renderer) {}
+
+void AnimationLibrary::begin()
+{
+  _mutex = xSemaphoreCreateMutex();
+  _load_index();
+
+  ESP_LOGI(TAG, "%u animations in the library", _entry_count);
+
+  // Next to the frame loader, it has to wait for the flash just the same.
+  BaseType_t result = xTaskCreatePinnedToCore(
+    _scheduler_loop,
+    PSTR("Playlist"),
+    4096,
+    this,
+    1,
+    &_scheduler_task,
+    FRAME_LOADER_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory for the playlist!");
+}
+
+// Names end up in paths and the index, so only letters, digits, '-' and '_' are allowed.
+bool AnimationLibrary::is_valid_name(const char* name)
+{
+  size_t length = 0;
+
+  for (; name[length] != '\0'; length++)
+  {
+    char character = name[length];
+
+    if (!isalnum((unsigned char)character) && character != '-' && character != '_')
+      return false;
+  }
+
+  return length > 0 && length < LIBRARY_NAME_LENGTH;
+}
+
+// Adds an animation that was just uploaded, or updates it if it's already there.
+bool AnimationLibrary::add(const char* name, uint16_t frame_count, size_t file_size, size_t memory_size)
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  int8_t index = _find_entry(name);
+
+  if (index < 0 && _entry_count == LIBRARY_MAX_ANIMATIONS)
+  {
+    xSemaphoreGive(_mutex);
+    ESP_LOGE(TAG, "The library is full, %s doesn't fit anymore!", name);
+    return false;
+  }
+
+  if (index < 0)
+    index = _entry_count++;
+
+  LibraryEntry& entry = _entries[index];
+
+  snprintf(entry.name, sizeof(entry.name), "%s", name);
+  entry.frame_count = frame_count;
+  entry.file_size = file_size;
+  entry.memory_size = memory_size;
+
+  _save_index();
+  xSemaphoreGive(_mutex);
+
+  return true;
+}
+
+// Removes the animation from the library and the playlist, along with its data file.
+bool AnimationLibrary::remove(const char* name)
+{
+  char path[LIBRARY_NAME_LENGTH + sizeof(LIBRARY_DIRECTORY) + 8];
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  int8_t index = _find_entry(name);
+
+  if (index < 0)
+  {
+    xSemaphoreGive(_mutex);
+    return false;
+  }
+
+  _entries[index] = _entries[--_entry_count];
+
+  uint8_t kept = 0;
+
+  for (uint8_t entry = 0; entry < _playlist_count; entry++)
+    if (strcmp(_playlist[entry].name, name) != 0)
+      _playlist[kept++] = _playlist[entry];
+
+  _playlist_count = kept;
+  _playlist_position = 0;
+  _playing &= _playlist_count > 0;
+
+  _renderer->evict_animation(name);
+  Renderer::get_animation_path(name, path, sizeof(path));
+  LittleFS.remove(path);
+
+  _save_index();
+  xSemaphoreGive(_mutex);
+
+  return true;
+}
+
+// Shows the animation right away, the playlist stops at that point.
+bool AnimationLibrary::select(const char* name)
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  int8_t index = _find_entry(name);
+
+  if (index >= 0)
+  {
+    strcpy(_selected, _entries[index].name);
+    _select_pending = true;
+  }
+
+  xSemaphoreGive(_mutex);
+
+  return index >= 0;
+}
+
+// Adds the animation to the end of the playlist, it's shown for the given duration once it's its turn.
+// Starts playing if the playlist is stopped.
+bool AnimationLibrary::queue(const char* name, uint32_t duration_ms)
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  int8_t index = _find_entry(name);
+
+  if (index < 0 || _playlist_count == PLAYLIST_MAX_ENTRIES)
+  {
+    xSemaphoreGive(_mutex);
+    return false;
+  }
+
+  PlaylistEntry& entry = _playlist[_playlist_count++];
+
+  strcpy(entry.name, _entries[index].name);
+  entry.duration_ms = max(duration_ms, (uint32_t)PLAYLIST_TICK_MS);
+
+  if (!_playing)
+  {
+    // Right behind the one before the new entry, so the next tick switches to it.
+    _playlist_position = (2 * _playlist_count - 2) % _playlist_count;
+    _next_switch_ms = millis();
+    _playing = true;
+    _select_pending = false;
+  }
+
+  // Whatever was preloaded might not be next anymore.
+  _preload_attempted = false;
+  xSemaphoreGive(_mutex);
+
+  return true;
+}
+
+void AnimationLibrary::clear()
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  _playlist_count = 0;
+  _playlist_position = 0;
+  _playing = false;
+  xSemaphoreGive(_mutex);
+}
+
+// Uploads and live frames take over the display, the playlist mustn't switch away from them.
+// Waits for the scheduler to finish whatever it's doing with the renderer.
+void AnimationLibrary::stop()
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  _playing = false;
+  _select_pending = false;
+  xSemaphoreGive(_mutex);
+}
+
+// Keeps the scheduler away from the renderer while an upload comes in, has to be renewed with every chunk.
+// Whatever gets selected or queued in the meantime only happens after release().
+void AnimationLibrary::hold()
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  _held = true;
+  _held_since_ms = millis();
+  xSemaphoreGive(_mutex);
+}
+
+void AnimationLibrary::release()
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  _held = false;
+  xSemaphoreGive(_mutex);
+}
+
+uint8_t AnimationLibrary::get_entry_count() { return _entry_count; }
+
+const LibraryEntry& AnimationLibrary::get_entry(uint8_t index) { return _entries[index]; }
+
+uint8_t AnimationLibrary::get_playlist_count() { return _playlist_count; }
+
+const PlaylistEntry& AnimationLibrary::get_playlist_entry(uint8_t index) { return _playlist[index]; }
+
+uint8_t AnimationLibrary::get_playlist_position() { return _playlist_position; }
+
+bool AnimationLibrary::is_playing() { return _playing; }
+
+uint32_t AnimationLibrary::get_switches() { return _switches; }
+
+// Switches to animations that didn't have to be read from the flash first.
+uint32_t AnimationLibrary::get_instant_switches() { return _instant_switches; }
+
+#ifdef RENDER_METRICS
+const TaskLoad& AnimationLibrary::get_load() { return _load; }
+#endif
+
+void AnimationLibrary::_scheduler_loop(void *parameter)
+{
+  AnimationLibrary *library = (AnimationLibrary*)parameter;
+
+  while (true)
+  {
+#ifdef RENDER_METRICS
+    int64_t start_us = esp_timer_get_time();
+    library->_tick();
+    library->_load.record(esp_timer_get_time() - start_us);
+#else
+    library->_tick();
+#endif
+    vTaskDelay(pdMS_TO_TICKS(PLAYLIST_TICK_MS));
+  }
+}
+
+void AnimationLibrary::_tick()
+{
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+
+  if (_held && millis() - _held_since_ms >= LIBRARY_HOLD_TIMEOUT_MS)
+  {
+    ESP_LOGE(TAG, "The upload stopped sending, resuming the playlist");
+    _held = false;
+  }
+
+  // Live frames hold it off for as long as they're shown.
+  if (_held || _renderer->is_live())
+  {
+    xSemaphoreGive(_mutex);
+    return;
+  }
+
+  if (_select_pending)
+  {
+    _select_pending = false;
+    _playing = false;
+    _switch_to(_selected);
+  }
+  else if (_playing && (long)(millis() - _next_switch_ms) >= 0)
+  {
+    _playlist_position = (_playlist_position + 1) % _playlist_count;
+    _next_switch_ms = millis() + _playlist[_playlist_position].duration_ms;
+    _preload_attempted = false;
+    _switch_to(_playlist[_playlist_position].name);
+  }
+
+  // The loader is busy until the animation on display is in, the next one has to wait for that.
+  if (_playing && _playlist_count > 1 && !_preload_attempted && !_renderer->is_streaming())
+  {
+    _preload_attempted = true;
+    _renderer->preload_animation(_playlist[(_playlist_position + 1) % _playlist_count].name);
+  }
+
+  xSemaphoreGive(_mutex);
+}
+
+void AnimationLibrary::_switch_to(const char* name)
+{
+  bool instant = _renderer->is_resident(name);
+
+  if (!_renderer->show_animation(name))
+  {
+    ESP_LOGE(TAG, "Couldn't show %s!", name);
+    return;
+  }
+
+  _switches++;
+  _instant_switches += instant;
+}
+
+int8_t AnimationLibrary::_find_entry(const char* name)
+{
+  for (uint8_t index = 0; index < _entry_count; index++)
+    if (strcmp(_entries[index].name, name) == 0)
+      return index;
+
+  return -1;
+}
+
+// Animations without a data file are left out, they might have been removed in between.
+void AnimationLibrary::_load_index()
+{
+  char path[LIBRARY_NAME_LENGTH + sizeof(LIBRARY_DIRECTORY) + 8];
+  File file = LittleFS.open(LIBRARY_INDEX_NAME, "r", false);
+
+  _entry_count = 0;
+
+  if (!file)
+    return;
+
+  size_t size = min(file.size(), (size_t)(LIBRARY_MAX_ANIMATIONS * INDEX_LINE_LENGTH));
+  char* index = (char*)malloc(size + 1);
+
+  if (index == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the library index!");
+    file.close();
+    return;
+  }
+
+  index[file.readBytes(index, size)] = '\0';
+  file.close();
+
+  char* save = NULL;
+
+  for (char* line = strtok_r(index, "\n", &save); line != NULL && _entry_count < LIBRARY_MAX_ANIMATIONS;
+    line = strtok_r(NULL, "\n", &save))
+  {
+    LibraryEntry& entry = _entries[_entry_count];
+    unsigned int frame_count;
+    unsigned long file_size, memory_size;
+
+    if (sscanf(line, "%23s %u %lu %lu", entry.name, &frame_count, &file_size, &memory_size) != 4
+      || !is_valid_name(entry.name))
+      continue;
+
+    Renderer::get_animation_path(entry.name, path, sizeof(path));
+
+    if (!LittleFS.exists(path))
+      continue;
+
+    entry.frame_count = frame_count;
+    entry.file_size = file_size;
+    entry.memory_size = memory_size;
+    _entry_count++;
+  }
+
+  free(index);
+}
+
+void AnimationLibrary::_save_index()
+{
+  // Creates the library directory with the first animation.
+  File file = LittleFS.open(LIBRARY_INDEX_NAME, "w", true);
+  char line[INDEX_LINE_LENGTH];
+
+  if (!file)
+  {
+    ESP_LOGE(TAG, "Failed to open the library index for writing");
+    return;
+  }
+
+  for (uint8_t index = 0; index < _entry_count; index++)
+  {
+    const LibraryEntry& entry = _entries[index];
+    int length = snprintf(line, sizeof(line), "%s %u %lu %lu\n", entry.name, entry.frame_count,
+      (unsigned long)entry.file_size, (unsigned long)entry.memory_size);
+
+    file.write((const uint8_t*)line, length);
+  }
+
+  file.close();
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+ * @file frame_decoder.cpp
+ * @authors mia
+ * @brief Decodes uploads chunk by chunk straight into the frame slots.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "Rendering/frame_decoder.hpp"
+
+namespace Rendering
+{
+
+FrameDecoder::FrameDecoder(Renderer* renderer) : _renderer(renderer) {}
+
+FrameDecoder::~FrameDecoder()
+{
+  free(_header);
+  free(_record);
+}
+
+// Forgets about the previous upload, total_size is the size the request announced.
+void FrameDecoder::begin(size_t total_size, const char* name)
+{
+  free(_header);
+
+  _total_size = total_size;
+  strncpy(_name, name, LIBRARY_NAME_LENGTH - 1);
+  _name[LIBRARY_NAME_LENGTH - 1] = '\0';
+  _prefix_size = 0;
+  _header = NULL;
+  _header_size = 0;
+  _header_received = 0;
+  _header_read = false;
+  _rejected = false;
+  _record_size = 0;
+  _record_offset = 0;
+  _frame = 0;
+}
+
+// Takes the next chunk of the upload, final marks the last one.
+void FrameDecoder::write(const uint8_t* data, size_t length, bool final)
+{
+  if (!_header_read && !_read_header(data, length, final))
+    return;
+
+  _read_records(data, length);
+}
+
+bool FrameDecoder::is_rejected() { return _rejected; }
+
+// The amount of complete frames so far, including the ones that didn't fit into the memory.
+uint16_t FrameDecoder::get_frame_count() { return _frame; }
+
+// Collects the header and lets the renderer prepare the frames with it.
+// Returns true once that happened, data then points to whatever is left of the chunk.
+bool FrameDecoder::_read_header(const uint8_t*& data, size_t& length, bool final)
+{
+  if (_header == NULL)
+  {
+    size_t count = min(length, sizeof(_prefix) - _prefix_size);
+
+    memcpy(_prefix + _prefix_size, data, count);
+    _prefix_size += count;
+    data += count;
+    length -= count;
+
+    // Short uploads might not even have a whole prefix.
+    if (_prefix_size < sizeof(_prefix) && !final)
+      return false;
+
+    // Uploads without a header still need the prefix, it's already part of the first frame.
+    _header_size = Renderer::get_frame_header_size(_prefix, _prefix_size);
+    _header = (uint8_t*)ps_malloc(max(_header_size, _prefix_size));
+
+    if (_header == NULL)
+    {
+      ESP_LOGE(TAG, "Couldn't allocate the header of the upload!");
+      _header_read = true;
+      _rejected = true;
+      return false;
+    }
+
+    memcpy(_header, _prefix, _prefix_size);
+    _header_received = _prefix_size;
+  }
+
+  if (_header_received < _header_size)
+  {
+    size_t count = min(length, _header_size - _header_received);
+
+    memcpy(_header + _header_received, data, count);
+    _header_received += count;
+    data += count;
+    length -= count;
+
+    if (_header_received < _header_size)
+      return false;
+  }
+
+  _header_read = true;
+  _record_size = _renderer->prepare_frames(_header, _header_size,
+    _total_size > _header_size ? _total_size - _header_size : 0, _name);
+  _rejected = _record_size == 0 || !_reserve_record();
+
+  // Whatever of the prefix isn't header belongs to the first frame.
+  if (!_rejected)
+    _read_records(_header + _header_size, _header_received - _header_size);
+
+  free(_header);
+  _header = NULL;
+
+  return !_rejected;
+}
+
+// Hands every piece of a record to the renderer right away, or collects compressed ones.
+void FrameDecoder::_read_records(const uint8_t* data, size_t length)
+{
+  // Whatever doesn't fit gets streamed from the file once the upload is done.
+  uint16_t capacity = _renderer->get_frame_capacity();
+  bool compressed = _renderer->is_compressed();
+
+  while (length > 0 && _record_size > 0)
+  {
+    size_t count = min(length, _record_size - _record_offset);
+
+    if (_frame < capacity && compressed)
+      memcpy(_record + _record_offset, data, count);
+    else if (_frame < capacity)
+      _renderer->write_frame(_frame, _record_offset, data, count);
+
+    _record_offset += count;
+    data += count;
+    length -= count;
+
+    if (_record_offset < _record_size)
+      return;
+
+    if (_frame < capacity && compressed)
+      _renderer->update_frame(_frame, _record);
+    else if (_frame < capacity)
+      _renderer->finish_frame(_frame);
+
+    _frame++;
+    _record_offset = 0;
+
+    // Compressed frames all differ in size.
+    _record_size = _renderer->get_record_size(_frame);
+
+    if (!_reserve_record())
+      _record_size = 0;
+  }
+}
+
+// Makes sure a compressed record of the current size fits into the record buffer.
+bool FrameDecoder::_reserve_record()
+{
+  if (!_renderer->is_compressed() || _record_size <= _record_capacity)
+    return true;
+
+  free(_record);
+  _record = (uint8_t*)ps_malloc(_record_size);
+  _record_capacity = _record == NULL ? 0 : _record_size;
+
+  if (_record == NULL)
+    ESP_LOGE(TAG, "Couldn't allocate a record of %lu bytes!", (unsigned long)_record_size);
+
+  return _record != NULL;
+}
+
+}
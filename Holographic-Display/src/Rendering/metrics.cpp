@@ -0,0 +1,129 @@
+/*
+ * @file metrics.cpp
+ * @authors mia
+ * @brief Timing histograms of the render loop.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "Rendering/metrics.hpp"
+
+#ifdef RENDER_METRICS
+
+namespace Rendering
+{
+
+uint8_t Histogram::_get_bucket(uint32_t value)
+{
+  if (value <= 1)
+    return value;
+
+  // The smallest power of two that is still bigger or equal.
+  uint8_t bucket = 1 + (32 - __builtin_clz(value - 1));
+
+  return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+uint32_t Histogram::get_bound(uint8_t bucket)
+{
+  return bucket == 0 ? 0 : 1 << (bucket - 1);
+}
+
+// There is only ever one writer, so plain loads and stores are enough.
+void Histogram::record(uint32_t value)
+{
+  std::atomic<uint32_t>& bucket = _buckets[_get_bucket(value)];
+
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  _count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  _sum.store(_sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+
+  if (value > _max.load(std::memory_order_relaxed))
+    _max.store(value, std::memory_order_relaxed);
+}
+
+void TaskLoad::record(uint32_t busy_us)
+{
+  int64_t now_us = esp_timer_get_time();
+
+  if (_window_start_us == 0)
+    _window_start_us = now_us - busy_us;
+
+  _busy_us += busy_us;
+
+  int64_t window_us = now_us - _window_start_us;
+
+  if (window_us < TASK_LOAD_WINDOW_MS * 1000)
+    return;
+
+  _load_permille.store(std::min((int64_t)_busy_us * 1000 / window_us, (int64_t)1000), std::memory_order_relaxed);
+  _window_end_ms.store(now_us / 1000, std::memory_order_relaxed);
+  _window_start_us = now_us;
+  _busy_us = 0;
+}
+
+// A task that stopped working doesn't record anything that would close its window, so that's idle.
+uint16_t TaskLoad::get_load_permille() const
+{
+  if (millis() - _window_end_ms.load(std::memory_order_relaxed) > 2 * TASK_LOAD_WINDOW_MS)
+    return 0;
+
+  return _load_permille.load(std::memory_order_relaxed);
+}
+
+void IRAM_ATTR RenderMetrics::on_tick(int64_t time_us)
+{
+  _tick_cycles = get_cycle_count();
+  _tick_time_us = time_us;
+  _tick_core = xPortGetCoreID();
+}
+
+void RenderMetrics::on_wake(uint32_t notifications)
+{
+  _wake_cycles = get_cycle_count();
+
+  // The cycle counters of the two cores aren't in sync, so only compare them on the same one.
+  if (_tick_core == xPortGetCoreID())
+    isr_latency.record(cycles_to_us(_wake_cycles - _tick_cycles));
+  else
+    isr_latency.record(esp_timer_get_time() - _tick_time_us);
+
+  // Every tick the task didn't get to in time is a slice that never got shown.
+  if (notifications > 1)
+  {
+    _rotation_missed_slices += notifications - 1;
+    _missed_slices.store(get_missed_slices() + notifications - 1, std::memory_order_relaxed);
+  }
+}
+
+void RenderMetrics::on_slice_done(uint32_t start_cycles, uint32_t slice_period_us)
+{
+  uint32_t end_cycles = get_cycle_count();
+
+  compute_time.record(cycles_to_us(end_cycles - start_cycles));
+  display_load.record(cycles_to_us(end_cycles - _wake_cycles));
+  _slices.store(get_slices() + 1, std::memory_order_relaxed);
+
+  // The next tick comes one period after the one that woke us up.
+  if (cycles_to_us(end_cycles - _wake_cycles) > slice_period_us)
+  {
+    _rotation_late_slices++;
+    _late_slices.store(get_late_slices() + 1, std::memory_order_relaxed);
+  }
+}
+
+void RenderMetrics::on_rotation()
+{
+  missed_per_rotation.record(_rotation_missed_slices);
+  late_per_rotation.record(_rotation_late_slices);
+
+  _rotation_missed_slices = 0;
+  _rotation_late_slices = 0;
+  _rotations.store(get_rotations() + 1, std::memory_order_relaxed);
+}
+
+}
+
+#endif
@@ -15,341 +15,2731 @@ namespace Rendering
 
 Renderer *g_renderer;
 
-// Clears the imageData Array.
-void Renderer::_clear_image_data()
+// The resolutions the renderer can switch between, from lowest to highest.
+static const uint16_t supported_angles_per_rotation[] = SUPPORTED_ANGLES_PER_ROTATION;
+
+// Holds the loader mutex until it goes out of scope. The loader functions call each other, 
+// so the task holding it may take it again.
+class LoaderLock
+{
+private:
+    SemaphoreHandle_t _mutex;
+public:
+    LoaderLock(SemaphoreHandle_t mutex) : _mutex(mutex) { xSemaphoreTakeRecursive(_mutex, portMAX_DELAY); }
+    ~LoaderLock() { xSemaphoreGiveRecursive(_mutex); }
+};
+
+// Generates ready-to-use pixel offsets for every slice of the highest resolution, 
+// so the render loop doesn't have to do any coordinate math. 
+// Lower resolutions just skip over rows.
+void Renderer::_build_pixel_offsets()
+{
+  for (uint16_t row = 0; row < PIXEL_OFFSET_ROWS; row++)
+  {
+    uint16_t* offsets = _pixel_offsets + row * LEDS_PER_SLICE;
+    // Go through degrees like the Conversionmatrix-Generator does, so the rows
+    // of whole degrees come out exactly the same.
+    double degrees = row * 360.0 / MAX_ANGLES_PER_ROTATION;
+    double theta = degrees * M_PI / 180.0;
+    double opposite_theta = (degrees + 180.0) * M_PI / 180.0;
+
+    // The first arm goes from the outer edge inwards.
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SIDE; led_index++)
+      offsets[led_index] = _get_pixel_offset(theta, LEDS_PER_SIDE - led_index - 1);
+
+    // The second arm goes from the center outwards on the opposite side.
+    for (uint8_t led_index = LEDS_PER_SIDE; led_index < LEDS_PER_SLICE; led_index++)
+      offsets[led_index] = _get_pixel_offset(opposite_theta, led_index - LEDS_PER_SIDE);
+  }
+}
+
+// Same math as the Conversionmatrix-Generator.
+uint16_t Renderer::_get_pixel_offset(double theta, uint8_t radius)
+{
+  int x = (int)round(LEDS_PER_SIDE + radius * cos(theta));
+  int y = (int)round(LEDS_PER_SIDE + radius * sin(theta));
+
+  return y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - x);
+}
+
+// Cartesian frames only store the pixels the LEDs can ever show, in the order the 
+// slices go through them. The Conversionmatrix-Generator prints the same layout.
+// Has to run right after the pixel offsets are built, it remaps them into the sparse frames.
+void Renderer::_build_sparse_layout()
+{
+  uint32_t* order = (uint32_t*)heap_caps_malloc(IMAGE_SIZE_PIXELS * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+
+  if (order == NULL || _pixel_remap == NULL || _sparse_pixels == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the sparse frame layout!");
+    free(order);
+    return;
+  }
+
+  for (uint32_t offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+    _pixel_remap[offset] = SPARSE_NO_PIXEL;
+
+  // Everything the pixel offset table references...
+  for (uint32_t index = 0; index < PIXEL_OFFSET_ROWS * LEDS_PER_SLICE; index++)
+    _pixel_remap[_pixel_offsets[index]] = 0;
+
+  // ...and everything anti-aliasing can blend in.
+  for (uint32_t offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+  {
+    double dx = (double)(IMAGE_LENGTH_PIXELS - offset % IMAGE_LENGTH_PIXELS) - LEDS_PER_SIDE;
+    double dy = (double)(offset / IMAGE_LENGTH_PIXELS) - LEDS_PER_SIDE;
+
+    if (dx * dx + dy * dy <= SPARSE_PIXEL_RADIUS * SPARSE_PIXEL_RADIUS)
+      _pixel_remap[offset] = 0;
+  }
+
+  uint16_t count = 0;
+
+  for (uint32_t offset = 0; offset < IMAGE_SIZE_PIXELS; offset++)
+    if (_pixel_remap[offset] != SPARSE_NO_PIXEL)
+      order[count++] = _get_sparse_order(offset) * IMAGE_SIZE_PIXELS + offset;
+
+  std::sort(order, order + count);
+
+  for (uint16_t index = 0; index < count; index++)
+  {
+    uint16_t offset = order[index] % IMAGE_SIZE_PIXELS;
+
+    _sparse_pixels[index] = offset;
+    _pixel_remap[offset] = index;
+  }
+
+  free(order);
+  _sparse_pixel_count = count;
+  _sparse_layout_hash = get_layout_hash(_sparse_pixels, count);
+
+  // From now on the pixel offsets point into the sparse frames.
+  for (uint32_t index = 0; index < PIXEL_OFFSET_ROWS * LEDS_PER_SLICE; index++)
+    _pixel_offsets[index] = _pixel_remap[_pixel_offsets[index]];
+
+  ESP_LOGI(TAG, "Cartesian frames store %d of %d pixels", count, IMAGE_SIZE_PIXELS);
+}
+
+// Sorts pixels by the row of the pixel offset table closest to them, 
+// then by the LED of that row that passes over them.
+uint32_t Renderer::_get_sparse_order(uint16_t offset)
+{
+  double dx = (double)(IMAGE_LENGTH_PIXELS - offset % IMAGE_LENGTH_PIXELS) - LEDS_PER_SIDE;
+  double dy = (double)(offset / IMAGE_LENGTH_PIXELS) - LEDS_PER_SIDE;
+  double degrees = atan2(dy, dx) * 180.0 / M_PI;
+  uint8_t radius = (uint8_t)min(round(sqrt(dx * dx + dy * dy)), (double)LEDS_PER_SIDE);
+  uint8_t position;
+
+  if (degrees < 0)
+    degrees += 360.0;
+
+  // The first arm goes from the outer edge inwards, the second one 
+  // shows the other half of the rotation from the center outwards.
+  if (degrees < 180.0)
+  {
+    position = LEDS_PER_SIDE - radius;
+  }
+  else
+  {
+    position = LEDS_PER_SIDE + radius;
+    degrees -= 180.0;
+  }
+
+  uint16_t row = (uint16_t)round(degrees * MAX_ANGLES_PER_ROTATION / 360.0) % PIXEL_OFFSET_ROWS;
+
+  return row * (LEDS_PER_SLICE + 1) + position;
+}
+
+// Builds the anti-aliasing table in PSRAM, if it doesn't exist yet.
+bool Renderer::_build_anti_aliasing_table()
+{
+  if (_anti_aliasing_table.load(std::memory_order_acquire) != NULL)
+    return true;
+
+  AntiAliasingRow* table = (AntiAliasingRow*)heap_caps_aligned_alloc(
+    VECTOR_ALIGNMENT,
+    SLICES_PER_HALF_ROTATION * sizeof(AntiAliasingRow),
+    MALLOC_CAP_SPIRAM
+  );
+
+  if (table == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the anti-aliasing table!");
+    return false;
+  }
+
+  unsigned long start = micros();
+
+  for (uint16_t row = 0; row < SLICES_PER_HALF_ROTATION; row++)
+  {
+    float degrees = row * 360.0f / ANGLES_PER_ROTATION;
+
+    // Same order of LEDs as the pixel offset table.
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SIDE; led_index++)
+      _build_anti_aliasing_taps(degrees, LEDS_PER_SIDE - led_index - 1, table + row, led_index);
+
+    for (uint8_t led_index = LEDS_PER_SIDE; led_index < LEDS_PER_SLICE; led_index++)
+      _build_anti_aliasing_taps(degrees + 180.0f, led_index - LEDS_PER_SIDE, table + row, led_index);
+  }
+
+  ESP_LOGI(TAG, "Built the anti-aliasing table in %lu μs", micros() - start);
+
+  _anti_aliasing_table.store(table, std::memory_order_release);
+  return true;
+}
+
+// Figures out how much of every pixel the footprint of a single LED covers,
+// by sampling it on a grid in polar coordinates, and keeps the biggest ones.
+void Renderer::_build_anti_aliasing_taps(float degrees, float radius, AntiAliasingRow* row, uint8_t led_index)
+{
+  const uint8_t max_pixels = AA_SUBSAMPLES * AA_SUBSAMPLES;
+  uint16_t pixels[max_pixels];
+  float coverage[max_pixels];
+  uint8_t pixel_count = 0;
+  float slice_degrees = 360.0f / ANGLES_PER_ROTATION;
+
+  for (uint8_t angle_step = 0; angle_step < AA_SUBSAMPLES; angle_step++)
+  {
+    float theta = (degrees + ((angle_step + 0.5f) / AA_SUBSAMPLES - 0.5f) * slice_degrees) * M_PI / 180.0f;
+    float cos_theta = cosf(theta);
+    float sin_theta = sinf(theta);
+
+    for (uint8_t radius_step = 0; radius_step < AA_SUBSAMPLES; radius_step++)
+    {
+      float sample_radius = radius + (radius_step + 0.5f) / AA_SUBSAMPLES - 0.5f;
+
+      // Stay inside of the image, the outermost LEDs reach a bit over the edge.
+      int x = constrain((int)roundf(LEDS_PER_SIDE + sample_radius * cos_theta), 1, IMAGE_LENGTH_PIXELS);
+      int y = constrain((int)roundf(LEDS_PER_SIDE + sample_radius * sin_theta), 0, IMAGE_LENGTH_PIXELS - 1);
+      // Everything in reach is part of the sparse frames.
+      uint16_t offset = _pixel_remap[y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - x)];
+
+      // The grid is even in polar coordinates, so the samples further out cover more area.
+      float area = fabsf(sample_radius);
+      uint8_t pixel = 0;
+
+      while (pixel < pixel_count && pixels[pixel] != offset)
+        pixel++;
+
+      if (pixel == pixel_count)
+      {
+        pixels[pixel_count] = offset;
+        coverage[pixel_count++] = 0;
+      }
+
+      coverage[pixel] += area;
+    }
+  }
+
+  // Move the biggest pixels to the front.
+  uint8_t taps = min(pixel_count, (uint8_t)AA_TAPS);
+  float total_coverage = 0;
+
+  for (uint8_t tap = 0; tap < taps; tap++)
+  {
+    uint8_t biggest = tap;
+
+    for (uint8_t pixel = tap + 1; pixel < pixel_count; pixel++)
+      if (coverage[pixel] > coverage[biggest])
+        biggest = pixel;
+
+    swap(pixels[tap], pixels[biggest]);
+    swap(coverage[tap], coverage[biggest]);
+    total_coverage += coverage[tap];
+  }
+
+  // Quantize the weights and hand whatever got lost to rounding to the biggest one.
+  int16_t remaining = 1 << AA_WEIGHT_BITS;
+
+  for (uint8_t tap = 0; tap < AA_TAPS; tap++)
+  {
+    int16_t weight = 0;
+
+    if (tap < taps && total_coverage > 0)
+      weight = (int16_t)roundf(coverage[tap] / total_coverage * (1 << AA_WEIGHT_BITS));
+
+    // Unused taps still need a valid pixel to read from.
+    row->offsets[tap][led_index] = pixels[tap < taps ? tap : 0];
+    row->weights[tap][led_index] = weight;
+    remaining -= weight;
+  }
+
+  row->weights[0][led_index] += remaining;
+}
+
+// The PIE instructions can't be tested anywhere but on the chip, 
+// so compare them against the scalar kernel once at startup.
+void Renderer::_check_vector_kernel()
+{
+  AntiAliasingScratch* scratch = &_render_scratch;
+  alignas(VECTOR_ALIGNMENT) int16_t weights[LEDS_PER_SLICE];
+
+  for (uint8_t lane = 0; lane < LEDS_PER_SLICE; lane++)
+  {
+    scratch->samples[0][lane] = (lane * 37) & 0xFF;
+    weights[lane] = lane % ((1 << AA_WEIGHT_BITS) + 1);
+    scratch->accumulators[0][lane] = scratch->accumulators[1][lane] = lane;
+  }
+
+  // The brightest sample at full weight on top of the rounding half, the highest a blend ever gets.
+  uint8_t last = LEDS_PER_SLICE - 1;
+
+  scratch->samples[0][last] = 255;
+  weights[last] = 1 << AA_WEIGHT_BITS;
+  scratch->accumulators[0][last] = scratch->accumulators[1][last] = 1 << (AA_WEIGHT_BITS - 1);
+
+  multiply_accumulate(scratch->accumulators[0], scratch->samples[0], weights, LEDS_PER_SLICE);
+  multiply_accumulate_scalar(scratch->accumulators[1], scratch->samples[0], weights, LEDS_PER_SLICE);
+
+  if (memcmp(scratch->accumulators[0], scratch->accumulators[1], sizeof(scratch->accumulators[0])) != 0)
+  {
+    ESP_LOGE(TAG, "The vectorised kernel is broken, falling back to the scalar one!");
+    _use_vector_kernel = false;
+  }
+}
+
+// Blends the pixels every LED of the row covers together, one LED per lane.
+// Without a palette the frame holds RGB pixels, otherwise indices into the palette.
+void Renderer::_sample_anti_aliased(const uint8_t* frame, const RGB* palette, const AntiAliasingRow* row, AntiAliasingScratch* scratch)
+{
+  // Start at one half, so shifting the fraction out later rounds instead of truncating.
+  for (uint8_t channel = 0; channel < 3; channel++)
+    for (uint8_t lane = 0; lane < LEDS_PER_SLICE; lane++)
+      scratch->accumulators[channel][lane] = 1 << (AA_WEIGHT_BITS - 1);
+
+  for (uint8_t tap = 0; tap < AA_TAPS; tap++)
+  {
+    const uint16_t* offsets = row->offsets[tap];
+
+    // There is no gather instruction, so this part stays scalar.
+    for (uint8_t lane = 0; lane < LEDS_PER_SLICE; lane++)
+    {
+      const RGB& pixel = palette == NULL ? 
+        ((const RGB*)frame)[offsets[lane]] : palette[frame[offsets[lane]]];
+
+      scratch->samples[0][lane] = pixel.r;
+      scratch->samples[1][lane] = pixel.g;
+      scratch->samples[2][lane] = pixel.b;
+    }
+
+    for (uint8_t channel = 0; channel < 3; channel++)
+    {
+      if (_use_vector_kernel)
+        multiply_accumulate(scratch->accumulators[channel], scratch->samples[channel], row->weights[tap], LEDS_PER_SLICE);
+      else
+        multiply_accumulate_scalar(scratch->accumulators[channel], scratch->samples[channel], row->weights[tap], LEDS_PER_SLICE);
+    }
+  }
+}
+
+RGB Renderer::_get_sampled_color(const AntiAliasingScratch* scratch, uint8_t led_index)
+{
+  return RGB(
+    scratch->accumulators[0][led_index] >> AA_WEIGHT_BITS,
+    scratch->accumulators[1][led_index] >> AA_WEIGHT_BITS,
+    scratch->accumulators[2][led_index] >> AA_WEIGHT_BITS
+  );
+}
+
+void Renderer::_print_image_data(uint16_t frame)
+{
+  ESP_LOGI(TAG, "\n\nFrame: %d\nDelay: %d ms\n", frame, _loading_frames->delays[frame]);
+
+  if (_frame_layout != FrameLayout::CARTESIAN || _frame_format != FrameFormat::RGB)
+  {
+    ESP_LOGW(TAG, "Only cartesian RGB frames can be printed!");
+    return;
+  }
+
+  const RGB* pixels = (const RGB*)_get_frame(frame);
+
+  char buffer[IMAGE_LENGTH_PIXELS + 1];
+  buffer[IMAGE_LENGTH_PIXELS] = '\0';
+
+  for (uint8_t x = 0; x < IMAGE_LENGTH_PIXELS; x++)
+  {
+    for (uint8_t y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+    {
+      uint16_t index = _pixel_remap[y * IMAGE_LENGTH_PIXELS + x];
+      
+      if (index == SPARSE_NO_PIXEL)
+        buffer[y] = ' ';
+      else
+        buffer[y] = pixels[index].r == 255 ? '#' : '.';
+    }
+    
+    ESP_LOGI(TAG, "%s", buffer);
+  }
+
+  ESP_LOGI(TAG, "\n\n- - - - - - - - - - - - - - - - - - - - \n");
+}
+
+void Renderer::_print_first_pixel()
+{
+  for (uint8_t frame = 0; frame < _loading_frames->max_frame - 1; frame++)
+  {
+    RGB color = *(const RGB*)_get_frame(frame);
+
+    ESP_LOGI(TAG, "r: %d, g: %d, b: %d", color.r, color.g, color.b);
+  }
+
+  ESP_LOGI(TAG, "\n\n- - - - - - - - - - - - - - - - - - - - \n");
+}
+
+void Renderer::_show()
+{
+  spi_transaction_t* transaction = &_transactions[_next_buffer];
+#ifdef RENDER_METRICS
+  uint32_t start_cycles = get_cycle_count();
+#endif
+
+  transaction->length = SLICE_BUFFER_SIZE_BYTES * 8; // Bits!
+  transaction->user = NULL;
+  transaction->tx_buffer = _led_buffer;
+   
+  // Non blocking transfer.
+  spi_device_queue_trans(_spi, transaction, portMAX_DELAY);
+  _transactions_in_flight++;
+
+  // Move on to the next buffer of the ring, so we never write into a buffer 
+  // that the DMA is still reading from.
+  _next_buffer = (_next_buffer + 1) % SLICE_BUFFER_COUNT;
+  _acquire_slice_buffer();
+
+#ifdef RENDER_METRICS
+  _metrics.spi_wait.record(cycles_to_us(get_cycle_count() - start_cycles));
+#endif
+}
+
+// Makes sure the next buffer of the ring isn't owned by the DMA anymore.
+void Renderer::_acquire_slice_buffer()
+{
+  spi_transaction_t* finished_transaction;
+
+  // Reap all the transactions that are already done.
+  while (_transactions_in_flight > 0 
+    && spi_device_get_trans_result(_spi, &finished_transaction, 0) == ESP_OK)
+    _transactions_in_flight--;
+
+  // Transactions finish in order, so if the whole ring is still in flight, 
+  // the next buffer is the oldest one and the SPI can't keep up with the slices.
+  if (_transactions_in_flight == SLICE_BUFFER_COUNT)
+  {
+    _spi_overruns++;
+
+    spi_device_get_trans_result(_spi, &finished_transaction, portMAX_DELAY);
+    _transactions_in_flight--;
+  }
+
+  _led_buffer = _led_buffers[_next_buffer];
+}
+
+void Renderer::_change_led(uint8_t index, RGB color)
+{
+  _write_led(_led_buffer + 4 + (index * 4), 0xE0 | _current_brightness, color);
+}
+
+// The brightness byte of the LED goes first, then the colors in BGR order.
+void Renderer::_write_led(uint8_t* led, uint8_t global, RGB color)
+{
+  led[0] = global;
+  led[1] = color.b;
+  led[2] = color.g;
+  led[3] = color.r;
+}
+
+// Applies the color adjustments before writing the LED.
+void Renderer::_write_led_adjusted(uint8_t* led, uint8_t global, RGB color, const ColorTables* tables)
+{
+  color.r = tables->red[color.r];
+  color.g = tables->green[color.g];
+  color.b = tables->blue[color.b];
+
+  _write_led(led, global, color);
+}
+
+void Renderer::_copy_to_frame_buffer(uint16_t frame, const uint8_t* data)
+{
+  if (frame >= _loading_frames->slot_count)
+  {
+    ESP_LOGE(TAG, "Too many frames, buffer overflow!!!");
+    return;
+  }
+
+  _decode_frame(frame, frame, data);
+  _complete_frame(frame);
+}
+
+// The frame is complete, so the render task may show it from now on.
+void Renderer::_complete_frame(uint16_t frame)
+{
+  _loading_frames->max_frame.store(frame, std::memory_order_release);
+
+  if (frame + 1 == _loading_frame_count)
+    _add_resident();
+
+  ESP_LOGD(TAG, "Setting max frame to : %d", frame);
+  
+  // Hand the new frames over as soon as there is something to show.
+  if (frame == 0)
+    _publish_frame_set();
+}
+
+// Converts the record of the given frame of the data file / upload into the frame slot.
+void Renderer::_decode_frame(uint16_t slot, uint16_t frame, const uint8_t* data)
+{
+  if (_compressed)
+  {
+    _decode_compressed_frame(slot, frame, data);
+    return;
+  }
+
+  // Extract the delay data from the frame.
+  uint16_t delay;
+  memcpy(&delay, data, 2);
+  _loading_frames->delays[slot] = delay;
+
+  uint8_t* destination = _get_frame(slot);
+  const uint8_t* pixels = data + 2;
+
+  if (_frame_format == FrameFormat::INDEXED)
+  {
+    // Every frame gets its own copy of the palette, even if they all share one.
+    if (_has_shared_palette)
+    {
+      memcpy(destination, _shared_palette, PALETTE_SIZE_BYTES);
+    }
+    else
+    {
+      memcpy(destination, pixels, PALETTE_SIZE_BYTES);
+      pixels += PALETTE_SIZE_BYTES;
+    }
+
+    if (_frame_layout == FrameLayout::POLAR)
+    {
+      _pack_indices(pixels, _conversion_buffer);
+      _polarize_indices(_conversion_buffer, destination + PALETTE_SIZE_BYTES);
+    }
+    else
+    {
+      _pack_indices(pixels, destination + PALETTE_SIZE_BYTES);
+    }
+
+    _palette_generation.fetch_add(1, std::memory_order_release);
+  }
+  // Copy the frame data into the PSRAM image buffer at the given frame index.
+  else if (_frame_layout == FrameLayout::POLAR)
+  {
+    _pack_frame((const RGB*)pixels, (RGB*)_conversion_buffer);
+    _polarize_frame((const RGB*)_conversion_buffer, (RGB*)destination);
+  }
+  else
+  {
+    _pack_frame((const RGB*)pixels, (RGB*)destination);
+  }
+}
+
+// Puts part of an uncompressed record right where it ends up in the slot, see write_frame().
+void Renderer::_write_record(uint16_t slot, size_t offset, const uint8_t* data, size_t length)
+{
+  uint8_t* destination = _get_frame(slot);
+  uint8_t pixel_size = _frame_format == FrameFormat::INDEXED ? 1 : sizeof(RGB);
+  size_t pixels_start = 2 + (_frame_format == FrameFormat::INDEXED && !_has_shared_palette ? PALETTE_SIZE_BYTES : 0);
+
+  // The delay, which might just as well be split up.
+  for (; length > 0 && offset < 2; offset++, data++, length--)
+    ((uint8_t*)&_loading_frames->delays[slot])[offset] = *data;
+
+  // The palette goes to the front of the slot as it is.
+  if (length > 0 && offset < pixels_start)
+  {
+    size_t count = min(length, pixels_start - offset);
+
+    memcpy(destination + offset - 2, data, count);
+    offset += count;
+    data += count;
+    length -= count;
+  }
+
+  // Polar frames collect the sparse pixels in the conversion buffer, until the whole frame is there.
+  uint8_t* pixels = _frame_layout == FrameLayout::POLAR ? _conversion_buffer : destination;
+
+  if (_frame_layout == FrameLayout::CARTESIAN && _frame_format == FrameFormat::INDEXED)
+    pixels += PALETTE_SIZE_BYTES;
+
+  size_t position = offset - pixels_start;
+  size_t end = min(position + length, (size_t)IMAGE_SIZE_PIXELS * pixel_size);
+
+  if (position >= end)
+    return;
+
+  size_t pixel = position / pixel_size;
+  uint8_t byte = position - pixel * pixel_size;
+
+  // The rest of a pixel that got split between two chunks.
+  if (byte > 0)
+  {
+    size_t count = min(end - position, (size_t)(pixel_size - byte));
+
+    if (_pixel_remap[pixel] != SPARSE_NO_PIXEL)
+      memcpy(pixels + _pixel_remap[pixel] * pixel_size + byte, data, count);
+
+    position += count;
+    data += count;
+    pixel++;
+  }
+
+  size_t whole_pixels = position < end ? (end - position) / pixel_size : 0;
+
+  if (pixel_size == 1)
+  {
+    for (size_t index = 0; index < whole_pixels; index++)
+      if (_pixel_remap[pixel + index] != SPARSE_NO_PIXEL)
+        pixels[_pixel_remap[pixel + index]] = data[index];
+  }
+  else
+  {
+    for (size_t index = 0; index < whole_pixels; index++)
+      if (_pixel_remap[pixel + index] != SPARSE_NO_PIXEL)
+        ((RGB*)pixels)[_pixel_remap[pixel + index]] = ((const RGB*)data)[index];
+  }
+
+  position += whole_pixels * pixel_size;
+  data += whole_pixels * pixel_size;
+  pixel += whole_pixels;
+
+  // The start of a pixel that continues in the next chunk.
+  if (position < end && _pixel_remap[pixel] != SPARSE_NO_PIXEL)
+    memcpy(pixels + _pixel_remap[pixel] * pixel_size, data, end - position);
+}
+
+// Converts the frame, once all of its record went through _write_record().
+void Renderer::_finish_record(uint16_t slot)
+{
+  uint8_t* destination = _get_frame(slot);
+
+  if (_frame_format == FrameFormat::INDEXED)
+  {
+    if (_has_shared_palette)
+      memcpy(destination, _shared_palette, PALETTE_SIZE_BYTES);
+
+    if (_frame_layout == FrameLayout::POLAR)
+      _polarize_indices(_conversion_buffer, destination + PALETTE_SIZE_BYTES);
+
+    _palette_generation.fetch_add(1, std::memory_order_release);
+  }
+  else if (_frame_layout == FrameLayout::POLAR)
+  {
+    _polarize_frame((const RGB*)_conversion_buffer, (RGB*)destination);
+  }
+}
+
+// Compressed frames are already sparse, so they get decoded right into the slot.
+// Polar frames get decoded into the conversion buffer first, which then also 
+// keeps the previous frame around for the next one to refer to.
+void Renderer::_decode_compressed_frame(uint16_t slot, uint16_t frame, const uint8_t* data)
+{
+  const ContainerFrame& entry = _frame_index[frame];
+  const uint8_t* end = data + entry.size;
+  uint8_t* destination = _get_frame(slot);
+  uint8_t* pixels = _frame_layout == FrameLayout::POLAR ? _conversion_buffer : destination;
+  uint8_t pixel_size = sizeof(RGB);
+
+  _loading_frames->delays[slot] = entry.delay;
+
+  if (_frame_format == FrameFormat::INDEXED)
+  {
+    if (_has_shared_palette)
+    {
+      memcpy(destination, _shared_palette, PALETTE_SIZE_BYTES);
+    }
+    else
+    {
+      memcpy(destination, data, PALETTE_SIZE_BYTES);
+      data += PALETTE_SIZE_BYTES;
+    }
+
+    if (_frame_layout == FrameLayout::CARTESIAN)
+      pixels += PALETTE_SIZE_BYTES;
+
+    pixel_size = 1;
+  }
+
+  const uint8_t* reference = entry.flags & CONTAINER_KEYFRAME ? NULL : _previous_frame;
+
+  if (!decode_frame(data, end - data, pixels, reference, _sparse_pixel_count, pixel_size))
+  {
+    ESP_LOGE(TAG, "Frame %d is corrupt!", frame);
+    memset(pixels, 0, _sparse_pixel_count * pixel_size);
+  }
+
+  _previous_frame = pixels;
+
+  if (_frame_layout == FrameLayout::POLAR && _frame_format == FrameFormat::INDEXED)
+    _polarize_indices(_conversion_buffer, destination + PALETTE_SIZE_BYTES);
+  else if (_frame_layout == FrameLayout::POLAR)
+    _polarize_frame((const RGB*)_conversion_buffer, (RGB*)destination);
+
+  if (_frame_format == FrameFormat::INDEXED)
+    _palette_generation.fetch_add(1, std::memory_order_release);
+}
+
+// Drops every pixel of the image the LEDs never show.
+void Renderer::_pack_frame(const RGB* source, RGB* destination)
+{
+  for (uint16_t index = 0; index < _sparse_pixel_count; index++)
+    destination[index] = source[_sparse_pixels[index]];
+}
+
+void Renderer::_pack_indices(const uint8_t* source, uint8_t* destination)
+{
+  for (uint16_t index = 0; index < _sparse_pixel_count; index++)
+    destination[index] = source[_sparse_pixels[index]];
+}
+
+// Resamples a sparse cartesian frame into one diameter per slice.
+// The rows of the pixel offset table are already in exactly that order.
+void Renderer::_polarize_frame(const RGB* source, RGB* destination)
+{
+  static_assert(MAX_ANGLES_PER_ROTATION % ANGLES_PER_ROTATION == 0, 
+    "Polar frames have to use one of the pixel offset table resolutions!");
+
+  // The anti-aliasing table has exactly the rows of a polar frame.
+  const AntiAliasingRow* anti_aliasing_table = _options.read().anti_aliasing ?
+    _anti_aliasing_table.load(std::memory_order_acquire) : NULL;
+
+  for (uint16_t row = 0; row < SLICES_PER_HALF_ROTATION; row++)
+  {
+    if (anti_aliasing_table != NULL)
+    {
+      _sample_anti_aliased((const uint8_t*)source, NULL, anti_aliasing_table + row, &_polarize_scratch);
+
+      for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+        *destination++ = _get_sampled_color(&_polarize_scratch, led_index);
+
+      continue;
+    }
+
+    const uint16_t* offsets = _pixel_offsets 
+      + row * (MAX_ANGLES_PER_ROTATION / ANGLES_PER_ROTATION) * LEDS_PER_SLICE;
+
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+      *destination++ = source[offsets[led_index]];
+  }
+}
+
+// Same as polarizing RGB frames, just with the nearest pixel instead of anti-aliasing.
+// Blending indices doesn't make any sense.
+void Renderer::_polarize_indices(const uint8_t* source, uint8_t* destination)
+{
+  for (uint16_t row = 0; row < SLICES_PER_HALF_ROTATION; row++)
+  {
+    const uint16_t* offsets = _pixel_offsets 
+      + row * (MAX_ANGLES_PER_ROTATION / ANGLES_PER_ROTATION) * LEDS_PER_SLICE;
+
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+      *destination++ = source[offsets[led_index]];
+  }
+}
+
+// Pre-polarized frames are bigger, so only use them if the whole animation still fits.
+// Indexed frames can only be anti-aliased while rendering, so they have to stay cartesian for it.
+void Renderer::_choose_frame_layout(uint16_t frame_count)
+{
+  _frame_layout = FrameLayout::POLAR;
+
+  if ((_frame_format == FrameFormat::INDEXED && _options.read().anti_aliasing) 
+    || frame_count > get_frame_capacity())
+    _frame_layout = FrameLayout::CARTESIAN;
+
+  ESP_LOGD(TAG, "Using %s %s frames for %d frames, %d fit", 
+    _frame_layout == FrameLayout::POLAR ? "polar" : "cartesian",
+    _frame_format == FrameFormat::INDEXED ? "indexed" : "RGB",
+    frame_count,
+    get_frame_capacity()
+  );
+}
+
+size_t Renderer::_get_frame_size_bytes()
+{
+  size_t pixels = _frame_layout == FrameLayout::POLAR ? 
+    POLAR_FRAME_SIZE_PIXELS : _sparse_pixel_count;
+
+  if (_frame_format == FrameFormat::INDEXED)
+    return PALETTE_SIZE_BYTES + pixels;
+
+  return pixels * sizeof(RGB);
+}
+
+// The size of a frame inside of the data file / upload, including its delay.
+// Compressed frames differ in size, this is only for the other formats.
+size_t Renderer::_get_record_size_bytes()
+{
+  if (_frame_format == FrameFormat::RGB)
+    return FRAME_RECORD_SIZE_BYTES;
+
+  return 2 + (_has_shared_palette ? 0 : PALETTE_SIZE_BYTES) + INDEXED_IMAGE_SIZE_BYTES;
+}
+
+size_t Renderer::_get_max_record_size()
+{
+  if (!_compressed)
+    return _get_record_size_bytes();
+
+  size_t max_size = 0;
+
+  for (uint16_t frame = 0; frame < _frame_index_count; frame++)
+    max_size = max(max_size, (size_t)get_container_span(_frame_index[frame].size));
+
+  return max_size;
+}
+
+// The slot of the frames being loaded.
+uint8_t* Renderer::_get_frame(uint16_t frame)
+{
+  return _loading_frames->frames + frame * _loading_frames->frame_size;
+}
+
+// Runs the palette of the frame through the color tables, unless that already happened.
+const RGB* Renderer::_get_resolved_palette(const uint8_t* frame, const ColorTables* tables)
+{
+  uint32_t generation = _palette_generation.load(std::memory_order_acquire);
+
+  if (frame == _resolved_palette_frame && tables == _resolved_palette_tables 
+    && generation == _resolved_palette_generation)
+    return _resolved_palette;
+
+  const RGB* palette = (const RGB*)frame;
+
+  for (uint16_t index = 0; index < 256; index++)
+  {
+    _resolved_palette[index] = RGB(
+      tables->red[palette[index].r],
+      tables->green[palette[index].g],
+      tables->blue[palette[index].b]
+    );
+  }
+
+  _resolved_palette_frame = frame;
+  _resolved_palette_tables = tables;
+  _resolved_palette_generation = generation;
+
+  return _resolved_palette;
+}
+
+// Starts a new set for frames of the current format and layout, with room for the given amount of them.
+// It goes next to the frames on display if there is room, otherwise those get swapped out first.
+// Only fails while preloading, which never changes what's on display.
+bool Renderer::_begin_frame_set(uint16_t slot_count)
+{
+  size_t frame_size = _get_frame_size_bytes();
+  size_t offset = 0;
+
+  // Animations that have to be streamed can't be preloaded.
+  if (_preloading && slot_count < _loading_frame_count)
+    return false;
+
+  // Whatever got handed over but wasn't picked up yet won't ever be shown now, unless this is a preload.
+  // If the render task takes it in the meantime, the swap fails and it's the one on display.
+  uint8_t ready = _ready_frame_set.load(std::memory_order_acquire);
+
+  if (!_preloading && (ready & FRAME_SET_FRESH))
+    _ready_frame_set.compare_exchange_strong(ready, ready & ~FRAME_SET_FRESH, std::memory_order_acq_rel);
+
+  if (!_find_frame_memory(slot_count * frame_size, offset))
+  {
+    if (_preloading)
+      return false;
+
+    // Nothing is left in the frame memory after that.
+    _show_blank_frames();
+    _resident_count = 0;
+    offset = 0;
+  }
+
+  FrameSet& frames = _frame_sets[_back_frame_set];
+
+  frames.frames = _image_data + offset;
+  frames.delays = _get_delays(offset);
+  frames.frame_size = frame_size;
+  frames.layout = _frame_layout;
+  frames.format = _frame_format;
+  frames.offset = offset;
+  frames.slot_count = slot_count;
+  frames.max_frame.store(0, std::memory_order_relaxed);
+  frames.streamed.store(false, std::memory_order_relaxed);
+  frames.live = false;
+  frames.saved = false;
+
+  _loading_frames = &frames;
+  _loading_published = false;
+
+  return true;
+}
+
+// Looks for a gap of the given size in the frame memory, that neither the frames on display,
+// the ones handed over nor any resident animation are in. Evicts the least recently used 
+// resident animations until there is one. Returns false if the frames on display are in the way.
+bool Renderer::_find_frame_memory(size_t size, size_t& offset)
+{
+  // If the render task takes the ready set in the meantime, it's still one of these two.
+  uint8_t ready = _ready_frame_set.load(std::memory_order_acquire);
+  const FrameSet* shown_sets[2] = {
+    &_frame_sets[3 - _back_frame_set - (ready & ~FRAME_SET_FRESH)],
+    ready & FRAME_SET_FRESH ? &_frame_sets[ready & ~FRAME_SET_FRESH] : NULL
+  };
+
+  while (true)
+  {
+    size_t starts[2 + LIBRARY_MAX_RESIDENT];
+    size_t ends[2 + LIBRARY_MAX_RESIDENT];
+    uint8_t count = 0;
+
+    for (const FrameSet* set : shown_sets)
+    {
+      if (set == NULL || set->slot_count == 0)
+        continue;
+
+      starts[count] = set->offset;
+      ends[count++] = set->offset + set->slot_count * set->frame_size;
+    }
+
+    for (uint8_t index = 0; index < _resident_count; index++)
+    {
+      starts[count] = _resident[index].offset;
+      ends[count++] = _resident[index].offset + _resident[index].frame_count * _resident[index].frame_size;
+    }
+
+    // Sorted by where they start, there are only a few of them.
+    for (uint8_t index = 1; index < count; index++)
+    {
+      for (uint8_t other = index; other > 0 && starts[other - 1] > starts[other]; other--)
+      {
+        std::swap(starts[other - 1], starts[other]);
+        std::swap(ends[other - 1], ends[other]);
+      }
+    }
+
+    size_t candidate = 0;
+
+    for (uint8_t index = 0; index < count && starts[index] < candidate + size; index++)
+      candidate = max(candidate, ends[index]);
+
+    if (candidate + size <= _image_data_size)
+    {
+      offset = candidate;
+      return true;
+    }
+
+    // Resident animations that are on display don't free anything up.
+    int8_t oldest = -1;
+
+    for (uint8_t index = 0; index < _resident_count; index++)
+    {
+      bool shown = false;
+
+      for (const FrameSet* set : shown_sets)
+        shown |= set != NULL && set->slot_count > 0 && set->offset == _resident[index].offset;
+
+      if (!shown && (oldest < 0 || _resident[index].last_used < _resident[oldest].last_used))
+        oldest = index;
+    }
+
+    if (oldest < 0)
+      return false;
+
+    ESP_LOGI(TAG, "Evicting %s from the frame memory", _resident[oldest].name);
+    _remove_resident(oldest);
+  }
+}
+
+// The delays of the frames at the given offset of the frame memory.
+// No frames are smaller than indexed cartesian ones, so the delays of two sets never overlap.
+uint16_t* Renderer::_get_delays(size_t offset)
+{
+  return _delay_data + offset / (PALETTE_SIZE_BYTES + _sparse_pixel_count);
+}
+
+int8_t Renderer::_find_resident(const char* name)
+{
+  for (uint8_t index = 0; index < _resident_count; index++)
+    if (strcmp(_resident[index].name, name) == 0)
+      return index;
+
+  return -1;
+}
+
+// Keeps the frames that were just loaded completely around, if they belong to an animation of the library.
+void Renderer::_add_resident()
+{
+  if (_loading_name[0] == '\0' || _loading_frames->slot_count != _loading_frame_count)
+    return;
+
+  int8_t index = _find_resident(_loading_name);
+
+  if (index < 0 && _resident_count == LIBRARY_MAX_RESIDENT)
+  {
+    index = 0;
+
+    for (uint8_t other = 1; other < _resident_count; other++)
+      if (_resident[other].last_used < _resident[index].last_used)
+        index = other;
+  }
+  else if (index < 0)
+  {
+    index = _resident_count++;
+  }
+
+  ResidentAnimation& animation = _resident[index];
+
+  strncpy(animation.name, _loading_name, LIBRARY_NAME_LENGTH);
+  animation.offset = _loading_frames->offset;
+  animation.frame_size = _loading_frames->frame_size;
+  animation.frame_count = _loading_frames->slot_count;
+  animation.layout = _loading_frames->layout;
+  animation.format = _loading_frames->format;
+  animation.last_used = ++_resident_clock;
+}
+
+void Renderer::_remove_resident(uint8_t index)
+{
+  _resident[index] = _resident[--_resident_count];
+}
+
+// The set handed over last, the render task shows it from the next rotation on at the latest.
+// If it takes it in the meantime, that's still the same set.
+const FrameSet* Renderer::_get_published_frame_set()
+{
+  uint8_t ready = _ready_frame_set.load(std::memory_order_acquire);
+
+  return &_frame_sets[ready & FRAME_SET_FRESH ? ready & ~FRAME_SET_FRESH : 3 - _back_frame_set - ready];
+}
+
+// Hands a black frame over and waits for the render task to take it, 
+// it doesn't show anything from the frame memory after that.
+void Renderer::_show_blank_frames()
+{
+  FrameSet& blank = _frame_sets[_back_frame_set];
+
+  blank.frames = _blank_frame;
+  blank.delays = &_blank_delay;
+  blank.frame_size = POLAR_FRAME_SIZE_BYTES;
+  blank.layout = FrameLayout::POLAR;
+  blank.format = FrameFormat::RGB;
+  blank.offset = 0;
+  blank.slot_count = 0;
+  blank.max_frame.store(0, std::memory_order_relaxed);
+  blank.streamed.store(false, std::memory_order_relaxed);
+  blank.live = false;
+  blank.saved = false;
+
+  _loading_frames = &blank;
+  _loading_published = false;
+  _publish_frame_set();
+
+  int64_t start_us = esp_timer_get_time();
+
+  // That happens with the next rotation.
+  while (_ready_frame_set.load(std::memory_order_acquire) & FRAME_SET_FRESH)
+    vTaskDelay(1);
+
+  ESP_LOGI(TAG, "Frames swapped out after %lld ms", (long long)(esp_timer_get_time() - start_us) / 1000);
+}
+
+// Hands the set that is being loaded over to the render task, it shows it from the next rotation on.
+// Frames that get added afterwards show up once they are complete.
+void Renderer::_publish_frame_set()
+{
+  if (_loading_published)
+    return;
+
+  uint8_t previous = _ready_frame_set.exchange(_back_frame_set | FRAME_SET_FRESH, std::memory_order_acq_rel);
+
+  _back_frame_set = previous & ~FRAME_SET_FRESH;
+  _loading_published = true;
+
+  if (_loading_frames->slot_count > 0)
+    strncpy(_animation_name, _loading_name, LIBRARY_NAME_LENGTH);
+
+  // The palette cache only knows the frames by their address, which might be the same.
+  _palette_generation.fetch_add(1, std::memory_order_release);
+}
+
+// Swaps in the set that got handed over last, if there is a new one.
+// Only ever happens between rotations, so a rotation never shows two different animations.
+void Renderer::_take_frame_set()
+{
+  uint8_t ready = _ready_frame_set.load(std::memory_order_acquire);
+
+  if (!(ready & FRAME_SET_FRESH))
+    return;
+
+  // It might just have been taken back, then there's nothing new after all.
+  if (!_ready_frame_set.compare_exchange_strong(ready, _frames - _frame_sets, std::memory_order_acq_rel))
+    return;
+
+  _frames = &_frame_sets[ready & ~FRAME_SET_FRESH];
+  _current_frame = 0;
+  _timeline_reset = true;
+}
+
+// Loads the animation that got shown last from the file system again.
+void Renderer::_load_image_from_flash()
+{
+  char name[LIBRARY_NAME_LENGTH];
+
+  strncpy(name, _animation_name, LIBRARY_NAME_LENGTH);
+  _load_animation(name);
+}
+
+// Loads the .bin file of the animation from the file system into the _image_data Array,
+// so it can be used for displaying. The data file doesn't have a name.
+// Returns false if not even the first frame could be loaded.
+bool Renderer::_load_animation(const char* name)
+{
+  char path[LIBRARY_NAME_LENGTH + sizeof(LIBRARY_DIRECTORY) + 8];
+
+  get_animation_path(name, path, sizeof(path));
+  File file = LittleFS.open(path, "r", false);
+
+  if (!file) 
+  {
+    ESP_LOGE(TAG, "Failed to open %s for reading", path);
+    return false;
+  }
+
+  size_t size = file.size();
+  if (size == 0) 
+  {
+    ESP_LOGE(TAG, "File is empty");
+    file.close();
+    return false;
+  }
+
+  // Indexed files and containers start with a header, RGB files with the first frame.
+  uint8_t start[CONTAINER_HEADER_SIZE_BYTES];
+  size_t header_size = get_frame_header_size(start, file.readBytes((char*)start, sizeof(start)));
+  uint8_t* header = header_size > 0 ? (uint8_t*)ps_malloc(header_size) : NULL;
+
+  file.seek(0);
+
+  if (header != NULL)
+    file.readBytes((char*)header, header_size);
+
+  size_t record_size = header_size == 0 || header != NULL ?
+    prepare_frames(header, header_size, size - header_size, name) : 0;
+  free(header);
+
+  // Compressed frames differ in size, the buffer has to fit the biggest one.
+  // Unlike uploads, these can always be read again.
+  if (record_size > 0)
+  {
+    record_size = _get_max_record_size();
+    _loading_frames->saved = true;
+  }
+  uint8_t* record = record_size > 0 ? (uint8_t*)ps_malloc(record_size) : NULL;
+
+  if (record == NULL)
+  {
+    // Preloads just don't happen if there isn't any room.
+    if (!_preloading)
+      ESP_LOGE(TAG, "Couldn't load the frames!");
+
+    file.close();
+    return false;
+  }
+
+  uint16_t frame_count = _compressed ? _frame_index_count :
+    min((size - header_size) / record_size, (size_t)UINT16_MAX);
+
+  // Streaming needs room for at least the frame on display and the next one, 
+  // otherwise just show whatever fits.
+  if (get_frame_capacity() < 2)
+    frame_count = min(frame_count, get_frame_capacity());
+
+  if (frame_count == 0)
+  {
+    ESP_LOGE(TAG, "There isn't a single whole frame in the file!");
+    free(record);
+    file.close();
+    return false;
+  }
+
+  // Only the first frame gets loaded right away, the loader task reads the rest in the background.
+  return _start_streaming(file, record, header_size, record_size, frame_count);
+
+  // _print_first_pixel();
+  // for (int i = 0; i < _loading_frames->max_frame + 1; i++)
+  //   _print_image_data(i);
+}
+
+// Hands over the open data file to the loader task, which streams the frames into the ring.
+// If the whole animation fits, the ring simply holds all of it and the stream ends 
+// once the last frame is in. The file has to be positioned at the first frame record.
+bool Renderer::_start_streaming(File file, uint8_t* record, size_t header_size, size_t record_size, uint16_t frame_count)
+{
+  xSemaphoreTake(_stream_mutex, portMAX_DELAY);
+
+  // The render task might still be moving the last stream on.
+  _wait_for_slice();
+
+  _stream_start_us = esp_timer_get_time();
+  _stream_file = file;
+  _stream_record = record;
+  _stream_header_size = header_size;
+  _stream_record_size = record_size;
+  _stream_frame_count = frame_count;
+  _stream_ring_size = min(frame_count, _loading_frames->slot_count);
+  _stream_position.store(0, std::memory_order_relaxed);
+  _stream_loaded.store(0, std::memory_order_relaxed);
+  _stream_waiting = false;
+
+  // Don't show anything until the first frame is there.
+  bool loaded = _load_stream_frame();
+
+  if (loaded && !_is_stream_resident())
+  {
+    _loading_frames->streamed.store(true, std::memory_order_relaxed);
+    _stream_frames.store(_loading_frames, std::memory_order_relaxed);
+    _streaming.store(true, std::memory_order_release);
+  }
+
+  if (loaded)
+    _loading_frames->max_frame.store(_stream_ring_size - 1, std::memory_order_relaxed);
+
+  if (!_streaming.load(std::memory_order_relaxed))
+    _close_stream();
+
+  xSemaphoreGive(_stream_mutex);
+
+  if (!loaded)
+    return false;
+
+  // Preloaded frames only get handed over once they are due.
+  if (!_preloading)
+    _publish_frame_set();
+
+  ESP_LOGI(TAG, "First frame loaded in %lld ms", (long long)(esp_timer_get_time() - _stream_start_us) / 1000);
+
+  if (_stream_ring_size < frame_count)
+    ESP_LOGI(TAG, "Streaming %d frames through a ring of %d", frame_count, _stream_ring_size);
+
+  // Let the loader fill up the rest of the ring.
+  xTaskNotifyGive(_frame_loader_task);
+
+  return true;
+}
+
+// Everything fits into the ring and is loaded, so there is nothing left to stream.
+bool Renderer::_is_stream_resident()
+{
+  return _stream_ring_size == _stream_frame_count 
+    && _stream_loaded.load(std::memory_order_relaxed) >= _stream_frame_count;
+}
+
+// Has to be called with the stream mutex held.
+// Frames that are resident now just keep cycling, the others stay on the frame they are at.
+void Renderer::_close_stream()
+{
+  if (_is_stream_resident())
+  {
+    _loading_frames->streamed.store(false, std::memory_order_release);
+    _add_resident();
+  }
+  // Half of a preloaded animation is of no use to anybody.
+  else if (!_loading_published)
+  {
+    _loading_name[0] = '\0';
+  }
+
+  _stream_frames.store(NULL, std::memory_order_release);
+  _streaming.store(false, std::memory_order_release);
+
+  if (_stream_file)
+    _stream_file.close();
+
+  free(_stream_record);
+  _stream_record = NULL;
+}
+
+// Reads the next frame of the stream into its slot, unless that one is still needed.
+// Returns false if the ring is full or the file couldn't be read.
+bool Renderer::_load_stream_frame()
+{
+  uint32_t loaded = _stream_loaded.load(std::memory_order_relaxed);
+
+  // The slot still holds a frame that is going to be shown, or is on display right now.
+  if (loaded >= _stream_position.load(std::memory_order_acquire) + _stream_ring_size)
+    return false;
+
+  uint16_t frame = loaded % _stream_frame_count;
+  size_t record_size = get_record_size(frame);
+
+  // The records are read one after another, so only the wrap around needs a seek.
+  if (frame == 0)
+    _stream_file.seek(_stream_header_size);
+
+#ifdef RENDER_METRICS
+  int64_t start_us = esp_timer_get_time();
+#endif
+
+  for (size_t read = 0; read < record_size; read += STREAM_READ_CHUNK_BYTES)
+  {
+    size_t length = min(record_size - read, (size_t)STREAM_READ_CHUNK_BYTES);
+
+    if (_stream_file.readBytes((char*)_stream_record + read, length) != length)
+    {
+      ESP_LOGE(TAG, "Couldn't read frame %d of the stream!", frame);
+      return false;
+    }
+  }
+
+#ifdef RENDER_METRICS
+  int64_t read_us = esp_timer_get_time();
+  _metrics.frame_read.record(read_us - start_us);
+#endif
+
+  _decode_frame(loaded % _stream_ring_size, frame, _stream_record);
+  _stream_loaded.store(loaded + 1, std::memory_order_release);
+
+#ifdef RENDER_METRICS
+  int64_t end_us = esp_timer_get_time();
+  _metrics.frame_decode.record(end_us - read_us);
+  _metrics.loader_load.record(end_us - start_us);
+#endif
+
+  return true;
+}
+
+// Moves the stream on to the next frame, if the loader already got it into the ring.
+bool Renderer::_advance_stream()
+{
+  uint32_t next = _stream_position.load(std::memory_order_relaxed) + 1;
+
+  if (next >= _stream_loaded.load(std::memory_order_acquire))
+  {
+    // Only count every late frame once, no matter how long it takes.
+    if (!_stream_waiting)
+      _stream_underruns++;
+
+    _stream_waiting = true;
+    return false;
+  }
+
+  _stream_waiting = false;
+  _current_frame = next % _stream_ring_size;
+  _stream_position.store(next, std::memory_order_release);
+
+  // The slot of the previous frame is free now.
+  xTaskNotifyGive(_frame_loader_task);
+
+  return true;
+}
+
+// Shows the newest complete live frame, if there is one the render task hasn't taken yet.
+// Only happens between rotations, so a frame is never cut in half.
+void Renderer::_take_live_frame()
+{
+  if (!(_live_ready.load(std::memory_order_relaxed) & LIVE_FRESH))
+    return;
+
+  uint8_t ready = _live_ready.exchange(_current_frame, std::memory_order_acq_rel);
+
+  _current_frame = ready & ~LIVE_FRESH;
+  _live_displayed.fetch_add(1, std::memory_order_relaxed);
+  _shown_frames++;
+}
+
+// Moves the animation along its timeline, once per rotation.
+// The whole rotation shows the frame that's due in the middle of it, so frames never get
+// sheared and frames shorter than a rotation get skipped. The timeline only moves on by 
+// the delays of the frames, so the animation keeps its speed no matter when the rotations start.
+void Renderer::_update_frame_count()
+{
+  // Live frames don't have a delay, they get switched as soon as they are in.
+  if (_frames->live)
+    return;
+
+  bool streaming = _frames->streamed.load(std::memory_order_acquire);
+  uint16_t max_frame = _frames->max_frame.load(std::memory_order_acquire);
+
+  // The stream got stopped before everything was loaded, newer frames are on their way.
+  if (streaming && _stream_frames.load(std::memory_order_acquire) != _frames)
+    return;
+
+  int64_t middle_us = _tick_time_us + (int64_t)_slice_period_us * _angles_per_rotation / 2;
+
+  // New frames start in the middle of the first rotation they are shown in.
+  // Until there's a second frame, the first one keeps starting over.
+  if (_timeline_reset || (max_frame == 0 && !streaming))
+  {
+    _timeline_reset = false;
+    _frame_end_us = middle_us + _frames->delays[_current_frame] * 1000;
+    return;
+  }
+
+  // Way behind, the rotations must have stopped for a while.
+  if (middle_us - _frame_end_us > FRAME_TIMELINE_MAX_LAG_MS * 1000)
+    _frame_end_us = middle_us;
+
+  int64_t frame_start_us = 0;
+  uint16_t switches = 0;
+
+  while (_frame_end_us <= middle_us)
+  {
+    // Keep showing the current frame until the next one got streamed in, the timeline waits for it.
+    if (streaming && !_advance_stream())
+    {
+      _frame_end_us = middle_us;
+      break;
+    }
+
+    if (!streaming)
+      _current_frame = _current_frame >= max_frame ? 0 : _current_frame + 1;
+
+    // Frames without a delay are over right away.
+    frame_start_us = _frame_end_us;
+    _frame_end_us += max(_frames->delays[_current_frame], (uint16_t)1) * 1000;
+    switches++;
+  }
+
+  if (switches == 0)
+    return;
+
+  _shown_frames++;
+  _skipped_frames += switches - 1;
+
+#ifdef RENDER_METRICS
+  _metrics.frame_jitter.record(middle_us - frame_start_us);
+#endif
+}
+
+// Counts the frames that actually got shown, over FRAME_RATE_WINDOW_MS.
+void Renderer::_update_frame_rate()
+{
+  int64_t elapsed_us = _tick_time_us - _frame_rate_start_us;
+
+  if (elapsed_us < FRAME_RATE_WINDOW_MS * 1000)
+    return;
+
+  _frame_rate = (_shown_frames - _frame_rate_shown_frames) * 1e6f / elapsed_us;
+  _frame_rate_shown_frames = _shown_frames;
+  _frame_rate_start_us = _tick_time_us;
+}
+
+void Renderer::_update_slice_count()
+{
+  uint16_t previous_slice = _current_slice;
+
+  // Follow the prediction of the PLL while it's locked, otherwise just count up 
+  // and rely on the HAL sensor snapping us back into place.
+  if (_rotation_pll.is_locked(_tick_time_us))
+#ifdef SLICE_ONE_SHOT_TIMER
+    // The tick is where the last slice started, so aim for the middle of the next one.
+    _current_slice = _rotation_pll.get_slice(_tick_time_us + _slice_period_us * 3 / 2, _angles_per_rotation);
+#else
+    _current_slice = _rotation_pll.get_slice(_tick_time_us + _slice_period_us, _angles_per_rotation);
+#endif
+  else
+    _current_slice = previous_slice + 1 < _angles_per_rotation ? previous_slice + 1 : 0;
+
+  // Only ever change the resolution and timing between rotations.
+  // The PLL may step back a slice when it corrects the phase, that doesn't count.
+  if ((int32_t)_current_slice - previous_slice > -(int32_t)(_angles_per_rotation / 2)
+    && !_rotation_end_missed.exchange(false, std::memory_order_relaxed))
+    return;
+
+  _rotation_ended.store(true, std::memory_order_relaxed);
+
+#ifdef RENDER_METRICS
+  _metrics.on_rotation();
+#endif
+
+  _take_frame_set();
+
+  if (_frames->live)
+    _take_live_frame();
+
+  uint16_t previous_angles_per_rotation = _angles_per_rotation;
+
+  uint32_t previous_options_version = _render_options_version;
+
+  _update_options();
+  _update_resolution();
+
+  // Stay at the same angle with the new resolution.
+  if (_angles_per_rotation != previous_angles_per_rotation)
+    _current_slice = (uint32_t)_current_slice * _angles_per_rotation / previous_angles_per_rotation;
+
+  if (_angles_per_rotation != previous_angles_per_rotation || _render_options_version != previous_options_version)
+    _offset_slices = _render_options.offset * _angles_per_rotation / 360;
+
+  // Needs the timing of the new rotation.
+  _update_frame_count();
+  _update_frame_rate();
+}
+
+#ifdef SLICE_ONE_SHOT_TIMER
+// Sets the alarm for the slice that was just prepared, a little ahead of when it's due.
+// Without a lock there is no phase, so it just goes on with the period.
+void Renderer::_schedule_slice()
+{
+  if (_rotation_pll.is_locked(_tick_time_us))
+    _slice_deadline_us = _rotation_pll.get_slice_time(_current_slice, 
+      _tick_time_us + _slice_period_us * 3 / 2, _angles_per_rotation);
+  else
+    _slice_deadline_us = max(_slice_deadline_us + _slice_period_us, _tick_time_us);
+
+  // The S3 fires an alarm that already passed right away, the slice just goes out late then.
+  timerAlarmWrite(_render_loop_timer, _slice_deadline_us - SLICE_TIME_MARGIN_US - _timer_offset_us, false);
+  timerAlarmEnable(_render_loop_timer);
+}
+#endif
+
+// Takes over new options between rotations. If the webserver is writing them right now,
+// the render task doesn't wait for it and keeps the old ones for another rotation.
+void Renderer::_update_options()
+{
+  _options.read_if_changed(_render_options, _render_options_version);
+  _motor_speed.read_if_changed(_render_motor_speed, _motor_speed_version);
+}
+
+// The PLL knows the period best, the speed from the motor controller is only a fallback.
+uint32_t Renderer::_get_rotation_period_us()
+{
+  int64_t now_us = esp_timer_get_time();
+
+  if (_rotation_pll.is_locked(now_us))
+    return _rotation_pll.get_period_us();
+
+  // The last report is already a few ms old, so it gets extrapolated to now.
+  uint32_t motor_period_us = _render_motor_speed.get_period_us(now_us);
+
+  if (motor_period_us != 0)
+    return motor_period_us;
+
+  return _render_options._rotation_period_us;
+}
+
+// Picks the resolution and timing for the next rotation.
+void Renderer::_update_resolution()
+{
+  uint32_t rotation_period_us = _get_rotation_period_us();
+
+  _slice_compute_us = _rotation_compute_us;
+  _rotation_compute_us = 0;
+
+  uint16_t angles_per_rotation = _render_options.angles_per_rotation;
+
+  if (angles_per_rotation == 0)
+    angles_per_rotation = _pick_angles_per_rotation(rotation_period_us);
+
+  if (angles_per_rotation != _angles_per_rotation)
+  {
+    ESP_LOGI(TAG, "Switching to %d slices per rotation", angles_per_rotation);
+    _angles_per_rotation = angles_per_rotation;
+  }
+
+  _slice_period_us = rotation_period_us / _angles_per_rotation;
+}
+
+// Returns the highest resolution the current rotation period can sustain.
+uint16_t Renderer::_pick_angles_per_rotation(uint32_t rotation_period_us)
+{
+  // The SPI transfer and the slice compute overlap, so only the slower one of them limits us.
+  uint32_t required_us = max((uint32_t)SLICE_TRANSFER_TIME_US, _slice_compute_us) + SLICE_TIME_MARGIN_US;
+  uint16_t picked = supported_angles_per_rotation[0];
+
+  for (uint16_t angles_per_rotation : supported_angles_per_rotation)
+  {
+    // Polar frames don't have any more detail than this anyway.
+    if (_frames->layout == FrameLayout::POLAR && angles_per_rotation > ANGLES_PER_ROTATION)
+      break;
+
+    // Ask for some headroom before switching up, so we don't flip back and forth.
+    uint32_t needed_us = angles_per_rotation > _angles_per_rotation ?
+      required_us * (100 + RESOLUTION_HYSTERESIS_PERCENT) / 100 : required_us;
+
+    if (rotation_period_us / angles_per_rotation < needed_us)
+      break;
+
+    picked = angles_per_rotation;
+  }
+
+  return picked;
+}
+
+void Renderer::_update_led_colors()
+{
+  uint16_t half_rotation = _angles_per_rotation / 2;
+  uint16_t slice = (_current_slice + _offset_slices) % _angles_per_rotation;
+  uint16_t half_slice = slice % half_rotation;
+
+  const FrameSet* frames = _frames;
+  uint16_t current_frame = _current_frame <= frames->max_frame.load(std::memory_order_acquire) ? _current_frame : 0;
+  const uint8_t* frame = frames->frames + current_frame * frames->frame_size;
+  // A patch is being applied to the frame, the finished copy is shown in the meantime.
+  const uint8_t* patched_frame = _patched_frame.load();
+
+  if (patched_frame != NULL && _patched_target.load() == frame)
+    frame = patched_frame;
+
+  const ColorTables* tables = _active_color_tables.load(std::memory_order_acquire);
+  const AntiAliasingRow* anti_aliasing_table = _anti_aliasing_table.load(std::memory_order_acquire);
+  uint8_t first = 0;
+  int8_t step = 1;
+  // As far as the compiler knows, every byte written to the buffer could be one of the members.
+  // Kept in locals, they don't have to be read again after each one.
+  uint8_t* led = _led_buffer + 4;
+  uint8_t global = 0xE0 | _current_brightness;
+
+  // In the second half of the rotation the strip shows the same diameter, 
+  // just from the other end, so walk the row backwards.
+  if (slice >= half_rotation)
+  {
+    first = LEDS_PER_SLICE - 1;
+    step = -1;
+  }
+  
+  // Polar frames already got anti-aliased when they were converted.
+  bool anti_aliased = _render_options.anti_aliasing && anti_aliasing_table != NULL 
+    && frames->layout == FrameLayout::CARTESIAN;
+
+  // Indexed frames take their colors from the palette, which already went through the tables.
+  if (frames->format == FrameFormat::INDEXED && !anti_aliased)
+  {
+    const RGB* palette = _get_resolved_palette(frame, tables);
+    const uint8_t* indices = frame + PALETTE_SIZE_BYTES;
+
+    if (frames->layout == FrameLayout::POLAR)
+    {
+      uint32_t row = (uint32_t)half_slice * SLICES_PER_HALF_ROTATION / half_rotation;
+      const uint8_t* index = indices + row * LEDS_PER_SLICE + first;
+
+      for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++, index += step, led += 4)
+        _write_led(led, global, palette[*index]);
+    }
+    else
+    {
+      uint32_t row = half_slice * (MAX_ANGLES_PER_ROTATION / _angles_per_rotation);
+      const uint16_t* offset = _pixel_offsets + row * LEDS_PER_SLICE + first;
+
+      for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++, offset += step, led += 4)
+        _write_led(led, global, palette[indices[*offset]]);
+    }
+  }
+  else if (frames->layout == FrameLayout::POLAR)
+  {
+    // The whole slice is already one contiguous row.
+    uint32_t row = (uint32_t)half_slice * SLICES_PER_HALF_ROTATION / half_rotation;
+    const RGB* pixel = (const RGB*)frame + row * LEDS_PER_SLICE + first;
+    
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++, pixel += step, led += 4)
+      _write_led_adjusted(led, global, *pixel, tables);
+  }
+  else if (anti_aliased)
+  {
+    // The table only has the resolution of polar frames.
+    uint32_t row = (uint32_t)half_slice * SLICES_PER_HALF_ROTATION / half_rotation;
+
+    // The blend has to happen on the raw colors, so indexed frames use their raw palette here.
+    if (frames->format == FrameFormat::INDEXED)
+      _sample_anti_aliased(frame + PALETTE_SIZE_BYTES, (const RGB*)frame, anti_aliasing_table + row, &_render_scratch);
+    else
+      _sample_anti_aliased(frame, NULL, anti_aliasing_table + row, &_render_scratch);
+
+    for (uint8_t led_index = 0, index = first; led_index < LEDS_PER_SLICE; led_index++, index += step, led += 4)
+      _write_led_adjusted(led, global, _get_sampled_color(&_render_scratch, index), tables);
+  }
+  else
+  {
+    uint32_t row = half_slice * (MAX_ANGLES_PER_ROTATION / _angles_per_rotation);
+    const uint16_t* offset = _pixel_offsets + row * LEDS_PER_SLICE + first;
+
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++, offset += step, led += 4)
+      _write_led_adjusted(led, global, ((const RGB*)frame)[*offset], tables);
+  }
+}
+
+void IRAM_ATTR _update_timer_ISR()
+{
+  g_renderer->_tick_time_us = esp_timer_get_time();
+#ifdef RENDER_METRICS
+  g_renderer->_metrics.on_tick(g_renderer->_tick_time_us);
+#endif
+
+#ifndef SLICE_ONE_SHOT_TIMER
+  // Pick up the new slice period, in case the speed or resolution changed.
+  timerAlarmWrite(g_renderer->_render_loop_timer, g_renderer->_slice_period_us, true);
+#endif
+
+  BaseType_t hptw;
+  vTaskNotifyGiveFromISR(g_renderer->_display_loop_task, &hptw);
+  
+  portYIELD_FROM_ISR(hptw);
+}
+
+void IRAM_ATTR _update_rotation_ISR(void* parameter)
+{
+  Renderer *renderer = (Renderer*)parameter;
+  int64_t now_us = esp_timer_get_time();
+  
+  bool locked = renderer->_rotation_pll.on_edge(now_us);
+
+  // Without a lock, snap to the angle of the sensor instead.
+  // The slice that is being prepared only gets shown at the next tick, 
+  // so it's one past the sensor already.
+  if (!locked)
+  {
+    renderer->_current_slice = (renderer->_angles_per_rotation * HAL_SENSOR_ANGLE / 360 + 1) 
+      % renderer->_angles_per_rotation;
+
+    if (!renderer->_rotation_ended.exchange(false, std::memory_order_relaxed))
+      renderer->_rotation_end_missed.store(true, std::memory_order_relaxed);
+  }
+  else
+  {
+    renderer->_rotation_ended.store(false, std::memory_order_relaxed);
+  }
+}
+
+uint8_t Renderer::_add_colors(uint8_t color, int16_t addition)
+{
+  int16_t temp_color = (int16_t)color;
+  int16_t clamped_color = clamp((temp_color + addition), 0, 255);
+
+  return (uint8_t)clamped_color;
+}
+
+uint8_t Renderer::_apply_gamma(uint8_t color, float gamma)
+{
+  if (gamma == 1.0)
+    return color;
+
+  return (uint8_t)round(255.0 * pow(color / 255.0, gamma));
+}
+
+// Rebuilds the color lookup tables from the options.
+// Only happens when the colors actually change, never in the render task.
+void Renderer::_update_color_tables(const Options& options)
+{
+  // Always write into the tables the render task isn't reading from.
+  const ColorTables* active_tables = _active_color_tables.load(std::memory_order_acquire);
+  ColorTables* tables = active_tables == &_color_tables[0] ? 
+    &_color_tables[1] : &_color_tables[0];
+
+  // A slice that started before the last swap might still be reading the other ones.
+  _wait_for_slice();
+
+  for (uint16_t color = 0; color < 256; color++)
+  {
+    tables->red[color] = _apply_gamma(_add_colors(color, options.red_color_adjust), options.gamma);
+    tables->green[color] = _apply_gamma(_add_colors(color, options.green_color_adjust), options.gamma);
+    tables->blue[color] = _apply_gamma(_add_colors(color, options.blue_color_adjust), options.gamma);
+  }
+
+  _active_color_tables.store(tables, std::memory_order_release);
+  // The tables alternate, so the resolved palette can't go by which ones they are.
+  _palette_generation.fetch_add(1, std::memory_order_release);
+}
+
+void Renderer::begin()
+{
+  g_renderer = this;
+  
+  BaseType_t result;
+  int64_t start_us = esp_timer_get_time();
+
+  // Keep the lookup table in internal DRAM, so the render loop never misses the flash cache.
+  _pixel_offsets = (uint16_t*)heap_caps_malloc(
+    PIXEL_OFFSETS_SIZE_BYTES,
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+  );
+
+  if (_pixel_offsets == NULL)
+    ESP_LOGE(TAG, "Couldn't allocate the pixel offset table!");
+
+  _pixel_remap = (uint16_t*)heap_caps_malloc(IMAGE_SIZE_PIXELS * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  _sparse_pixels = (uint16_t*)heap_caps_malloc(IMAGE_SIZE_PIXELS * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+  
+  _build_pixel_offsets();
+  _build_sparse_layout();
+
+  ESP_LOGI(TAG, "Lookup tables built in %lld ms", (long long)(esp_timer_get_time() - start_us) / 1000);
+
+  _conversion_buffer = (uint8_t*)ps_malloc(_sparse_pixel_count * sizeof(RGB));
+
+  // Allocate all the image data in PSRAM, except for what the rest of the renderer needs.
+  size_t free_psram = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+  _image_data_size = free_psram > FRAME_MEMORY_RESERVE_BYTES ? free_psram - FRAME_MEMORY_RESERVE_BYTES : 0;
+  _image_data = (uint8_t*)ps_malloc(_image_data_size);
+
+  if (_image_data == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the image data!");
+    _image_data_size = 0;
+  }
+  
+  // Black, in the biggest layout there is.
+  _blank_frame = (uint8_t*)ps_calloc(1, POLAR_FRAME_SIZE_BYTES);
+  _frames->frames = _blank_frame;
+  _frames->delays = &_blank_delay;
+  _frames->frame_size = POLAR_FRAME_SIZE_BYTES;
+
+  // Indexed cartesian frames are the smallest, so there are never more frames than that.
+  _max_frames = min(_image_data_size / (PALETTE_SIZE_BYTES + _sparse_pixel_count), (size_t)UINT16_MAX);
+  _delay_data = (uint16_t*)calloc(_max_frames, sizeof(uint16_t));
+  
+  _check_vector_kernel();
+  _update_color_tables(_options.read());
+
+  // Initialize the SPI bus.
+  spi_bus_initialize(SPI_HOST, &_buscfg, SPI_DMA_CH_AUTO);
+  
+  // Attach the SPI device.
+  spi_bus_add_device(SPI_HOST, &_devcfg, &_spi);
+
+  // Allocate the ring of DMA buffers.
+  for (uint8_t buffer = 0; buffer < SLICE_BUFFER_COUNT; buffer++)
+  {
+    _led_buffers[buffer] = (uint8_t*)heap_caps_malloc(
+      SLICE_BUFFER_SIZE_BYTES,
+      MALLOC_CAP_DMA
+    );
+
+    // Write start and end sections.
+    _led_buffer = _led_buffers[buffer];
+    memset(_led_buffer, 0x00, 4);
+    memset(_led_buffer + 4 + (LEDS_PER_SLICE * 4), 0xFF, 4);
+
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+      _change_led(led_index, RGB::Black);
+  }
+
+  memset(_transactions, 0, sizeof(_transactions));
+  _led_buffer = _led_buffers[_next_buffer];
+
+  _show();
+
+  // Get the render loop going right away, it shows black until the first frame is in.
+  _render_loop_timer = timerBegin(
+    0,
+    80,
+    true
+  );
+
+  // Nothing but the render task runs on its core, the network and the flash stay on the other one.
+  // It attaches the timer and HAL ISRs itself, so they end up on its core too.
+  result = xTaskCreatePinnedToCore(
+    _display_loop,
+    PSTR("Display Loop"),
+    4096,
+    this,
+    configMAX_PRIORITIES - 1,
+    &_display_loop_task,
+    RENDERER_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory!");
+
+  ESP_LOGI(TAG, "Render loop running after %lld ms", (long long)(esp_timer_get_time() - start_us) / 1000);
+
+  _stream_mutex = xSemaphoreCreateMutex();
+  _loader_mutex = xSemaphoreCreateRecursiveMutex();
+
+  // The loader has to be there before the first stream starts.
+  result = xTaskCreatePinnedToCore(
+    _frame_loader,
+    PSTR("Frame Loader"),
+    4096,
+    this,
+    1,
+    &_frame_loader_task,
+    FRAME_LOADER_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory for the frame loader!");
+
+  _load_image_from_flash();
+  // _print_image_data();
+}
+
+void Renderer::_display_loop(void *parameter)
+{
+  Renderer *renderer = (Renderer*)parameter;
+
+  // Interrupts are allocated on the core that attaches them, so the ISRs
+  // never have to wait for the WiFi or webserver on the other one.
+  timerAttachInterrupt(renderer->_render_loop_timer, _update_timer_ISR, false);
+#ifdef SLICE_ONE_SHOT_TIMER
+  // The counter runs at 1 MHz as well, it just started at a different time.
+  renderer->_timer_offset_us = esp_timer_get_time() - timerRead(renderer->_render_loop_timer);
+  renderer->_tick_time_us = esp_timer_get_time();
+  renderer->_schedule_slice();
+#else
+  timerAlarmWrite(renderer->_render_loop_timer, renderer->_slice_period_us, true);
+  timerAlarmEnable(renderer->_render_loop_timer);
+#endif
+  
+  attachInterruptArg(digitalPinToInterrupt(HAL_PIN), _update_rotation_ISR, renderer, FALLING);
+
+  renderer->_update_led_colors();
+  
+  while (true)
+  {
+#ifdef RENDER_METRICS
+    // More than one notification means we slept through some of the ticks.
+    renderer->_metrics.on_wake(ulTaskNotifyTake(true, portMAX_DELAY));
+#else
+    ulTaskNotifyTake(true, portMAX_DELAY);
+#endif
+
+#ifdef SLICE_ONE_SHOT_TIMER
+    // The alarm went off a little early, so the task switch is already done when the slice is due.
+    while (esp_timer_get_time() < renderer->_slice_deadline_us);
+
+    renderer->_tick_time_us = esp_timer_get_time();
+#endif
+
+    // Send out the slice that has been prepared during the last period right away,
+    // and assemble the next one while this one is still being clocked out.
+    renderer->_show();
+
+    unsigned long start = micros();
+#ifdef RENDER_METRICS
+    uint32_t start_cycles = get_cycle_count();
+#endif
+
+    // Odd while anything of the frames on display might be in use.
+    renderer->_slice_sequence++;
+    renderer->_update_slice_count();
+    renderer->_update_led_colors();
+    renderer->_slice_sequence++;
+
+#ifdef SLICE_ONE_SHOT_TIMER
+    renderer->_schedule_slice();
+#endif
+
+    renderer->_rotation_compute_us = max(renderer->_rotation_compute_us, (uint32_t)(micros() - start));
+#ifdef RENDER_METRICS
+    renderer->_metrics.on_slice_done(start_cycles, renderer->_slice_period_us);
+#endif
+  }
+}
+
+void Renderer::_frame_loader(void *parameter)
+{
+  Renderer *renderer = (Renderer*)parameter;
+
+  while (true)
+  {
+    // Sleep until a stream starts or the render task frees up a slot.
+    ulTaskNotifyTake(true, portMAX_DELAY);
+
+    bool loaded = true;
+
+    // Take the lock for every frame on its own, so stopping the stream never has to wait long.
+    while (loaded)
+    {
+      xSemaphoreTake(renderer->_stream_mutex, portMAX_DELAY);
+
+      loaded = renderer->_streaming.load(std::memory_order_relaxed) && renderer->_load_stream_frame();
+
+      // The render task just keeps cycling through the ring on its own from here on.
+      if (loaded && renderer->_is_stream_resident())
+      {
+        renderer->_close_stream();
+        loaded = false;
+
+        ESP_LOGI(TAG, "Frames loaded: %d in %lld ms", renderer->_stream_frame_count, 
+          (long long)(esp_timer_get_time() - renderer->_stream_start_us) / 1000);
+      }
+
+      xSemaphoreGive(renderer->_stream_mutex);
+    }
+  }
+}
+
+void Renderer::set_brightness(uint8_t brightness) 
+{ 
+  // Only change the current brightness if the leds aren't disabled.
+  if (_current_brightness != 0)
+    _current_brightness = brightness;
+
+  _saved_brightness = brightness;
+}
+
+void Renderer::set_renderer_state(bool enabled)
+{
+  // Set the brightness to 0 incase the renderer should be disabled.
+  // This might seem like a stupid idea but it's far more reliable than disabling the 
+  // Task or doing something over the top... trust me.
+  enabled ? _current_brightness = _saved_brightness : _current_brightness = 0;
+}
+
+uint32_t Renderer::get_spi_overruns() { return _spi_overruns; }
+
+uint16_t Renderer::get_angles_per_rotation() { return _angles_per_rotation; }
+
+uint32_t Renderer::get_slice_period_us() { return _slice_period_us; }
+
+uint32_t Renderer::get_slice_compute_us() { return _slice_compute_us; }
+
+bool Renderer::is_rotation_locked() { return _rotation_pll.is_locked(esp_timer_get_time()); }
+
+uint32_t Renderer::get_rotation_period_us() { return _rotation_pll.get_period_us(); }
+
+uint32_t Renderer::get_hal_glitches() { return _rotation_pll.get_glitches(); }
+
+#ifdef RENDER_METRICS
+const RenderMetrics& Renderer::get_metrics() { return _metrics; }
+#endif
+
+bool Renderer::is_supported_angles_per_rotation(uint16_t angles)
+{
+  for (uint16_t supported_angles : supported_angles_per_rotation)
+    if (angles == supported_angles)
+      return true;
+
+  return false;
+}
+
+void Renderer::set_anti_aliasing(bool enabled)
+{
+  LoaderLock lock(_loader_mutex);
+
+  if (enabled && !_build_anti_aliasing_table())
+    return;
+
+  Options options = _options.read();
+
+  if (options.anti_aliasing == enabled)
+    return;
+
+  const FrameSet* shown = _get_published_frame_set();
+  // Polar frames got filtered while they were converted, so they have to be converted again.
+  // Cartesian frames, live ones included, get filtered while rendering.
+  bool convert = shown->layout == FrameLayout::POLAR && shown->slot_count > 0;
+  // Indexed frames can go back to the smaller polar layout, if they can be read again.
+  bool relayout = !enabled && shown->format == FrameFormat::INDEXED && shown->layout == FrameLayout::CARTESIAN
+    && shown->saved && !shown->live;
+
+  if (convert && !shown->saved)
+  {
+    ESP_LOGE(TAG, "The frames on display weren't saved, they can't be converted for anti-aliasing!");
+    return;
+  }
+
+  options.anti_aliasing = enabled;
+  _options.write(options);
+
+  // The same goes for the resident animations.
+  for (uint8_t index = 0; index < _resident_count;)
+  {
+    if (_resident[index].layout == FrameLayout::POLAR)
+      _remove_resident(index);
+    else
+      index++;
+  }
+
+  if (convert || relayout)
+    _load_image_from_flash();
+}
+
+// The webserver saved the frames being loaded to the file system as well.
+void Renderer::set_frames_saved()
+{
+  LoaderLock lock(_loader_mutex);
+
+  _loading_frames->saved = true;
+}
+
+void Renderer::refresh_image()
+{
+  LoaderLock lock(_loader_mutex);
+
+  _load_image_from_flash();
+}
+
+Options Renderer::get_options() { return _options.read(); }
+
+// Publishes new options, the render task takes them over with the next rotation.
+// Only a single task may set them, on the device that's the webserver.
+// Anti-aliasing needs its table and the frames converted again, set_anti_aliasing takes care of that.
+void Renderer::set_options(const Options& options)
+{
+  Options published = options;
+  Options previous = _options.read();
+
+  published.anti_aliasing = previous.anti_aliasing;
+
+  if (options.red_color_adjust != previous.red_color_adjust || options.green_color_adjust != previous.green_color_adjust
+    || options.blue_color_adjust != previous.blue_color_adjust || options.gamma != previous.gamma)
+    _update_color_tables(options);
+
+  _options.write(published);
+}
+
+// Only a single task may set it, on the device that's the speed link.
+void Renderer::set_motor_speed(const PeriodTracker& motor_speed) { _motor_speed.write(motor_speed); }
+
+uint16_t Renderer::get_frame_capacity()
+{
+  return min(_image_data_size / _get_frame_size_bytes(), (size_t)_max_frames);
+}
+
+// Needs at least the first CONTAINER_HEADER_SIZE_BYTES of the file.
+// Returns 0 for plain RGB files, which don't have a header.
+size_t Renderer::get_frame_header_size(const uint8_t* data, size_t length)
 {
-  ESP_LOGW(TAG, "Clearing image data...");
-  memset(&_image_data, 0, IMAGE_DATA_SIZE);
+  if (length >= CONTAINER_HEADER_SIZE_BYTES && memcmp(data, CONTAINER_MAGIC, 4) == 0)
+  {
+    ContainerHeader header;
+    memcpy(&header, data, sizeof(ContainerHeader));
+
+    // Just the fixed part for too many frames, so prepare_frames() gets to reject it.
+    if (header.frame_count > CONTAINER_MAX_FRAMES)
+      return CONTAINER_HEADER_SIZE_BYTES;
+
+    return CONTAINER_HEADER_SIZE_BYTES 
+      + (header.flags & CONTAINER_GLOBAL_PALETTE ? PALETTE_SIZE_BYTES : 0)
+      + header.frame_count * CONTAINER_INDEX_ENTRY_SIZE_BYTES;
+  }
+
+  if (length < INDEXED_HEADER_SIZE_BYTES || memcmp(data, INDEXED_MAGIC, 4) != 0)
+    return 0;
+
+  const IndexedHeader* header = (const IndexedHeader*)data;
+
+  return INDEXED_HEADER_SIZE_BYTES + 
+    (header->flags & INDEXED_GLOBAL_PALETTE ? PALETTE_SIZE_BYTES : 0);
 }
 
-void Renderer::_print_image_data(uint8_t frame)
+// Picks the format and layout for the frames following the header.
+// Returns the size of their records, or 0 if the header is invalid.
+// Frames of the library are named, so they can stay resident.
+size_t Renderer::prepare_frames(const uint8_t* header, size_t header_size, size_t total_size, const char* name)
 {
-  ESP_LOGI(TAG, "\n\nFrame: %d\nDelay: %d ms\n", frame, _delay_data[frame]);
+  LoaderLock lock(_loader_mutex);
 
-  char buffer[IMAGE_LENGTH_PIXELS + 1];
-  buffer[IMAGE_LENGTH_PIXELS] = '\0';
+  stop_streaming();
 
-  for (uint8_t x = 0; x < IMAGE_LENGTH_PIXELS; x++)
+  // The frames on display stay there, until the first new one is loaded.
+  _live.store(false, std::memory_order_release);
+  _has_shared_palette = false;
+  _compressed = false;
+  _previous_frame = NULL;
+
+  uint16_t frame_count;
+
+  if (header_size >= CONTAINER_HEADER_SIZE_BYTES && memcmp(header, CONTAINER_MAGIC, 4) == 0)
   {
-    for (uint8_t y = 0; y < IMAGE_LENGTH_PIXELS; y++)
+    if (!_prepare_container(header, header_size))
+      return 0;
+
+    frame_count = _frame_index_count;
+  }
+  else if (header_size == 0)
+  {
+    _frame_format = FrameFormat::RGB;
+    frame_count = total_size / FRAME_RECORD_SIZE_BYTES;
+  }
+  else
+  {
+    IndexedHeader indexed_header;
+    memcpy(&indexed_header, header, sizeof(IndexedHeader));
+
+    if (indexed_header.version != INDEXED_VERSION)
     {
-      uint32_t index = frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS + y * IMAGE_LENGTH_PIXELS + x;
-      
-      buffer[y] = _image_data[index].r == 255 ? '#' : '.';
+      ESP_LOGE(TAG, "Unsupported version of indexed frames: %d", indexed_header.version);
+      return 0;
+    }
+
+    _frame_format = FrameFormat::INDEXED;
+    frame_count = indexed_header.frame_count;
+
+    if (indexed_header.flags & INDEXED_GLOBAL_PALETTE)
+    {
+      memcpy(_shared_palette, header + INDEXED_HEADER_SIZE_BYTES, PALETTE_SIZE_BYTES);
+      _has_shared_palette = true;
     }
-    
-    ESP_LOGI(TAG, "%s", buffer);
   }
 
-  ESP_LOGI(TAG, "\n\n- - - - - - - - - - - - - - - - - - - - \n");
+  _choose_frame_layout(frame_count);
+  _loading_frame_count = frame_count;
+
+  // Frames of an older version of the animation mustn't be shown anymore.
+  if (name[0] != '\0' && !_preloading)
+    evict_animation(name);
+
+  if (!_begin_frame_set(min(frame_count, get_frame_capacity())))
+    return 0;
+
+  strncpy(_loading_name, name, LIBRARY_NAME_LENGTH - 1);
+  _loading_name[LIBRARY_NAME_LENGTH - 1] = '\0';
+
+  return get_record_size(0);
 }
 
-void Renderer::_print_first_pixel()
+// Checks the header of a container and takes over its index.
+bool Renderer::_prepare_container(const uint8_t* data, size_t header_size)
 {
-  for (uint8_t frame = 0; frame < _max_frame - 1; frame++)
+  ContainerHeader header;
+  memcpy(&header, data, sizeof(ContainerHeader));
+
+  if (header.version != CONTAINER_VERSION)
   {
-    uint32_t index = frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS; 
-    
-    RGB color = _image_data[index];
+    ESP_LOGE(TAG, "Unsupported version of the container: %d", header.version);
+    return false;
+  }
 
-    ESP_LOGI(TAG, "r: %d, g: %d, b: %d", color.r, color.g, color.b);
+  if (header.width != IMAGE_LENGTH_PIXELS || header.height != IMAGE_LENGTH_PIXELS
+    || header.pixel_count != _sparse_pixel_count || header.layout_hash != _sparse_layout_hash)
+  {
+    ESP_LOGE(TAG, "The container was made for another image size or sparse layout!");
+    return false;
   }
 
-  ESP_LOGI(TAG, "\n\n- - - - - - - - - - - - - - - - - - - - \n");
+  if (header.frame_count == 0 || header.frame_count > CONTAINER_MAX_FRAMES 
+    || header_size != get_frame_header_size(data, header_size))
+  {
+    ESP_LOGE(TAG, "The container has %d frames, at most %d are supported", header.frame_count, CONTAINER_MAX_FRAMES);
+    return false;
+  }
+
+  free(_frame_index);
+  _frame_index_count = 0;
+  _frame_index = (ContainerFrame*)ps_malloc(header.frame_count * sizeof(ContainerFrame));
+
+  if (_frame_index == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the frame index!");
+    return false;
+  }
+
+  memcpy(_frame_index, data + header_size - header.frame_count * sizeof(ContainerFrame), 
+    header.frame_count * sizeof(ContainerFrame));
+
+  // The frames have to follow each other without any gaps, since they get read one after another.
+  // The first one can't depend on anything, the animation starts over with it.
+  uint32_t offset = header_size;
+  size_t palette_size = header.flags & CONTAINER_GLOBAL_PALETTE ? 0 : PALETTE_SIZE_BYTES;
+
+  for (uint16_t frame = 0; frame < header.frame_count; frame++)
+  {
+    const ContainerFrame& entry = _frame_index[frame];
+
+    if (entry.offset != offset || entry.size > IMAGE_SIZE_BYTES 
+      || (header.format == CONTAINER_FORMAT_INDEXED && entry.size < palette_size)
+      || (frame == 0 && !(entry.flags & CONTAINER_KEYFRAME)))
+    {
+      ESP_LOGE(TAG, "The index of the container is broken at frame %d!", frame);
+      return false;
+    }
+
+    offset += get_container_span(entry.size);
+  }
+
+  _frame_format = header.format == CONTAINER_FORMAT_INDEXED ? FrameFormat::INDEXED : FrameFormat::RGB;
+  _frame_index_count = header.frame_count;
+  _compressed = true;
+
+  if (header.flags & CONTAINER_GLOBAL_PALETTE)
+  {
+    memcpy(_shared_palette, data + CONTAINER_HEADER_SIZE_BYTES, PALETTE_SIZE_BYTES);
+    _has_shared_palette = true;
+  }
+
+  ESP_LOGI(TAG, "Container with %d compressed frames, %lu bytes", _frame_index_count, (unsigned long)offset);
+
+  return true;
 }
 
-void Renderer::_show()
+// The size of the given frame inside of the data file / upload, 0 if there is no such frame.
+size_t Renderer::get_record_size(uint16_t frame)
 {
-    _current_transaction.length = ((LEDS_PER_SIDE * 2 * 4) + 8) * 8;
-    _current_transaction.user = NULL;
-    _current_transaction.tx_buffer = _led_buffer;
-   
-    // Non blocking transfer.
-    spi_device_queue_trans(_spi, &_current_transaction, portMAX_DELAY);
+  if (!_compressed)
+    return _get_record_size_bytes();
+
+  return frame < _frame_index_count ? get_container_span(_frame_index[frame].size) : 0;
 }
 
-void Renderer::_change_led(uint8_t index, RGB color)
+// The frames have to arrive in order, compressed ones depend on the previous one.
+void Renderer::update_frame(uint16_t frame, const uint8_t* data)
 {
-  uint16_t offset = 4 + (index * 4);
-  
-  _led_buffer[offset] = 0xE0 | _current_brightness;
-  _led_buffer[offset + 1] = color.b;
-  _led_buffer[offset + 2] = color.g;
-  _led_buffer[offset + 3] = color.r;
+  LoaderLock lock(_loader_mutex);
+
+  _copy_to_frame_buffer(frame, data);
 }
 
-void Renderer::_copy_to_frame_buffer(uint8_t frame, uint8_t* data)
+bool Renderer::is_compressed() { return _compressed; }
+
+// Takes the record of an uncompressed frame piece by piece, in the order of the record.
+// Every piece goes straight to where it ends up, without collecting the whole record first.
+void Renderer::write_frame(uint16_t frame, size_t offset, const uint8_t* data, size_t length)
 {
-  // Extract the delay data from the frame.
-  uint16_t delay;
-  memcpy(&delay, data, 2);
-  _delay_data[frame] = delay;
+  LoaderLock lock(_loader_mutex);
 
-  // Copy the frame data into the PSRAM image buffer at the given frame index.
-  memcpy(((char*)_image_data) + frame * IMAGE_SIZE_BYTES,
-    data + 2,
-    IMAGE_SIZE_BYTES
-  );
-  
+  if (_compressed || frame >= _loading_frames->slot_count)
+    return;
 
-  _max_frame = frame;
+  _write_record(frame, offset, data, length);
+}
 
-  ESP_LOGI(TAG, "Setting max frame to : %d", _max_frame);
-  
-  // Always reset the current frame counter, incase we have a still image now.
-  if (_max_frame == 0)
-    _current_frame = 0;
- }
+// Has to be called once the whole record of the frame went through write_frame().
+void Renderer::finish_frame(uint16_t frame)
+{
+  LoaderLock lock(_loader_mutex);
 
-// Loads the .bin file from the file system into the _image_data Array,
-// so it can be used for displaying.
-void Renderer::_load_image_from_flash()
+  if (_compressed || frame >= _loading_frames->slot_count)
+    return;
+
+  _finish_record(frame);
+  _complete_frame(frame);
+}
+
+// The slot of a frame that is being loaded, or NULL if it doesn't have one.
+const uint8_t* Renderer::get_frame_data(uint16_t frame)
 {
-  File file = LittleFS.open(IMAGE_DATA_NAME, "r", false);
+  return frame < _loading_frames->slot_count ? _get_frame(frame) : NULL;
+}
 
-  if (!file) 
+size_t Renderer::get_frame_size() { return _loading_frames->frame_size; }
+
+// Changes the pixels of a frame that is in memory, see PATCH_RECT and PATCH_RUN.
+// The render task either shows the whole patch or none of it, never half of it.
+// Returns false if the patch is corrupt or the frame isn't resident.
+bool Renderer::patch_frame(uint16_t frame, const uint8_t* patch, size_t length)
+{
+  LoaderLock lock(_loader_mutex);
+
+  // Streamed and live frames get replaced all the time anyway.
+  if (_streaming.load(std::memory_order_acquire) || _live.load(std::memory_order_acquire) 
+    || _loading_frames->frames == _blank_frame || !_loading_published
+    || frame > _loading_frames->max_frame.load(std::memory_order_relaxed))
   {
-    ESP_LOGE(TAG, "Failed to open file for reading");
-    return;
+    ESP_LOGE(TAG, "Frame %d isn't resident, can't patch it!", frame);
+    return false;
   }
 
-  size_t size = file.size();
-  if (size == 0) 
+  // Big enough for a frame of any layout.
+  if (_patch_buffer == NULL)
   {
-    ESP_LOGE(TAG, "File is empty");
-    file.close();
-    return;
+    _patch_buffer = (uint8_t*)ps_malloc(POLAR_FRAME_SIZE_BYTES);
+    _patch_dirty = (uint8_t*)ps_malloc((_sparse_pixel_count + 7) / 8);
   }
 
-  // Reset all the delay data.
-  memset(_delay_data, 0, MAX_FRAMES * sizeof(uint16_t));
-  
-  uint16_t frame_index, delay = 0;
-  char* image_data_pointer = (char*)_image_data;
+  if (_patch_buffer == NULL || _patch_dirty == NULL)
+  {
+    ESP_LOGE(TAG, "Couldn't allocate the patch buffer!");
+    return false;
+  }
 
-  while (file.available()) 
+  uint8_t* slot = _get_frame(frame);
+  size_t frame_size = _loading_frames->frame_size;
+
+  memcpy(_patch_buffer, slot, frame_size);
+
+  if (!_apply_patch(_patch_buffer, patch, length))
+  {
+    ESP_LOGE(TAG, "The patch for frame %d is corrupt!", frame);
+    return false;
+  }
+
+  // Show the patched copy, until the slot has caught up with it.
+  // The slot has to be there before the copy, the render task reads them the other way around.
+  _patched_target.store(slot);
+  _patched_frame.store(_patch_buffer);
+
+  if (_loading_frames->format == FrameFormat::INDEXED)
+    _palette_generation.fetch_add(1, std::memory_order_release);
+
+  _wait_for_slice();
+  memcpy(slot, _patch_buffer, frame_size);
+
+  // The copy can't be touched again, until nothing shows it anymore.
+  _patched_frame.store(NULL);
+  _wait_for_slice();
+
+  return true;
+}
+
+// Writes the patch into a copy of a frame, returns false as soon as it turns out to be corrupt.
+// Pixels outside of the disc aren't stored, so they just get skipped.
+bool Renderer::_apply_patch(uint8_t* frame, const uint8_t* patch, size_t length)
+{
+  const uint8_t* end = patch + length;
+  // The frames on display might be resident ones, that don't have the format of the last load.
+  uint8_t pixel_size = _loading_frames->format == FrameFormat::INDEXED ? 1 : sizeof(RGB);
+  bool polar = _loading_frames->layout == FrameLayout::POLAR;
+  uint8_t* pixels = _loading_frames->format == FrameFormat::INDEXED ? frame + PALETTE_SIZE_BYTES : frame;
+
+  // Polar frames don't have the sparse pixels anymore, so collect the patched ones first.
+  uint8_t* target = polar ? _conversion_buffer : pixels;
+
+  if (polar)
+    memset(_patch_dirty, 0, (_sparse_pixel_count + 7) / 8);
+
+  auto set_pixel = [&](uint32_t offset, const uint8_t* value)
+  {
+    uint16_t index = _pixel_remap[offset];
+
+    if (index == SPARSE_NO_PIXEL)
+      return;
+
+    memcpy(target + index * pixel_size, value, pixel_size);
+
+    if (polar)
+      _patch_dirty[index / 8] |= 1 << (index % 8);
+  };
+
+  while (patch < end)
   {
-    if (frame_index >= MAX_FRAMES) 
+    uint8_t operation = *patch++;
+
+    if (operation == PATCH_RECT)
     {
-      ESP_LOGE(TAG, "Too many frames, buffer overflow!!!");
-      break;
+      if (end - patch < 4)
+        return false;
+
+      uint8_t x = patch[0], y = patch[1], width = patch[2], height = patch[3];
+      patch += 4;
+
+      if (x + width > IMAGE_LENGTH_PIXELS || y + height > IMAGE_LENGTH_PIXELS
+        || (size_t)(end - patch) < (size_t)width * height * pixel_size)
+        return false;
+
+      for (uint8_t row = 0; row < height; row++)
+        for (uint8_t column = 0; column < width; column++, patch += pixel_size)
+          set_pixel((y + row) * IMAGE_LENGTH_PIXELS + x + column, patch);
     }
+    else if (operation == PATCH_RUN)
+    {
+      if ((size_t)(end - patch) < (size_t)4 + pixel_size)
+        return false;
 
-    // Read delay and save it inside of the delay buffer.
-    file.readBytes((char*)&delay, 2);
-    _delay_data[frame_index] = delay;
+      uint16_t offset, count;
+      memcpy(&offset, patch, 2);
+      memcpy(&count, patch + 2, 2);
+      patch += 4;
 
-    // Read the frame data and write it to the current PSRAM buffer pointer. 
-    file.readBytes(
-      image_data_pointer,
-      IMAGE_SIZE_BYTES
-    );
+      if ((uint32_t)offset + count > IMAGE_SIZE_PIXELS)
+        return false;
+
+      for (uint16_t index = 0; index < count; index++)
+        set_pixel(offset + index, patch);
 
-    image_data_pointer += IMAGE_SIZE_BYTES;
-    frame_index++;
+      patch += pixel_size;
+    }
+    else
+    {
+      return false;
+    }
   }
 
-  file.close();
+  if (!polar)
+    return true;
 
-  _max_frame = frame_index - 1;
-  ESP_LOGI(TAG, "Frames loaded: %d", _max_frame);
-  
+  // Every position that shows one of the patched pixels gets it.
+  // Anti-aliased polar frames get the nearest pixel there, until they are loaded again.
+  for (uint16_t row = 0; row < SLICES_PER_HALF_ROTATION; row++)
+  {
+    const uint16_t* offsets = _pixel_offsets
+      + row * (MAX_ANGLES_PER_ROTATION / ANGLES_PER_ROTATION) * LEDS_PER_SLICE;
+    uint8_t* destination = pixels + row * LEDS_PER_SLICE * pixel_size;
 
-  // _print_first_pixel();
-  // for (int i = 0; i < _max_frame + 1; i++)
-  //   _print_image_data(i);
+    for (uint8_t led_index = 0; led_index < LEDS_PER_SLICE; led_index++)
+    {
+      uint16_t index = offsets[led_index];
+
+      if (_patch_dirty[index / 8] & (1 << (index % 8)))
+        memcpy(destination + led_index * pixel_size, _conversion_buffer + index * pixel_size, pixel_size);
+    }
+  }
+
+  return true;
 }
 
-void Renderer::_update_frame_count()
+// Waits until the render task is done with the slice it might be in the middle of right now.
+// Everything it does after that sees whatever got published before.
+void Renderer::_wait_for_slice()
 {
-  // If there aren't multiple frames that we need to cycle through.
-  if (_max_frame < 2)
+  uint32_t sequence = _slice_sequence.load();
+
+  if (!(sequence & 1))
     return;
-    
-  unsigned long now = micros();
-  uint32_t delay_us = _delay_data[_current_frame] * 1000;
-  
-  // If it's time to switch to the next frame.
-  if (now - _last_frame_switch > delay_us)
-  {
-    // Switch to the next frame.
-    _current_frame = _current_frame == _max_frame ?
-      0 : _current_frame + 1;
-    
-    _last_frame_switch = now;
-  }
+
+  while (_slice_sequence.load() == sequence)
+    vTaskDelay(1);
 }
 
-void Renderer::_update_degree_count() { _current_degrees = _current_degrees == 359 ? 0 : _current_degrees + 1 ; }
+// The data file of the animation with the given name, the data file itself doesn't have one.
+void Renderer::get_animation_path(const char* name, char* path, size_t size)
+{
+  if (name[0] == '\0')
+    snprintf(path, size, "%s", IMAGE_DATA_NAME);
+  else
+    snprintf(path, size, "%s/%s.bin", LIBRARY_DIRECTORY, name);
+}
 
-void Renderer::_update_led_colors()
+// Shows an animation of the library from the next rotation on, if it's resident.
+// Otherwise it gets loaded from the flash, like the data file.
+bool Renderer::show_animation(const char* name)
 {
-  uint32_t index;
-  RGB color;
-  
-  uint16_t offset_degrees = (_current_degrees + options.offset) % 360;
+  LoaderLock lock(_loader_mutex);
 
-  // Go through all the LEDs and change their current color value.  
-  for (uint8_t led_index = 0; led_index < LEDS_PER_SIDE; led_index++)
+  // A preloaded animation only has to be handed over, even if it isn't complete yet.
+  if (!_loading_published && _loading_frames->slot_count > 0 && strcmp(_loading_name, name) == 0)
   {
-    // Get the cartesian coordinates the LED should be showing inside of the image at that time.
-    auto coordinates = conversion_matrix[offset_degrees][LEDS_PER_SIDE - led_index - 1];
-    
-    index = _current_frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS + coordinates.y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - coordinates.x);
+    xSemaphoreTake(_stream_mutex, portMAX_DELAY);
+    _publish_frame_set();
+    xSemaphoreGive(_stream_mutex);
 
-    // Get the color value from the image at those coordinates.
-    color = _image_data[index];
+    ESP_LOGI(TAG, "Showing preloaded %s", name);
+    return true;
+  }
 
-    color.r = _add_colors(color.r, options.red_color_adjust);
-    color.g = _add_colors(color.g, options.green_color_adjust);
-    color.b = _add_colors(color.b, options.blue_color_adjust);
+  int8_t index = _find_resident(name);
+
+  if (index < 0)
+    return _load_animation(name);
+
+  stop_streaming();
+  _live.store(false, std::memory_order_release);
+
+  ResidentAnimation& animation = _resident[index];
+  FrameSet& frames = _frame_sets[_back_frame_set];
+
+  frames.frames = _image_data + animation.offset;
+  frames.delays = _get_delays(animation.offset);
+  frames.frame_size = animation.frame_size;
+  frames.layout = animation.layout;
+  frames.format = animation.format;
+  frames.offset = animation.offset;
+  frames.slot_count = animation.frame_count;
+  frames.max_frame.store(animation.frame_count - 1, std::memory_order_relaxed);
+  frames.streamed.store(false, std::memory_order_relaxed);
+  frames.live = false;
+  // Resident animations all come from the library.
+  frames.saved = true;
+
+  animation.last_used = ++_resident_clock;
+  _frame_layout = animation.layout;
+  _frame_format = animation.format;
+  _loading_frame_count = animation.frame_count;
+  strcpy(_loading_name, animation.name);
+  _loading_frames = &frames;
+  _loading_published = false;
+  _publish_frame_set();
+
+  ESP_LOGI(TAG, "Showing resident %s", name);
+  return true;
+}
 
-    _change_led(led_index, color);
-  }
-  
-  uint16_t opposite_degrees = (offset_degrees + 180) % 360;
-  
-  // Go through all the LEDs and change their current color value.  
-  for (uint8_t led_index = LEDS_PER_SIDE; led_index < LEDS_PER_SIDE * 2; led_index++)
+// Loads an animation of the library into the frame memory in the background, without showing it.
+// That only happens if it fits next to the frames on display, and nothing else is being loaded.
+// Returns false if it isn't going to be resident.
+bool Renderer::preload_animation(const char* name)
+{
+  LoaderLock lock(_loader_mutex);
+
+  if (_streaming.load(std::memory_order_acquire) || _live.load(std::memory_order_acquire))
+    return false;
+
+  int8_t index = _find_resident(name);
+
+  // Make sure it doesn't get evicted, before it's due.
+  if (index >= 0)
   {
-    // Get the cartesian coordinates the LED should be showing inside of the image at that time.
-    auto coordinates = conversion_matrix[opposite_degrees][led_index - LEDS_PER_SIDE];
+    _resident[index].last_used = ++_resident_clock;
+    return true;
+  }
 
-    index = _current_frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS + coordinates.y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - coordinates.x);
+  if (!_loading_published && strcmp(_loading_name, name) == 0)
+    return true;
 
-    // Get the color value from the image at those coordinates.
-    color = _image_data[index];
+  _preloading = true;
+  bool loaded = _load_animation(name);
+  _preloading = false;
 
-    color.r = _add_colors(color.r, options.red_color_adjust);
-    color.g = _add_colors(color.g, options.green_color_adjust);
-    color.b = _add_colors(color.b, options.blue_color_adjust);
+  if (!loaded)
+    ESP_LOGI(TAG, "Not preloading %s, it doesn't fit next to the frames on display", name);
 
-    _change_led(led_index, color);
-  }
+  return loaded;
 }
 
-void IRAM_ATTR _update_timer_ISR()
+// Whether showing the animation doesn't have to wait for the flash, which includes the one being preloaded.
+bool Renderer::is_resident(const char* name)
 {
-  // Update the timer delay once every full rotation.
-  timerAlarmWrite(g_renderer->_render_loop_timer, g_renderer->options._delay_between_degrees_us, true);
+  LoaderLock lock(_loader_mutex);
 
-  BaseType_t hptw;
-  vTaskNotifyGiveFromISR(g_renderer->_display_loop_task, &hptw);
-  
-  portYIELD_FROM_ISR(hptw);
+  return _find_resident(name) >= 0 
+    || (!_loading_published && _loading_frames->slot_count > 0 && strcmp(_loading_name, name) == 0);
 }
 
-void IRAM_ATTR _update_rotation_ISR(void* parameter)
+// Frees up the frame memory of an animation that's going to be replaced or removed.
+// If it's on display, it stays there until something else gets shown.
+void Renderer::evict_animation(const char* name)
 {
-  Renderer *renderer = (Renderer*)parameter;
-  
-  renderer->_current_degrees = 180;
+  LoaderLock lock(_loader_mutex);
+
+  int8_t index = _find_resident(name);
+
+  if (index >= 0)
+    _remove_resident(index);
 }
 
-uint8_t Renderer::_add_colors(uint8_t color, int16_t addition)
+// The name of the animation handed over last, empty for the data file.
+const char* Renderer::get_animation_name() { return _animation_name; }
+
+size_t Renderer::get_frame_memory_size() { return _image_data_size; }
+
+// How much of the frame memory the frames on display take up.
+size_t Renderer::get_displayed_size()
 {
-  int16_t temp_color = (int16_t)color;
-  int16_t clamped_color = clamp((temp_color + addition), 0, 255);
+  const FrameSet* shown = _get_published_frame_set();
 
-  return (uint8_t)clamped_color;
+  return shown->slot_count * shown->frame_size;
 }
 
-void Renderer::begin()
+uint8_t Renderer::get_resident_count() { return _resident_count; }
+
+const ResidentAnimation& Renderer::get_resident(uint8_t index) { return _resident[index]; }
+
+// Waits for the loader to finish the frame it's reading, then closes the data file.
+// Also ends loading the frames in the background.
+// Has to happen before anybody writes the data file.
+void Renderer::stop_streaming()
 {
-  g_renderer = this;
-  
-  BaseType_t result;
+  LoaderLock lock(_loader_mutex);
 
-  // Allocate all the image data in PSRAM.
-  _image_data = (RGB*)ps_malloc(IMAGE_DATA_SIZE);
-  
-  for (uint32_t index = 0; index < (IMAGE_DATA_SIZE / sizeof(RGB)); index++)
-    _image_data[index] = RGB::Black;
-  
-  // Initialize the SPI bus.
-  spi_bus_initialize(SPI_HOST, &_buscfg, SPI_DMA_CH_AUTO);
-  
-  // Attach the SPI device.
-  spi_bus_add_device(SPI_HOST, &_devcfg, &_spi);
+  if (!_streaming.load(std::memory_order_acquire))
+    return;
 
-  // Allocate DMA buffer.
-  _led_buffer = (uint8_t*)heap_caps_malloc(
-    (LEDS_PER_SIDE * 2 * 4) + 8,
-     MALLOC_CAP_DMA
-  );
+  xSemaphoreTake(_stream_mutex, portMAX_DELAY);
+  _close_stream();
+  xSemaphoreGive(_stream_mutex);
+
+  ESP_LOGI(TAG, "Stopped streaming, %lu underruns so far", (unsigned long)_stream_underruns);
+}
 
-  // Write start and end sections.
-  memset(_led_buffer, 0x00, 4);
-  memset(_led_buffer + 4 + (LEDS_PER_SIDE * 2 * 4), 0xFF, 4);
+bool Renderer::is_streaming() { return _streaming.load(std::memory_order_relaxed); }
 
-  for (uint8_t led_index = 0; led_index < LEDS_PER_SIDE * 2; led_index++)
-    _change_led(led_index, RGB::Black);
+uint32_t Renderer::get_stream_underruns() { return _stream_underruns; }
 
-  _show();
+// Frames per second that actually got shown, which is less than the animation has if they are shorter than a rotation.
+float Renderer::get_frame_rate() { return _frame_rate; }
 
-  _load_image_from_flash();
-  // _print_image_data();
+// Frames that were over before a rotation could show them.
+uint32_t Renderer::get_skipped_frames() { return _skipped_frames; }
 
-  _render_loop_timer = timerBegin(
-    0,
-    80,
-    true
-  );
+// Replaces the animation with live frames, until stop_live() or the next upload.
+// Starts out black.
+void Renderer::start_live()
+{
+  LoaderLock lock(_loader_mutex);
 
-  result = xTaskCreate(
-    _display_loop,
-    PSTR("Display Loop"),
-    4096,
-    this,
-    configMAX_PRIORITIES,
-    &_display_loop_task
-  );
+  if (_live.load(std::memory_order_acquire))
+    return;
 
-  if (result != pdPASS)
-    ESP_LOGE(TAG, "Couldn't allocate enough memory!");
+  stop_streaming();
 
-  timerAttachInterrupt(_render_loop_timer, _update_timer_ISR, false);
-  timerAlarmWrite(_render_loop_timer, options._delay_between_degrees_us, true);
-  timerAlarmEnable(_render_loop_timer);
-  
-  attachInterruptArg(digitalPinToInterrupt(HAL_PIN), _update_rotation_ISR, this, FALLING);
+  // The codec works on the sparse pixels, so live frames are always cartesian RGB.
+  _compressed = false;
+  _has_shared_palette = false;
+  _frame_format = FrameFormat::RGB;
+  _frame_layout = FrameLayout::CARTESIAN;
+
+  if (get_frame_capacity() < LIVE_RING_SIZE)
+  {
+    ESP_LOGE(TAG, "There isn't enough memory for live frames!");
+    return;
+  }
+
+  _begin_frame_set(LIVE_RING_SIZE);
+  memset(_loading_frames->frames, 0, LIVE_RING_SIZE * _loading_frames->frame_size);
+
+  // The render task starts out on the first slot.
+  _live_ready.store(1, std::memory_order_relaxed);
+  _live_back = 2;
+  _live_last = LIVE_NO_SLOT;
+  _loading_frames->live = true;
+  _loading_frames->max_frame.store(LIVE_RING_SIZE - 1, std::memory_order_relaxed);
+  _live.store(true, std::memory_order_release);
+  _publish_frame_set();
+
+  ESP_LOGI(TAG, "Showing live frames");
 }
 
-void Renderer::_display_loop(void *parameter)
+// Takes a whole message from the live socket, see LIVE_FORMAT_RGB and LIVE_FORMAT_CODEC.
+// Returns false if it's invalid, or live frames aren't being shown right now.
+bool Renderer::push_live_frame(const uint8_t* message, size_t length)
 {
-  Renderer *renderer = (Renderer*)parameter;
-  
-  while (true)
+  LoaderLock lock(_loader_mutex);
+
+  if (!_live.load(std::memory_order_acquire))
+    return false;
+
+  _live_received.fetch_add(1, std::memory_order_relaxed);
+
+  uint8_t* destination = _get_frame(_live_back);
+  bool valid = false;
+
+  if (length == LIVE_MESSAGE_MAX_BYTES && message[0] == LIVE_FORMAT_RGB)
   {
-    ulTaskNotifyTake(true, portMAX_DELAY);
+    _pack_frame((const RGB*)(message + 1), (RGB*)destination);
+    valid = true;
+  }
+  else if (length > 0 && message[0] == LIVE_FORMAT_CODEC)
+  {
+    const uint8_t* reference = _live_last != LIVE_NO_SLOT ? _get_frame(_live_last) : NULL;
+    valid = decode_frame(message + 1, length - 1, destination, reference, _sparse_pixel_count, sizeof(RGB));
+  }
 
-    renderer->_update_degree_count();
-    renderer->_update_frame_count();
-    renderer->_update_led_colors();
-    renderer->_show();
+  if (!valid)
+  {
+    ESP_LOGE(TAG, "Dropping an invalid live frame of %lu bytes", (unsigned long)length);
+    _live_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
   }
-}
 
-void Renderer::set_brightness(uint8_t brightness) 
-{ 
-  // Only change the current brightness if the leds aren't disabled.
-  if (_current_brightness != 0)
-    _current_brightness = brightness;
+  // Hand the frame over, and receive the next one into whatever the render task isn't showing.
+  uint8_t previous = _live_ready.exchange(_live_back | LIVE_FRESH, std::memory_order_acq_rel);
 
-  _saved_brightness = brightness;
+  _live_last = _live_back;
+  _live_back = previous & ~LIVE_FRESH;
+
+  // The render task never got to show that one, there's a newer one already.
+  if (previous & LIVE_FRESH)
+    _live_dropped.fetch_add(1, std::memory_order_relaxed);
+
+  return true;
 }
 
-void Renderer::set_renderer_state(bool enabled)
+// Goes back to the animation in the data file.
+void Renderer::stop_live()
 {
-  // Set the brightness to 0 incase the renderer should be disabled.
-  // This might seem like a stupid idea but it's far more reliable than disabling the 
-  // Task or doing something over the top... trust me.
-  enabled ? _current_brightness = _saved_brightness : _current_brightness = 0;
-}
+  LoaderLock lock(_loader_mutex);
 
-void Renderer::refresh_image() { _load_image_from_flash(); }
+  if (!_live.load(std::memory_order_acquire))
+    return;
 
-void Renderer::update_frame(uint8_t frame, uint8_t* data) { _copy_to_frame_buffer(frame, data); }
+  ESP_LOGI(TAG, "Live frames: %lu received, %lu dropped, %lu displayed",
+    (unsigned long)get_live_received(), (unsigned long)get_live_dropped(), (unsigned long)get_live_displayed());
 
+  // The last live frame stays on display, in case there is no animation to go back to.
+  _live.store(false, std::memory_order_release);
+  _load_image_from_flash();
 }
 
+bool Renderer::is_live() { return _live.load(std::memory_order_relaxed); }
+
+uint32_t Renderer::get_live_received() { return _live_received.load(std::memory_order_relaxed); }
+
+uint32_t Renderer::get_live_dropped() { return _live_dropped.load(std::memory_order_relaxed); }
+
+uint32_t Renderer::get_live_displayed() { return _live_displayed.load(std::memory_order_relaxed); }
+
+}
@@ -0,0 +1,169 @@
+/*
+ * @file rotation_pll.cpp
+ * @authors mia
+ * @brief Tracks the rotation period and phase from the HAL sensor edges.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "Rendering/rotation_pll.hpp"
+
+namespace Rendering 
+{
+
+// Forgets the current estimate and starts measuring from this edge again.
+void IRAM_ATTR RotationPLL::_restart(int64_t now_us)
+{
+  _period_q8 = 0;
+  _good_edges = 0;
+  _phase_us = now_us;
+  _last_edge_us = now_us;
+}
+
+// Returns whether the PLL is locked after the edge, so the ISR doesn't have to take the lock twice.
+bool IRAM_ATTR RotationPLL::on_edge(int64_t now_us)
+{
+  taskENTER_CRITICAL_ISR(&_mux);
+  _update(now_us);
+  bool locked = _is_locked(now_us);
+  taskEXIT_CRITICAL_ISR(&_mux);
+
+  return locked;
+}
+
+// Only ever called with the lock held.
+void IRAM_ATTR RotationPLL::_update(int64_t now_us)
+{
+  int64_t interval_us = now_us - _last_edge_us;
+  int64_t period_us = _period_q8 >> 8;
+
+  // The very first edge doesn't have anything to compare against.
+  if (_last_edge_us == 0)
+  {
+    _restart(now_us);
+    return;
+  }
+
+  // Edges that come way too soon are bounces or noise.
+  if (interval_us * 100 < period_us * PLL_GLITCH_PERCENT || interval_us < PLL_MIN_PERIOD_US)
+  {
+    _glitches++;
+    return;
+  }
+
+  // The motor was standing still or we just started measuring.
+  if (period_us == 0 || interval_us > PLL_MAX_PERIOD_US)
+  {
+    _restart(now_us);
+
+    if (interval_us <= PLL_MAX_PERIOD_US)
+      _period_q8 = interval_us << 8;
+
+    return;
+  }
+
+  // Figure out how many rotations passed, in case some edges got lost.
+  int64_t rotations = (now_us - _phase_us + period_us / 2) / period_us;
+
+  if (rotations < 1)
+    rotations = 1;
+
+  int64_t predicted_us = _phase_us + rotations * period_us;
+  int64_t error_us = now_us - predicted_us;
+
+  if ((error_us < 0 ? -error_us : error_us) * 100 > period_us * PLL_MAX_ERROR_PERCENT)
+  {
+    // Way off, the speed must have changed a lot. Measure from scratch.
+    _restart(now_us);
+    _period_q8 = (interval_us / rotations) << 8;
+  }
+  else
+  {
+    // Pull the phase and the period towards the measured edge.
+    _phase_us = predicted_us + (error_us >> PLL_PHASE_GAIN_SHIFT);
+    _period_q8 += ((error_us << 8) >> PLL_PERIOD_GAIN_SHIFT) / rotations;
+    _last_edge_us = now_us;
+
+    if (_good_edges < PLL_LOCK_EDGES)
+      _good_edges++;
+  }
+}
+
+// Locked means the last few edges matched the prediction, 
+// and we haven't gone two whole rotations without any edge.
+bool IRAM_ATTR RotationPLL::_is_locked(int64_t now_us)
+{
+  return _good_edges >= PLL_LOCK_EDGES 
+    && now_us - _last_edge_us < 2 * (_period_q8 >> 8);
+}
+
+bool RotationPLL::is_locked(int64_t now_us)
+{
+  taskENTER_CRITICAL(&_mux);
+  bool locked = _is_locked(now_us);
+  taskEXIT_CRITICAL(&_mux);
+
+  return locked;
+}
+
+uint32_t RotationPLL::get_period_us()
+{
+  taskENTER_CRITICAL(&_mux);
+  uint32_t period_us = _period_q8 >> 8;
+  taskEXIT_CRITICAL(&_mux);
+
+  return period_us;
+}
+
+// Predicts which slice the strip is going to be at, at the given time.
+uint16_t RotationPLL::get_slice(int64_t time_us, uint16_t angles_per_rotation)
+{
+  taskENTER_CRITICAL(&_mux);
+  int64_t period_us = _period_q8 >> 8;
+  int64_t elapsed_us = time_us - _phase_us;
+  taskEXIT_CRITICAL(&_mux);
+
+  if (period_us == 0)
+    return 0;
+
+  elapsed_us %= period_us;
+  
+  if (elapsed_us < 0)
+    elapsed_us += period_us;
+
+  // The edge happens when the strip is at the angle of the sensor.
+  uint32_t slice = elapsed_us * angles_per_rotation / period_us 
+    + HAL_SENSOR_ANGLE * angles_per_rotation / 360;
+
+  return slice % angles_per_rotation;
+}
+
+// The time the slice starts at, in the rotation that puts it closest to the given time.
+// Always computed from the phase, so the rounding of the slice period never adds up.
+int64_t RotationPLL::get_slice_time(uint16_t slice, int64_t near_us, uint16_t angles_per_rotation)
+{
+  taskENTER_CRITICAL(&_mux);
+  int64_t period_us = _period_q8 >> 8;
+  int64_t phase_us = _phase_us;
+  taskEXIT_CRITICAL(&_mux);
+
+  if (period_us == 0)
+    return near_us;
+
+  int64_t angles = angles_per_rotation;
+  // Counted from the edge on, which is at the angle of the sensor.
+  int64_t first = (slice + angles - HAL_SENSOR_ANGLE * angles / 360 % angles) % angles;
+  int64_t nearest = (near_us - phase_us) * angles / period_us;
+  int64_t distance = ((nearest - first) % angles + angles) % angles;
+  int64_t index = nearest - distance + (distance > angles / 2 ? angles : 0);
+  int64_t offset = index * period_us;
+
+  // Rounded up, get_slice() only gets to the slice from there on.
+  return phase_us + (offset >= 0 ? (offset + angles - 1) / angles : -(-offset / angles));
+}
+
+uint32_t RotationPLL::get_glitches() { return _glitches; }
+
+}
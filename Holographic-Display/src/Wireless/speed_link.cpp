@@ -0,0 +1,136 @@
+/*
+ * @file speed_link.cpp
+ * @authors mia
+ * @brief Exchanges the speed and the power with the motor controller over UDP.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include "Wireless/speed_link.hpp"
+
+
+namespace Wireless
+{
+
+SpeedLink::SpeedLink(Rendering::Renderer *renderer)
+{
+  _renderer = renderer;
+}
+
+void SpeedLink::begin()
+{
+  if (!_socket.open(SPEED_LINK_PORT))
+  {
+    ESP_LOGE(TAG, "Couldn't open the speed link on port %d!", SPEED_LINK_PORT);
+    return;
+  }
+
+  // Just like the webserver, it mustn't get in the way of the renderer.
+  BaseType_t result = xTaskCreatePinnedToCore(
+    _link_loop,
+    PSTR("Speed Link"),
+    4096,
+    this,
+    2,
+    &_link_task,
+    NETWORK_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory for the speed link!");
+}
+
+// Calculate the time for a whole rotation in μs, the renderer
+// divides it up into however many slices it is currently using.
+// (This used to be the time per degree, hence the 360)
+uint32_t SpeedLink::get_rotation_period_us(uint32_t pulse_period_us)
+{
+  return (uint32_t)((float)(pulse_period_us) / (8.0 * MAGIC_VALUE_TM) * 360.0);
+}
+
+// Prefer the period the PLL measured at the HAL sensor over this one.
+unsigned long SpeedLink::get_RPM()
+{
+  uint32_t rotation_period_us = _rotation_period_us;
+
+  if (!_connected || rotation_period_us == 0)
+    return 0;
+
+  return 60000000UL / rotation_period_us;
+}
+
+// The pulse time is moved into the local clock, with the offset if the clocks are
+// synced already. Otherwise the age of the pulse is all there is to go on.
+void SpeedLink::_handle_speed(const SpeedMessage& message, int64_t receive_us)
+{
+  const ClockSync& clock = _link.get_clock();
+  int64_t pulse_time_us = clock.is_synced()
+    ? clock.to_local(message.pulse_time_us)
+    : receive_us - (message.header.send_time_us - message.pulse_time_us);
+
+  if (message.pulse_period_us == 0)
+    _motor_speed.reset();
+  else
+    _motor_speed.update(get_rotation_period_us(message.pulse_period_us), pulse_time_us);
+
+  _renderer->set_motor_speed(_motor_speed);
+
+  _rotation_period_us = _motor_speed.get_period_us(receive_us);
+  _round_trip_us = clock.get_round_trip_us();
+  _lost = _link.get_lost();
+}
+
+void SpeedLink::_send_power()
+{
+  PowerMessage message;
+
+  _link.fill_header(message.header, SPEED_MESSAGE_POWER, esp_timer_get_time());
+  message.target_power = _target_power;
+  _socket.send(&message, sizeof(message));
+}
+
+// Sends the power every SPEED_LINK_INTERVAL_MS, and waits for the speed in between.
+// Nothing goes out until the motor controller made itself known.
+void SpeedLink::_link_loop(void *parameter)
+{
+  SpeedLink *link = (SpeedLink*)parameter;
+  int64_t next_send_us = esp_timer_get_time();
+  SpeedMessage message;
+
+  while (true)
+  {
+    int64_t now_us = esp_timer_get_time();
+    size_t length = link->_socket.receive(&message, sizeof(message),
+      next_send_us > now_us ? next_send_us - now_us : 0);
+    int64_t receive_us = esp_timer_get_time();
+
+    if (length == sizeof(message) && link->_link.accept(message.header, SPEED_MESSAGE_SPEED, receive_us))
+    {
+      link->_socket.answer_sender();
+      link->_handle_speed(message, receive_us);
+    }
+
+    // Back to the fallback from the options, once the motor controller is gone.
+    if (link->_connected && link->_link.is_timed_out(receive_us))
+    {
+      ESP_LOGE(TAG, "Lost the motor controller!");
+      link->_motor_speed.reset();
+      link->_renderer->set_motor_speed(link->_motor_speed);
+    }
+
+    link->_connected = !link->_link.is_timed_out(receive_us);
+
+    if (receive_us < next_send_us)
+      continue;
+
+    if (link->_connected)
+      link->_send_power();
+
+    // Never tries to catch up, it's only ever the latest power that matters.
+    next_send_us = max(next_send_us + SPEED_LINK_INTERVAL_MS * 1000, receive_us);
+  }
+}
+
+}
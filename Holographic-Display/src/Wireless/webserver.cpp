@@ -14,9 +14,13 @@
 namespace Wireless
 {
 
-WebServer::WebServer(uint16_t port, Rendering::Renderer *renderer) : _server(port)
+WebServer::WebServer(uint16_t port, Rendering::Renderer *renderer, Rendering::AnimationLibrary *library, SpeedLink *speed_link) 
+  : _server(port), _upload_decoder(renderer), _live_socket(LIVE_SOCKET_PATH), 
+    _control_socket(CONTROL_SOCKET_PATH)
 {
   _renderer = renderer;
+  _library = library;
+  _speed_link = speed_link;
 }
 
 String WebServer::_format_bytes(const size_t bytes) 
@@ -44,6 +48,30 @@ void WebServer::_begin_OTA()
   ElegantOTA.setAuth(OTA_USERNAME, OTA_PASSWORD);
 #endif
 #endif
+
+  // On the network core, the loop task of the Arduino core would share its core with the renderer.
+  BaseType_t result = xTaskCreatePinnedToCore(
+    _OTA_loop,
+    PSTR("OTA"),
+    4096,
+    NULL,
+    1,
+    &_OTA_loop_task,
+    NETWORK_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory for the OTA loop!");
+}
+
+// Reboots the ESP once an update finished, if there was one.
+void WebServer::_OTA_loop(void *parameter)
+{
+  while (true)
+  {
+    ElegantOTA.loop();
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
 }
 #endif
 
@@ -99,10 +127,52 @@ void WebServer::_setup_webserver_tree()
   _server.on(PSTR("/CurrentRPM"), HTTP_GET, [this](AsyncWebServerRequest *request)
   {
     char buffer[10];
-    sprintf(buffer, "%d", _current_RPM);
+    sprintf(buffer, "%lu", _get_measured_RPM());
     request->send(200, F("text/plain"), buffer);
   });
   
+  _server.on(PSTR("/Status"), HTTP_GET, [this](AsyncWebServerRequest *request)
+  {
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer), 
+      "{\"rpm\":%lu,\"angles_per_rotation\":%u,\"angles_mode\":%u,"
+      "\"slice_period_us\":%lu,\"slice_compute_us\":%lu,\"spi_overruns\":%lu,"
+      "\"pll_locked\":%s,\"hal_glitches\":%lu,\"frame_capacity\":%u,"
+      "\"streaming\":%s,\"stream_underruns\":%lu,\"frame_rate\":%.1f,\"skipped_frames\":%lu,"
+      "\"live\":%s,\"live_received\":%lu,\"live_dropped\":%lu,\"live_displayed\":%lu,"
+      "\"motor_link\":%s,\"motor_round_trip_us\":%lu,\"motor_lost\":%lu}",
+      _get_measured_RPM(),
+      _renderer->get_angles_per_rotation(),
+      _renderer->get_options().angles_per_rotation,
+      (unsigned long)_renderer->get_slice_period_us(),
+      (unsigned long)_renderer->get_slice_compute_us(),
+      (unsigned long)_renderer->get_spi_overruns(),
+      _renderer->is_rotation_locked() ? "true" : "false",
+      (unsigned long)_renderer->get_hal_glitches(),
+      _renderer->get_frame_capacity(),
+      _renderer->is_streaming() ? "true" : "false",
+      (unsigned long)_renderer->get_stream_underruns(),
+      _renderer->get_frame_rate(),
+      (unsigned long)_renderer->get_skipped_frames(),
+      _renderer->is_live() ? "true" : "false",
+      (unsigned long)_renderer->get_live_received(),
+      (unsigned long)_renderer->get_live_dropped(),
+      (unsigned long)_renderer->get_live_displayed(),
+      _speed_link->is_connected() ? "true" : "false",
+      (unsigned long)_speed_link->get_round_trip_us(),
+      (unsigned long)_speed_link->get_lost()
+    );
+
+    request->send(200, F("application/json"), buffer);
+  });
+  
+#ifdef RENDER_METRICS
+  _server.on(PSTR("/metrics"), HTTP_GET, [this](AsyncWebServerRequest *request)
+  {
+    _send_metrics(request);
+  });
+#endif
+  
   _server.onNotFound([](AsyncWebServerRequest *request)
   {
     ESP_LOGI(TAG, "Unable to find http://%s | request from %s\n", request->host().c_str(), request->client()->remoteIP().toString().c_str());
@@ -110,75 +180,147 @@ void WebServer::_setup_webserver_tree()
     request->send(LittleFS, F("/site/notfound/index.html"), F("text/html"));
   });
 
-  _server.onFileUpload([this](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) 
+  // Takes the frames either as a multipart form, or the raw data file as the body.
+  // With /upload?name=... they are added to the library, instead of replacing the data file.
+  _server.on(PSTR("/upload"), HTTP_POST, [this](AsyncWebServerRequest *request)
   {
-    // If a new upload has been started.
-    if (!index)                   
+    if (_upload_name_invalid)
     {
-      ESP_LOGI(TAG, "Upload started!");
-      ESP_LOGI(TAG, "DMO Mode: %s", _dmo_mode ? "enabled" : "disabled");
-                       
-      if (!_dmo_mode)
-        request->_tempFile = LittleFS.open(IMAGE_DATA_NAME, "w");
-
-      _frame_buffer_index = 0;
-      _frame_counter = 0;
+      request->send(400, F("text/plain"), F("Invalid animation name"));
+      return;
     }
-                       
-    // Copy the received data into the frame buffer.
-    memcpy(_frame_buffer + _frame_buffer_index, 
-      data,
-      len
-    );
 
-    _frame_buffer_index += len;
-       
-    // If the frame buffer is full.
-    if (_frame_buffer_index >= IMAGE_SIZE_BYTES + 2)
+    if (_upload_decoder.is_rejected())
     {
-      _renderer->update_frame(_frame_counter, _frame_buffer);
-                 
-      // Only care about writing anything to the file system if we aren't in DMU mode!
-      if (!_dmo_mode)
-      {
-        size_t free_bytes = LittleFS.totalBytes() - LittleFS.usedBytes();
-        ESP_LOGI(TAG, "LittleFS Free: %s", _format_bytes(free_bytes).c_str());
-                       
-        if (request->_tempFile)
-          request->_tempFile.write(_frame_buffer, IMAGE_SIZE_BYTES + 2);
-        }
-
-      size_t remaining_bytes = _frame_buffer_index - (IMAGE_SIZE_BYTES + 2);
-
-      // Move the rest of the buffer back to the start if there is remaining data.
-      if (remaining_bytes > 0)
-        memmove(_frame_buffer,
-            _frame_buffer + (IMAGE_SIZE_BYTES + 2),
-            remaining_bytes
-        );
-  
-      _frame_buffer_index -= (IMAGE_SIZE_BYTES + 2);
-      _frame_counter++;
+      request->send(400, F("text/plain"), F("Unknown frame format"));
+      return;
+    }
+
+    request->send(200, F("text/plain"), F("OK"));
+  }, [this](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) 
+  {
+    _handle_upload(request, index, data, len, final);
+  }, [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+  {
+    _handle_upload(request, index, data, len, index + len == total);
+  });
+
+  // Patches the pixels of a frame in memory, /patch?frame=N with the raw patch as the body.
+  _server.on(PSTR("/patch"), HTTP_POST, [this](AsyncWebServerRequest *request)
+  {
+    const AsyncWebParameter* frame = request->getParam("frame");
+
+    if (request->contentLength() > PATCH_MAX_SIZE_BYTES)
+    {
+      request->send(413, F("text/plain"), F("Patch too big, upload the frame instead"));
+      return;
+    }
+
+    if (request->_tempObject == NULL
+      || !_renderer->patch_frame(frame != NULL ? frame->value().toInt() : 0,
+        (const uint8_t*)request->_tempObject, request->contentLength()))
+    {
+      request->send(400, F("text/plain"), F("Couldn't apply the patch"));
+      return;
+    }
+
+    request->send(200, F("text/plain"), F("OK"));
+  }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+  {
+    // The patch has to be complete before any of it gets applied.
+    // The request frees the buffer once it's done.
+    if (!index && total <= PATCH_MAX_SIZE_BYTES)
+      request->_tempObject = malloc(total);
+
+    if (request->_tempObject != NULL)
+      memcpy((uint8_t*)request->_tempObject + index, data, len);
+  });
+
+  _server.on(PSTR("/library"), HTTP_GET, [this](AsyncWebServerRequest *request)
+  {
+    _send_library(request);
+  });
+
+  // Shows the animation right away and stops the playlist, /library/select?name=...
+  _server.on(PSTR("/library/select"), HTTP_POST, [this](AsyncWebServerRequest *request)
+  {
+    const AsyncWebParameter* name = request->getParam("name");
+
+    if (name == NULL || !_library->select(name->value().c_str()))
+    {
+      request->send(404, F("text/plain"), F("Unknown animation"));
+      return;
     }
-                       
-    if (!_dmo_mode && final)
+
+    request->send(200, F("text/plain"), F("OK"));
+  });
+
+  // Adds the animation to the playlist, /library/queue?name=...&duration=ms
+  _server.on(PSTR("/library/queue"), HTTP_POST, [this](AsyncWebServerRequest *request)
+  {
+    const AsyncWebParameter* name = request->getParam("name");
+    const AsyncWebParameter* duration = request->getParam("duration");
+
+    if (name == NULL || duration == NULL || duration->value().toInt() <= 0)
     {
-      request->_tempFile.close();
-      ESP_LOGI(TAG, "Upload ended! %s, %u\n", filename.c_str(), _format_bytes(index + len));
-      ESP_LOGI(TAG, "Free Heap: %d", ESP.getFreeHeap());
+      request->send(400, F("text/plain"), F("Missing name or duration"));
+      return;
     }
+
+    if (!_library->queue(name->value().c_str(), duration->value().toInt()))
+    {
+      request->send(409, F("text/plain"), F("Unknown animation or the playlist is full"));
+      return;
+    }
+
+    request->send(200, F("text/plain"), F("OK"));
+  });
+
+  _server.on(PSTR("/library/clear"), HTTP_POST, [this](AsyncWebServerRequest *request)
+  {
+    _library->clear();
+    request->send(200, F("text/plain"), F("OK"));
   });
 
+  _server.on(PSTR("/library/remove"), HTTP_POST, [this](AsyncWebServerRequest *request)
+  {
+    const AsyncWebParameter* name = request->getParam("name");
+
+    if (name == NULL || !_library->remove(name->value().c_str()))
+    {
+      request->send(404, F("text/plain"), F("Unknown animation"));
+      return;
+    }
+
+    request->send(200, F("text/plain"), F("OK"));
+  });
+
+  _live_socket.onEvent([this](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+  {
+    _handle_live_event(client, type, arg, data, len);
+  });
+  _server.addHandler(&_live_socket);
+
+  _control_socket.onEvent([this](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+  {
+    _handle_control_event(client, type, arg, data, len);
+  });
+  _server.addHandler(&_control_socket);
+
+  // Still there for older motor controllers and anything that doesn't speak the control socket.
   _server.on(PSTR("/post"), HTTP_POST, [this](AsyncWebServerRequest *request)
   {
     uint8_t params = request->params();
+    Rendering::Options options = _renderer->get_options();
     
     for(uint8_t i = 0; i < params; i++)
     {
       const AsyncWebParameter* parameter = request->getParam(i);
             
-      _handle_input(parameter);
+      _handle_input(parameter, options);
     }
+
+    _renderer->set_options(options);
       
     request->send(200, F("text/plain"), F("OK"));
   });
@@ -190,30 +332,512 @@ void WebServer::_setup_webserver_tree()
   _server.begin();
 }
 
-// This handles any responses we get from the User-Interface.
-void WebServer::_handle_input(const AsyncWebParameter* parameter)
+#ifdef RENDER_METRICS
+// Prometheus text format by default, JSON with ?format=json.
+void WebServer::_send_metrics(AsyncWebServerRequest *request)
+{
+  const Rendering::RenderMetrics& metrics = _renderer->get_metrics();
+  const AsyncWebParameter* format = request->getParam("format");
+  bool json = format != NULL && format->value() == "json";
+
+  AsyncResponseStream *response = request->beginResponseStream(json ? "application/json" : "text/plain; version=0.0.4");
+
+  if (json)
+  {
+    response->printf("{\"slices\":%lu,\"missed_slices\":%lu,\"late_slices\":%lu,\"rotations\":%lu,\"stream_underruns\":%lu,",
+      (unsigned long)metrics.get_slices(), (unsigned long)metrics.get_missed_slices(),
+      (unsigned long)metrics.get_late_slices(), (unsigned long)metrics.get_rotations(),
+      (unsigned long)_renderer->get_stream_underruns());
+    response->printf("\"frame_rate\":%.2f,\"skipped_frames\":%lu,",
+      _renderer->get_frame_rate(), (unsigned long)_renderer->get_skipped_frames());
+    response->printf("\"live_received\":%lu,\"live_dropped\":%lu,\"live_displayed\":%lu,",
+      (unsigned long)_renderer->get_live_received(), (unsigned long)_renderer->get_live_dropped(),
+      (unsigned long)_renderer->get_live_displayed());
+
+    _print_histogram_json(response, "isr_latency_us", metrics.isr_latency);
+    response->print(",");
+    _print_histogram_json(response, "compute_us", metrics.compute_time);
+    response->print(",");
+    _print_histogram_json(response, "spi_wait_us", metrics.spi_wait);
+    response->print(",");
+    _print_histogram_json(response, "missed_per_rotation", metrics.missed_per_rotation);
+    response->print(",");
+    _print_histogram_json(response, "late_per_rotation", metrics.late_per_rotation);
+    response->print(",");
+    _print_histogram_json(response, "frame_jitter_us", metrics.frame_jitter);
+    response->print(",");
+    _print_histogram_json(response, "frame_read_us", metrics.frame_read);
+    response->print(",");
+    _print_histogram_json(response, "frame_decode_us", metrics.frame_decode);
+    response->print(",\"task_load_percent\":{");
+    _print_task_load(response, json, "display", RENDERER_CORE, metrics.display_load);
+    response->print(",");
+    _print_task_load(response, json, "loader", FRAME_LOADER_CORE, metrics.loader_load);
+    response->print(",");
+    _print_task_load(response, json, "playlist", FRAME_LOADER_CORE, _library->get_load());
+    response->print(",");
+    _print_task_load(response, json, "network", NETWORK_CORE, _network_load);
+    response->print("}}");
+  }
+  else
+  {
+    response->printf("# TYPE holo_slices_total counter\nholo_slices_total %lu\n", (unsigned long)metrics.get_slices());
+    response->printf("# TYPE holo_missed_slices_total counter\nholo_missed_slices_total %lu\n", (unsigned long)metrics.get_missed_slices());
+    response->printf("# TYPE holo_late_slices_total counter\nholo_late_slices_total %lu\n", (unsigned long)metrics.get_late_slices());
+    response->printf("# TYPE holo_rotations_total counter\nholo_rotations_total %lu\n", (unsigned long)metrics.get_rotations());
+    response->printf("# TYPE holo_stream_underruns_total counter\nholo_stream_underruns_total %lu\n", (unsigned long)_renderer->get_stream_underruns());
+    response->printf("# TYPE holo_frame_rate gauge\nholo_frame_rate %.2f\n", _renderer->get_frame_rate());
+    response->printf("# TYPE holo_skipped_frames_total counter\nholo_skipped_frames_total %lu\n", (unsigned long)_renderer->get_skipped_frames());
+    response->printf("# TYPE holo_live_frames_received_total counter\nholo_live_frames_received_total %lu\n", (unsigned long)_renderer->get_live_received());
+    response->printf("# TYPE holo_live_frames_dropped_total counter\nholo_live_frames_dropped_total %lu\n", (unsigned long)_renderer->get_live_dropped());
+    response->printf("# TYPE holo_live_frames_displayed_total counter\nholo_live_frames_displayed_total %lu\n", (unsigned long)_renderer->get_live_displayed());
+
+    _print_histogram(response, "holo_isr_latency_us", "Time from the timer ISR to the display task running.", metrics.isr_latency);
+    _print_histogram(response, "holo_compute_us", "Time spent assembling a slice.", metrics.compute_time);
+    _print_histogram(response, "holo_spi_wait_us", "Time spent queueing a slice and waiting for a DMA buffer.", metrics.spi_wait);
+    _print_histogram(response, "holo_missed_per_rotation", "Timer ticks the display task slept through, per rotation.", metrics.missed_per_rotation);
+    _print_histogram(response, "holo_late_per_rotation", "Slices that took longer than their period, per rotation.", metrics.late_per_rotation);
+    _print_histogram(response, "holo_frame_jitter_us", "How far into its time on the timeline a frame first got shown.", metrics.frame_jitter);
+    _print_histogram(response, "holo_frame_read_us", "Time spent reading a frame from the flash.", metrics.frame_read);
+    _print_histogram(response, "holo_frame_decode_us", "Time spent decoding a frame into its slot.", metrics.frame_decode);
+
+    response->print("# HELP holo_task_load_percent Share of the time the task spent working, on the core it's pinned to.\n"
+      "# TYPE holo_task_load_percent gauge\n");
+    _print_task_load(response, json, "display", RENDERER_CORE, metrics.display_load);
+    _print_task_load(response, json, "loader", FRAME_LOADER_CORE, metrics.loader_load);
+    _print_task_load(response, json, "playlist", FRAME_LOADER_CORE, _library->get_load());
+    _print_task_load(response, json, "network", NETWORK_CORE, _network_load);
+  }
+
+  request->send(response);
+}
+
+// Prometheus wants the buckets to be cumulative.
+void WebServer::_print_histogram(AsyncResponseStream *response, const char* name, const char* help, const Rendering::Histogram& histogram)
+{
+  unsigned long count = 0;
+
+  response->printf("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+
+  for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; bucket++)
+  {
+    count += histogram.get_bucket(bucket);
+    response->printf("%s_bucket{le=\"%lu\"} %lu\n", name, (unsigned long)Rendering::Histogram::get_bound(bucket), count);
+  }
+
+  response->printf("%s_bucket{le=\"+Inf\"} %lu\n", name, (unsigned long)histogram.get_count());
+  response->printf("%s_sum %lu\n%s_count %lu\n", name, (unsigned long)histogram.get_sum(), name, (unsigned long)histogram.get_count());
+}
+
+void WebServer::_print_task_load(AsyncResponseStream *response, bool json, const char* task, uint8_t core, const Rendering::TaskLoad& load)
+{
+  float percent = load.get_load_permille() / 10.0;
+
+  if (json)
+    response->printf("\"%s\":{\"core\":%u,\"load\":%.1f}", task, core, percent);
+  else
+    response->printf("holo_task_load_percent{task=\"%s\",core=\"%u\"} %.1f\n", task, core, percent);
+}
+
+// The buckets aren't cumulative here, the last one is everything above the biggest bound.
+void WebServer::_print_histogram_json(AsyncResponseStream *response, const char* name, const Rendering::Histogram& histogram)
+{
+  response->printf("\"%s\":{\"count\":%lu,\"sum\":%lu,\"max\":%lu,\"buckets\":[", name,
+    (unsigned long)histogram.get_count(), (unsigned long)histogram.get_sum(), (unsigned long)histogram.get_max());
+
+  for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+    response->printf(bucket == 0 ? "%lu" : ",%lu", (unsigned long)histogram.get_bucket(bucket));
+
+  response->print("]}");
+}
+#endif
+
+// What's in the library and whether it fits into the frame memory next to the animation on display.
+void WebServer::_send_library(AsyncWebServerRequest *request)
+{
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  size_t free_bytes = _renderer->get_frame_memory_size() - _renderer->get_displayed_size();
+
+  response->printf("{\"frame_memory\":%lu,\"displayed\":%lu,\"current\":\"%s\",\"playing\":%s,\"position\":%u,",
+    (unsigned long)_renderer->get_frame_memory_size(), (unsigned long)_renderer->get_displayed_size(),
+    _renderer->get_animation_name(), _library->is_playing() ? "true" : "false", _library->get_playlist_position());
+  response->printf("\"switches\":%lu,\"instant_switches\":%lu,\"animations\":[",
+    (unsigned long)_library->get_switches(), (unsigned long)_library->get_instant_switches());
+
+  for (uint8_t index = 0; index < _library->get_entry_count(); index++)
+  {
+    const Rendering::LibraryEntry& entry = _library->get_entry(index);
+
+    response->printf("%s{\"name\":\"%s\",\"frames\":%u,\"file_size\":%lu,\"memory_size\":%lu,"
+      "\"resident\":%s,\"fits\":%s}",
+      index == 0 ? "" : ",", entry.name, entry.frame_count,
+      (unsigned long)entry.file_size, (unsigned long)entry.memory_size,
+      _renderer->is_resident(entry.name) ? "true" : "false",
+      entry.memory_size <= free_bytes ? "true" : "false");
+  }
+
+  response->print("],\"resident\":[");
+
+  for (uint8_t index = 0; index < _renderer->get_resident_count(); index++)
+  {
+    const Rendering::ResidentAnimation& animation = _renderer->get_resident(index);
+
+    response->printf("%s{\"name\":\"%s\",\"offset\":%lu,\"size\":%lu}",
+      index == 0 ? "" : ",", animation.name, (unsigned long)animation.offset,
+      (unsigned long)(animation.frame_count * animation.frame_size));
+  }
+
+  response->print("],\"playlist\":[");
+
+  for (uint8_t index = 0; index < _library->get_playlist_count(); index++)
+  {
+    const Rendering::PlaylistEntry& entry = _library->get_playlist_entry(index);
+
+    response->printf("%s{\"name\":\"%s\",\"duration_ms\":%lu}",
+      index == 0 ? "" : ",", entry.name, (unsigned long)entry.duration_ms);
+  }
+
+  response->print("]}");
+  request->send(response);
+}
+
+// Live frames replace the animation for as long as the client is connected.
+// Frames that don't fit are still passed on, so they get counted as dropped.
+void WebServer::_handle_live_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+{
+  switch (type)
+  {
+    case WS_EVT_CONNECT:
+      if (_live_client != 0)
+      {
+        ESP_LOGE(TAG, "Somebody else is already sending live frames!");
+        client->close();
+        break;
+      }
+
+      if (_live_message == NULL)
+        _live_message = (uint8_t*)ps_malloc(LIVE_MESSAGE_MAX_BYTES);
+
+      if (_live_message == NULL)
+      {
+        ESP_LOGE(TAG, "Couldn't allocate the live frame buffer!");
+        client->close();
+        break;
+      }
+
+      ESP_LOGI(TAG, "Live frames from IP: %s", client->remoteIP().toString().c_str());
+
+      // Uploads and live frames would overwrite each other, and the playlist both of them.
+      _library->stop();
+      _can_upload = false;
+      _live_client = client->id();
+      _live_message_size = 0;
+      _renderer->start_live();
+      break;
+
+    case WS_EVT_DISCONNECT:
+      if (client->id() != _live_client)
+        break;
+
+      _live_client = 0;
+      _can_upload = true;
+      _renderer->stop_live();
+      break;
+
+    case WS_EVT_DATA:
+    {
+      AwsFrameInfo *info = (AwsFrameInfo*)arg;
+
+      if (client->id() != _live_client)
+        break;
+
+      // A new message starts, whatever is left of the last one was broken.
+      if (info->num == 0 && info->index == 0)
+        _live_message_size = 0;
+
+      if (_live_message_size + len <= LIVE_MESSAGE_MAX_BYTES)
+        memcpy(_live_message + _live_message_size, data, len);
+
+      _live_message_size += len;
+
+      if (info->final && info->index + len == info->len)
+      {
+#ifdef RENDER_METRICS
+        int64_t start_us = esp_timer_get_time();
+#endif
+        _renderer->push_live_frame(_live_message, 
+          _live_message_size <= LIVE_MESSAGE_MAX_BYTES ? _live_message_size : 0);
+        _live_message_size = 0;
+#ifdef RENDER_METRICS
+        _network_load.record(esp_timer_get_time() - start_us);
+#endif
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+// Every chunk of an upload goes straight to the frame slots and the data file.
+void WebServer::_handle_upload(AsyncWebServerRequest *request, size_t index, uint8_t *data, size_t len, bool final)
 {
-  const char* name;
-  const char* value;
-  uint8_t index = 0;
-
-  try
-  {
-    // The name will be something like s5 -> Slider 5.
-    name = parameter->name().c_str();
-    value = parameter->value().c_str();
-    index = std::stoi(parameter->name()
-                                      .substring(1)
-                                      .c_str());
+  char path[LIBRARY_NAME_LENGTH + sizeof(LIBRARY_DIRECTORY) + 8];
+
+  // If a new upload has been started.
+  if (!index)                   
+  {
+    const AsyncWebParameter* name = request->getParam("name");
+
+    ESP_LOGI(TAG, "Upload started!");
+    ESP_LOGI(TAG, "DMO Mode: %s", _dmo_mode ? "enabled" : "disabled");
+
+    // Nothing gets saved in DMO mode, so there's nothing to add to the library either.
+    snprintf(_upload_name, sizeof(_upload_name), "%s", name != NULL && !_dmo_mode ? name->value().c_str() : "");
+    _upload_name_invalid = name != NULL && !_dmo_mode && !Rendering::AnimationLibrary::is_valid_name(name->value().c_str());
+
+    if (_upload_name_invalid)
+      return;
+
+    _library->stop();
+                     
+    // The loader mustn't read the data file while it gets overwritten.
+    _renderer->stop_streaming();
+    Rendering::Renderer::get_animation_path(_upload_name, path, sizeof(path));
+
+    if (!_dmo_mode)
+      request->_tempFile = LittleFS.open(path, "w", true);
+
+    _upload_decoder.begin(request->contentLength(), _upload_name);
   }
-  catch (...)
+
+  if (_upload_name_invalid)
+    return;
+
+  // The playlist mustn't load anything in between the chunks.
+  _library->hold();
+
+#ifdef RENDER_METRICS
+  int64_t start_us = esp_timer_get_time();
+#endif
+
+  _upload_decoder.write(data, len, final);
+
+  // Only care about writing anything to the file system if we aren't in DMU mode!
+  if (!_dmo_mode && request->_tempFile && !_upload_decoder.is_rejected())
+    request->_tempFile.write(data, len);
+
+#ifdef RENDER_METRICS
+  _network_load.record(esp_timer_get_time() - start_us);
+#endif
+
+  if (!final)
+    return;
+
+  _library->release();
+
+  ESP_LOGI(TAG, "Upload ended! %u frames, %s", _upload_decoder.get_frame_count(), _format_bytes(index + len).c_str());
+
+  if (_dmo_mode)
+    return;
+
+  // Only frames that made it into the file system can be converted again.
+  if (request->_tempFile && !_upload_decoder.is_rejected())
+    _renderer->set_frames_saved();
+
+  request->_tempFile.close();
+
+  // Don't leave anything behind that can't be loaded again.
+  Rendering::Renderer::get_animation_path(_upload_name, path, sizeof(path));
+
+  if (_upload_decoder.is_rejected())
+    LittleFS.remove(path);
+  else if (_upload_name[0] != '\0')
+    _library->add(_upload_name, _upload_decoder.get_frame_count(), index + len,
+      _upload_decoder.get_frame_count() * _renderer->get_frame_size());
+
+  size_t free_bytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+  ESP_LOGI(TAG, "LittleFS Free: %s", _format_bytes(free_bytes).c_str());
+  ESP_LOGI(TAG, "Free Heap: %d", ESP.getFreeHeap());
+
+  if (_upload_decoder.get_frame_count() > _renderer->get_frame_capacity())
+    _renderer->refresh_image();
+}
+
+// Prefer the speed the PLL measured at the HAL sensor over the one the motor controller reports.
+// Older motor controllers still post theirs.
+unsigned long WebServer::_get_measured_RPM()
+{
+  uint32_t rotation_period_us = _renderer->get_rotation_period_us();
+
+  if (_renderer->is_rotation_locked() && rotation_period_us > 0)
+    return 60000000UL / rotation_period_us;
+
+  if (_speed_link->is_connected())
+    return _speed_link->get_RPM();
+
+  return _current_RPM;
+}
+
+// Every UI gets the whole state once it connects, and then whenever it changes.
+// The records of a message are applied in order, just like a form with several inputs.
+void WebServer::_handle_control_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+{
+  switch (type)
   {
-    ESP_LOGE(TAG, "Failed to parse input!\n");
+    case WS_EVT_CONNECT:
+    {
+      ControlState state;
+
+      ESP_LOGI(TAG, "Control socket from IP: %s", client->remoteIP().toString().c_str());
+
+      // Closed connections only go away once they're cleaned up, which is safe here on async_tcp.
+      _control_socket.cleanupClients(CONTROL_MAX_CLIENTS);
+      _get_state(state);
+      client->binary((const uint8_t*)&state, sizeof(state));
+      break;
+    }
+
+    case WS_EVT_DATA:
+    {
+      AwsFrameInfo *info = (AwsFrameInfo*)arg;
+
+      // The messages of the UI are tiny, they always come in a single frame.
+      if (info->opcode != WS_BINARY || !info->final || info->index != 0 || info->len != len
+        || len % sizeof(ControlRecord) != 0)
+      {
+        ESP_LOGE(TAG, "Invalid control message!");
+        break;
+      }
+
+      Rendering::Options options = _renderer->get_options();
+
+      for (size_t offset = 0; offset < len; offset += sizeof(ControlRecord))
+      {
+        ControlRecord record;
+
+        memcpy(&record, data + offset, sizeof(record));
+        _apply_control(record.type, record.index, record.value, options);
+      }
+
+      _renderer->set_options(options);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+// Only sends anything if there's somebody to see it and it changed since last time.
+// async_tcp adds and removes clients in the meantime, so this only uses the calls of the 
+// socket that take its lock, and leaves cleaning up the clients to the event handler.
+void WebServer::_telemetry_loop(void *parameter)
+{
+  WebServer *server = (WebServer*)parameter;
+  ControlState state;
+
+  while (true)
+  {
+    vTaskDelay(pdMS_TO_TICKS(TELEMETRY_INTERVAL_MS));
+
+    if (server->_control_socket.count() == 0)
+      continue;
+
+    server->_get_state(state);
+
+    // A UI that can't keep up just gets the next state instead.
+    if (!memcmp(&state, &server->_sent_state, sizeof(state)) 
+      || !server->_control_socket.availableForWriteAll())
+      continue;
+
+    server->_control_socket.binaryAll((const uint8_t*)&state, sizeof(state));
+    server->_sent_state = state;
+  }
+}
+
+void WebServer::_get_state(ControlState& state)
+{
+  Rendering::Options options = _renderer->get_options();
+
+  state.flags = (_motor_enabled ? CONTROL_FLAG_MOTOR_ENABLED : 0)
+    | (_renderer_enabled ? CONTROL_FLAG_RENDERER_ENABLED : 0)
+    | (_dmo_mode ? CONTROL_FLAG_DMO_MODE : 0)
+    | (options.anti_aliasing ? CONTROL_FLAG_ANTI_ALIASING : 0)
+    | (_can_upload ? CONTROL_FLAG_CAN_UPLOAD : 0)
+    | (_renderer->is_rotation_locked() ? CONTROL_FLAG_PLL_LOCKED : 0)
+    | (_renderer->is_streaming() ? CONTROL_FLAG_STREAMING : 0)
+    | (_renderer->is_live() ? CONTROL_FLAG_LIVE : 0);
+  state.rpm = _get_measured_RPM();
+  state.angles_per_rotation = _renderer->get_angles_per_rotation();
+  state.frame_rate = (uint16_t)(_renderer->get_frame_rate() * 10.0 + 0.5);
+  state.spi_overruns = _renderer->get_spi_overruns();
+  state.stream_underruns = _renderer->get_stream_underruns();
+
+  state.motor_power = _motor_power;
+  state.brightness = _led_brightness;
+  state.red_color_adjust = options.red_color_adjust;
+  state.green_color_adjust = options.green_color_adjust;
+  state.blue_color_adjust = options.blue_color_adjust;
+  state.offset = options.offset;
+  state.gamma = (uint8_t)(options.gamma * 10.0 + 0.5);
+  state.angles_mode = options.angles_per_rotation;
+}
+
+// Form posts, the name will be something like s5 -> Slider 5.
+// They end up as the same controls the control socket sends.
+void WebServer::_handle_input(const AsyncWebParameter* parameter, Rendering::Options& options)
+{
+  const char* name = parameter->name().c_str();
+  const char* value = parameter->value().c_str();
+  char* end;
+  long index;
+  int32_t parsed;
+
+  if (name[0] == '\0')
+    return;
+
+  // Color-Input
+  if (name[0] == 'c')
+  {
+    ESP_LOGI(TAG, "Color: %s", value);
     return;
   }
-  
+
+  index = strtol(name + 1, &end, 10);
+
+  if (end == name + 1 || *end != '\0')
+  {
+    ESP_LOGE(TAG, "Failed to parse input!");
+    return;
+  }
+
+  // Levers send true or false, everything else a number.
+  if (!strcmp(value, "true"))
+    parsed = 1;
+  else if (!strcmp(value, "false"))
+    parsed = 0;
+  else
+  {
+    parsed = strtol(value, &end, 10);
+
+    if (end == value)
+    {
+      ESP_LOGE(TAG, "Failed to parse input!");
+      return;
+    }
+  }
+
+  _apply_control(name[0], index, parsed, options);
+}
+
+// This handles any input we get from the User-Interface.
+// Changed options only go into the given copy, the caller sets them all at once.
+void WebServer::_apply_control(char type, uint8_t index, int32_t value, Rendering::Options& options)
+{
   // Figure out what type of element sent the response.
-  switch (name[0])
+  switch (type)
   {
     // Slider
     case 's':
@@ -227,31 +851,37 @@ void WebServer::_handle_input(const AsyncWebParameter* parameter)
 
           float raw_power;
           
-          raw_power = (float)std::stoi(value);
+          raw_power = (float)value;
           raw_power = raw_power * (255.0 - 96.0) / 100.0 + 96.0;
 
+          _motor_power = value;
           _target_power = (uint16_t)raw_power;
+          _speed_link->set_target_power(_target_power);
           break;
         // LED Brightness Slider
         case 2:
-          _led_brightness = std::stoi(value);
+          _led_brightness = value;
           _renderer->set_brightness(_led_brightness);
           break;
         // Red-Color-Slider
         case 3:
-          _renderer->options.red_color_adjust = std::stoi(value);
+          options.red_color_adjust = value;
           break;
         // Green-Color-Slider
         case 4:
-          _renderer->options.green_color_adjust = std::stoi(value);
+          options.green_color_adjust = value;
           break;
         // Blue-Color-Slider
         case 5:
-          _renderer->options.blue_color_adjust = std::stoi(value);
+          options.blue_color_adjust = value;
           break;
         // Offset-slider 
         case 6:
-          _renderer->options.offset = std::stoi(value);
+          options.offset = value;
+          break;
+        // Gamma-Slider (in tenths)
+        case 7:
+          options.gamma = value / 10.0;
           break;
         default:
           break;
@@ -263,20 +893,18 @@ void WebServer::_handle_input(const AsyncWebParameter* parameter)
       unsigned long delay_per_pulse_us, delay_per_rotation_us;
       float frequency_hz;
 
-      delay_per_pulse_us = std::stoi(value);
+      delay_per_pulse_us = value;
 
       // ESP_LOGI(TAG, "delay_per_pulse_us %d", delay_per_pulse_us);
       
       // If the motor is standing still or the delay is impossibly small.
-      if (delay_per_pulse_us == LONG_MAX || delay_per_pulse_us < 1000)
+      if (value == INT32_MAX || value < 1000)
       {
-        taskENTER_CRITICAL(&Rendering::optionsMUX);
-        // Calculate the time between each degree in μs.
-        _renderer->options._delay_between_degrees_us = 5000; // We don't really care since the motor is stuck anyway.
+        // We don't really care about the period since the motor is stuck anyway.
+        options._rotation_period_us = IDLE_ROTATION_PERIOD_US;
 
         // Calculate the RPM.
         _current_RPM = 0;
-        taskEXIT_CRITICAL(&Rendering::optionsMUX);
       }
       else
       {
@@ -284,19 +912,27 @@ void WebServer::_handle_input(const AsyncWebParameter* parameter)
         delay_per_rotation_us = delay_per_pulse_us * 90;
         frequency_hz = 1000000.0 / (float)(delay_per_rotation_us); 
 
-        taskENTER_CRITICAL(&Rendering::optionsMUX);
-        // Calculate the time between each degree in μs.
-        // ESP_LOGI(TAG, "changing delay to %d", (unsigned long)(delay_per_pulse_us / 4));
-      
-        _renderer->options._delay_between_degrees_us 
-          = (unsigned long)((float)(delay_per_pulse_us) / (8.0 * MAGIC_VALUE_TM));
+        // Only used as long as the PLL isn't locked to the HAL sensor.
+        options._rotation_period_us = SpeedLink::get_rotation_period_us(delay_per_pulse_us);
 
         // Calculate the RPM.
         _current_RPM = (unsigned long)(frequency_hz * 60.0);
-        taskEXIT_CRITICAL(&Rendering::optionsMUX);
       }
       break;
 
+    // Resolution-Select
+    case 'r':
+      // 0 lets the renderer pick the resolution automatically.
+      if (value != 0 
+        && !Rendering::Renderer::is_supported_angles_per_rotation(value))
+      {
+        ESP_LOGE(TAG, "Unsupported resolution: %ld", (long)value);
+        break;
+      }
+
+      options.angles_per_rotation = value;
+      break;
+
      // Lever-Field
     case 'l':
       // Figure out what lever was used.
@@ -304,40 +940,34 @@ void WebServer::_handle_input(const AsyncWebParameter* parameter)
       {
         // Motor-Active-Lever
         case 1:
-          if (!strncmp(value, "true", 8))
+          if (value)
           {
             _motor_enabled = true;
           }
           else
           { 
             _motor_enabled = false;
+            _motor_power = 0;
             _target_power = 0;
+            _speed_link->set_target_power(_target_power);
           }
           break;
         // LED-Active-Lever
         case 2:
-          if (!strncmp(value, "true", 8))
-            _renderer->set_renderer_state(true);
-          else
-            _renderer->set_renderer_state(false);
+          _renderer_enabled = value;
+          _renderer->set_renderer_state(_renderer_enabled);
           break;
           
         // DMU-Mode-Lever
         case 3:
-          if (!strncmp(value, "true", 8))
-            _dmo_mode = true;
-          else
-            _dmo_mode = false;
+          _dmo_mode = value;
+          break;
+        // Anti-Aliasing-Lever
+        case 4:
+          _renderer->set_anti_aliasing(value);
           break;
       }
       break;
-
-    // Color-Input
-    case 'c':
-      std::string color_string = parameter->value().substring(2).c_str();
-
-      ESP_LOGI(TAG, "Color: %s", parameter->value().substring(2).c_str());
-      break;
   }
 }
 
@@ -352,6 +982,20 @@ void WebServer::begin()
   #endif
  
   _setup_webserver_tree();
+
+  // Next to the async_tcp task, which it hands the messages to anyway.
+  BaseType_t result = xTaskCreatePinnedToCore(
+    _telemetry_loop,
+    PSTR("Telemetry"),
+    4096,
+    this,
+    1,
+    &_telemetry_task,
+    NETWORK_CORE
+  );
+
+  if (result != pdPASS)
+    ESP_LOGE(TAG, "Couldn't allocate enough memory for the telemetry!");
 }
 
 } // Namespace Webserver 
\ No newline at end of file
@@ -24,20 +24,25 @@ void setup()
     vTaskDelay(pdMS_TO_TICKS(200));
   }
   
+  // Everything after the renderer only has to be there eventually, the image comes first.
   renderer.begin();
+  ESP_LOGI(TAG, "Renderer up %lld ms after boot", (long long)esp_timer_get_time() / 1000);
+
+  library.begin();
+
   wifimanager.begin();
+  ESP_LOGI(TAG, "WiFi up %lld ms after boot", (long long)esp_timer_get_time() / 1000);
+
+  speed_link.begin();
+
   server.begin();
+  ESP_LOGI(TAG, "Webserver up %lld ms after boot", (long long)esp_timer_get_time() / 1000);
 
-#ifndef OTA_FIRMWARE
-   // Delete the loop task from the scheduler, as we don't need it.
+  // Delete the loop task from the scheduler, as we don't need it.
+  // It runs on the renderer's core, the OTA loop has a task of its own on the network core.
   vTaskDelete(NULL);
-#endif
 }
 
 void loop()
 {
-#ifdef OTA_FIRMWARE
-  ElegantOTA.loop();
-  vTaskDelay(100);
-#endif
 }
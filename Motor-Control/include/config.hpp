@@ -11,9 +11,10 @@
 
 #pragma once
 
-#define SERVER_DNS_NAME "http://holo.local"
-#define SERVER_POST_SUFFIX "/post"
-#define SERVER_GET_SUFFIX "/TargetPower"
+// The speed goes to the display and the power comes back over UDP, see speed_protocol.hpp
+// of the display. Until the display answers, the speed gets broadcast.
+// How often the speed gets sent. (in ms)
+#define SPEED_LINK_INTERVAL_MS 20
 
 
 #define MOTOR_PWM_SEND_PIN 11
@@ -34,10 +35,6 @@
 #define LAST_PULSES_TO_AVERAGE 5 
 #endif
 
-// The timings for when to send the different updates.
-#define GET_RPM_DELAY 500
-#define SEND_RPM_DELAY 200
-
 #define DEFAULT_DELAY 500
 
 // Define the baudrate the serial interface will use.
@@ -20,8 +20,4 @@
 
 void calculate_new_delay(unsigned long *plast_pass);
 
-void get_target_power(void *pvParameters);
-
-void send_current_speed(void *pvParameters);
-
 void get_last_pass_delay(void *pvParameters);
@@ -13,11 +13,12 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <ESP32Servo.h> 
 #include <vector>
+#include "esp_timer.h"
 #include "credentials.hpp"
 #include "config.hpp"
+#include "speed_protocol.hpp"
 
 namespace Motor 
 {
@@ -27,19 +28,21 @@ void IRAM_ATTR _motor_pulse_ISR();
 class MotorController 
 {
 private:
-    HTTPClient _http_receive;
-    HTTPClient _http_send;
+    Wireless::SpeedSocket _socket;
+    Wireless::LinkState _link;
 
     uint16_t _target_power = 0;
+    // Written by the pulse ISR, only read with the mux taken.
+    portMUX_TYPE _pulse_mux = portMUX_INITIALIZER_UNLOCKED;
     unsigned long _current_delay_per_pulse_us = 0;
-    unsigned long _time_last_pulse_us = 0;
+    int64_t _time_last_pulse_us = 0;
     std::vector<unsigned long> _last_delays_us;
 
-    TaskHandle_t _get_target_power_task = NULL;
-    TaskHandle_t _send_current_speed_task = NULL;
+    TaskHandle_t _speed_link_task = NULL;
 
-    static void get_target_power(void *parameter);
-    static void send_current_speed(void *parameter);
+    static void speed_link(void *parameter);
+    void _send_current_speed();
+    void _handle_target_power(const Wireless::PowerMessage& message);
 
 #ifdef USE_AVERAGED_DELAY
     unsigned long _get_average_pulse();
@@ -14,62 +14,53 @@
 namespace Motor
 {
 
-void MotorController::get_target_power(void *parameter)
+void MotorController::_handle_target_power(const Wireless::PowerMessage& message)
 {
-  MotorController *motorcontroller = (MotorController*)parameter;
-  int http_code;
+  if (_target_power == message.target_power)
+    return;
 
-  while (true)
-  {
-    if (WiFi.status() != WL_CONNECTED)
-    {
-      Serial.println("Couldn't establish network connection!");
-      vTaskDelay(DEFAULT_DELAY / portTICK_PERIOD_MS);  
-      continue;
-    }
+  _target_power = message.target_power;
+  Serial.println("New target speed: " + String(_target_power));
 
-    if (!motorcontroller->_http_receive.begin(String(SERVER_DNS_NAME) + String(SERVER_GET_SUFFIX)))
-    {
-      Serial.println("Couldn't establish http connection for getting the motor value!");
-      vTaskDelay(DEFAULT_DELAY / portTICK_PERIOD_MS);  
-      continue;
-    }
+  ledcWrite(MOTOR_PWM_CHANNEL, _target_power);
+}
 
-    // Fetch desired motor power from ESP32 server
-    http_code = motorcontroller->_http_receive.GET();
+void MotorController::_send_current_speed()
+{
+  Wireless::SpeedMessage message;
+  unsigned long time_between_pulses_us;
+  int64_t time_last_pulse_us;
+  int64_t now_us;
 
-    if (http_code != HTTP_CODE_OK) 
-    {
-      Serial.println("Error fetching motor power");
-      motorcontroller->_http_receive.end();
-      vTaskDelay(DEFAULT_DELAY / portTICK_PERIOD_MS);  
-      continue;
-    }
+  portENTER_CRITICAL(&_pulse_mux);
+#ifdef USE_AVERAGED_DELAY
+  time_between_pulses_us = _get_average_pulse();
+#else
+  time_between_pulses_us = _current_delay_per_pulse_us;
+#endif
+  time_last_pulse_us = _time_last_pulse_us;
+  portEXIT_CRITICAL(&_pulse_mux);
 
-    String payload = motorcontroller->_http_receive.getString();
-    int target_power_temp = payload.toInt();
+  now_us = esp_timer_get_time();
 
-    if (motorcontroller->_target_power == target_power_temp)
-    {
-      motorcontroller->_http_receive.end();
-      vTaskDelay(GET_RPM_DELAY / portTICK_PERIOD_MS);  
-      continue;
-    }
+  // If we didn't get a pulse in the maximum allowed time then consider the motor stopped.
+  if (now_us - time_last_pulse_us > LAST_PULSE_MAX_DELAY_US)
+    time_between_pulses_us = 0;
 
-    motorcontroller->_target_power = target_power_temp;
-    Serial.println("New target speed: " + String(motorcontroller->_target_power));
-    
-    ledcWrite(MOTOR_PWM_CHANNEL, motorcontroller->_target_power);
-    motorcontroller->_http_receive.end();
+  _link.fill_header(message.header, SPEED_MESSAGE_SPEED, now_us);
+  message.pulse_period_us = time_between_pulses_us;
+  message.pulse_time_us = time_last_pulse_us;
+  message.power = _target_power;
 
-    vTaskDelay(GET_RPM_DELAY / portTICK_PERIOD_MS);  
-  }
+  _socket.send(&message, sizeof(message));
 }
 
-void MotorController::send_current_speed(void *parameter)
+// Sends the speed every SPEED_LINK_INTERVAL_MS, and waits for the power in between.
+void MotorController::speed_link(void *parameter)
 {
   MotorController *motorcontroller = (MotorController*)parameter;
-  int http_code;
+  int64_t next_send_us = esp_timer_get_time();
+  Wireless::PowerMessage message;
 
   while (true)
   {
@@ -79,40 +70,38 @@ void MotorController::send_current_speed(void *parameter)
       vTaskDelay(DEFAULT_DELAY / portTICK_PERIOD_MS);  
       continue;
     }
-    
-    if (!motorcontroller->_http_send.begin(String(SERVER_DNS_NAME) + String(SERVER_POST_SUFFIX)))
+
+    // The network stack is only up once the WiFi connected.
+    if (!motorcontroller->_socket.is_open() && !motorcontroller->_socket.open(0))
     {
-      Serial.println("Couldn't establish http connection for sending the motor value!");
+      Serial.println("Couldn't open the speed link!");
       vTaskDelay(DEFAULT_DELAY / portTICK_PERIOD_MS);  
       continue;
     }
 
-    motorcontroller->_http_send.addHeader("Content-Type", "application/x-www-form-urlencoded");
-    unsigned long time_between_pulses_us;
+    int64_t now_us = esp_timer_get_time();
+    size_t length = motorcontroller->_socket.receive(&message, sizeof(message),
+      next_send_us > now_us ? next_send_us - now_us : 0);
+    int64_t receive_us = esp_timer_get_time();
 
-    // If we didn't get a pulse in the maximum allowed time then consider the motor stopped.
-    if ((micros() - motorcontroller->_time_last_pulse_us) > LAST_PULSE_MAX_DELAY_US)
-      time_between_pulses_us = 0;
-    else
-#ifdef USE_AVERAGED_DELAY
-      time_between_pulses_us = motorcontroller->_get_average_pulse();
-#else
-      time_between_pulses_us = motorcontroller->_time_last_pulse_us;
-#endif
+    if (length == sizeof(message) && motorcontroller->_link.accept(message.header, SPEED_MESSAGE_POWER, receive_us))
+    {
+      motorcontroller->_socket.answer_sender();
+      motorcontroller->_handle_target_power(message);
+    }
 
-    
-    String post_data = "m1=" + String(time_between_pulses_us);
-    http_code = motorcontroller->_http_send.POST(post_data);
-    Serial.println(post_data);
-    
-    if (http_code != HTTP_CODE_OK)
-      Serial.println("Couldn't post the current motor speed!");
+    // Until the display answers, or once it stopped, everybody gets the speed.
+    if (motorcontroller->_link.is_timed_out(receive_us))
+      motorcontroller->_socket.set_peer(htonl(INADDR_BROADCAST), SPEED_LINK_PORT);
 
-    motorcontroller->_http_send.end();
-    
-    vTaskDelay(SEND_RPM_DELAY / portTICK_PERIOD_MS);  
-  }
+    if (receive_us < next_send_us)
+      continue;
+
+    motorcontroller->_send_current_speed();
 
+    // Never tries to catch up, it's only ever the latest speed that matters.
+    next_send_us = max(next_send_us + SPEED_LINK_INTERVAL_MS * 1000, receive_us);
+  }
 }
 
 #ifdef USE_AVERAGED_DELAY
@@ -149,32 +138,23 @@ void MotorController::init()
 
   ledcWrite(MOTOR_PWM_CHANNEL, 0);
 
-  // Task for receiving the target power.
-  xTaskCreate(
-    get_target_power,
-    "Get Motor Power", 
-    4096,
-    this,
-    1,
-    &_get_target_power_task
-  );
-
-  // Task for sending the current speed.
+  // Task for sending the current speed and receiving the target power.
   xTaskCreate(
-    send_current_speed,
-    "Send Motor Speed",
+    speed_link,
+    "Speed Link",
     4096,
     this,
-    1,
-    &_send_current_speed_task
+    2,
+    &_speed_link_task
   );
 }
 
 void MotorController::handle_pulse()
 {
+  portENTER_CRITICAL_ISR(&_pulse_mux);
 #ifdef USE_AVERAGED_DELAY
   unsigned long current_delay_per_pulse_us = 0; 
-  unsigned long current_time = micros();
+  int64_t current_time = esp_timer_get_time();
   
   this->_current_delay_per_pulse_us = current_time - this->_time_last_pulse_us;
   
@@ -185,10 +165,11 @@ void MotorController::handle_pulse()
   
   this->_time_last_pulse_us = current_time;
 #else
-unsigned long current_time = micros();
+int64_t current_time = esp_timer_get_time();
 this->_current_delay_per_pulse_us = current_time - this->_time_last_pulse_us;
 this->_time_last_pulse_us = current_time;
 #endif
+  portEXIT_CRITICAL_ISR(&_pulse_mux);
 }
 
 }
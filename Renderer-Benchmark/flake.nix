@@ -0,0 +1,37 @@
+{
+  description = "Flake for building the host benchmarks of the holographic display renderer.";
+
+  inputs.nixpkgs.url = "github:NixOS/nixpkgs/nixos-unstable";
+
+  outputs = { self, nixpkgs }:
+    let
+      pkgs = import nixpkgs { system = "x86_64-linux"; };
+    in
+    {
+      packages.x86_64-linux.default = pkgs.stdenv.mkDerivation {
+        pname = "renderer-benchmark";
+        version = "0.1.0";
+
+        # The renderer is built straight from the firmware, against the stand-ins of the simulator.
+        src = ./..;
+
+        buildInputs = [ 
+          pkgs.gcc
+        ];
+
+        # Define build steps
+        buildPhase = ''
+          g++ -O2 -std=gnu++17 -pthread -DRENDER_BENCHMARK \
+            -I Holographic-Display/simulator/stubs -I Holographic-Display/simulator -I Holographic-Display/include \
+            -o renderer-benchmark Renderer-Benchmark/src/main.cpp \
+            Holographic-Display/src/Rendering/*.cpp Holographic-Display/simulator/virtual_hardware.cpp
+        '';
+
+        # Define install steps
+        installPhase = ''
+          mkdir -p $out/bin
+          cp renderer-benchmark $out/bin/
+        '';
+      };
+    };
+}
@@ -0,0 +1,500 @@
+/*
+ * @file main.cpp
+ * @authors mia
+ * @brief Host benchmark of the slice kernel of the renderer, built from the firmware sources.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// The renderer runs against the stand-ins of the simulator, just like there.
+#include <LittleFS.h>
+#include "config.hpp"
+#include "Rendering/rendering.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+
+
+//  - - - - - - - - - - Constants - - - - - - - - - -
+
+const int FRAMES = 8;
+// Every kernel gets timed this many times, the runs are reported as min and median.
+const int RUNS = 15;
+const int ROTATIONS_PER_RUN = 200;
+
+//  - - - - - - - - - - Types - - - - - - - - - -
+
+struct Coordinates
+{
+  uint8_t x;
+  uint8_t y;
+};
+
+struct Configuration
+{
+  const char* name;
+  Rendering::FrameFormat format;
+  Rendering::FrameLayout layout;
+  bool anti_aliasing;
+  bool vector_kernel;
+};
+
+struct Measurement
+{
+  double min;
+  double median;
+};
+
+// The slice kernel of the renderer before the pixel offset table, copied as it was.
+// It read whole images through the conversion matrix and adjusted every channel on its own.
+class BaselineRenderer
+{
+public:
+    RGB* _image_data = NULL;
+    uint8_t* _led_buffer = NULL;
+    uint8_t _current_brightness = 1;
+    uint8_t _current_frame = 0;
+    uint16_t _current_degrees = 0;
+    Rendering::Options options;
+
+    void _update_led_colors();
+    void _change_led(uint8_t index, RGB color);
+    uint8_t _add_colors(uint8_t color, int16_t addition);
+};
+
+//  - - - - - - - - - - Globals - - - - - - - - - -
+
+Rendering::Renderer renderer;
+BaselineRenderer baseline;
+Coordinates conversion_matrix[ANGLES_PER_ROTATION][LEDS_PER_SIDE];
+volatile uint64_t benchmark_sink;
+
+//  - - - - - - - - - - Function Declarations - - - - - - - - - -
+
+void create_conversion_matrix(int center_x, int center_y);
+vector<uint8_t> create_rgb_records(mt19937& generator);
+vector<uint8_t> create_indexed_upload(mt19937& generator, uint16_t frame_count);
+template <typename Render>
+Measurement measure_kernel(Render render, uint8_t* led_buffer);
+uint64_t read_cycles();
+
+//  - - - - - - - - - - Slice Benchmark - - - - - - - - - -
+
+namespace Rendering
+{
+
+// Loads frames into the renderer and runs its slice kernel directly,
+// without the timer and the SPI bus around it.
+class SliceBenchmark
+{
+public:
+    static bool load(const Configuration& configuration, const vector<uint8_t>& rgb_records, const vector<uint8_t>& indexed_upload);
+    static void render_slice(uint16_t frame, uint16_t slice, uint8_t* led_buffer);
+    static bool compare_anti_aliasing_kernels(const uint8_t* frame);
+    static bool compare_anti_aliasing_kernels();
+    static uint16_t get_cartesian_frame_count(FrameFormat format);
+};
+
+// Uploads the first FRAMES frames the way the webserver does and shows them.
+// Cartesian frames are forced with an animation longer than fits into memory as polar frames.
+bool SliceBenchmark::load(const Configuration& configuration, const vector<uint8_t>& rgb_records, const vector<uint8_t>& indexed_upload)
+{
+  // Swap in an empty animation first, like the render task would with the next rotation.
+  // Otherwise the frames of the last configuration stay in the way of the new ones, 
+  // and anti-aliasing can't be toggled, since they never got saved.
+  renderer.prepare_frames(NULL, 0, 0);
+  renderer._publish_frame_set();
+  renderer._take_frame_set();
+  renderer.set_anti_aliasing(configuration.anti_aliasing);
+
+  if (renderer.get_options().anti_aliasing != configuration.anti_aliasing)
+  {
+    cerr << configuration.name << ": anti-aliasing couldn't be toggled!\n";
+    return false;
+  }
+
+  uint16_t frame_count = configuration.layout == FrameLayout::CARTESIAN ? get_cartesian_frame_count(configuration.format) : FRAMES;
+  size_t record_size;
+  const uint8_t* records;
+
+  if (configuration.format == FrameFormat::RGB)
+  {
+    record_size = renderer.prepare_frames(NULL, 0, (size_t)frame_count * FRAME_RECORD_SIZE_BYTES);
+    records = rgb_records.data();
+  }
+  else
+  {
+    vector<uint8_t> header(indexed_upload.begin(), indexed_upload.begin() + INDEXED_HEADER_SIZE_BYTES + PALETTE_SIZE_BYTES);
+    ((IndexedHeader*)header.data())->frame_count = frame_count;
+
+    record_size = renderer.prepare_frames(header.data(), header.size(), 0);
+    records = indexed_upload.data() + header.size();
+  }
+
+  if (record_size == 0 || renderer._loading_frames->layout != configuration.layout)
+  {
+    cerr << configuration.name << ": the frames didn't get the expected layout!\n";
+    return false;
+  }
+
+  for (uint16_t frame = 0; frame < FRAMES; frame++)
+    renderer.update_frame(frame, records + frame * record_size);
+
+  renderer._publish_frame_set();
+  renderer._take_frame_set();
+  renderer._render_options = renderer._options.read();
+  renderer._angles_per_rotation = ANGLES_PER_ROTATION;
+  renderer._use_vector_kernel = configuration.vector_kernel;
+
+  return true;
+}
+
+// Just one frame more than fit as polar frames, the memory doesn't have to be filled up.
+uint16_t SliceBenchmark::get_cartesian_frame_count(FrameFormat format)
+{
+  size_t polar_frame_size = format == FrameFormat::RGB ? POLAR_FRAME_SIZE_BYTES : PALETTE_SIZE_BYTES + POLAR_FRAME_SIZE_PIXELS;
+
+  return renderer._image_data_size / polar_frame_size + 1;
+}
+
+// Renders the given slice of the given frame into the buffer.
+void SliceBenchmark::render_slice(uint16_t frame, uint16_t slice, uint8_t* led_buffer)
+{
+  renderer._led_buffer = led_buffer;
+  renderer._current_frame = frame;
+  renderer._current_slice = slice;
+  renderer._update_led_colors();
+}
+
+// Samples every row of the RGB frame with the scalar and the vector kernel
+// and compares the raw accumulators, not just the final colors.
+// On the host the vector kernel is the generic one, the PIE one only gets
+// checked on the chip, by Renderer::_check_vector_kernel() at startup.
+bool SliceBenchmark::compare_anti_aliasing_kernels(const uint8_t* frame)
+{
+  static AntiAliasingScratch scalar_scratch, vector_scratch;
+  const AntiAliasingRow* table = renderer._anti_aliasing_table.load();
+  bool use_vector_kernel = renderer._use_vector_kernel;
+  bool matching = true;
+
+  for (uint16_t row = 0; row < SLICES_PER_HALF_ROTATION && matching; row++)
+  {
+    renderer._use_vector_kernel = false;
+    renderer._sample_anti_aliased(frame, NULL, table + row, &scalar_scratch);
+    renderer._use_vector_kernel = true;
+    renderer._sample_anti_aliased(frame, NULL, table + row, &vector_scratch);
+
+    matching = memcmp(scalar_scratch.accumulators, vector_scratch.accumulators, sizeof(scalar_scratch.accumulators)) == 0;
+
+    if (!matching)
+      cerr << "Mismatch at row " << row << "\n";
+  }
+
+  renderer._use_vector_kernel = use_vector_kernel;
+
+  return matching;
+}
+
+// Goes through the frames that are shown, and a completely white one,
+// which pushes the accumulators as high as they can go.
+bool SliceBenchmark::compare_anti_aliasing_kernels()
+{
+  const FrameSet* frames = renderer._frames;
+
+  for (uint16_t frame = 0; frame < FRAMES; frame++)
+    if (!compare_anti_aliasing_kernels(frames->frames + frame * frames->frame_size))
+      return false;
+
+  vector<uint8_t> white_frame(renderer._sparse_pixel_count * sizeof(RGB), 255);
+
+  return compare_anti_aliasing_kernels(white_frame.data());
+}
+
+}
+
+using Rendering::SliceBenchmark;
+using Rendering::FrameFormat;
+using Rendering::FrameLayout;
+
+//  - - - - - - - - - - Function Definitons - - - - - - - - - -
+
+int main()
+{
+  // Nothing from the data directory gets shown in between.
+  LittleFS.map_file(IMAGE_DATA_NAME, "");
+  renderer.begin();
+
+  create_conversion_matrix(LEDS_PER_SIDE, LEDS_PER_SIDE);
+
+  // Fill a few frames with noise, so nothing can be folded away by the compiler.
+  mt19937 generator(1234);
+  vector<uint8_t> rgb_records = create_rgb_records(generator);
+  vector<uint8_t> indexed_upload = create_indexed_upload(generator, FRAMES);
+
+  // The baseline kept all of the frames as whole images.
+  vector<RGB> baseline_images(FRAMES * IMAGE_SIZE_PIXELS);
+
+  for (uint16_t frame = 0; frame < FRAMES; frame++)
+    memcpy(baseline_images.data() + frame * IMAGE_SIZE_PIXELS, rgb_records.data() + frame * FRAME_RECORD_SIZE_BYTES + 2, IMAGE_SIZE_BYTES);
+
+  baseline._image_data = baseline_images.data();
+
+  auto render_baseline = [](uint16_t frame, uint16_t slice, uint8_t* buffer)
+  {
+    baseline._led_buffer = buffer;
+    baseline._current_frame = frame;
+    baseline._current_degrees = slice;
+    baseline._update_led_colors();
+  };
+
+  uint8_t led_buffer[SLICE_BUFFER_SIZE_BYTES];
+  uint8_t reference_buffer[SLICE_BUFFER_SIZE_BYTES];
+  memset(led_buffer, 0, SLICE_BUFFER_SIZE_BYTES);
+  memset(reference_buffer, 0, SLICE_BUFFER_SIZE_BYTES);
+
+  Configuration configurations[] = {
+    { "RGB cartesian", FrameFormat::RGB, FrameLayout::CARTESIAN, false, true },
+    { "RGB polar", FrameFormat::RGB, FrameLayout::POLAR, false, true },
+    { "indexed cartesian", FrameFormat::INDEXED, FrameLayout::CARTESIAN, false, true },
+    { "indexed polar", FrameFormat::INDEXED, FrameLayout::POLAR, false, true },
+    { "anti-aliased (scalar)", FrameFormat::RGB, FrameLayout::CARTESIAN, true, false },
+    { "anti-aliased (vector)", FrameFormat::RGB, FrameLayout::CARTESIAN, true, true },
+    { "anti-aliased indexed", FrameFormat::INDEXED, FrameLayout::CARTESIAN, true, true },
+  };
+
+#if defined(__x86_64__) || defined(__i386__)
+  const char* unit = "cycles";
+#else
+  const char* unit = "ns";
+#endif
+
+  cout << "Slices per run: " << ANGLES_PER_ROTATION * ROTATIONS_PER_RUN << ", " << RUNS << " runs\n";
+
+  auto print = [unit](const char* name, Measurement measurement)
+  {
+    cout << setw(22) << left << name << ": " << fixed << setprecision(1)
+      << "min " << setw(7) << right << measurement.min << ", median " << setw(7) << measurement.median
+      << " " << unit << "/slice\n";
+  };
+
+  print("baseline", measure_kernel(render_baseline, led_buffer));
+
+  for (const Configuration& configuration : configurations)
+  {
+    if (!SliceBenchmark::load(configuration, rgb_records, indexed_upload))
+    {
+      fflush(stdout);
+      _Exit(1);
+    }
+
+    // Without anti-aliasing, RGB frames show exactly what the baseline did.
+    if (configuration.format == FrameFormat::RGB && !configuration.anti_aliasing)
+    {
+      for (uint16_t frame = 0; frame < FRAMES; frame++)
+      {
+        for (uint16_t slice = 0; slice < ANGLES_PER_ROTATION; slice++)
+        {
+          SliceBenchmark::render_slice(frame, slice, led_buffer);
+          render_baseline(frame, slice, reference_buffer);
+
+          if (memcmp(led_buffer + 4, reference_buffer + 4, LEDS_PER_SLICE * 4) != 0)
+          {
+            cerr << configuration.name << " doesn't match the baseline at frame " << frame
+              << ", slice " << slice << "!\n";
+            fflush(stdout);
+            _Exit(1);
+          }
+        }
+      }
+    }
+
+    if (configuration.anti_aliasing && configuration.format == FrameFormat::RGB && !configuration.vector_kernel)
+    {
+      if (!SliceBenchmark::compare_anti_aliasing_kernels())
+      {
+        cerr << "The vector kernel doesn't match the scalar one!\n";
+        fflush(stdout);
+        _Exit(1);
+      }
+
+      cout << "Scalar and generic vector anti-aliasing kernels are bit-identical on the host.\n";
+    }
+
+    print(configuration.name, measure_kernel(SliceBenchmark::render_slice, led_buffer));
+  }
+
+  fflush(stdout);
+
+  // The tasks of the renderer never return.
+  _Exit(0);
+}
+
+// Same as the Conversionmatrix-Generator, so the baseline reads the same pixels as the display.
+void create_conversion_matrix(int center_x, int center_y)
+{
+  for (int angle = 0; angle < ANGLES_PER_ROTATION; angle++)
+  {
+    double theta = angle * M_PI / 180.0;
+
+    for (int led_index = 0; led_index < LEDS_PER_SIDE; led_index++)
+    {
+      conversion_matrix[angle][led_index].x = static_cast<uint8_t>(round(center_x + led_index * cos(theta)));
+      conversion_matrix[angle][led_index].y = static_cast<uint8_t>(round(center_y + led_index * sin(theta)));
+    }
+  }
+}
+
+void BaselineRenderer::_change_led(uint8_t index, RGB color)
+{
+  uint16_t offset = 4 + (index * 4);
+  
+  _led_buffer[offset] = 0xE0 | _current_brightness;
+  _led_buffer[offset + 1] = color.b;
+  _led_buffer[offset + 2] = color.g;
+  _led_buffer[offset + 3] = color.r;
+}
+
+void BaselineRenderer::_update_led_colors()
+{
+  uint32_t index;
+  RGB color;
+  
+  uint16_t offset_degrees = (_current_degrees + options.offset) % 360;
+
+  // Go through all the LEDs and change their current color value.  
+  for (uint8_t led_index = 0; led_index < LEDS_PER_SIDE; led_index++)
+  {
+    // Get the cartesian coordinates the LED should be showing inside of the image at that time.
+    auto coordinates = conversion_matrix[offset_degrees][LEDS_PER_SIDE - led_index - 1];
+    
+    index = _current_frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS + coordinates.y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - coordinates.x);
+
+    // Get the color value from the image at those coordinates.
+    color = _image_data[index];
+
+    color.r = _add_colors(color.r, options.red_color_adjust);
+    color.g = _add_colors(color.g, options.green_color_adjust);
+    color.b = _add_colors(color.b, options.blue_color_adjust);
+
+    _change_led(led_index, color);
+  }
+  
+  uint16_t opposite_degrees = (offset_degrees + 180) % 360;
+  
+  // Go through all the LEDs and change their current color value.  
+  for (uint8_t led_index = LEDS_PER_SIDE; led_index < LEDS_PER_SIDE * 2; led_index++)
+  {
+    // Get the cartesian coordinates the LED should be showing inside of the image at that time.
+    auto coordinates = conversion_matrix[opposite_degrees][led_index - LEDS_PER_SIDE];
+
+    index = _current_frame * IMAGE_LENGTH_PIXELS * IMAGE_LENGTH_PIXELS + coordinates.y * IMAGE_LENGTH_PIXELS + (IMAGE_LENGTH_PIXELS - coordinates.x);
+
+    // Get the color value from the image at those coordinates.
+    color = _image_data[index];
+
+    color.r = _add_colors(color.r, options.red_color_adjust);
+    color.g = _add_colors(color.g, options.green_color_adjust);
+    color.b = _add_colors(color.b, options.blue_color_adjust);
+
+    _change_led(led_index, color);
+  }
+}
+
+uint8_t BaselineRenderer::_add_colors(uint8_t color, int16_t addition)
+{
+  int16_t temp_color = (int16_t)color;
+  int16_t clamped_color = clamp((temp_color + addition), 0, 255);
+
+  return (uint8_t)clamped_color;
+}
+
+// Records like in the data file, the delay followed by the image.
+vector<uint8_t> create_rgb_records(mt19937& generator)
+{
+  vector<uint8_t> records(FRAMES * FRAME_RECORD_SIZE_BYTES);
+
+  for (uint8_t& byte : records)
+    byte = generator();
+
+  return records;
+}
+
+// An indexed upload with a shared palette, like the Image-Converter writes it.
+vector<uint8_t> create_indexed_upload(mt19937& generator, uint16_t frame_count)
+{
+  size_t header_size = INDEXED_HEADER_SIZE_BYTES + PALETTE_SIZE_BYTES;
+  vector<uint8_t> upload(header_size + frame_count * (2 + INDEXED_IMAGE_SIZE_BYTES));
+  Rendering::IndexedHeader* header = (Rendering::IndexedHeader*)upload.data();
+
+  for (size_t index = INDEXED_HEADER_SIZE_BYTES; index < upload.size(); index++)
+    upload[index] = generator();
+
+  memcpy(header->magic, INDEXED_MAGIC, 4);
+  header->version = INDEXED_VERSION;
+  header->flags = INDEXED_GLOBAL_PALETTE;
+  header->frame_count = frame_count;
+
+  return upload;
+}
+
+// Times RUNS runs of rendering every slice of a few rotations.
+template <typename Render>
+Measurement measure_kernel(Render render, uint8_t* led_buffer)
+{
+  vector<double> runs;
+  uint64_t checksum = 0;
+
+  for (int run = 0; run < RUNS; run++)
+  {
+    uint64_t start = read_cycles();
+
+    for (uint32_t rotation = 0; rotation < ROTATIONS_PER_RUN; rotation++)
+    {
+      uint16_t frame = rotation % FRAMES;
+
+      for (uint16_t slice = 0; slice < ANGLES_PER_ROTATION; slice++)
+      {
+        render(frame, slice, led_buffer);
+        checksum += led_buffer[4 + (slice % LEDS_PER_SLICE) * 4 + 1];
+      }
+    }
+
+    uint64_t end = read_cycles();
+
+    runs.push_back((double)(end - start) / (double)(ANGLES_PER_ROTATION * ROTATIONS_PER_RUN));
+  }
+
+  // Keep the results alive.
+  benchmark_sink = checksum;
+
+  sort(runs.begin(), runs.end());
+
+  return { runs.front(), runs[runs.size() / 2] };
+}
+
+// Uses the time stamp counter where there is one, nanoseconds otherwise.
+uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return chrono::duration_cast<chrono::nanoseconds>(
+    chrono::steady_clock::now().time_since_epoch()
+  ).count();
+#endif
+}
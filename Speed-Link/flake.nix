@@ -0,0 +1,36 @@
+{
+  description = "Flake for building the host tool running either end of the speed link.";
+
+  inputs.nixpkgs.url = "github:NixOS/nixpkgs/nixos-unstable";
+
+  outputs = { self, nixpkgs }:
+    let
+      pkgs = import nixpkgs { system = "x86_64-linux"; };
+    in
+    {
+      packages.x86_64-linux.default = pkgs.stdenv.mkDerivation {
+        pname = "speed-link";
+        version = "0.1.0";
+
+        # The protocol is included straight from the firmware.
+        src = ./..;
+
+        buildInputs = [ 
+          pkgs.gcc
+        ];
+
+        # Define build steps
+        buildPhase = ''
+          g++ -O2 -std=gnu++17 -I Holographic-Display/include/Wireless \
+            -I Holographic-Display/include/Rendering \
+            -o speed-link Speed-Link/src/main.cpp
+        '';
+
+        # Define install steps
+        installPhase = ''
+          mkdir -p $out/bin
+          cp speed-link $out/bin/
+        '';
+      };
+    };
+}
@@ -0,0 +1,374 @@
+/*
+ * @file main.cpp
+ * @authors mia
+ * @brief Runs either end of the speed link on the host, over real UDP.
+ * @version 0.1.0
+ * @date 2026-10-17
+ *
+ * Start the display end, then the motor controller end in another terminal:
+ *   speed-link display --seconds 10
+ *   speed-link motor --rpm 300:900 --clock-offset 123456 --loss 5 --seconds 10
+ *
+ * Copyright Deimo Elektronik GmbH (c) 2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// The protocol and the extrapolation come straight from the firmware.
+#include "speed_protocol.hpp"
+#include "period_tracker.hpp"
+
+using namespace Wireless;
+
+
+//  - - - - - - - - - - Constants - - - - - - - - - -
+
+// The same as SpeedLink::get_rotation_period_us(), pulses to whole rotations.
+const double ROTATION_PER_PULSE = 360.0 / (8.0 * 0.75);
+
+//  - - - - - - - - - - Options - - - - - - - - - -
+
+struct LinkOptions
+{
+    bool motor = false;
+    std::string display = "127.0.0.1";
+    uint16_t port = SPEED_LINK_PORT;
+    double seconds = 10;
+    // Both ends send this often.
+    double rate_hz = 50;
+    // The motor ramps from the start to the end speed and back, over the ramp time.
+    double start_rpm = 600;
+    double end_rpm = 600;
+    double ramp_seconds = 4;
+    // Random jitter on every pulse of the motor.
+    double jitter_us = 0;
+    // Added to the clock of the motor end, which the display end has to find.
+    int64_t clock_offset_us = 0;
+    // Share of the messages that don't get sent, on either end. (in %)
+    double loss_percent = 0;
+    uint8_t power = 128;
+    uint32_t seed = 1;
+};
+
+// Over one report interval.
+struct LinkStatistics
+{
+    uint32_t received = 0;
+    // How far the period was off at the time of a new pulse, held or extrapolated.
+    double held_error_us = 0;
+    double extrapolated_error_us = 0;
+    uint32_t predictions = 0;
+};
+
+//  - - - - - - - - - - Function Declarations - - - - - - - - - -
+
+void print_usage(const char* program);
+bool parse_options(int argc, char** argv, LinkOptions& options);
+int64_t get_time_us();
+double get_motor_rpm(const LinkOptions& options, double seconds);
+bool should_send(const LinkOptions& options, std::mt19937& generator);
+int run_display(const LinkOptions& options);
+int run_motor(const LinkOptions& options);
+
+//  - - - - - - - - - - Function Definitons - - - - - - - - - -
+
+int main(int argc, char** argv)
+{
+  LinkOptions options;
+
+  if (!parse_options(argc, argv, options))
+  {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  return options.motor ? run_motor(options) : run_display(options);
+}
+
+void print_usage(const char* program)
+{
+  fprintf(stderr,
+    "Usage: %s display|motor [options]\n"
+    "  --display ADDRESS      Where the motor end sends to. (127.0.0.1)\n"
+    "  --port N               The port of the display end. (%d)\n"
+    "  --seconds S            How long to run. (10)\n"
+    "  --rate HZ              How often both ends send. (50)\n"
+    "  --rpm START[:END]      Speed of the motor, ramping from START to END and back. (600)\n"
+    "  --ramp S               Time for a ramp one way. (4)\n"
+    "  --jitter US            Random jitter on every pulse. (0)\n"
+    "  --clock-offset US      Added to the clock of the motor end. (0)\n"
+    "  --loss PERCENT         Share of the messages that are dropped before sending. (0)\n"
+    "  --power N              Target power the display end sends. (128)\n"
+    "  --seed N               Seed for the jitter and the loss. (1)\n",
+    program, SPEED_LINK_PORT
+  );
+}
+
+bool parse_options(int argc, char** argv, LinkOptions& options)
+{
+  if (argc < 2)
+    return false;
+
+  if (!strcmp(argv[1], "motor"))
+    options.motor = true;
+  else if (strcmp(argv[1], "display"))
+    return false;
+
+  for (int index = 2; index < argc; index++)
+  {
+    std::string name = argv[index];
+
+    if (index + 1 >= argc)
+      return false;
+
+    const char* value = argv[++index];
+
+    if (name == "--display")
+      options.display = value;
+    else if (name == "--port")
+      options.port = atoi(value);
+    else if (name == "--seconds")
+      options.seconds = atof(value);
+    else if (name == "--rate")
+      options.rate_hz = atof(value);
+    else if (name == "--rpm")
+    {
+      const char* separator = strchr(value, ':');
+
+      options.start_rpm = atof(value);
+      options.end_rpm = separator != NULL ? atof(separator + 1) : options.start_rpm;
+    }
+    else if (name == "--ramp")
+      options.ramp_seconds = atof(value);
+    else if (name == "--jitter")
+      options.jitter_us = atof(value);
+    else if (name == "--clock-offset")
+      options.clock_offset_us = atoll(value);
+    else if (name == "--loss")
+      options.loss_percent = atof(value);
+    else if (name == "--power")
+      options.power = atoi(value);
+    else if (name == "--seed")
+      options.seed = atoi(value);
+    else
+      return false;
+  }
+
+  return options.rate_hz > 0 && options.ramp_seconds > 0;
+}
+
+// Never 0, that's what the echo uses for nothing received yet.
+int64_t get_time_us()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count() + 1;
+}
+
+// Back and forth between the two speeds, so there's always something to extrapolate.
+double get_motor_rpm(const LinkOptions& options, double seconds)
+{
+  double position = fmod(seconds / options.ramp_seconds, 2.0);
+
+  if (position > 1.0)
+    position = 2.0 - position;
+
+  return options.start_rpm + (options.end_rpm - options.start_rpm) * position;
+}
+
+bool should_send(const LinkOptions& options, std::mt19937& generator)
+{
+  return std::uniform_real_distribution<double>(0, 100)(generator) >= options.loss_percent;
+}
+
+// The same as the link task of the display: answers whoever sent the speed, and
+// extrapolates the period with the pulse times moved into the local clock.
+int run_display(const LinkOptions& options)
+{
+  SpeedSocket socket;
+  LinkState link;
+  Rendering::PeriodTracker motor_speed;
+  LinkStatistics statistics;
+  std::mt19937 generator(options.seed);
+  int64_t interval_us = (int64_t)(1e6 / options.rate_hz);
+  int64_t start_us = get_time_us();
+  int64_t next_send_us = start_us;
+  int64_t next_report_us = start_us + 1000000;
+  // The link counts from the start, the reports are per interval.
+  uint32_t reported_lost = 0;
+  uint32_t reported_stale = 0;
+  SpeedMessage message;
+
+  if (!socket.open(options.port))
+  {
+    fprintf(stderr, "Couldn't open port %d\n", options.port);
+    return 1;
+  }
+
+  printf("Waiting for the motor controller on port %d\n", options.port);
+
+  while (get_time_us() - start_us < options.seconds * 1e6)
+  {
+    int64_t now_us = get_time_us();
+    size_t length = socket.receive(&message, sizeof(message), next_send_us > now_us ? next_send_us - now_us : 0);
+    int64_t receive_us = get_time_us();
+
+    if (length == sizeof(message) && link.accept(message.header, SPEED_MESSAGE_SPEED, receive_us))
+    {
+      const ClockSync& clock = link.get_clock();
+      int64_t pulse_time_us = clock.is_synced()
+        ? clock.to_local(message.pulse_time_us)
+        : receive_us - (message.header.send_time_us - message.pulse_time_us);
+      uint32_t period_us = (uint32_t)(message.pulse_period_us * ROTATION_PER_PULSE);
+
+      socket.answer_sender();
+      statistics.received++;
+
+      // How well the last report predicted the period at the new pulse.
+      if (period_us != 0 && motor_speed.get_measured_period_us() != 0 && pulse_time_us > motor_speed.get_time_us())
+      {
+        statistics.held_error_us += fabs((double)motor_speed.get_measured_period_us() - period_us);
+        statistics.extrapolated_error_us += fabs((double)motor_speed.get_period_us(pulse_time_us) - period_us);
+        statistics.predictions++;
+      }
+
+      if (period_us == 0)
+        motor_speed.reset();
+      else
+        motor_speed.update(period_us, pulse_time_us);
+    }
+
+    if (receive_us >= next_report_us)
+    {
+      const ClockSync& clock = link.get_clock();
+      uint32_t period_us = motor_speed.get_period_us(receive_us);
+
+      printf("%5.1f s: %3u received, %u lost, %u stale, round trip %5lld us, clock offset %lld us, "
+        "%6.1f RPM, period error held %6.1f us extrapolated %6.1f us\n",
+        (receive_us - start_us) / 1e6, statistics.received,
+        link.get_lost() - reported_lost, link.get_stale() - reported_stale,
+        (long long)clock.get_round_trip_us(), (long long)clock.get_offset_us(),
+        period_us != 0 ? 60e6 / period_us : 0.0,
+        statistics.predictions ? statistics.held_error_us / statistics.predictions : 0.0,
+        statistics.predictions ? statistics.extrapolated_error_us / statistics.predictions : 0.0);
+
+      statistics = LinkStatistics();
+      reported_lost = link.get_lost();
+      reported_stale = link.get_stale();
+      next_report_us += 1000000;
+    }
+
+    if (receive_us < next_send_us)
+      continue;
+
+    // Dropped ones still take up a sequence number, so they show up as lost.
+    if (!link.is_timed_out(receive_us))
+    {
+      PowerMessage power;
+
+      link.fill_header(power.header, SPEED_MESSAGE_POWER, get_time_us());
+      power.target_power = options.power;
+
+      if (should_send(options, generator))
+        socket.send(&power, sizeof(power));
+    }
+
+    next_send_us = std::max(next_send_us + interval_us, receive_us);
+  }
+
+  return 0;
+}
+
+// The same as the link task of the motor controller, with the pulses of a motor
+// following the ramp instead of the ones of the sensor.
+int run_motor(const LinkOptions& options)
+{
+  SpeedSocket socket;
+  LinkState link;
+  std::mt19937 generator(options.seed);
+  std::normal_distribution<double> jitter(0, options.jitter_us > 0 ? options.jitter_us : 1);
+  int64_t interval_us = (int64_t)(1e6 / options.rate_hz);
+  int64_t start_us = get_time_us() + options.clock_offset_us;
+  int64_t next_send_us = start_us;
+  int64_t next_report_us = start_us + 1000000;
+  // The pulses in the clock of the motor, without the jitter.
+  int64_t next_pulse_us = start_us;
+  int64_t last_pulse_us = 0;
+  int64_t measured_pulse_us = 0;
+  uint32_t pulse_period_us = 0;
+  uint32_t received = 0;
+  uint32_t reported_lost = 0;
+  uint8_t power = 0;
+  PowerMessage message;
+
+  if (!socket.open(0))
+  {
+    fprintf(stderr, "Couldn't open a socket\n");
+    return 1;
+  }
+
+  socket.set_peer(inet_addr(options.display.c_str()), options.port);
+
+  while (get_time_us() + options.clock_offset_us - start_us < options.seconds * 1e6)
+  {
+    int64_t now_us = get_time_us() + options.clock_offset_us;
+    size_t length = socket.receive(&message, sizeof(message), next_send_us > now_us ? next_send_us - now_us : 0);
+    int64_t receive_us = get_time_us() + options.clock_offset_us;
+
+    if (length == sizeof(message) && link.accept(message.header, SPEED_MESSAGE_POWER, receive_us))
+    {
+      socket.answer_sender();
+      power = message.target_power;
+      received++;
+    }
+
+    if (receive_us >= next_report_us)
+    {
+      printf("%5.1f s: %3u received, %u lost, round trip %5lld us, clock offset %lld us, %6.1f RPM, power %u\n",
+        (receive_us - start_us) / 1e6, received, link.get_lost() - reported_lost,
+        (long long)link.get_clock().get_round_trip_us(), (long long)link.get_clock().get_offset_us(),
+        get_motor_rpm(options, (receive_us - start_us) / 1e6), power);
+
+      received = 0;
+      reported_lost = link.get_lost();
+      next_report_us += 1000000;
+    }
+
+    if (receive_us < next_send_us)
+      continue;
+
+    // Every pulse up to now, the period is measured between two of them just like the ISR does.
+    while (next_pulse_us <= receive_us)
+    {
+      int64_t pulse_us = next_pulse_us + (options.jitter_us > 0 ? (int64_t)jitter(generator) : 0);
+      double rpm = get_motor_rpm(options, (next_pulse_us - start_us) / 1e6);
+
+      if (last_pulse_us != 0)
+        pulse_period_us = (uint32_t)(pulse_us - last_pulse_us);
+
+      last_pulse_us = pulse_us;
+      measured_pulse_us = pulse_us;
+      next_pulse_us += (int64_t)(60e6 / std::max(rpm, 1.0) / ROTATION_PER_PULSE);
+    }
+
+    SpeedMessage speed;
+
+    link.fill_header(speed.header, SPEED_MESSAGE_SPEED, get_time_us() + options.clock_offset_us);
+    speed.pulse_period_us = pulse_period_us;
+    speed.pulse_time_us = measured_pulse_us;
+    speed.power = power;
+
+    if (should_send(options, generator))
+      socket.send(&speed, sizeof(speed));
+
+    next_send_us = std::max(next_send_us + interval_us, receive_us);
+  }
+
+  return 0;
+}